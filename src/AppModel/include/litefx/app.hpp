@@ -455,6 +455,28 @@ namespace LiteFX {
 		/// <returns>All registered instances of <paramref name="type" />.</returns>
 		Enumerable<const IBackend&> getBackends(const BackendType type) const;
 
+		/// <summary>
+		/// Returns the task scheduler of the app.
+		/// </summary>
+		/// <remarks>
+		/// The app owns a single task scheduler, that is shared between the app and its backends. Use it to distribute work, such as parallel command recording,
+		/// instead of spawning threads manually.
+		/// </remarks>
+		/// <returns>A reference of the task scheduler of the app.</returns>
+		/// <seealso cref="TaskScheduler" />
+		TaskScheduler& scheduler() const noexcept;
+
+		/// <summary>
+		/// Returns the CPU instrumentation of the app.
+		/// </summary>
+		/// <remarks>
+		/// The instrumentation is shared between the app and its backends, which annotate their hot paths with zones. Call <see cref="Instrumentation::start" /> to 
+		/// begin recording and <see cref="Instrumentation::exportChromeTrace" /> to write the recorded zones.
+		/// </remarks>
+		/// <returns>A reference of the CPU instrumentation of the app.</returns>
+		/// <seealso cref="Instrumentation" />
+		Instrumentation& instrumentation() const noexcept;
+
 	protected:
 		/// <summary>
 		/// Returns the registered backend instance for a type index.
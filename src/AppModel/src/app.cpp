@@ -11,6 +11,8 @@ public:
 	friend class App;
 
 private:
+	UniquePtr<Instrumentation> m_instrumentation = makeUnique<Instrumentation>();
+	UniquePtr<TaskScheduler> m_scheduler = makeUnique<TaskScheduler>();
 	Dictionary<std::type_index, UniquePtr<IBackend>> m_backends{};
 	std::multimap<std::type_index, const std::function<bool()>> m_startCallbacks{};
 	std::multimap<std::type_index, const std::function<void()>> m_stopCallbacks{};
@@ -164,6 +166,16 @@ Enumerable<const IBackend&> App::getBackends(const BackendType type) const
 		std::views::filter([type](const auto& backend) { return backend.type() == type; });
 }
 
+TaskScheduler& App::scheduler() const noexcept
+{
+	return *m_impl->m_scheduler;
+}
+
+Instrumentation& App::instrumentation() const noexcept
+{
+	return *m_impl->m_instrumentation;
+}
+
 void App::use(UniquePtr<IBackend>&& backend)
 {
 	auto type = backend->typeId();
@@ -484,7 +484,7 @@ namespace LiteFX::Rendering::Backends {
     /// <seealso cref="IDirectX12Image" />
     /// <seealso cref="Barrier" />
     class LITEFX_DIRECTX12_API DirectX12Barrier final : public Barrier<IDirectX12Buffer, IDirectX12Image> {
-        LITEFX_IMPLEMENTATION(DirectX12BarrierImpl);
+        LITEFX_INLINE_IMPLEMENTATION(DirectX12BarrierImpl, 128);
         LITEFX_BUILDER(DirectX12BarrierBuilder);
 
     public:
@@ -587,6 +587,20 @@ namespace LiteFX::Rendering::Backends {
         /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
         explicit DirectX12ShaderModule(const DirectX12Device& device, ShaderStage type, std::istream& stream, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
 
+        /// <summary>
+        /// Initializes a new DirectX 12 shader module from a shader archive.
+        /// </summary>
+        /// <remarks>
+        /// The shader module references the memory mapped by the <paramref name="archive" /> directly, without copying the bytecode.
+        /// </remarks>
+        /// <param name="device">The parent device, this shader module has been created from.</param>
+        /// <param name="type">The shader stage, this module is used in.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="entryPoint">The name of the module entry point.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        explicit DirectX12ShaderModule(const DirectX12Device& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
+
         /// <inheritdoc />
         DirectX12ShaderModule(DirectX12ShaderModule&&) noexcept;
 
@@ -1447,6 +1461,20 @@ namespace LiteFX::Rendering::Backends {
         /// </summary>
         /// <param name="commandBuffer">The command buffer to set the current pipeline state on.</param>
         virtual void use(const DirectX12CommandBuffer& commandBuffer) const = 0;
+
+        // IPipeline interface.
+    public:
+        /// <inheritdoc />
+        /// <remarks>
+        /// DirectX 12 pipeline states are always compiled when building them, so this method always returns `true`.
+        /// </remarks>
+        inline bool isReady() const noexcept override {
+            return true;
+        }
+
+        /// <inheritdoc />
+        inline void wait() const override {
+        }
     };
 
     /// <summary>
@@ -2385,9 +2413,15 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         SharedPtr<const DirectX12CommandBuffer> commandBuffer(UInt32 index) const override;
 
+        /// <inheritdoc />
+        SharedPtr<const DirectX12CommandBuffer> acquireCommandBuffer() const override;
+
         /// <inheritdoc />
         UInt32 secondaryCommandBuffers() const noexcept override;
 
+        /// <inheritdoc />
+        UInt32 pooledCommandBuffers() const noexcept override;
+
         /// <inheritdoc />
         const Array<RenderTarget>& renderTargets() const noexcept override;
 
@@ -2503,7 +2537,7 @@ namespace LiteFX::Rendering::Backends {
         IDirectX12Image* image(UInt32 backBuffer) const override;
 
         /// <inheritdoc />
-        const IDirectX12Image& image() const noexcept override;
+        const IDirectX12Image& image() const override;
 
         /// <inheritdoc />
         const Array<SharedPtr<IDirectX12Image>>& images() const noexcept override;
@@ -2836,7 +2870,7 @@ namespace LiteFX::Rendering::Backends {
         DirectX12SwapChain& swapChain() noexcept override;
 
         /// <inheritdoc />
-        const DirectX12Surface& surface() const noexcept override;
+        const DirectX12Surface& surface() const override;
 
         /// <inheritdoc />
         const DirectX12GraphicsAdapter& adapter() const noexcept override;
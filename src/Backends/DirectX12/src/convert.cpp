@@ -340,6 +340,16 @@ DXGI_FORMAT LiteFX::Rendering::Backends::DX12::getFormat(BufferFormat format)
 		return DXGI_FORMAT_R16G16B16A16_SINT;
 	case BufferFormat::XYZW16U:
 		return DXGI_FORMAT_R16G16B16A16_UINT;
+	case BufferFormat::XYZW8UN:
+		return DXGI_FORMAT_R8G8B8A8_UNORM;
+	case BufferFormat::XY16UN:
+		return DXGI_FORMAT_R16G16_UNORM;
+	case BufferFormat::XY16SN:
+		return DXGI_FORMAT_R16G16_SNORM;
+	case BufferFormat::XYZW16UN:
+		return DXGI_FORMAT_R16G16B16A16_UNORM;
+	case BufferFormat::XYZW16SN:
+		return DXGI_FORMAT_R16G16B16A16_SNORM;
 	default: [[unlikely]]
 		throw InvalidArgumentException("format", "Unsupported format: {0}.", format);
 	}
@@ -531,7 +531,7 @@ const DirectX12SwapChain& DirectX12Device::swapChain() const noexcept
 	return *m_impl->m_swapChain;
 }
 
-const DirectX12Surface& DirectX12Device::surface() const noexcept
+const DirectX12Surface& DirectX12Device::surface() const
 {
 	return *m_impl->m_surface;
 }
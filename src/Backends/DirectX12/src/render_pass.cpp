@@ -19,6 +19,18 @@ public:
     friend class DirectX12RenderPass;
     using RenderPassContext = Tuple<Array<D3D12_RENDER_PASS_RENDER_TARGET_DESC>, Optional<D3D12_RENDER_PASS_DEPTH_STENCIL_DESC>>;
 
+    /// <summary>
+    /// The number of times a frame buffer is used, after which its command buffer pool is trimmed to the largest number of command buffers acquired in between.
+    /// </summary>
+    static constexpr UInt32 POOL_TRIM_INTERVAL = 60u;
+
+    struct CommandBufferPool {
+        Array<SharedPtr<DirectX12CommandBuffer>> commandBuffers;
+        size_t acquired{ 0u };
+        size_t peak{ 0u };
+        UInt32 frames{ 0u };
+    };
+
 private:
     Array<RenderTarget> m_renderTargets;
     Array<RenderPassDependency> m_inputAttachments;
@@ -26,6 +38,8 @@ private:
     Dictionary<const IFrameBuffer*, SharedPtr<DirectX12CommandBuffer>> m_beginCommandBuffers;
     Dictionary<const IFrameBuffer*, SharedPtr<DirectX12CommandBuffer>> m_endCommandBuffers;
     Dictionary<const IFrameBuffer*, Array<SharedPtr<DirectX12CommandBuffer>>> m_secondaryCommandBuffers;
+    Dictionary<const IFrameBuffer*, CommandBufferPool> m_commandBufferPools;
+    mutable std::mutex m_poolMutex;
     UInt32 m_secondaryCommandBufferCount = 0;
     SharedPtr<const DirectX12FrameBuffer> m_activeFrameBuffer = nullptr;
     RenderPassContext m_activeContext;
@@ -43,9 +57,6 @@ public:
     {
         this->mapRenderTargets(renderTargets);
         this->mapInputAttachments(inputAttachments);
-
-        if (secondaryCommandBuffers == 0) [[unlikely]]
-            LITEFX_WARNING(DIRECTX12_LOG, "Secondary command buffer count for this render pass is 0, which makes it prevents recording draw commands to this render pass.");
     }
 
     DirectX12RenderPassImpl(const DirectX12Device& device) :
@@ -130,6 +141,10 @@ public:
 #endif
                     return commandBuffer;
                 }) | std::ranges::to<Array<SharedPtr<DirectX12CommandBuffer>>>();
+
+            // Create an empty command buffer pool, that grows when command buffers are acquired.
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_commandBufferPools[interfacePointer] = {};
         }
 
         // Store the active frame buffer pointer.
@@ -148,6 +163,11 @@ public:
         m_endCommandBuffers.erase(interfacePointer);
         m_secondaryCommandBuffers.erase(interfacePointer);
 
+        {
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_commandBufferPools.erase(interfacePointer);
+        }
+
         // Release the token.
         m_frameBufferTokens.erase(interfacePointer);
     }
@@ -222,6 +242,45 @@ public:
     {
         return m_secondaryCommandBuffers.at(static_cast<const IFrameBuffer*>(&frameBuffer));
     }
+
+    SharedPtr<DirectX12CommandBuffer> acquireCommandBuffer([[maybe_unused]] const DirectX12RenderPass& renderPass)
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        auto& pool = m_commandBufferPools.at(static_cast<const IFrameBuffer*>(m_activeFrameBuffer.get()));
+
+        // Grow the pool, if all command buffers are currently acquired.
+        if (pool.acquired == pool.commandBuffers.size())
+        {
+            auto commandBuffer = m_queue->createCommandBuffer(false);
+#ifndef NDEBUG
+            std::as_const(*commandBuffer).handle()->SetName(Widen(std::format("{0} Pooled Commands {1}", renderPass.name(), pool.commandBuffers.size())).c_str());
+#endif
+            pool.commandBuffers.push_back(commandBuffer);
+        }
+
+        return pool.commandBuffers[pool.acquired++]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    Array<SharedPtr<DirectX12CommandBuffer>> releaseCommandBuffers(const DirectX12FrameBuffer& frameBuffer)
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        auto& pool = m_commandBufferPools.at(static_cast<const IFrameBuffer*>(&frameBuffer));
+        auto acquired = pool.commandBuffers | std::views::take(pool.acquired) | std::ranges::to<Array<SharedPtr<DirectX12CommandBuffer>>>();
+
+        // Trim the pool to the largest number of command buffers acquired within the last interval. The released command buffers have not been used since the frame 
+        // buffer has been used the last time, so they are no longer executed.
+        pool.peak = std::max(pool.peak, pool.acquired);
+
+        if (++pool.frames >= POOL_TRIM_INTERVAL)
+        {
+            pool.commandBuffers.resize(pool.peak);
+            pool.peak = 0u;
+            pool.frames = 0u;
+        }
+
+        pool.acquired = 0u;
+        return acquired;
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -298,11 +357,35 @@ Enumerable<SharedPtr<const DirectX12CommandBuffer>> DirectX12RenderPass::command
     }
 }
 
+SharedPtr<const DirectX12CommandBuffer> DirectX12RenderPass::acquireCommandBuffer() const
+{
+    if (m_impl->m_activeFrameBuffer == nullptr) [[unlikely]]
+        throw RuntimeException("Unable to acquire command buffers on a render pass that has not been begun.");
+
+    // Resume the render pass on the command buffer.
+    const auto& context = m_impl->m_activeContext;
+    auto commandBuffer = m_impl->acquireCommandBuffer(*this);
+    commandBuffer->begin();
+    std::as_const(*commandBuffer).handle()->BeginRenderPass(static_cast<UINT>(std::get<0>(context).size()), std::get<0>(context).data(), std::get<1>(context).has_value() ? &std::get<1>(context).value() : nullptr, D3D12_RENDER_PASS_FLAG_SUSPENDING_PASS | D3D12_RENDER_PASS_FLAG_RESUMING_PASS); // NOLINT(bugprone-unchecked-optional-access)
+    std::as_const(*commandBuffer).handle()->SetViewInstanceMask(m_impl->m_viewMask);
+
+    return commandBuffer;
+}
+
 UInt32 DirectX12RenderPass::secondaryCommandBuffers() const noexcept
 {
     return m_impl->m_secondaryCommandBufferCount;
 }
 
+UInt32 DirectX12RenderPass::pooledCommandBuffers() const noexcept
+{
+    if (m_impl->m_activeFrameBuffer == nullptr)
+        return 0u;
+
+    std::lock_guard<std::mutex> lock(m_impl->m_poolMutex);
+    return static_cast<UInt32>(m_impl->m_commandBufferPools.at(m_impl->m_activeFrameBuffer.get()).commandBuffers.size());
+}
+
 const Array<RenderTarget>& DirectX12RenderPass::renderTargets() const noexcept
 {
     return m_impl->m_renderTargets;
@@ -419,7 +502,9 @@ UInt64 DirectX12RenderPass::end() const
     // Resume and end the render pass.
     const auto& context = m_impl->m_activeContext;
     auto endCommandBuffer = m_impl->getEndCommandBuffer(frameBuffer);
+    auto pooledCommandBuffers = m_impl->releaseCommandBuffers(frameBuffer);
     std::ranges::for_each(m_impl->getSecondaryCommandBuffers(frameBuffer), [](auto& commandBuffer) { std::as_const(*commandBuffer).handle()->EndRenderPass(); });
+    std::ranges::for_each(pooledCommandBuffers, [](auto& commandBuffer) { std::as_const(*commandBuffer).handle()->EndRenderPass(); });
     endCommandBuffer->begin();
     std::as_const(*endCommandBuffer).handle()->BeginRenderPass(static_cast<UInt32>(std::get<0>(context).size()), std::get<0>(context).data(), std::get<1>(context).has_value() ? &std::get<1>(context).value() : nullptr, D3D12_RENDER_PASS_FLAG_RESUMING_PASS); // NOLINT(bugprone-unchecked-optional-access)
     std::as_const(*endCommandBuffer).handle()->EndRenderPass();
@@ -499,6 +584,7 @@ UInt64 DirectX12RenderPass::end() const
     //       important, since the first command list also gets executed first.
     auto commandBuffers = m_impl->getSecondaryCommandBuffers(frameBuffer);
     commandBuffers.insert(commandBuffers.begin(), m_impl->getBeginCommandBuffer(frameBuffer));
+    commandBuffers.insert(commandBuffers.end(), pooledCommandBuffers.begin(), pooledCommandBuffers.end());
     commandBuffers.push_back(endCommandBuffer);
 
     // Submit and store the fence.
@@ -13,6 +13,7 @@ public:
 private:
 	ShaderStage m_type;
 	String m_fileName, m_entryPoint;
+	SharedPtr<const ShaderArchive> m_archive;
 	Optional<DescriptorBindingPoint> m_shaderLocalDescriptor;
 
 public:
@@ -48,6 +49,24 @@ public:
 
 		return blob;
 	}
+
+	ComPtr<IDxcBlob> initialize(const SharedPtr<const ShaderArchive>& archive)
+	{
+		if (archive == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+		// TODO: We share the library handle over the whole api by moving them to the device level at least.
+		ComPtr<IDxcLibrary> library;
+		raiseIfFailed(::DxcCreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&library)), "Unable to access DirectX shader compiler library.");
+
+		// Create a blob that references the mapped archive memory. The module keeps the archive alive, so the memory stays valid while the module is in use.
+		ComPtr<IDxcBlobEncoding> blob;
+		auto data = archive->find(m_fileName);
+		raiseIfFailed(library->CreateBlobWithEncodingFromPinned(data.data(), static_cast<UINT32>(data.size()), CP_ACP, &blob), "Unable to load shader from archive: {0}.", m_fileName.c_str());
+		m_archive = archive;
+
+		return blob;
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -66,6 +85,12 @@ DirectX12ShaderModule::DirectX12ShaderModule(const DirectX12Device& /*device*/,
 	this->handle() = m_impl->initialize(stream);
 }
 
+DirectX12ShaderModule::DirectX12ShaderModule(const DirectX12Device& /*device*/, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) :
+	ComResource<IDxcBlob>(nullptr), m_impl(type, name, entryPoint, shaderLocalDescriptor)
+{
+	this->handle() = m_impl->initialize(archive);
+}
+
 DirectX12ShaderModule::DirectX12ShaderModule(DirectX12ShaderModule&&) noexcept = default;
 DirectX12ShaderModule& DirectX12ShaderModule::operator=(DirectX12ShaderModule&&) noexcept = default;
 DirectX12ShaderModule::~DirectX12ShaderModule() noexcept = default;
@@ -734,4 +734,9 @@ UniquePtr<DirectX12ShaderModule> DirectX12ShaderProgramBuilder::makeShaderModule
 {
     return makeUnique<DirectX12ShaderModule>(*this->instance()->m_impl->m_device.get(), type, stream, name, entryPoint, shaderLocalDescriptor);
 }
+
+UniquePtr<DirectX12ShaderModule> DirectX12ShaderProgramBuilder::makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor)
+{
+    return makeUnique<DirectX12ShaderModule>(*this->instance()->m_impl->m_device.get(), type, archive, name, entryPoint, shaderLocalDescriptor);
+}
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
@@ -310,7 +310,7 @@ IDirectX12Image* DirectX12SwapChain::image(UInt32 backBuffer) const
 	return m_impl->m_presentImages[backBuffer].get(); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 }
 
-const IDirectX12Image& DirectX12SwapChain::image() const noexcept
+const IDirectX12Image& DirectX12SwapChain::image() const
 {
 	return *m_impl->m_presentImages[m_impl->m_currentImage]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 }
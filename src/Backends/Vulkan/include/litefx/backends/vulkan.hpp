@@ -314,6 +314,7 @@ namespace LiteFX::Rendering::Backends {
         LITEFX_IMPLEMENTATION(VulkanBottomLevelAccelerationStructureImpl);
         friend class VulkanDevice;
         friend class VulkanCommandBuffer;
+        friend class VulkanBottomLevelAccelerationStructureBatch;
 
         using IAccelerationStructure::build;
         using IAccelerationStructure::update;
@@ -392,7 +393,8 @@ namespace LiteFX::Rendering::Backends {
 
     private:
         Array<std::pair<UInt32, VkAccelerationStructureGeometryKHR>> buildInfo() const;
-        void updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
+        VkAccelerationStructureKHR updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
+        VkAccelerationStructureKHR exchangeState(const VulkanDevice* device, VkAccelerationStructureKHR handle, const SharedPtr<const IVulkanBuffer>& buffer, UInt64 offset, UInt64 size) noexcept;
 
     private:
         SharedPtr<const IBuffer> getBuffer() const noexcept override;
@@ -414,6 +416,13 @@ namespace LiteFX::Rendering::Backends {
         using IAccelerationStructure::update;
         using ITopLevelAccelerationStructure::copy;
 
+    public:
+        /// <summary>
+        /// The type of the handles that identify instances of the acceleration structure.
+        /// </summary>
+        /// <seealso cref="insert" />
+        using instance_handle = UInt64;
+
     public:
         /// <summary>
         /// Initializes a new Vulkan top-level acceleration structure (BLAS).
@@ -476,9 +485,98 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         bool remove(const Instance& mesh) noexcept override;
 
+    public:
+        /// <summary>
+        /// Adds an instance to the acceleration structure and returns a handle that identifies it.
+        /// </summary>
+        /// <remarks>
+        /// The handle stays valid until the instance is removed, even if other instances are added or removed in the meantime. Instances can be added and removed after the 
+        /// acceleration structure has been built, however it needs to be re-built afterwards, as updates require the number of instances to stay the same.
+        /// </remarks>
+        /// <param name="instance">The instance to add to the acceleration structure.</param>
+        /// <returns>The handle that identifies the instance.</returns>
+        /// <seealso cref="remove(instance_handle)" />
+        instance_handle insert(const Instance& instance);
+
+        /// <summary>
+        /// Removes the instance identified by <paramref name="handle" /> from the acceleration structure.
+        /// </summary>
+        /// <remarks>
+        /// The last instance is moved into the place of the removed instance, which means that removal does not preserve the order of the instances. Handles of other instances 
+        /// are not affected.
+        /// </remarks>
+        /// <param name="handle">The handle of the instance to remove.</param>
+        /// <returns>`true`, if the instance has been removed, or `false`, if the handle does not refer to an instance of the acceleration structure.</returns>
+        bool remove(instance_handle handle) noexcept;
+
+        /// <summary>
+        /// Returns `true`, if <paramref name="handle" /> refers to an instance of the acceleration structure.
+        /// </summary>
+        /// <param name="handle">The handle to look up.</param>
+        /// <returns>`true`, if <paramref name="handle" /> refers to an instance of the acceleration structure, otherwise `false`.</returns>
+        bool contains(instance_handle handle) const noexcept;
+
+        /// <summary>
+        /// Returns the instance identified by <paramref name="handle" />.
+        /// </summary>
+        /// <param name="handle">The handle of the instance.</param>
+        /// <returns>A reference of the instance, which remains valid until instances are added or removed.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to an instance of the acceleration structure.</exception>
+        const Instance& instance(instance_handle handle) const;
+
+        /// <summary>
+        /// Replaces the instance identified by <paramref name="handle" /> and marks it to be written to the instance buffer during the next build or update.
+        /// </summary>
+        /// <remarks>
+        /// Only instances that have been changed since the last build or update are converted and uploaded during an update. Note that updates only allow to change 
+        /// the transform, mask, hit group offset, custom index and flags of an instance. To exchange the bottom-level acceleration structure, the top-level acceleration
+        /// structure needs to be re-built.
+        /// </remarks>
+        /// <param name="handle">The handle of the instance to replace.</param>
+        /// <param name="instance">The new instance.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to an instance of the acceleration structure.</exception>
+        void updateInstance(instance_handle handle, const Instance& instance);
+
+        /// <summary>
+        /// Sets the transform of the instance identified by <paramref name="handle" />.
+        /// </summary>
+        /// <param name="handle">The handle of the instance to update.</param>
+        /// <param name="transform">The new transformation matrix of the instance.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to an instance of the acceleration structure.</exception>
+        /// <seealso cref="updateInstance" />
+        void updateTransform(instance_handle handle, const TMatrix3x4<Float>& transform);
+
+        /// <summary>
+        /// Sets the mask of the instance identified by <paramref name="handle" />.
+        /// </summary>
+        /// <param name="handle">The handle of the instance to update.</param>
+        /// <param name="mask">The new mask of the instance.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to an instance of the acceleration structure.</exception>
+        /// <seealso cref="updateInstance" />
+        void updateMask(instance_handle handle, UInt8 mask);
+
+        /// <summary>
+        /// Sets the flags of the instance identified by <paramref name="handle" />.
+        /// </summary>
+        /// <param name="handle">The handle of the instance to update.</param>
+        /// <param name="flags">The new flags of the instance.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to an instance of the acceleration structure.</exception>
+        /// <seealso cref="updateInstance" />
+        void updateFlags(instance_handle handle, InstanceFlags flags);
+
+        /// <summary>
+        /// Returns the buffer that stores the instance data read during builds and updates, or `nullptr`, if the acceleration structure has not yet been built.
+        /// </summary>
+        /// <remarks>
+        /// The buffer is owned by the acceleration structure and kept between builds, so that only changed instances need to be written. It grows when more instances
+        /// are added than it can hold.
+        /// </remarks>
+        /// <returns>The buffer that stores the instance data.</returns>
+        SharedPtr<const IVulkanBuffer> instanceBuffer() const noexcept;
+
     private:
-        Array<VkAccelerationStructureInstanceKHR> buildInfo() const;
-        void updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
+        SharedPtr<const IVulkanBuffer> uploadInstances(const VulkanCommandBuffer& commandBuffer, bool update);
+        VkAccelerationStructureKHR updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
 
     private:
         SharedPtr<const IBuffer> getBuffer() const noexcept override;
@@ -487,6 +585,156 @@ namespace LiteFX::Rendering::Backends {
         void doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, const SharedPtr<const IBuffer>& buffer, UInt64 offset, bool copyBuildInfo) const override;
     };
 
+    /// <summary>
+    /// Builds many bottom-level acceleration structures (BLAS) with a single command and compacts them automatically.
+    /// </summary>
+    /// <remarks>
+    /// Acceleration structures are queued by calling <see cref="add" /> and built by calling <see cref="build" />. This records all queued builds into one
+    /// `vkCmdBuildAccelerationStructuresKHR` command. The scratch memory for this command is sub-allocated from a scratch buffer that is owned by the batch and
+    /// grows as needed. All acceleration structures of one build are stored in a single buffer.
+    /// 
+    /// Acceleration structures that were created with <see cref="AccelerationStructureFlags::AllowCompaction" /> get compacted in a later frame. Once a build has
+    /// finished executing, the batch reads back the compacted sizes without waiting and copies the acceleration structures into a tightly packed buffer. The original
+    /// memory is released a few frames after the compaction has finished, so that frames that still use it can finish first. This happens automatically whenever the
+    /// swap chain swaps its back buffers, or when calling <see cref="update" />.
+    /// 
+    /// Compaction changes the address of an acceleration structure. Top-level acceleration structures that reference a compacted acceleration structure must be
+    /// re-built (not updated) before they are used again. The return value of <see cref="update" /> and the <see cref="compacted" /> event tell when this is needed.
+    /// </remarks>
+    /// <seealso cref="VulkanBottomLevelAccelerationStructure" />
+    class LITEFX_VULKAN_API VulkanBottomLevelAccelerationStructureBatch final : public SharedObject {
+        LITEFX_IMPLEMENTATION(VulkanBottomLevelAccelerationStructureBatchImpl);
+        friend struct SharedObject::Allocator<VulkanBottomLevelAccelerationStructureBatch>;
+
+    public:
+        /// <summary>
+        /// Stores statistics about the builds and compactions performed by a batch.
+        /// </summary>
+        struct Statistics final {
+            /// <summary>
+            /// The number of builds that have been submitted.
+            /// </summary>
+            UInt32 Builds { 0u };
+
+            /// <summary>
+            /// The number of acceleration structures that have been built.
+            /// </summary>
+            UInt32 AccelerationStructures { 0u };
+
+            /// <summary>
+            /// The number of acceleration structures that have been compacted.
+            /// </summary>
+            UInt32 Compacted { 0u };
+
+            /// <summary>
+            /// The number of bytes allocated to store the acceleration structures before compaction.
+            /// </summary>
+            UInt64 BuildSize { 0u };
+
+            /// <summary>
+            /// The number of bytes saved by compaction.
+            /// </summary>
+            UInt64 SavedMemory { 0u };
+
+            /// <summary>
+            /// The size of the scratch buffer that is shared between all builds.
+            /// </summary>
+            UInt64 ScratchSize { 0u };
+
+            /// <summary>
+            /// The GPU time spent on the last build in milliseconds, or `0.0`, if the queue does not support timestamps.
+            /// </summary>
+            double LastBuildTime { 0.0 };
+
+            /// <summary>
+            /// The total GPU time spent on all builds in milliseconds, or `0.0`, if the queue does not support timestamps.
+            /// </summary>
+            double BuildTime { 0.0 };
+        };
+
+    private:
+        /// <summary>
+        /// Initializes a new batch.
+        /// </summary>
+        /// <param name="queue">The queue that executes the builds and compactions.</param>
+        /// <param name="releaseDelay">The number of frames to wait after a compaction has finished before the original memory is released.</param>
+        explicit VulkanBottomLevelAccelerationStructureBatch(const VulkanQueue& queue, UInt32 releaseDelay);
+
+    public:
+        VulkanBottomLevelAccelerationStructureBatch(VulkanBottomLevelAccelerationStructureBatch&&) noexcept = delete;
+        VulkanBottomLevelAccelerationStructureBatch(const VulkanBottomLevelAccelerationStructureBatch&) = delete;
+        VulkanBottomLevelAccelerationStructureBatch& operator=(VulkanBottomLevelAccelerationStructureBatch&&) noexcept = delete;
+        VulkanBottomLevelAccelerationStructureBatch& operator=(const VulkanBottomLevelAccelerationStructureBatch&) = delete;
+
+        /// <summary>
+        /// Waits for all pending builds and compactions and releases the memory of the batch.
+        /// </summary>
+        ~VulkanBottomLevelAccelerationStructureBatch() noexcept override;
+
+    public:
+        /// <summary>
+        /// Creates a new batch.
+        /// </summary>
+        /// <param name="queue">The queue that executes the builds and compactions. Must support compute workloads.</param>
+        /// <param name="releaseDelay">The number of frames to wait after a compaction has finished before the original memory is released.</param>
+        /// <returns>A shared pointer to the new batch instance.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="queue" /> does not support compute workloads.</exception>
+        static inline SharedPtr<VulkanBottomLevelAccelerationStructureBatch> create(const VulkanQueue& queue, UInt32 releaseDelay = 3) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            return SharedObject::create<VulkanBottomLevelAccelerationStructureBatch>(queue, releaseDelay);
+        }
+
+    public:
+        /// <summary>
+        /// Invoked after acceleration structures have been compacted, which requires top-level acceleration structures that reference them to be re-built.
+        /// </summary>
+        mutable Event<EventArgs> compacted;
+
+    public:
+        /// <summary>
+        /// Queues <paramref name="accelerationStructure" /> to be built by the next call to <see cref="build" />.
+        /// </summary>
+        /// <remarks>
+        /// If the acceleration structure has been built before, its previous memory is released after the new build has finished. Note that the acceleration 
+        /// structure must not be updated while it is queued or while its build has not yet been compacted.
+        /// </remarks>
+        /// <param name="accelerationStructure">The acceleration structure to build.</param>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if <paramref name="accelerationStructure" /> is not initialized.</exception>
+        void add(const SharedPtr<VulkanBottomLevelAccelerationStructure>& accelerationStructure);
+
+        /// <summary>
+        /// Returns the number of acceleration structures that are queued to be built.
+        /// </summary>
+        /// <returns>The number of acceleration structures that are queued to be built.</returns>
+        UInt32 queued() const noexcept;
+
+        /// <summary>
+        /// Builds all queued acceleration structures with a single command and submits it to the queue of the batch.
+        /// </summary>
+        /// <returns>The fence that is signaled when the build has finished, or the current fence of the queue, if no acceleration structures are queued.</returns>
+        UInt64 build() const;
+
+        /// <summary>
+        /// Compacts the acceleration structures of finished builds and releases memory that is no longer used. This method never waits for the GPU.
+        /// </summary>
+        /// <remarks>
+        /// This method is called automatically, whenever the swap chain swaps its back buffers. It only needs to be called manually by applications that do not present.
+        /// </remarks>
+        /// <returns>The number of acceleration structures for which compaction has been submitted by this call.</returns>
+        UInt32 update() const;
+
+        /// <summary>
+        /// Returns `true`, if there are no pending builds, compactions or releases.
+        /// </summary>
+        /// <returns>`true`, if there are no pending builds, compactions or releases, otherwise `false`.</returns>
+        bool idle() const noexcept;
+
+        /// <summary>
+        /// Returns statistics about the builds and compactions performed by the batch.
+        /// </summary>
+        /// <returns>Statistics about the builds and compactions performed by the batch.</returns>
+        Statistics statistics() const noexcept;
+    };
+
     /// <summary>
     /// Implements a Vulkan resource barrier.
     /// </summary>
@@ -495,7 +743,7 @@ namespace LiteFX::Rendering::Backends {
     /// <seealso cref="IVulkanImage" />
     /// <seealso cref="Barrier" />
     class LITEFX_VULKAN_API VulkanBarrier final : public Barrier<IVulkanBuffer, IVulkanImage> {
-        LITEFX_IMPLEMENTATION(VulkanBarrierImpl);
+        LITEFX_INLINE_IMPLEMENTATION(VulkanBarrierImpl, 128);
         LITEFX_BUILDER(VulkanBarrierBuilder);
 
     public:
@@ -599,6 +847,20 @@ namespace LiteFX::Rendering::Backends {
         /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
         explicit VulkanShaderModule(const VulkanDevice& device, ShaderStage type, std::istream& stream, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
 
+        /// <summary>
+        /// Initializes a new Vulkan shader module from a shader archive.
+        /// </summary>
+        /// <remarks>
+        /// The shader module references the memory mapped by the <paramref name="archive" /> directly, without copying the bytecode.
+        /// </remarks>
+        /// <param name="device">The parent device, this shader module has been created from.</param>
+        /// <param name="type">The shader stage, this module is used in.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="entryPoint">The name of the module entry point.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        explicit VulkanShaderModule(const VulkanDevice& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
+
         /// <inheritdoc />
         VulkanShaderModule(VulkanShaderModule&&) noexcept;
 
@@ -632,8 +894,11 @@ namespace LiteFX::Rendering::Backends {
         /// <summary>
         /// Returns the shader byte code.
         /// </summary>
+        /// <remarks>
+        /// If the module has been created from a <see cref="ShaderArchive" />, the byte code refers to the memory mapped by the archive.
+        /// </remarks>
         /// <returns>The shader byte code.</returns>
-        const Array<UInt32>& bytecode() const noexcept;
+        Span<const UInt32> bytecode() const noexcept;
 
         /// <summary>
         /// Returns the shader stage creation info for convenience.
@@ -712,6 +977,38 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         SharedPtr<VulkanPipelineLayout> reflectPipelineLayout(Enumerable<PipelineBindingHint> hints = {}) const;
 
+        // Reflection cache.
+    public:
+        /// <summary>
+        /// Loads shader module reflection results from a cache file, previously written by <see cref="saveReflectionCache" />.
+        /// </summary>
+        /// <remarks>
+        /// Reflection results are cached for each shader module, keyed by the SHA-256 digest of its bytecode and the bytecode size. When reflecting the pipeline layout 
+        /// of a program, modules with known bytecode are not parsed again. Binding hints are not stored in the cache, as they are applied each time a pipeline layout is 
+        /// reflected. Entries from the file are added to the cache and replace existing entries for the same bytecode.
+        /// 
+        /// If the file has been written by another format version, is truncated or contains records that do not match the expected layout, it is ignored entirely and 
+        /// the affected modules are reflected again.
+        /// </remarks>
+        /// <param name="fileName">The name of the reflection cache file.</param>
+        /// <returns><c>true</c>, if the entries of the file have been loaded, otherwise <c>false</c>.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be opened or read.</exception>
+        /// <seealso cref="saveReflectionCache" />
+        static bool loadReflectionCache(const String& fileName);
+
+        /// <summary>
+        /// Writes all cached shader module reflection results into a file.
+        /// </summary>
+        /// <param name="fileName">The name of the reflection cache file.</param>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be written.</exception>
+        /// <seealso cref="loadReflectionCache" />
+        static void saveReflectionCache(const String& fileName);
+
+        /// <summary>
+        /// Removes all shader module reflection results from the cache.
+        /// </summary>
+        static void clearReflectionCache() noexcept;
+
     private:
         SharedPtr<IPipelineLayout> parsePipelineLayout(Enumerable<PipelineBindingHint> hints) const override {
             return std::static_pointer_cast<IPipelineLayout>(this->reflectPipelineLayout(hints));
@@ -1450,16 +1747,54 @@ namespace LiteFX::Rendering::Backends {
     /// <seealso cref="VulkanRenderPipeline" />
     /// <seealso cref="VulkanComputePipeline" />
     class LITEFX_VULKAN_API VulkanPipelineState : public virtual Pipeline<VulkanPipelineLayout, VulkanShaderProgram>, public Resource<VkPipeline> {
+        LITEFX_IMPLEMENTATION(VulkanPipelineStateImpl);
+
     protected:
-        using Resource<VkPipeline>::Resource;
+        /// <summary>
+        /// Initializes a new pipeline state.
+        /// </summary>
+        /// <param name="handle">The handle of the pipeline state, or `VK_NULL_HANDLE`, if it gets compiled later.</param>
+        explicit VulkanPipelineState(VkPipeline handle);
 
-        VulkanPipelineState(VulkanPipelineState&&) noexcept = default;
+        // Pipeline states are not movable, as pending compilations reference them.
+        VulkanPipelineState(VulkanPipelineState&&) noexcept = delete;
         VulkanPipelineState(const VulkanPipelineState&) = delete;
-        VulkanPipelineState& operator=(VulkanPipelineState&&) noexcept = default;
+        VulkanPipelineState& operator=(VulkanPipelineState&&) noexcept = delete;
         VulkanPipelineState& operator=(const VulkanPipelineState&) = delete;
 
     public:
-        ~VulkanPipelineState() noexcept override = default;
+        ~VulkanPipelineState() noexcept override;
+
+    protected:
+        /// <summary>
+        /// Compiles the pipeline state on a worker thread of <paramref name="scheduler" />.
+        /// </summary>
+        /// <remarks>
+        /// The pipeline handle is set as soon as <paramref name="compile" /> returns. Until then, the pipeline is not ready and any access to the handle 
+        /// must be preceded by a call to <see cref="wait" />.
+        /// 
+        /// The compilation task references the pipeline state and <paramref name="compile" /> typically references the pipeline itself. Pipeline states
+        /// can therefore not be moved and each pipeline must call <see cref="finishCompilation" /> in its destructor, so that no pending compilation
+        /// outlives the pipeline.
+        /// </remarks>
+        /// <param name="scheduler">The scheduler to compile the pipeline state on.</param>
+        /// <param name="compile">A callback that compiles the pipeline state and returns its handle.</param>
+        void compileAsync(TaskScheduler& scheduler, std::function<VkPipeline()> compile);
+
+        /// <summary>
+        /// Waits for a pending compilation to finish, without re-throwing any compilation errors.
+        /// </summary>
+        /// <remarks>
+        /// Pipelines must call this method before releasing their handle.
+        /// </remarks>
+        void finishCompilation() const noexcept;
+
+    public:
+        /// <inheritdoc />
+        bool isReady() const noexcept override;
+
+        /// <inheritdoc />
+        void wait() const override;
 
     public:
         /// <summary>
@@ -1844,11 +2179,31 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         UInt64 submit(Enumerable<SharedPtr<const VulkanCommandBuffer>> commandBuffers) const override;
 
+        /// <summary>
+        /// Submits a single command buffer and additionally signals a binary semaphore, when the command buffer has finished executing.
+        /// </summary>
+        /// <remarks>
+        /// Presentation can only wait for binary semaphores. Signaling one with the last submission of a frame allows the swap chain to present the frame without 
+        /// issuing an additional queue submission (see <see cref="VulkanSwapChain::present" />).
+        /// </remarks>
+        /// <param name="commandBuffer">The command buffer to submit.</param>
+        /// <param name="signalSemaphore">The binary semaphore to signal.</param>
+        /// <returns>The value of the fence that is signaled by the submission.</returns>
+        UInt64 submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer, VkSemaphore signalSemaphore) const;
+
         /// <inheritdoc />
         void waitFor(UInt64 fence) const override;
 
-        /// <inheritdoc />
-        void waitFor(const VulkanQueue& queue, UInt64 fence) const noexcept;
+        /// <summary>
+        /// Lets the command queue wait for a certain fence value to complete on another queue.
+        /// </summary>
+        /// <remarks>
+        /// The wait is not submitted immediately. Instead, it is recorded as a pending dependency and attached to the next submission to this queue, which avoids an
+        /// empty queue submission for each wait. Multiple waits for the same queue are merged and waits for fences that have already completed are skipped.
+        /// </remarks>
+        /// <param name="queue">The queue to wait upon.</param>
+        /// <param name="fence">The value of the fence to wait upon on the other queue.</param>
+        void waitFor(const VulkanQueue& queue, UInt64 fence) const;
 
         /// <inheritdoc />
         UInt64 currentFence() const noexcept override;
@@ -1967,13 +2322,13 @@ namespace LiteFX::Rendering::Backends {
         explicit VulkanComputePipeline(const VulkanDevice& device, const SharedPtr<VulkanPipelineLayout>& layout, const SharedPtr<VulkanShaderProgram>& shaderProgram, const String& name = "");
 
         /// <inheritdoc />
-        VulkanComputePipeline(VulkanComputePipeline&&) noexcept;
+        VulkanComputePipeline(VulkanComputePipeline&&) noexcept = delete;
 
         /// <inheritdoc />
         VulkanComputePipeline(const VulkanComputePipeline&) = delete;
 
         /// <inheritdoc />
-        VulkanComputePipeline& operator=(VulkanComputePipeline&&) noexcept;
+        VulkanComputePipeline& operator=(VulkanComputePipeline&&) noexcept = delete;
 
         /// <inheritdoc />
         VulkanComputePipeline& operator=(const VulkanComputePipeline&) = delete;
@@ -2029,13 +2384,13 @@ namespace LiteFX::Rendering::Backends {
         explicit VulkanRayTracingPipeline(const VulkanDevice& device, const SharedPtr<VulkanPipelineLayout>& layout, const SharedPtr<VulkanShaderProgram>& shaderProgram, ShaderRecordCollection&& shaderRecords, UInt32 maxRecursionDepth = 10, UInt32 maxPayloadSize = 0, UInt32 maxAttributeSize = 32, const String& name = ""); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 
         /// <inheritdoc />
-        VulkanRayTracingPipeline(VulkanRayTracingPipeline&&) noexcept;
+        VulkanRayTracingPipeline(VulkanRayTracingPipeline&&) noexcept = delete;
 
         /// <inheritdoc />
         VulkanRayTracingPipeline(const VulkanRayTracingPipeline&) = delete;
 
         /// <inheritdoc />
-        VulkanRayTracingPipeline& operator=(VulkanRayTracingPipeline&&) noexcept;
+        VulkanRayTracingPipeline& operator=(VulkanRayTracingPipeline&&) noexcept = delete;
 
         /// <inheritdoc />
         VulkanRayTracingPipeline& operator=(const VulkanRayTracingPipeline&) = delete;
@@ -2085,6 +2440,183 @@ namespace LiteFX::Rendering::Backends {
         void use(const VulkanCommandBuffer& commandBuffer) const override;
     };
 
+    /// <summary>
+    /// Implements a shader binding table for a <see cref="VulkanRayTracingPipeline" />, whose records can be updated in place.
+    /// </summary>
+    /// <remarks>
+    /// Other than <see cref="VulkanRayTracingPipeline::allocateShaderBindingTable" />, which allocates a new buffer every time it is called, a shader binding table keeps one 
+    /// persistently mapped buffer for each frame in flight. Changes to the shader-local data of a record, as well as appended hit group records, are stored in a shadow copy 
+    /// and only written to the buffer of a frame when calling <see cref="prepare" /> for this frame. This way, a buffer is never written while it is still used by a previous 
+    /// frame, as long as <see cref="prepare" /> is only called for frames whose previous commands have finished executing (which is true for the back buffer that has been
+    /// swapped in by the swap chain).
+    /// 
+    /// Records are identified by their index within the <see cref="ShaderRecordCollection" /> of the pipeline. Hit group records appended by <see cref="appendHitGroup" /> 
+    /// continue this sequence. As the hit group table is stored at the end of the buffer, appending hit group records does not change the offsets of any other records. The
+    /// buffers are only re-allocated if the number of hit group records exceeds the hit group capacity.
+    /// </remarks>
+    /// <seealso cref="VulkanRayTracingPipeline" />
+    /// <seealso cref="ShaderRecordCollection" />
+    class LITEFX_VULKAN_API VulkanShaderBindingTable final : public SharedObject {
+        LITEFX_IMPLEMENTATION(VulkanShaderBindingTableImpl);
+        friend struct SharedObject::Allocator<VulkanShaderBindingTable>;
+
+    private:
+        /// <summary>
+        /// Initializes a new shader binding table.
+        /// </summary>
+        /// <param name="device">The parent device.</param>
+        /// <param name="pipeline">The ray tracing pipeline that provides the shader records.</param>
+        /// <param name="frames">The number of frames in flight, each of which gets its own buffer.</param>
+        /// <param name="hitGroupCapacity">The number of hit group records to reserve memory for.</param>
+        /// <param name="maxLocalDataSize">The maximum size of the shader-local data of a record.</param>
+        /// <param name="groups">The shader binding groups to include in the shader binding table.</param>
+        explicit VulkanShaderBindingTable(const VulkanDevice& device, const VulkanRayTracingPipeline& pipeline, UInt32 frames, UInt32 hitGroupCapacity, UInt64 maxLocalDataSize, ShaderBindingGroup groups);
+
+    public:
+        VulkanShaderBindingTable(VulkanShaderBindingTable&&) noexcept = delete;
+        VulkanShaderBindingTable(const VulkanShaderBindingTable&) = delete;
+        VulkanShaderBindingTable& operator=(VulkanShaderBindingTable&&) noexcept = delete;
+        VulkanShaderBindingTable& operator=(const VulkanShaderBindingTable&) = delete;
+
+        /// <summary>
+        /// Releases the buffers of the shader binding table.
+        /// </summary>
+        ~VulkanShaderBindingTable() noexcept override;
+
+    public:
+        /// <summary>
+        /// Creates a new shader binding table.
+        /// </summary>
+        /// <remarks>
+        /// The size of each record is large enough to store the largest shader-local data of the included records, or <paramref name="maxLocalDataSize" />, whichever is
+        /// larger. Provide <paramref name="maxLocalDataSize" /> if records should later be updated with larger local data.
+        /// </remarks>
+        /// <param name="device">The parent device.</param>
+        /// <param name="pipeline">The ray tracing pipeline that provides the shader records.</param>
+        /// <param name="frames">The number of frames in flight, each of which gets its own buffer.</param>
+        /// <param name="hitGroupCapacity">The number of hit group records to reserve memory for. If smaller than the number of hit group records of the pipeline, no additional memory is reserved.</param>
+        /// <param name="maxLocalDataSize">The maximum size of the shader-local data of a record.</param>
+        /// <param name="groups">The shader binding groups to include in the shader binding table.</param>
+        /// <returns>A shared pointer to the new shader binding table.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="frames" /> is `0` or larger than `64`.</exception>
+        static inline SharedPtr<VulkanShaderBindingTable> create(const VulkanDevice& device, const VulkanRayTracingPipeline& pipeline, UInt32 frames = 3, UInt32 hitGroupCapacity = 0, UInt64 maxLocalDataSize = 0, ShaderBindingGroup groups = ShaderBindingGroup::All) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            return SharedObject::create<VulkanShaderBindingTable>(device, pipeline, frames, hitGroupCapacity, maxLocalDataSize, groups);
+        }
+
+    public:
+        /// <summary>
+        /// Returns the number of frames in flight, i.e., the number of buffers of the shader binding table.
+        /// </summary>
+        /// <returns>The number of frames in flight.</returns>
+        UInt32 frames() const noexcept;
+
+        /// <summary>
+        /// Returns the number of records in the shader binding table, including appended hit group records.
+        /// </summary>
+        /// <returns>The number of records in the shader binding table.</returns>
+        UInt32 records() const noexcept;
+
+        /// <summary>
+        /// Returns the number of hit group records in the shader binding table.
+        /// </summary>
+        /// <returns>The number of hit group records in the shader binding table.</returns>
+        UInt32 hitGroups() const noexcept;
+
+        /// <summary>
+        /// Returns the number of hit group records that fit into the buffers without re-allocating them.
+        /// </summary>
+        /// <returns>The number of hit group records that fit into the buffers without re-allocating them.</returns>
+        UInt32 hitGroupCapacity() const noexcept;
+
+        /// <summary>
+        /// Returns the size of a single record, including the shader group handle and the shader-local data.
+        /// </summary>
+        /// <returns>The size of a single record.</returns>
+        UInt64 recordSize() const noexcept;
+
+        /// <summary>
+        /// Returns the offset of a record within the buffers of the shader binding table.
+        /// </summary>
+        /// <param name="record">The index of the record.</param>
+        /// <returns>The offset of the record within the buffers of the shader binding table.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="record" /> does not address a record within the shader binding table.</exception>
+        UInt64 recordOffset(UInt32 record) const;
+
+        /// <summary>
+        /// Returns the offsets of the shader binding groups to pass to <see cref="VulkanCommandBuffer::traceRays" />.
+        /// </summary>
+        /// <remarks>
+        /// The hit group size grows when appending hit group records. The offsets match the buffer returned by the last call to <see cref="prepare" />.
+        /// </remarks>
+        /// <returns>The offsets of the shader binding groups.</returns>
+        ShaderBindingTableOffsets offsets() const noexcept;
+
+        /// <summary>
+        /// Overwrites the shader-local data of a record.
+        /// </summary>
+        /// <remarks>
+        /// The change is applied to the buffer of each frame during the next call to <see cref="prepare" /> for this frame.
+        /// </remarks>
+        /// <param name="record">The index of the record.</param>
+        /// <param name="data">The new shader-local data of the record.</param>
+        /// <param name="size">The size of the shader-local data.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="record" /> does not address a record within the shader binding table.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="size" /> exceeds the local data size of a record.</exception>
+        void updateLocalData(UInt32 record, const void* data, size_t size) const;
+
+        /// <summary>
+        /// Overwrites the shader-local data of a record.
+        /// </summary>
+        /// <typeparam name="TLocalData">The type of the shader-local data.</typeparam>
+        /// <param name="record">The index of the record.</param>
+        /// <param name="data">The new shader-local data of the record.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="record" /> does not address a record within the shader binding table.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if the size of <typeparamref name="TLocalData" /> exceeds the local data size of a record.</exception>
+        template <typename TLocalData>
+        inline void updateLocalData(UInt32 record, const TLocalData& data) const {
+            this->updateLocalData(record, static_cast<const void*>(&data), sizeof(TLocalData));
+        }
+
+        /// <summary>
+        /// Appends a hit group record that invokes the same shader group as another hit group record, but with different shader-local data.
+        /// </summary>
+        /// <remarks>
+        /// If the hit group capacity is exhausted, it is doubled and the buffers are re-allocated during the next call to <see cref="prepare" /> for each frame.
+        /// </remarks>
+        /// <param name="record">The index of the hit group record that provides the shader group.</param>
+        /// <param name="data">The shader-local data of the new record.</param>
+        /// <param name="size">The size of the shader-local data.</param>
+        /// <returns>The index of the new record.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="record" /> does not address a record within the shader binding table.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="record" /> is not a hit group record, or <paramref name="size" /> exceeds the local data size of a record.</exception>
+        UInt32 appendHitGroup(UInt32 record, const void* data, size_t size) const;
+
+        /// <summary>
+        /// Appends a hit group record that invokes the same shader group as another hit group record, but with different shader-local data.
+        /// </summary>
+        /// <typeparam name="TLocalData">The type of the shader-local data.</typeparam>
+        /// <param name="record">The index of the hit group record that provides the shader group.</param>
+        /// <param name="data">The shader-local data of the new record.</param>
+        /// <returns>The index of the new record.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="record" /> does not address a record within the shader binding table.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="record" /> is not a hit group record, or the size of <typeparamref name="TLocalData" /> exceeds the local data size of a record.</exception>
+        template <typename TLocalData>
+        inline UInt32 appendHitGroup(UInt32 record, const TLocalData& data) const {
+            return this->appendHitGroup(record, static_cast<const void*>(&data), sizeof(TLocalData));
+        }
+
+        /// <summary>
+        /// Writes all pending changes to the buffer of a frame and returns it.
+        /// </summary>
+        /// <remarks>
+        /// Only the records that changed since the last call for <paramref name="frame" /> are written. The buffer must not be in use by the GPU when calling this method.
+        /// </remarks>
+        /// <param name="frame">The index of the frame in flight.</param>
+        /// <returns>The buffer of the frame.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="frame" /> is not a valid frame index.</exception>
+        SharedPtr<const IVulkanBuffer> prepare(UInt32 frame) const;
+    };
+
     /// <summary>
     /// Implements a Vulkan frame buffer.
     /// </summary>
@@ -2099,6 +2631,51 @@ namespace LiteFX::Rendering::Backends {
         using FrameBuffer::mapRenderTarget;
         using FrameBuffer::mapRenderTargets;
 
+        /// <summary>
+        /// The default granularity in pixels, to which image sizes are rounded up when using <see cref="FrameBufferResizePolicy::OverAllocate" />.
+        /// </summary>
+        static constexpr UInt32 DEFAULT_BUCKET_SIZE = 256;
+
+        /// <summary>
+        /// The default number of replaced images kept for reuse when using <see cref="FrameBufferResizePolicy::ReuseImages" />.
+        /// </summary>
+        static constexpr UInt32 DEFAULT_POOL_SIZE = 16;
+
+        /// <summary>
+        /// Stores statistics about the resize operations of a frame buffer.
+        /// </summary>
+        struct ResizeStatistics final {
+            /// <summary>
+            /// The number of times the frame buffer has been resized.
+            /// </summary>
+            UInt32 Resizes { 0u };
+
+            /// <summary>
+            /// The number of images that have been allocated during resizes.
+            /// </summary>
+            UInt32 Reallocations { 0u };
+
+            /// <summary>
+            /// The number of images that have been reused from the image pool during resizes.
+            /// </summary>
+            UInt32 ReusedImages { 0u };
+
+            /// <summary>
+            /// The time spent on the last resize in milliseconds.
+            /// </summary>
+            double LastResizeTime { 0.0 };
+
+            /// <summary>
+            /// The longest time spent on a single resize in milliseconds.
+            /// </summary>
+            double MaxResizeTime { 0.0 };
+
+            /// <summary>
+            /// The total time spent on all resizes in milliseconds.
+            /// </summary>
+            double TotalResizeTime { 0.0 };
+        };
+
     private:
         /// <summary>
         /// Initializes a Vulkan frame buffer.
@@ -2185,6 +2762,45 @@ namespace LiteFX::Rendering::Backends {
         /// <exception cref="InvalidArgumentException">Thrown, if the provided render target is not mapped to an image within the frame buffer.</exception>
         VkImageView imageView(const RenderTarget& renderTarget) const;
 
+        /// <summary>
+        /// Returns the size of the images of the frame buffer.
+        /// </summary>
+        /// <remarks>
+        /// This is equal to <see cref="size" />, unless the resize policy contains <see cref="FrameBufferResizePolicy::OverAllocate" />. In this case, the images can be
+        /// larger than the frame buffer and rendering only covers the sub-rectangle starting at the origin with the size of the frame buffer.
+        /// </remarks>
+        /// <returns>The size of the images of the frame buffer.</returns>
+        const Size2d& allocatedSize() const noexcept;
+
+        /// <summary>
+        /// Returns the policy that is used to allocate images when the frame buffer gets resized.
+        /// </summary>
+        /// <returns>The policy that is used to allocate images when the frame buffer gets resized.</returns>
+        FrameBufferResizePolicy resizePolicy() const noexcept;
+
+        /// <summary>
+        /// Sets the policy that is used to allocate images when the frame buffer gets resized.
+        /// </summary>
+        /// <remarks>
+        /// The policy is applied on the next resize. Images that are kept for reuse are released, if the new policy does not contain <see cref="FrameBufferResizePolicy::ReuseImages" />.
+        /// </remarks>
+        /// <param name="policy">The policy that is used to allocate images when the frame buffer gets resized.</param>
+        /// <param name="bucketSize">The granularity in pixels, to which image sizes are rounded up when using <see cref="FrameBufferResizePolicy::OverAllocate" />.</param>
+        /// <param name="poolSize">The maximum number of replaced images kept for reuse when using <see cref="FrameBufferResizePolicy::ReuseImages" />.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="bucketSize" /> is `0`.</exception>
+        void setResizePolicy(FrameBufferResizePolicy policy, UInt32 bucketSize = DEFAULT_BUCKET_SIZE, UInt32 poolSize = DEFAULT_POOL_SIZE);
+
+        /// <summary>
+        /// Releases all images that are kept for reuse by later resizes.
+        /// </summary>
+        void releasePooledImages() noexcept;
+
+        /// <summary>
+        /// Returns statistics about the resize operations of the frame buffer.
+        /// </summary>
+        /// <returns>Statistics about the resize operations of the frame buffer.</returns>
+        ResizeStatistics resizeStatistics() const noexcept;
+
         // FrameBuffer interface.
     public:
         /// <inheritdoc />
@@ -2428,9 +3044,15 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         SharedPtr<const VulkanCommandBuffer> commandBuffer(UInt32 index) const override;
 
+        /// <inheritdoc />
+        SharedPtr<const VulkanCommandBuffer> acquireCommandBuffer() const override;
+
         /// <inheritdoc />
         UInt32 secondaryCommandBuffers() const noexcept override;
 
+        /// <inheritdoc />
+        UInt32 pooledCommandBuffers() const noexcept override;
+
         /// <inheritdoc />
         const Array<RenderTarget>& renderTargets() const noexcept override;
 
@@ -2457,6 +3079,21 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         UInt32 viewMask() const noexcept override;
+
+        // Vulkan render pass interface.
+    public:
+        /// <summary>
+        /// Returns the load and store operations, that are used for a render target when the render pass is begun on <paramref name="frameBuffer" />.
+        /// </summary>
+        /// <remarks>
+        /// Transient render targets are only loaded, if they are cleared and they are never stored. Whether or not a render target is transient depends on its image 
+        /// in the frame buffer, as the frame buffer may fall back to a regular image.
+        /// </remarks>
+        /// <param name="frameBuffer">The frame buffer that contains the image of the render target.</param>
+        /// <param name="renderTarget">The render target to return the operations for.</param>
+        /// <param name="stencil"><c>true</c> to return the operations for the stencil aspect of a depth/stencil target, <c>false</c> otherwise.</param>
+        /// <returns>The load and store operations for the render target.</returns>
+        std::pair<VkAttachmentLoadOp, VkAttachmentStoreOp> attachmentOperations(const VulkanFrameBuffer& frameBuffer, const RenderTarget& renderTarget, bool stencil = false) const;
     };
 
     /// <summary>
@@ -2505,6 +3142,76 @@ namespace LiteFX::Rendering::Backends {
         /// <returns>A reference of the query pool for the current frame.</returns>
         const VkQueryPool& timestampQueryPool() const noexcept;
 
+        /// <summary>
+        /// Returns the present mode that is currently used by the swap chain.
+        /// </summary>
+        /// <remarks>
+        /// The present mode may differ from the one passed to <see cref="setPresentMode" />, if the requested mode is not supported by the surface. In this case, the
+        /// closest supported mode is selected: mailbox and immediate mode fall back to each other, before falling back to FIFO, which is always available. Similarly,
+        /// relaxed FIFO falls back to FIFO.
+        /// </remarks>
+        /// <returns>The present mode that is currently used by the swap chain.</returns>
+        /// <seealso cref="setPresentMode" />
+        VkPresentModeKHR presentMode() const noexcept;
+
+        /// <summary>
+        /// Returns all present modes that are supported by the surface of the swap chain.
+        /// </summary>
+        /// <returns>An array of present modes that are supported by the surface.</returns>
+        Enumerable<VkPresentModeKHR> presentModes() const;
+
+        /// <summary>
+        /// Re-creates the swap chain using the provided present mode.
+        /// </summary>
+        /// <remarks>
+        /// FIFO and relaxed FIFO enable vertical synchronization, mailbox and immediate mode disable it. The requested mode is retained if the swap chain is reset with a
+        /// matching value for vertical synchronization (e.g., when resizing), but is replaced by the default mode, if vertical synchronization is toggled. The default mode
+        /// is FIFO, if vertical synchronization is enabled and immediate mode otherwise.
+        ///
+        /// Like <see cref="reset" />, this invalidates all frame buffers and must not be called while frames are in flight.
+        /// </remarks>
+        /// <param name="presentMode">The requested present mode.</param>
+        /// <seealso cref="presentMode" />
+        void setPresentMode(VkPresentModeKHR presentMode);
+
+        /// <summary>
+        /// Returns the maximum number of frames that the CPU can queue up ahead of the GPU, or `0` if the number of frames is only limited by the number of back buffers.
+        /// </summary>
+        /// <returns>The maximum number of frames that can be queued ahead of the GPU.</returns>
+        /// <seealso cref="setMaxFrameLatency" />
+        UInt32 maxFrameLatency() const noexcept;
+
+        /// <summary>
+        /// Sets the maximum number of frames that the CPU can queue up ahead of the GPU.
+        /// </summary>
+        /// <remarks>
+        /// When swapping the back buffers, the swap chain waits on the timeline of the queue that executed the workload of the oldest presented frame, until less than
+        /// <paramref name="frames" /> frames are pending. Lower values reduce the latency between sampling input and presenting the result, at the cost of GPU utilization.
+        /// </remarks>
+        /// <param name="frames">The maximum number of frames that can be queued ahead of the GPU, or `0` to only limit them by the number of back buffers.</param>
+        /// <seealso cref="maxFrameLatency" />
+        void setMaxFrameLatency(UInt32 frames) noexcept;
+
+        /// <summary>
+        /// Marks the point in time at which input for the current frame has been sampled.
+        /// </summary>
+        /// <remarks>
+        /// Calling this method is optional. If it is not called, the input time is set when swapping the back buffers.
+        /// </remarks>
+        /// <seealso cref="presentLatency" />
+        void markInput() const noexcept;
+
+        /// <summary>
+        /// Returns the time between sampling input and queuing the presentation of the last frame.
+        /// </summary>
+        /// <remarks>
+        /// The latency is measured on the CPU up to the point where the frame is handed to the presentation engine. Use <see cref="TimingEvent" />s to measure how long
+        /// the GPU spends on the frame after it has been submitted.
+        /// </remarks>
+        /// <returns>The input-to-present latency of the last frame.</returns>
+        /// <seealso cref="markInput" />
+        std::chrono::nanoseconds presentLatency() const noexcept;
+
         // SwapChain interface.
     public:
         /// <inheritdoc />
@@ -2538,7 +3245,7 @@ namespace LiteFX::Rendering::Backends {
         IVulkanImage* image(UInt32 backBuffer) const override;
 
         /// <inheritdoc />
-        const IVulkanImage& image() const noexcept override;
+        const IVulkanImage& image() const override;
 
         /// <inheritdoc />
         const Array<SharedPtr<IVulkanImage>>& images() const noexcept override;
@@ -2546,6 +3253,31 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         void present(UInt64 fence) const override;
 
+        /// <summary>
+        /// Submits a command buffer and presents the current back buffer, as soon as the command buffer has finished executing.
+        /// </summary>
+        /// <remarks>
+        /// If the command buffer is submitted to the queue that presents the swap chain images, presentation waits for a binary semaphore that is signaled by the 
+        /// submission itself. This avoids the additional queue submission that <see cref="present(UInt64)" /> requires in order to turn the timeline semaphore wait 
+        /// into a binary semaphore wait.
+        /// </remarks>
+        /// <param name="commandBuffer">The last command buffer of the frame.</param>
+        /// <returns>The value of the fence that is signaled by the submission.</returns>
+        /// <seealso cref="submit" />
+        UInt64 present(const SharedPtr<const VulkanCommandBuffer>& commandBuffer) const;
+
+        /// <summary>
+        /// Submits the last command buffer of a frame, so that the current back buffer can be presented without an additional queue submission.
+        /// </summary>
+        /// <remarks>
+        /// This performs the submission part of <see cref="present" />. Presenting the returned fence with 
+        /// <see cref="present(UInt64)" /> then presents the back buffer, as soon as the command buffer has finished executing. Separating both steps allows to issue 
+        /// other queue commands, such as ending a debug region, after the submission, but before the frame is presented.
+        /// </remarks>
+        /// <param name="commandBuffer">The last command buffer of the frame.</param>
+        /// <returns>The value of the fence that is signaled by the submission.</returns>
+        UInt64 submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer) const;
+
     public:
         /// <inheritdoc />
         Enumerable<Format> getSurfaceFormats() const override;
@@ -2560,6 +3292,287 @@ namespace LiteFX::Rendering::Backends {
         [[nodiscard]] UInt32 swapBackBuffer() const override;
     };
 
+    /// <summary>
+    /// Records hierarchical GPU timestamps on command buffers of any command queue.
+    /// </summary>
+    /// <remarks>
+    /// Other than <see cref="TimingEvent" />, which writes a single timestamp into the query pool of the swap chain, the profiler records a begin and end timestamp
+    /// for each scope. Scopes can be nested on a command buffer and are recorded into query pools that are allocated for each command queue and frame in flight. 
+    /// The frame is advanced each time the swap chain swaps its back buffers, or if <see cref="nextFrame" /> is called explicitly. Results of previous frames are 
+    /// read back without blocking, using the availability bits of the queries, and only block if a frame needs to be re-used before it has finished. Scopes that
+    /// have been recorded into command buffers that were never submitted are discarded.
+    /// 
+    /// If pipeline statistics are enabled and supported by the device, the outermost scope on each command buffer additionally collects pipeline statistics. Note 
+    /// that those scopes must either completely contain or be completely contained by a render pass.
+    /// </remarks>
+    /// <seealso cref="TimingEvent" />
+    class LITEFX_VULKAN_API VulkanProfiler final : public SharedObject {
+        LITEFX_IMPLEMENTATION(VulkanProfilerImpl);
+        friend struct SharedObject::Allocator<VulkanProfiler>;
+
+    public:
+        /// <summary>
+        /// Stores the pipeline statistics collected for a scope.
+        /// </summary>
+        /// <remarks>
+        /// Graphics statistics are only collected on queues that support graphics workloads and are zero otherwise.
+        /// </remarks>
+        struct PipelineStatistics final {
+            /// <summary>
+            /// The number of vertices processed by the input assembler.
+            /// </summary>
+            UInt64 InputAssemblyVertices { 0u };
+
+            /// <summary>
+            /// The number of primitives processed by the input assembler.
+            /// </summary>
+            UInt64 InputAssemblyPrimitives { 0u };
+
+            /// <summary>
+            /// The number of vertex shader invocations.
+            /// </summary>
+            UInt64 VertexShaderInvocations { 0u };
+
+            /// <summary>
+            /// The number of primitives that have been processed by the clipping stage.
+            /// </summary>
+            UInt64 ClippingInvocations { 0u };
+
+            /// <summary>
+            /// The number of primitives that have been output by the clipping stage.
+            /// </summary>
+            UInt64 ClippingPrimitives { 0u };
+
+            /// <summary>
+            /// The number of fragment shader invocations.
+            /// </summary>
+            UInt64 FragmentShaderInvocations { 0u };
+
+            /// <summary>
+            /// The number of compute shader invocations.
+            /// </summary>
+            UInt64 ComputeShaderInvocations { 0u };
+        };
+
+        /// <summary>
+        /// Stores the resolved timing of a single scope.
+        /// </summary>
+        struct ScopeTiming final {
+            /// <summary>
+            /// The name of the scope.
+            /// </summary>
+            String Name;
+
+            /// <summary>
+            /// The nesting depth of the scope within its command buffer.
+            /// </summary>
+            UInt32 Depth { 0u };
+
+            /// <summary>
+            /// The index of the parent scope within <see cref="FrameTimings::Scopes" />, or `std::nullopt` for top-level scopes.
+            /// </summary>
+            Optional<UInt32> Parent { std::nullopt };
+
+            /// <summary>
+            /// The type of the queue that executed the scope.
+            /// </summary>
+            QueueType Queue { QueueType::None };
+
+            /// <summary>
+            /// The family ID of the queue that executed the scope.
+            /// </summary>
+            UInt32 QueueFamily { 0u };
+
+            /// <summary>
+            /// The ID of the queue within its family.
+            /// </summary>
+            UInt32 QueueId { 0u };
+
+            /// <summary>
+            /// The time at which the scope started executing in milliseconds, relative to the first resolved scope of the profiler.
+            /// </summary>
+            double Begin { 0.0 };
+
+            /// <summary>
+            /// The time at which the scope finished executing in milliseconds, relative to the first resolved scope of the profiler.
+            /// </summary>
+            double End { 0.0 };
+
+            /// <summary>
+            /// The pipeline statistics of the scope, if they have been collected.
+            /// </summary>
+            Optional<PipelineStatistics> Statistics { std::nullopt };
+
+            /// <summary>
+            /// Returns the duration of the scope in milliseconds.
+            /// </summary>
+            /// <returns>The duration of the scope in milliseconds.</returns>
+            inline double duration() const noexcept {
+                return End - Begin;
+            }
+        };
+
+        /// <summary>
+        /// Stores the scopes that have been resolved for a frame.
+        /// </summary>
+        struct FrameTimings final {
+            /// <summary>
+            /// The index of the frame.
+            /// </summary>
+            UInt64 Frame { 0u };
+
+            /// <summary>
+            /// The resolved scopes of the frame, grouped by queue in recording order.
+            /// </summary>
+            Array<ScopeTiming> Scopes;
+        };
+
+        /// <summary>
+        /// Ends a scope when being destroyed.
+        /// </summary>
+        /// <seealso cref="VulkanProfiler::scope" />
+        class ScopeGuard final {
+        private:
+            const VulkanProfiler* m_profiler;
+            const VulkanCommandBuffer* m_commandBuffer;
+
+        public:
+            /// <summary>
+            /// Initializes a new scope guard.
+            /// </summary>
+            /// <param name="profiler">The profiler that recorded the scope.</param>
+            /// <param name="commandBuffer">The command buffer the scope has been recorded into.</param>
+            inline ScopeGuard(const VulkanProfiler& profiler, const VulkanCommandBuffer& commandBuffer) noexcept :
+                m_profiler(&profiler), m_commandBuffer(&commandBuffer) { }
+            ScopeGuard(const ScopeGuard&) = delete;
+            ScopeGuard(ScopeGuard&&) noexcept = delete;
+            ScopeGuard& operator=(const ScopeGuard&) = delete;
+            ScopeGuard& operator=(ScopeGuard&&) noexcept = delete;
+
+            /// <summary>
+            /// Ends the scope.
+            /// </summary>
+            inline ~ScopeGuard() noexcept {
+                m_profiler->end(*m_commandBuffer);
+            }
+        };
+
+    private:
+        /// <summary>
+        /// Initializes a new GPU profiler.
+        /// </summary>
+        /// <param name="device">The device to profile.</param>
+        /// <param name="maxScopes">The maximum number of scopes per queue and frame.</param>
+        /// <param name="pipelineStatistics">`true`, if pipeline statistics should be collected for top-level scopes.</param>
+        /// <param name="history">The number of resolved frames to keep.</param>
+        explicit VulkanProfiler(const VulkanDevice& device, UInt32 maxScopes, bool pipelineStatistics, UInt32 history);
+
+    public:
+        VulkanProfiler(VulkanProfiler&&) noexcept = delete;
+        VulkanProfiler(const VulkanProfiler&) = delete;
+        VulkanProfiler& operator=(VulkanProfiler&&) noexcept = delete;
+        VulkanProfiler& operator=(const VulkanProfiler&) = delete;
+
+        /// <summary>
+        /// Releases the query pools of the profiler.
+        /// </summary>
+        ~VulkanProfiler() noexcept override;
+
+    public:
+        /// <summary>
+        /// Creates a new GPU profiler.
+        /// </summary>
+        /// <param name="device">The device to profile.</param>
+        /// <param name="maxScopes">The maximum number of scopes per queue and frame. Additional scopes are ignored.</param>
+        /// <param name="pipelineStatistics">`true`, if pipeline statistics should be collected for top-level scopes.</param>
+        /// <param name="history">The number of resolved frames to keep.</param>
+        /// <returns>A shared pointer to the new profiler instance.</returns>
+        static inline SharedPtr<VulkanProfiler> create(const VulkanDevice& device, UInt32 maxScopes = 256, bool pipelineStatistics = false, UInt32 history = 64) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            return SharedObject::create<VulkanProfiler>(device, maxScopes, pipelineStatistics, history);
+        }
+
+    public:
+        /// <summary>
+        /// Begins a new scope on <paramref name="commandBuffer" />.
+        /// </summary>
+        /// <remarks>
+        /// If the scope is opened while another scope is open on the same command buffer, the new scope becomes a child of the open scope. Each call to 
+        /// <see cref="begin" /> must be matched by a call to <see cref="end" /> on the same command buffer before it ends recording.
+        /// </remarks>
+        /// <param name="commandBuffer">The command buffer to record the scope into.</param>
+        /// <param name="name">The name of the scope.</param>
+        void begin(const VulkanCommandBuffer& commandBuffer, StringView name) const;
+
+        /// <summary>
+        /// Ends the innermost open scope on <paramref name="commandBuffer" />.
+        /// </summary>
+        /// <param name="commandBuffer">The command buffer to end the scope on.</param>
+        void end(const VulkanCommandBuffer& commandBuffer) const noexcept;
+
+        /// <summary>
+        /// Begins a new scope on <paramref name="commandBuffer" /> that ends when the returned guard is destroyed.
+        /// </summary>
+        /// <param name="commandBuffer">The command buffer to record the scope into.</param>
+        /// <param name="name">The name of the scope.</param>
+        /// <returns>A guard that ends the scope when being destroyed.</returns>
+        [[nodiscard]] inline ScopeGuard scope(const VulkanCommandBuffer& commandBuffer, StringView name) const {
+            this->begin(commandBuffer, name);
+            return ScopeGuard(*this, commandBuffer);
+        }
+
+        /// <summary>
+        /// Closes the current frame and resolves all previous frames that have finished executing.
+        /// </summary>
+        /// <remarks>
+        /// This is called automatically, when the swap chain of the device swaps its back buffers. All command buffers that contain scopes of the current frame
+        /// should be submitted before the frame is closed.
+        /// </remarks>
+        void nextFrame() const;
+
+        /// <summary>
+        /// Returns the index of the frame that is currently recorded.
+        /// </summary>
+        /// <returns>The index of the frame that is currently recorded.</returns>
+        UInt64 frame() const noexcept;
+
+        /// <summary>
+        /// Returns `true`, if the profiler collects pipeline statistics.
+        /// </summary>
+        /// <returns>`true`, if the profiler collects pipeline statistics, `false` otherwise.</returns>
+        bool collectsPipelineStatistics() const noexcept;
+
+        /// <summary>
+        /// Returns the most recently resolved frame, or `std::nullopt`, if no frame has been resolved yet.
+        /// </summary>
+        /// <returns>The most recently resolved frame.</returns>
+        Optional<FrameTimings> lastFrame() const;
+
+        /// <summary>
+        /// Returns all resolved frames that are still kept in the history of the profiler, ordered from oldest to newest.
+        /// </summary>
+        /// <returns>The resolved frames of the profiler.</returns>
+        Array<FrameTimings> frames() const;
+
+        /// <summary>
+        /// Writes the resolved frames as Chrome trace events, that can be loaded in `chrome://tracing` or Perfetto.
+        /// </summary>
+        /// <remarks>
+        /// Each queue is written as a separate thread of a process named "GPU". Pipeline statistics are stored in the arguments of the events.
+        /// </remarks>
+        /// <param name="stream">The stream to write the trace to.</param>
+        void exportChromeTrace(std::ostream& stream) const;
+
+        /// <summary>
+        /// Writes the resolved frames as Chrome trace events into an existing trace, where each event is prefixed by a comma.
+        /// </summary>
+        /// <remarks>
+        /// Use this method to merge GPU timings into a CPU trace, by passing it as a writer to <see cref="Instrumentation::exportChromeTrace" />. Note that GPU
+        /// time stamps are not calibrated against the CPU clock, so both processes use their own time line.
+        /// </remarks>
+        /// <param name="stream">The stream to write the events to.</param>
+        void writeChromeTraceEvents(std::ostream& stream) const;
+    };
+
     /// <summary>
     /// A graphics factory that produces objects for a <see cref="VulkanDevice" />.
     /// </summary>
@@ -2586,6 +3599,160 @@ namespace LiteFX::Rendering::Backends {
         using base_type::createSamplers;
         using base_type::allocate;
 
+    public:
+        /// <summary>
+        /// Configures the background defragmentation of a factory.
+        /// </summary>
+        /// <seealso cref="VulkanGraphicsFactory::enableBackgroundDefragmentation" />
+        struct BackgroundDefragmentationSettings final {
+            /// <summary>
+            /// The strategy used by each defragmentation process.
+            /// </summary>
+            DefragmentationStrategy Strategy { DefragmentationStrategy::Fast };
+
+            /// <summary>
+            /// The maximum number of bytes moved by the pass of a single frame or `0`, if no limitation should be imposed.
+            /// </summary>
+            UInt64 MaxBytesPerFrame { 16u * 1024u * 1024u }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The maximum number of allocations moved by the pass of a single frame or `0`, if no limitation should be imposed.
+            /// </summary>
+            UInt32 MaxAllocationsPerFrame { 64u }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The CPU time a frame may spend on defragmentation. Frames that exceed the budget cause subsequent frames to skip defragmentation until the excess has 
+            /// been paid back.
+            /// </summary>
+            std::chrono::microseconds MaxTimePerFrame { 500 }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The fraction of the budget of any memory heap, above which no new passes are started.
+            /// </summary>
+            /// <remarks>
+            /// Each pass allocates the destination memory for all moved resources before the source memory is released, so defragmentation is paused while memory 
+            /// is scarce.
+            /// </remarks>
+            Float MemoryPressureThreshold { 0.9f }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The fraction of unused memory within all allocated memory blocks, above which a new defragmentation process is started.
+            /// </summary>
+            Float FragmentationThreshold { 0.1f }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The number of frames to wait after a defragmentation process has finished, before the fragmentation is checked again.
+            /// </summary>
+            UInt32 Cooldown { 60u }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        };
+
+        /// <summary>
+        /// Describes how close the usage of a memory heap is to its budget.
+        /// </summary>
+        /// <seealso cref="VulkanGraphicsFactory::memoryBudgetLevel" />
+        enum class MemoryBudgetLevel : UInt32 {
+            /// <summary>
+            /// The usage of the heap is below the soft threshold.
+            /// </summary>
+            Normal = 0x00,
+
+            /// <summary>
+            /// The usage of the heap is above the soft threshold, but below the hard threshold.
+            /// </summary>
+            Soft = 0x01,
+
+            /// <summary>
+            /// The usage of the heap is above the hard threshold. Allocations from the heap are likely to fail.
+            /// </summary>
+            Hard = 0x02
+        };
+
+        /// <summary>
+        /// Stores the thresholds of a memory heap as fractions of the heap budget reported by the driver.
+        /// </summary>
+        /// <seealso cref="VulkanGraphicsFactory::setMemoryBudgetThresholds" />
+        struct MemoryBudgetThresholds final {
+            /// <summary>
+            /// The fraction of the budget, above which the heap is at the <see cref="MemoryBudgetLevel::Soft" /> level and eviction handlers are invoked.
+            /// </summary>
+            Float Soft { 0.8f }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// The fraction of the budget, above which the heap is at the <see cref="MemoryBudgetLevel::Hard" /> level.
+            /// </summary>
+            Float Hard { 0.95f }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        };
+
+        /// <summary>
+        /// Event arguments for a <see cref="VulkanGraphicsFactory::memoryBudgetChanged" /> event.
+        /// </summary>
+        struct MemoryBudgetEventArgs : public EventArgs {
+        private:
+            UInt32 m_heap;
+            MemoryBudgetLevel m_previousLevel, m_level;
+            UInt64 m_usage, m_budget;
+
+        public:
+            MemoryBudgetEventArgs(UInt32 heap, MemoryBudgetLevel previousLevel, MemoryBudgetLevel level, UInt64 usage, UInt64 budget) noexcept :
+                EventArgs(), m_heap(heap), m_previousLevel(previousLevel), m_level(level), m_usage(usage), m_budget(budget) {
+            }
+            MemoryBudgetEventArgs(const MemoryBudgetEventArgs&) = default;
+            MemoryBudgetEventArgs(MemoryBudgetEventArgs&&) noexcept = default;
+            MemoryBudgetEventArgs& operator=(const MemoryBudgetEventArgs&) = default;
+            MemoryBudgetEventArgs& operator=(MemoryBudgetEventArgs&&) noexcept = default;
+            ~MemoryBudgetEventArgs() noexcept override = default;
+
+        public:
+            /// <summary>
+            /// Returns the index of the memory heap that crossed a threshold.
+            /// </summary>
+            /// <returns>The index of the memory heap that crossed a threshold.</returns>
+            UInt32 heap() const noexcept {
+                return m_heap;
+            }
+
+            /// <summary>
+            /// Returns the level of the heap before the threshold has been crossed.
+            /// </summary>
+            /// <returns>The level of the heap before the threshold has been crossed.</returns>
+            MemoryBudgetLevel previousLevel() const noexcept {
+                return m_previousLevel;
+            }
+
+            /// <summary>
+            /// Returns the current level of the heap.
+            /// </summary>
+            /// <returns>The current level of the heap.</returns>
+            MemoryBudgetLevel level() const noexcept {
+                return m_level;
+            }
+
+            /// <summary>
+            /// Returns the number of bytes currently used from the heap.
+            /// </summary>
+            /// <returns>The number of bytes currently used from the heap.</returns>
+            UInt64 usage() const noexcept {
+                return m_usage;
+            }
+
+            /// <summary>
+            /// Returns the number of bytes the application can use from the heap without degrading performance.
+            /// </summary>
+            /// <returns>The number of bytes the application can use from the heap without degrading performance.</returns>
+            UInt64 budget() const noexcept {
+                return m_budget;
+            }
+        };
+
+        /// <summary>
+        /// The type of a callback that is invoked to release memory from a heap.
+        /// </summary>
+        /// <remarks>
+        /// The callback receives the index of the heap and the number of bytes that should be released from it. It returns the number of bytes it actually released.
+        /// </remarks>
+        /// <seealso cref="VulkanGraphicsFactory::registerEvictionHandler" />
+        using eviction_handler_type = std::function<UInt64(UInt32, UInt64)>;
+
     private:
         /// <summary>
         /// Creates a new graphics factory.
@@ -2639,14 +3806,142 @@ namespace LiteFX::Rendering::Backends {
         [[nodiscard]] VirtualAllocator createAllocator(UInt64 overallMemory, AllocationAlgorithm algorithm = AllocationAlgorithm::Default) const override;
 
         /// <inheritdoc />
+        /// <remarks>
+        /// Acceleration structure buffers, render targets and allocations that are currently mapped are never moved.
+        /// </remarks>
         void beginDefragmentation(const ICommandQueue& queue, DefragmentationStrategy strategy = DefragmentationStrategy::Balanced, UInt64 maxBytesToMove = 0u, UInt32 maxAllocationsToMove = 0u) const override;
 
         /// <inheritdoc />
         UInt64 beginDefragmentationPass() const override;
 
         /// <inheritdoc />
+        /// <remarks>
+        /// Other queues may still access the moved-from resources. Besides the fence returned by <see cref="beginDefragmentationPass" />, this method waits for the 
+        /// current fence of each queue of the device, before releasing the moved-from resources.
+        /// </remarks>
         bool endDefragmentationPass() const override;
 
+        /// <summary>
+        /// Starts defragmenting device memory in the background.
+        /// </summary>
+        /// <remarks>
+        /// Background defragmentation runs at most one bounded pass per frame on the default transfer queue. Each pass is advanced when the swap chain swaps its back 
+        /// buffers, or by calling <see cref="updateBackgroundDefragmentation" /> on devices that do not present. Advancing never waits for the GPU: a pass is only 
+        /// finished once the transfer queue has executed it, so moves are spread over multiple frames.
+        /// 
+        /// Moved resources raise the <see cref="IDeviceMemory::prepareMove" />, <see cref="IDeviceMemory::moving" /> and <see cref="IDeviceMemory::moved" /> events,
+        /// just like they do for manual defragmentation. While background defragmentation is enabled, manual defragmentation is not available.
+        /// </remarks>
+        /// <param name="settings">The settings that control the budget of each frame and when defragmentation starts and pauses.</param>
+        /// <exception cref="RuntimeException">Thrown, if a manual defragmentation process is currently running.</exception>
+        /// <seealso cref="disableBackgroundDefragmentation" />
+        void enableBackgroundDefragmentation(const BackgroundDefragmentationSettings& settings = {}) const;
+
+        /// <summary>
+        /// Stops defragmenting device memory in the background.
+        /// </summary>
+        /// <remarks>
+        /// If a pass is currently executed on the transfer queue, this method waits for it to finish, so that all moved resources are released.
+        /// </remarks>
+        /// <seealso cref="enableBackgroundDefragmentation" />
+        void disableBackgroundDefragmentation() const;
+
+        /// <summary>
+        /// Returns `true`, if background defragmentation is enabled.
+        /// </summary>
+        /// <returns>`true`, if background defragmentation is enabled.</returns>
+        bool backgroundDefragmentationEnabled() const noexcept;
+
+        /// <summary>
+        /// Returns `true`, if background defragmentation has been paused, because a memory heap exceeded the memory pressure threshold.
+        /// </summary>
+        /// <returns>`true`, if background defragmentation is paused.</returns>
+        /// <seealso cref="BackgroundDefragmentationSettings::MemoryPressureThreshold" />
+        bool backgroundDefragmentationPaused() const noexcept;
+
+        /// <summary>
+        /// Advances background defragmentation by one frame.
+        /// </summary>
+        /// <remarks>
+        /// This method is called automatically each time the swap chain swaps its back buffers. Call it once per frame manually, if the device does not present. If
+        /// background defragmentation is disabled, calling this method has no effect.
+        /// </remarks>
+        void updateBackgroundDefragmentation() const;
+
+        /// <summary>
+        /// Sets the thresholds of all memory heaps.
+        /// </summary>
+        /// <param name="thresholds">The thresholds to apply to all memory heaps.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the soft threshold exceeds the hard threshold.</exception>
+        void setMemoryBudgetThresholds(const MemoryBudgetThresholds& thresholds) const;
+
+        /// <summary>
+        /// Sets the thresholds of a memory heap.
+        /// </summary>
+        /// <param name="heap">The index of the memory heap.</param>
+        /// <param name="thresholds">The thresholds to apply to the memory heap.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="heap" /> does not address a memory heap of the device.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if the soft threshold exceeds the hard threshold.</exception>
+        void setMemoryBudgetThresholds(UInt32 heap, const MemoryBudgetThresholds& thresholds) const;
+
+        /// <summary>
+        /// Returns the thresholds of a memory heap.
+        /// </summary>
+        /// <param name="heap">The index of the memory heap.</param>
+        /// <returns>The thresholds of the memory heap.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="heap" /> does not address a memory heap of the device.</exception>
+        MemoryBudgetThresholds memoryBudgetThresholds(UInt32 heap) const;
+
+        /// <summary>
+        /// Returns the level of a memory heap, as determined by the last call to <see cref="updateMemoryBudget" />.
+        /// </summary>
+        /// <param name="heap">The index of the memory heap.</param>
+        /// <returns>The level of the memory heap.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="heap" /> does not address a memory heap of the device.</exception>
+        MemoryBudgetLevel memoryBudgetLevel(UInt32 heap) const;
+
+        /// <summary>
+        /// Registers a callback that releases memory, if a heap exceeds its soft threshold or an allocation fails.
+        /// </summary>
+        /// <remarks>
+        /// Eviction handlers are invoked in ascending order of their priority, until enough memory has been released. Streaming systems can use handlers with low 
+        /// priorities to drop the most detailed mip levels of distant textures, for example, and handlers with higher priorities to release more important resources.
+        /// 
+        /// Handlers are invoked once per frame for each heap above its soft threshold, with the number of bytes required to get back below it. If 
+        /// <see cref="tryCreateBuffer" /> or <see cref="tryCreateTexture" /> fail to allocate device-local memory, the handlers are invoked with the size of the
+        /// requested resource, before the allocation is retried once. Note that handlers must only release resources that are no longer used by the GPU.
+        /// </remarks>
+        /// <param name="priority">The priority of the handler. Handlers with lower priorities are invoked first.</param>
+        /// <param name="handler">The callback that releases memory.</param>
+        /// <returns>A token that can be used to unregister the handler.</returns>
+        /// <seealso cref="unregisterEvictionHandler" />
+        UInt64 registerEvictionHandler(UInt32 priority, eviction_handler_type handler) const;
+
+        /// <summary>
+        /// Removes a previously registered eviction handler.
+        /// </summary>
+        /// <param name="token">The token returned by <see cref="registerEvictionHandler" />.</param>
+        /// <returns>`true`, if the handler has been removed, `false` if no handler has been registered for the token.</returns>
+        bool unregisterEvictionHandler(UInt64 token) const;
+
+        /// <summary>
+        /// Queries the memory budget of all heaps, raises <see cref="memoryBudgetChanged" /> for heaps that crossed a threshold and invokes the eviction handlers for 
+        /// heaps above their soft threshold.
+        /// </summary>
+        /// <remarks>
+        /// This method is called automatically each time the swap chain swaps its back buffers. Call it once per frame manually, if the device does not present. The 
+        /// budget is reported by `VK_EXT_memory_budget`, if the extension is enabled. Otherwise it is estimated from the heap sizes.
+        /// </remarks>
+        void updateMemoryBudget() const;
+
+    public:
+        /// <summary>
+        /// Invoked, if the usage of a memory heap crossed one of its thresholds.
+        /// </summary>
+        /// <seealso cref="updateMemoryBudget" />
+        mutable Event<MemoryBudgetEventArgs> memoryBudgetChanged;
+
+    public:
         /// <inheritdoc />
         Generator<ResourceAllocationResult> allocate(Enumerable<const ResourceAllocationInfo&> allocationInfos, AllocationBehavior allocationBehavior = AllocationBehavior::Default, bool alias = false) const override;
 
@@ -2753,7 +4048,7 @@ namespace LiteFX::Rendering::Backends {
         /// </summary>
         /// <param name="backend">The backend from which the device is created.</param>
         /// <param name="adapter">The adapter the device uses for drawing.</param>
-        /// <param name="surface">The surface, the device should draw to.</param>
+        /// <param name="surface">The surface, the device should draw to, or `nullptr` to create a compute-only device.</param>
         /// <param name="features">The features that should be supported by this device.</param>
         /// <param name="extensions">The required extensions the device gets initialized with.</param>
         /// <param name="globalDescriptorHeapSize">The size of the global descriptor heap in bytes.</param>
@@ -2785,10 +4080,13 @@ namespace LiteFX::Rendering::Backends {
         /// Providing an extension chain using <paramref name="deviceExtensionObjects" /> allows to customize which extensions to load and enable. User-defined extensions provided this way will be picked up
         /// and patched with the required settings accordingly. Settings enabled by the user will not be disabled this way, with the exception of features that are controlled by the <paramref name="features" /> 
         /// property.
+        ///
+        /// If <paramref name="surface" /> is `nullptr`, a compute-only device is created. Compute-only devices do not create a swap chain, presentation state or graphics 
+        /// queues. Their swap chain only provides frame pacing for timing events (see <see cref="computeOnly" />).
         /// </remarks>
         /// <param name="backend">The backend from which the device is created.</param>
         /// <param name="adapter">The adapter the device uses for drawing.</param>
-        /// <param name="surface">The surface, the device should draw to.</param>
+        /// <param name="surface">The surface, the device should draw to, or `nullptr` to create a compute-only device.</param>
         /// <param name="features">The features that should be supported by this device.</param>
         /// <param name="extensions">The required extensions the device gets initialized with.</param>
         /// <param name="deviceExtensionObjects">A pointer to additional extension objects (such as device features) that are stored in the devices's `pNext` chain during device creation.</param>
@@ -2805,10 +4103,13 @@ namespace LiteFX::Rendering::Backends {
         /// Providing an extension chain using <paramref name="deviceExtensionObjects" /> allows to customize which extensions to load and enable. User-defined extensions provided this way will be picked up
         /// and patched with the required settings accordingly. Settings enabled by the user will not be disabled this way, with the exception of features that are controlled by the <paramref name="features" /> 
         /// property.
+        ///
+        /// If <paramref name="surface" /> is `nullptr`, a compute-only device is created. Compute-only devices do not create a swap chain, presentation state or graphics 
+        /// queues. Their swap chain only provides frame pacing for timing events (see <see cref="computeOnly" />).
         /// </remarks>
         /// <param name="backend">The backend from which the device is created.</param>
         /// <param name="adapter">The adapter the device uses for drawing.</param>
-        /// <param name="surface">The surface, the device should draw to.</param>
+        /// <param name="surface">The surface, the device should draw to, or `nullptr` to create a compute-only device.</param>
         /// <param name="format">The initial surface format, device uses for drawing.</param>
         /// <param name="renderArea">The initial size of the render area.</param>
         /// <param name="backBuffers">The initial number of back buffers.</param>
@@ -2891,6 +4192,48 @@ namespace LiteFX::Rendering::Backends {
         /// <returns>The size of the descriptor.</returns>
         UInt32 descriptorSize(DescriptorType type) const;
 
+        /// <summary>
+        /// Returns the task scheduler of the application that owns the device.
+        /// </summary>
+        /// <remarks>
+        /// The scheduler is used to perform work on behalf of the device, for example when compiling pipeline states asynchronously.
+        /// </remarks>
+        /// <returns>A reference of the task scheduler of the application that owns the device.</returns>
+        TaskScheduler& scheduler() const noexcept;
+
+        /// <summary>
+        /// Returns the CPU instrumentation of the application that owns the device.
+        /// </summary>
+        /// <remarks>
+        /// The hot paths of the device and the objects it creates, such as queue submission, command buffer recording, barriers, descriptor allocation and pipeline
+        /// creation, record zones using this instrumentation.
+        /// </remarks>
+        /// <returns>A reference of the CPU instrumentation of the application that owns the device.</returns>
+        Instrumentation& instrumentation() const noexcept;
+
+        /// <summary>
+        /// Returns the handle of the Vulkan instance the device has been created from.
+        /// </summary>
+        /// <returns>The handle of the Vulkan instance the device has been created from.</returns>
+        const VkInstance& instance() const noexcept;
+
+        /// <summary>
+        /// Returns `true`, if the device has been created without a surface.
+        /// </summary>
+        /// <remarks>
+        /// Compute-only devices only create compute and transfer queues. Requesting the default graphics queue throws an exception and the surface of the device must 
+        /// not be accessed. The swap chain of a compute-only device does not own any images and cannot be presented. Swapping its back buffers waits for the workloads 
+        /// of the default compute and transfer queues that have been submitted during the frame that is about to be re-used, which allows to use timing events.
+        /// </remarks>
+        /// <returns>`true`, if the device is compute-only, `false` otherwise.</returns>
+        bool computeOnly() const noexcept;
+
+        /// <summary>
+        /// Returns all queues of the device, including the default queues.
+        /// </summary>
+        /// <returns>All queues of the device.</returns>
+        Enumerable<const VulkanQueue&> queues() const;
+
         // GraphicsDevice interface.
     public:
         /// <inheritdoc />
@@ -2903,7 +4246,7 @@ namespace LiteFX::Rendering::Backends {
         VulkanSwapChain& swapChain() noexcept override;
 
         /// <inheritdoc />
-        const VulkanSurface& surface() const noexcept override;
+        const VulkanSurface& surface() const override;
 
         /// <inheritdoc />
         const VulkanGraphicsAdapter& adapter() const noexcept override;
@@ -3034,6 +4377,18 @@ namespace LiteFX::Rendering::Backends {
         /// <returns>An array of validation layers that are enabled on the backend.</returns>
         Span<const String> getEnabledValidationLayers() const noexcept;
 
+        /// <summary>
+        /// Returns the task scheduler of the application that owns the backend.
+        /// </summary>
+        /// <returns>A reference of the task scheduler of the application that owns the backend.</returns>
+        TaskScheduler& scheduler() const noexcept;
+
+        /// <summary>
+        /// Returns the CPU instrumentation of the application that owns the backend.
+        /// </summary>
+        /// <returns>A reference of the CPU instrumentation of the application that owns the backend.</returns>
+        Instrumentation& instrumentation() const noexcept;
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
         /// <summary>
         /// Creates a surface on a window handle.
@@ -3056,6 +4411,18 @@ namespace LiteFX::Rendering::Backends {
         UniquePtr<VulkanSurface> createSurface(surface_callback predicate) const;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
+        /// <summary>
+        /// Creates a surface that is not bound to a window.
+        /// </summary>
+        /// <remarks>
+        /// Headless surfaces are provided by the `VK_EXT_headless_surface` instance extension, which must be enabled when creating the backend. A device created on a 
+        /// headless surface uses a regular swap chain, including back buffer swapping, present fences and timing events, but presented images are never displayed. 
+        /// This allows to run frame loops on machines without a display, for example on build servers using a software implementation.
+        /// </remarks>
+        /// <returns>The instance of the created surface.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the `VK_EXT_headless_surface` extension has not been enabled.</exception>
+        UniquePtr<VulkanSurface> createHeadlessSurface() const;
+
     public:
         /// <summary>
         /// Returns <c>true</c>, if all elements of <paramref cref="extensions" /> are contained by the a list of available extensions.
@@ -50,9 +50,11 @@ namespace LiteFX::Rendering::Backends {
     class VulkanRenderPipeline;
     class VulkanComputePipeline;
     class VulkanRayTracingPipeline;
+    class VulkanShaderBindingTable;
     class VulkanFrameBuffer;
     class VulkanRenderPass;
     class VulkanSwapChain;
+    class VulkanProfiler;
     class VulkanQueue;
     class VulkanGraphicsFactory;
     class VulkanDevice;
@@ -67,6 +69,7 @@ namespace LiteFX::Rendering::Backends {
     class IVulkanAccelerationStructure;
     class VulkanBottomLevelAccelerationStructure;
     class VulkanTopLevelAccelerationStructure;
+    class VulkanBottomLevelAccelerationStructureBatch;
 
 #if defined(LITEFX_BUILD_DEFINE_BUILDERS)
     // Builder declarations.
@@ -109,6 +112,16 @@ namespace LiteFX::Rendering::Backends {
         /// </summary>
         VkFormat LITEFX_VULKAN_API getFormat(BufferFormat format);
 
+        /// <summary>
+        /// 
+        /// </summary>
+        bool LITEFX_VULKAN_API isSRGB(Format format);
+
+        /// <summary>
+        /// 
+        /// </summary>
+        Format LITEFX_VULKAN_API getLinearFormat(Format format);
+
         /// <summary>
         /// 
         /// </summary>
@@ -379,6 +392,9 @@ namespace LiteFX::Rendering::Backends {
         /// <summary>
         /// Returns the window handle of the surface.
         /// </summary>
+        /// <remarks>
+        /// If the surface has been created using <see cref="VulkanBackend::createHeadlessSurface" />, the window handle is `nullptr`.
+        /// </remarks>
         /// <returns>The window handle of the surface.</returns>
         /// <seealso cref="createSurface" />
         HWND windowHandle() const noexcept;
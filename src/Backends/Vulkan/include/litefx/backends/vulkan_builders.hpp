@@ -71,6 +71,9 @@ namespace LiteFX::Rendering::Backends {
 
 		/// <inheritdoc />
 		UniquePtr<VulkanShaderModule> makeShaderModule(ShaderStage type, std::istream& stream, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) override;
+
+		/// <inheritdoc />
+		UniquePtr<VulkanShaderModule> makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) override;
 	};
 
 	/// <summary>
@@ -29,9 +29,12 @@ private:
     Dictionary<String, SharedPtr<VulkanDevice>> m_devices;
     Array<String> m_extensions;
     Array<String> m_layers;
+    TaskScheduler* m_scheduler;
+    Instrumentation* m_instrumentation;
 
 public:
-    VulkanBackendImpl(Span<String> extensions, Span<String> validationLayers)
+    VulkanBackendImpl(const App& app, Span<String> extensions, Span<String> validationLayers) :
+        m_scheduler(&app.scheduler()), m_instrumentation(&app.instrumentation())
     {
         m_extensions.assign(std::begin(extensions), std::end(extensions));
         m_layers.assign(std::begin(validationLayers), std::end(validationLayers));
@@ -230,7 +233,7 @@ public:
 // ------------------------------------------------------------------------------------------------
 
 VulkanBackend::VulkanBackend(const App& app, Span<String> extensions, Span<String> validationLayers, void* instanceExtensionObjects) :
-    Resource<VkInstance>(nullptr), m_impl(extensions, validationLayers)
+    Resource<VkInstance>(nullptr), m_impl(app, extensions, validationLayers)
 {
     this->handle() = m_impl->initialize(app, instanceExtensionObjects);
     m_impl->loadAdapters(*this);
@@ -372,6 +375,16 @@ Span<const String> VulkanBackend::getEnabledValidationLayers() const noexcept
     return m_impl->m_layers;
 }
 
+TaskScheduler& VulkanBackend::scheduler() const noexcept
+{
+    return *m_impl->m_scheduler;
+}
+
+Instrumentation& VulkanBackend::instrumentation() const noexcept
+{
+    return *m_impl->m_instrumentation;
+}
+
 
 // ------------------------------------------------------------------------------------------------
 // Platform-specific implementation.
@@ -402,6 +415,30 @@ UniquePtr<VulkanSurface> VulkanBackend::createSurface(surface_callback predicate
 
 #endif
 
+UniquePtr<VulkanSurface> VulkanBackend::createHeadlessSurface() const
+{
+    if (!std::ranges::contains(m_impl->m_extensions, String(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME))) [[unlikely]]
+        throw RuntimeException("Unable to create headless surface: the instance extension {0} has not been enabled.", VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+
+    auto createHeadlessSurface = reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(::vkGetInstanceProcAddr(this->handle(), "vkCreateHeadlessSurfaceEXT")); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    if (createHeadlessSurface == nullptr) [[unlikely]]
+        throw RuntimeException("Unable to create headless surface: the function \"vkCreateHeadlessSurfaceEXT\" could not be loaded.");
+
+    VkHeadlessSurfaceCreateInfoEXT createInfo = {
+        .sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT
+    };
+
+    VkSurfaceKHR surface{};
+    raiseIfFailed(createHeadlessSurface(this->handle(), &createInfo, nullptr, &surface), "Unable to create headless vulkan surface.");
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    return makeUnique<VulkanSurface>(surface, this->handle(), nullptr);
+#else
+    return makeUnique<VulkanSurface>(surface, this->handle());
+#endif // VK_USE_PLATFORM_WIN32_KHR
+}
+
 // ------------------------------------------------------------------------------------------------
 // Static interface.
 // ------------------------------------------------------------------------------------------------
@@ -447,13 +447,21 @@ Array<std::pair<UInt32, VkAccelerationStructureGeometryKHR>> VulkanBottomLevelAc
     return m_impl->build();
 }
 
-void VulkanBottomLevelAccelerationStructure::updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept
+VkAccelerationStructureKHR VulkanBottomLevelAccelerationStructure::updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept
 {
-    if (this->handle() != VK_NULL_HANDLE)
-        ::vkDestroyAccelerationStructure(m_impl->m_device->handle(), handle, nullptr);
+    // The previous handle may still be used by the GPU (e.g., as the source of an update), so the caller is responsible for releasing it.
+    m_impl->m_device = device;
+    return std::exchange(this->handle(), handle);
+}
 
+VkAccelerationStructureKHR VulkanBottomLevelAccelerationStructure::exchangeState(const VulkanDevice* device, VkAccelerationStructureKHR handle, const SharedPtr<const IVulkanBuffer>& buffer, UInt64 offset, UInt64 size) noexcept
+{
     m_impl->m_device = device;
-    this->handle() = handle;
+    m_impl->m_buffer = buffer;
+    m_impl->m_offset = offset;
+    m_impl->m_size = size;
+
+    return std::exchange(this->handle(), handle);
 }
 
 SharedPtr<const IBuffer> VulkanBottomLevelAccelerationStructure::getBuffer() const noexcept
@@ -0,0 +1,489 @@
+#include <litefx/backends/vulkan.hpp>
+
+using namespace LiteFX::Rendering::Backends;
+using Statistics = VulkanBottomLevelAccelerationStructureBatch::Statistics;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+extern PFN_vkCreateAccelerationStructureKHR vkCreateAccelerationStructure;
+extern PFN_vkDestroyAccelerationStructureKHR vkDestroyAccelerationStructure;
+extern PFN_vkCmdBuildAccelerationStructuresKHR vkCmdBuildAccelerationStructures;
+extern PFN_vkCmdCopyAccelerationStructureKHR vkCmdCopyAccelerationStructure;
+extern PFN_vkCmdWriteAccelerationStructuresPropertiesKHR vkCmdWriteAccelerationStructuresProperties;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanBottomLevelAccelerationStructureBatch::VulkanBottomLevelAccelerationStructureBatchImpl {
+public:
+    friend class VulkanBottomLevelAccelerationStructureBatch;
+
+private:
+    // NOTE: This is a hard requirement for the offset of acceleration structures within their buffer (see `VUID-VkAccelerationStructureCreateInfoKHR-offset-03734`).
+    static constexpr UInt64 ACCELERATION_STRUCTURE_ALIGNMENT = 256;
+
+    struct PendingBuild {
+        UInt64 fence{ 0u };
+        SharedPtr<const VulkanCommandBuffer> commandBuffer;
+        Array<SharedPtr<VulkanBottomLevelAccelerationStructure>> accelerationStructures;
+        Array<UInt64> sizes;
+        Array<VkAccelerationStructureKHR> handles;
+        Array<UInt32> compactable;
+        VkQueryPool compactedSizes{ VK_NULL_HANDLE };
+        VkQueryPool timestamps{ VK_NULL_HANDLE };
+    };
+
+    struct PendingRelease {
+        UInt64 fence{ 0u };
+        UInt32 delay{ 0u };
+        SharedPtr<const VulkanCommandBuffer> commandBuffer;
+        Array<SharedPtr<const IVulkanBuffer>> buffers;
+        Array<VkAccelerationStructureKHR> handles;
+    };
+
+private:
+    WeakPtr<const VulkanDevice> m_device;
+    SharedPtr<const VulkanQueue> m_queue;
+    UInt32 m_releaseDelay;
+    UInt64 m_scratchAlignment{ 1u };
+    UInt64 m_timestampMask{ 0u };
+    double m_ticksPerMillisecond{ 1.0 };
+    SharedPtr<const IVulkanBuffer> m_scratchBuffer;
+    Array<SharedPtr<VulkanBottomLevelAccelerationStructure>> m_queued;
+    Array<PendingBuild> m_builds;
+    Array<PendingRelease> m_releases;
+    Statistics m_statistics{ };
+    Event<ISwapChain::BackBufferSwapEventArgs>::event_token_type m_swapEventToken{ };
+    mutable std::mutex m_mutex;
+
+public:
+    VulkanBottomLevelAccelerationStructureBatchImpl(const VulkanQueue& queue, UInt32 releaseDelay) :
+        m_device(queue.device()), m_queue(queue.shared_from_this()), m_releaseDelay(releaseDelay)
+    {
+        if (!LITEFX_FLAG_IS_SET(queue.type(), QueueType::Compute) && !LITEFX_FLAG_IS_SET(queue.type(), QueueType::Graphics)) [[unlikely]]
+            throw InvalidArgumentException("queue", "Acceleration structures can only be built on queues that support compute workloads.");
+    }
+
+    VulkanBottomLevelAccelerationStructureBatchImpl(VulkanBottomLevelAccelerationStructureBatchImpl&&) noexcept = delete;
+    VulkanBottomLevelAccelerationStructureBatchImpl(const VulkanBottomLevelAccelerationStructureBatchImpl&) = delete;
+    VulkanBottomLevelAccelerationStructureBatchImpl& operator=(VulkanBottomLevelAccelerationStructureBatchImpl&&) noexcept = delete;
+    VulkanBottomLevelAccelerationStructureBatchImpl& operator=(const VulkanBottomLevelAccelerationStructureBatchImpl&) = delete;
+
+    ~VulkanBottomLevelAccelerationStructureBatchImpl() noexcept
+    {
+        auto device = m_device.lock();
+
+        if (device == nullptr) [[unlikely]]
+        {
+            LITEFX_FATAL_ERROR(VULKAN_LOG, "Invalid attempt to release acceleration structure batch after parent device.");
+            return;
+        }
+
+        device->swapChain().swapped.remove(m_swapEventToken);
+
+        // Wait for all pending work, as it still references the memory and handles owned by the batch.
+        m_queue->waitFor(m_queue->currentFence());
+
+        for (auto& build : m_builds)
+            this->releaseQueries(*device, build);
+
+        for (auto& release : m_releases)
+            std::ranges::for_each(release.handles, [&device](auto handle) { ::vkDestroyAccelerationStructure(device->handle(), handle, nullptr); });
+    }
+
+public:
+    void initialize(const VulkanDevice& device, const VulkanBottomLevelAccelerationStructureBatch& parent)
+    {
+        m_ticksPerMillisecond = device.ticksPerMillisecond();
+
+        // Scratch memory of each build must be aligned to the minimum scratch offset alignment of the device.
+        VkPhysicalDeviceAccelerationStructurePropertiesKHR accelerationStructureProperties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR };
+        VkPhysicalDeviceProperties2 properties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &accelerationStructureProperties };
+        ::vkGetPhysicalDeviceProperties2(device.adapter().handle(), &properties);
+        m_scratchAlignment = std::max(accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment, 1u);
+
+        // Builds are only timed, if the queue family supports timestamps.
+        uint32_t queueFamilies = 0;
+        ::vkGetPhysicalDeviceQueueFamilyProperties(device.adapter().handle(), &queueFamilies, nullptr);
+
+        Array<VkQueueFamilyProperties> familyProperties(queueFamilies);
+        ::vkGetPhysicalDeviceQueueFamilyProperties(device.adapter().handle(), &queueFamilies, familyProperties.data());
+
+        auto validBits = m_queue->familyId() < familyProperties.size() ? familyProperties[m_queue->familyId()].timestampValidBits : 0u; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        m_timestampMask = validBits >= 64u ? std::numeric_limits<UInt64>::max() : (1ull << validBits) - 1ull; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+        // Compact and release memory, whenever the swap chain swaps its back buffers.
+        m_swapEventToken = device.swapChain().swapped.add([&parent](const void* /*sender*/, const ISwapChain::BackBufferSwapEventArgs& /*args*/) { parent.update(); });
+    }
+
+private:
+    static constexpr UInt64 align(UInt64 size, UInt64 alignment) noexcept
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    void releaseQueries(const VulkanDevice& device, PendingBuild& build) noexcept
+    {
+        ::vkDestroyQueryPool(device.handle(), build.compactedSizes, nullptr);
+        ::vkDestroyQueryPool(device.handle(), build.timestamps, nullptr);
+        build.compactedSizes = VK_NULL_HANDLE;
+        build.timestamps = VK_NULL_HANDLE;
+    }
+
+    VkQueryPool createQueryPool(const VulkanDevice& device, VkQueryType type, UInt32 queries) const
+    {
+        VkQueryPool queryPool{ VK_NULL_HANDLE };
+
+        VkQueryPoolCreateInfo queryPoolInfo = {
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType = type,
+            .queryCount = queries
+        };
+
+        raiseIfFailed(::vkCreateQueryPool(device.handle(), &queryPoolInfo, nullptr, &queryPool), "Unable to create query pool for acceleration structure batch.");
+        ::vkResetQueryPool(device.handle(), queryPool, 0, queries);
+
+        return queryPool;
+    }
+
+    VkAccelerationStructureKHR createHandle(const VulkanDevice& device, const IVulkanBuffer& buffer, UInt64 offset, UInt64 size) const
+    {
+        VkAccelerationStructureKHR handle{ VK_NULL_HANDLE };
+
+        VkAccelerationStructureCreateInfoKHR info = {
+            .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
+            .buffer = buffer.handle(),
+            .offset = offset,
+            .size = size,
+            .type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR
+        };
+
+        raiseIfFailed(::vkCreateAccelerationStructure(device.handle(), &info, nullptr, &handle), "Unable to create acceleration structure handle.");
+
+        return handle;
+    }
+
+public:
+    UInt64 build(const VulkanDevice& device)
+    {
+        if (m_queued.empty())
+            return m_queue->currentFence();
+
+        PendingBuild build{ .accelerationStructures = std::move(m_queued) };
+        m_queued.clear();
+
+        // Compute the memory layout of the acceleration structures and their scratch memory.
+        const auto count = static_cast<UInt32>(build.accelerationStructures.size());
+        Array<UInt64> offsets(count), scratchOffsets(count);
+        UInt64 bufferSize{ 0u }, scratchSize{ 0u };
+
+        for (UInt32 i{ 0 }; i < count; ++i)
+        {
+            UInt64 size{}, scratch{};
+            device.computeAccelerationStructureSizes(*build.accelerationStructures[i], size, scratch); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            build.sizes.push_back(size);
+
+            offsets[i] = bufferSize; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            scratchOffsets[i] = scratchSize; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            bufferSize += align(size, ACCELERATION_STRUCTURE_ALIGNMENT);
+            scratchSize += align(scratch, m_scratchAlignment);
+
+            if (LITEFX_FLAG_IS_SET(build.accelerationStructures[i]->flags(), AccelerationStructureFlags::AllowCompaction)) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                build.compactable.push_back(i);
+        }
+
+        // Grow the shared scratch buffer, if required. The previous buffer is kept alive by the command buffers of the builds that still use it.
+        if (m_scratchBuffer == nullptr || m_scratchBuffer->size() < scratchSize)
+        {
+            m_scratchBuffer = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, static_cast<size_t>(scratchSize), 1, ResourceUsage::AllowWrite);
+            m_statistics.ScratchSize = m_scratchBuffer->size();
+        }
+
+        auto buffer = device.factory().createBuffer(BufferType::AccelerationStructure, ResourceHeap::Resource, static_cast<size_t>(bufferSize), 1, ResourceUsage::AllowWrite);
+        auto commandBuffer = m_queue->createCommandBuffer(true);
+        commandBuffer->track(m_scratchBuffer);
+
+        // Wait for previous builds on the queue to stop using the scratch memory.
+        VulkanBarrier scratchBarrier(PipelineStage::AccelerationStructureBuild, PipelineStage::AccelerationStructureBuild);
+        scratchBarrier.transition(*m_scratchBuffer, ResourceAccess::AccelerationStructureWrite, ResourceAccess::AccelerationStructureWrite);
+        commandBuffer->barrier(scratchBarrier);
+
+        if (m_timestampMask != 0u)
+        {
+            build.timestamps = this->createQueryPool(device, VK_QUERY_TYPE_TIMESTAMP, 2);
+            ::vkCmdWriteTimestamp(commandBuffer->handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, build.timestamps, 0);
+        }
+
+        // Setup the build inputs for all acceleration structures. The geometry and range arrays must outlive the build command.
+        Array<Array<VkAccelerationStructureGeometryKHR>> geometries(count);
+        Array<Array<VkAccelerationStructureBuildRangeInfoKHR>> ranges(count);
+        Array<const VkAccelerationStructureBuildRangeInfoKHR*> rangePointers(count);
+        Array<VkAccelerationStructureBuildGeometryInfoKHR> inputs(count);
+        Array<VkAccelerationStructureKHR> handles(count);
+        PendingRelease release{ .delay = m_releaseDelay };
+
+        for (UInt32 i{ 0 }; i < count; ++i)
+        {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            auto& blas = *build.accelerationStructures[i];
+            auto buildInfo = blas.buildInfo();
+            geometries[i] = buildInfo | std::views::values | std::ranges::to<Array<VkAccelerationStructureGeometryKHR>>();
+            ranges[i] = buildInfo | std::views::keys |
+                std::views::transform([](UInt32 primitives) { return VkAccelerationStructureBuildRangeInfoKHR { .primitiveCount = primitives }; }) |
+                std::ranges::to<Array<VkAccelerationStructureBuildRangeInfoKHR>>();
+            rangePointers[i] = ranges[i].data();
+            handles[i] = this->createHandle(device, *buffer, offsets[i], build.sizes[i]);
+
+            inputs[i] = {
+                .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+                .type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR,
+                .flags = std::bit_cast<VkBuildAccelerationStructureFlagsKHR>(blas.flags()),
+                .mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
+                .dstAccelerationStructure = handles[i],
+                .geometryCount = static_cast<UInt32>(geometries[i].size()),
+                .pGeometries = geometries[i].data(),
+                .scratchData = {
+                    .deviceAddress = m_scratchBuffer->virtualAddress() + scratchOffsets[i]
+                }
+            };
+
+            // If the acceleration structure has been built before, release its previous handle and memory after the build has finished.
+            auto previousBuffer = blas.buffer();
+
+            if (auto previousHandle = blas.exchangeState(&device, handles[i], buffer, offsets[i], build.sizes[i]); previousHandle != VK_NULL_HANDLE)
+                release.handles.push_back(previousHandle);
+
+            if (previousBuffer != nullptr)
+                release.buffers.push_back(previousBuffer);
+            // NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        }
+
+        ::vkCmdBuildAccelerationStructures(commandBuffer->handle(), count, inputs.data(), rangePointers.data());
+        build.handles = handles;
+
+        // Write out the compacted sizes of all acceleration structures that allow compaction.
+        if (!build.compactable.empty())
+        {
+            auto compactable = static_cast<UInt32>(build.compactable.size());
+            auto compactableHandles = build.compactable | std::views::transform([&handles](UInt32 i) { return handles[i]; }) | std::ranges::to<Array<VkAccelerationStructureKHR>>(); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            build.compactedSizes = this->createQueryPool(device, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, compactable);
+
+            VulkanBarrier barrier(PipelineStage::AccelerationStructureBuild, PipelineStage::AccelerationStructureBuild);
+            barrier.transition(*buffer, ResourceAccess::AccelerationStructureWrite, ResourceAccess::AccelerationStructureRead);
+            commandBuffer->barrier(barrier);
+            ::vkCmdWriteAccelerationStructuresProperties(commandBuffer->handle(), compactable, compactableHandles.data(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, build.compactedSizes, 0);
+        }
+
+        if (build.timestamps != VK_NULL_HANDLE)
+            ::vkCmdWriteTimestamp(commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, build.timestamps, 1);
+
+        build.fence = commandBuffer->submit();
+        build.commandBuffer = commandBuffer;
+
+        m_statistics.Builds++;
+        m_statistics.AccelerationStructures += count;
+        m_statistics.BuildSize += bufferSize;
+
+        if (!release.handles.empty() || !release.buffers.empty())
+        {
+            release.fence = build.fence;
+            release.commandBuffer = commandBuffer;
+            m_releases.push_back(std::move(release));
+        }
+
+        auto fence = build.fence;
+        m_builds.push_back(std::move(build));
+
+        return fence;
+    }
+
+    UInt32 update(const VulkanDevice& device)
+    {
+        auto completedFence = m_queue->lastCompletedFence();
+        UInt32 compacted{ 0u };
+
+        // Compact the acceleration structures of all builds that have finished executing.
+        for (auto& build : m_builds | std::views::filter([completedFence](const auto& build) { return build.fence <= completedFence; }))
+        {
+            if (build.timestamps != VK_NULL_HANDLE)
+            {
+                std::array<UInt64, 2> timestamps{};
+                raiseIfFailed(::vkGetQueryPoolResults(device.handle(), build.timestamps, 0, 2, sizeof(timestamps), timestamps.data(), sizeof(UInt64), VK_QUERY_RESULT_64_BIT), "Unable to read acceleration structure build timestamps.");
+                auto ticks = (timestamps[1] & m_timestampMask) - (timestamps[0] & m_timestampMask); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                m_statistics.LastBuildTime = static_cast<double>(ticks) / m_ticksPerMillisecond;
+                m_statistics.BuildTime += m_statistics.LastBuildTime;
+            }
+
+            if (build.compactedSizes != VK_NULL_HANDLE)
+                compacted += this->compact(device, build);
+
+            this->releaseQueries(device, build);
+        }
+
+        std::erase_if(m_builds, [completedFence](const auto& build) { return build.fence <= completedFence; });
+
+        // Release memory that is no longer used, after waiting for the configured number of frames.
+        for (auto& release : m_releases | std::views::filter([completedFence](const auto& release) { return release.fence <= completedFence; }))
+        {
+            if (release.delay > 0u)
+            {
+                release.delay--;
+                continue;
+            }
+
+            std::ranges::for_each(release.handles, [&device](auto handle) { ::vkDestroyAccelerationStructure(device.handle(), handle, nullptr); });
+            release.handles.clear();
+            release.buffers.clear();
+            release.commandBuffer.reset();
+        }
+
+        std::erase_if(m_releases, [](const auto& release) { return release.commandBuffer == nullptr; });
+
+        return compacted;
+    }
+
+private:
+    UInt32 compact(const VulkanDevice& device, PendingBuild& build)
+    {
+        // Read the compacted sizes. They are available, since the build has finished executing.
+        auto compactable = static_cast<UInt32>(build.compactable.size());
+        Array<UInt64> compactedSizes(compactable);
+        raiseIfFailed(::vkGetQueryPoolResults(device.handle(), build.compactedSizes, 0, compactable, compactedSizes.size() * sizeof(UInt64), compactedSizes.data(), sizeof(UInt64), VK_QUERY_RESULT_64_BIT), "Unable to query for compacted acceleration structure sizes.");
+
+        // Only compact acceleration structures that actually shrink.
+        Array<std::pair<UInt32, UInt64>> compactions;
+        UInt64 bufferSize{ 0u };
+
+        for (UInt32 i{ 0 }; i < compactable; ++i)
+        {
+            auto index = build.compactable[i]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+            // If the acceleration structure has been re-built or compacted elsewhere since, the compacted size does not describe its current handle anymore.
+            if (build.accelerationStructures[index]->handle() != build.handles[index]) [[unlikely]] // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            {
+                LITEFX_DEBUG(VULKAN_LOG, "Skipping compaction of acceleration structure {0}, as it has been re-built since.", build.accelerationStructures[index]->name()); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                continue;
+            }
+
+            if (compactedSizes[i] > 0u && compactedSizes[i] < build.sizes[index]) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            {
+                compactions.emplace_back(index, compactedSizes[i]); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                bufferSize += align(compactedSizes[i], ACCELERATION_STRUCTURE_ALIGNMENT); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            }
+        }
+
+        if (compactions.empty())
+            return 0u;
+
+        // Copy the acceleration structures into a tightly packed buffer.
+        auto buffer = device.factory().createBuffer(BufferType::AccelerationStructure, ResourceHeap::Resource, static_cast<size_t>(bufferSize), 1, ResourceUsage::AllowWrite);
+        auto commandBuffer = m_queue->createCommandBuffer(true);
+        PendingRelease release{ .delay = m_releaseDelay };
+        UInt64 offset{ 0u }, savedMemory{ 0u };
+
+        for (auto [index, size] : compactions)
+        {
+            auto& blas = *build.accelerationStructures[index]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            auto handle = this->createHandle(device, *buffer, offset, size);
+
+            VkCopyAccelerationStructureInfoKHR copyInfo = {
+                .sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR,
+                .src = blas.handle(),
+                .dst = handle,
+                .mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR
+            };
+
+            ::vkCmdCopyAccelerationStructure(commandBuffer->handle(), &copyInfo);
+
+            release.buffers.push_back(blas.buffer());
+            release.handles.push_back(blas.exchangeState(&device, handle, buffer, offset, size));
+            savedMemory += build.sizes[index] - size; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            offset += align(size, ACCELERATION_STRUCTURE_ALIGNMENT);
+        }
+
+        release.fence = commandBuffer->submit();
+        release.commandBuffer = commandBuffer;
+        m_releases.push_back(std::move(release));
+
+        m_statistics.Compacted += static_cast<UInt32>(compactions.size());
+        m_statistics.SavedMemory += savedMemory;
+
+        return static_cast<UInt32>(compactions.size());
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanBottomLevelAccelerationStructureBatch::VulkanBottomLevelAccelerationStructureBatch(const VulkanQueue& queue, UInt32 releaseDelay) :
+    m_impl(queue, releaseDelay)
+{
+    auto device = queue.device();
+
+    if (device == nullptr) [[unlikely]]
+        throw RuntimeException("Cannot create acceleration structure batch on a released device instance.");
+
+    m_impl->initialize(*device, *this);
+}
+
+VulkanBottomLevelAccelerationStructureBatch::~VulkanBottomLevelAccelerationStructureBatch() noexcept = default;
+
+void VulkanBottomLevelAccelerationStructureBatch::add(const SharedPtr<VulkanBottomLevelAccelerationStructure>& accelerationStructure)
+{
+    if (accelerationStructure == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("accelerationStructure", "The acceleration structure must be initialized.");
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    m_impl->m_queued.push_back(accelerationStructure);
+}
+
+UInt32 VulkanBottomLevelAccelerationStructureBatch::queued() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return static_cast<UInt32>(m_impl->m_queued.size());
+}
+
+UInt64 VulkanBottomLevelAccelerationStructureBatch::build() const
+{
+    auto device = m_impl->m_device.lock();
+
+    if (device == nullptr) [[unlikely]]
+        throw RuntimeException("Cannot build acceleration structures on a released device instance.");
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->build(*device);
+}
+
+UInt32 VulkanBottomLevelAccelerationStructureBatch::update() const
+{
+    auto device = m_impl->m_device.lock();
+
+    if (device == nullptr) [[unlikely]]
+        throw RuntimeException("Cannot compact acceleration structures on a released device instance.");
+
+    UInt32 compactions{ 0u };
+
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        compactions = m_impl->update(*device);
+    }
+
+    if (compactions > 0u)
+        this->compacted(this, { });
+
+    return compactions;
+}
+
+bool VulkanBottomLevelAccelerationStructureBatch::idle() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_queued.empty() && m_impl->m_builds.empty() && m_impl->m_releases.empty();
+}
+
+Statistics VulkanBottomLevelAccelerationStructureBatch::statistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_statistics;
+}
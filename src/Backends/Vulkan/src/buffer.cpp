@@ -216,7 +216,7 @@ bool VulkanBuffer::tryAllocate(SharedPtr<IVulkanBuffer>& buffer, const String& n
 bool VulkanBuffer::move(SharedPtr<IVulkanBuffer> buffer, VmaAllocation to, const VulkanCommandBuffer& commandBuffer) // NOLINT(performance-unnecessary-value-param)
 {
 	// NOTES: If this method returns true, the command buffer must be executed and all bindings to the image must be updated afterwards, otherwise the result of this operation is undefined behavior.
-	// TODO: Handle host-visible copies
+	//        Mapped buffers must not be moved, as host pointers to their memory would become invalid. The factory never moves buffers while they are mapped.
 
 	if (buffer == nullptr) [[unlikely]]
 		throw ArgumentNotInitializedException("buffer");
@@ -25,15 +25,17 @@ private:
 	bool m_recording{ false }, m_secondary{ false };
 	VkCommandPool m_commandPool{};
 	Array<SharedPtr<const IStateResource>> m_sharedResources;
+	Array<VkAccelerationStructureKHR> m_retiredAccelerationStructures;
 	Array<UniquePtr<const IDescriptorSet>> m_trackedDescriptorSets;
 	const VulkanPipelineState* m_lastPipeline = nullptr;
 	WeakPtr<const VulkanQueue> m_queue;
 	WeakPtr<const VulkanDevice> m_device;
+	Instrumentation* m_instrumentation;
 	bool m_canBindDescriptorHeaps = false;
 
 public:
 	VulkanCommandBufferImpl(const VulkanQueue& queue, bool primary) :
-		m_secondary(!primary), m_queue(queue.weak_from_this()), m_device(queue.device()), 
+		m_secondary(!primary), m_queue(queue.weak_from_this()), m_device(queue.device()), m_instrumentation(&queue.device()->instrumentation()),
 		m_canBindDescriptorHeaps(LITEFX_FLAG_IS_SET(queue.type(), QueueType::Compute) || LITEFX_FLAG_IS_SET(queue.type(), QueueType::Graphics))
 	{
 	}
@@ -47,11 +49,20 @@ public:
 			LITEFX_FATAL_ERROR(VULKAN_LOG, "Invalid attempt to release command buffer after parent device has been released.");
 		else
 		{
+			this->releaseRetiredAccelerationStructures(*device);
 			::vkFreeCommandBuffers(device->handle(), m_commandPool, 1, &commandBuffer.handle());
 			::vkDestroyCommandPool(device->handle(), m_commandPool, nullptr);
 		}
 	}
 
+	void releaseRetiredAccelerationStructures(const VulkanDevice& device) noexcept
+	{
+		for (auto handle : m_retiredAccelerationStructures)
+			::vkDestroyAccelerationStructure(device.handle(), handle, nullptr);
+
+		m_retiredAccelerationStructures.clear();
+	}
+
 	VkCommandBuffer initialize(const VulkanQueue& queue, const VulkanDevice& device)
 	{
 		// Create command pool.
@@ -129,8 +140,10 @@ public:
 
 		::vkCmdBuildAccelerationStructures(commandBuffer.handle(), 1, &inputs, &rangePointer);
 
-		// Store the acceleration structure handle.
-		blas.updateState(device.get(), handle);
+		// Store the acceleration structure handle. The previous handle is the source of an update, so it can only be destroyed after the command buffer has
+		// been executed.
+		if (auto previous = blas.updateState(device.get(), handle); previous != VK_NULL_HANDLE)
+			m_retiredAccelerationStructures.push_back(previous);
 
 		// Store the scratch buffer.
 		m_sharedResources.push_back(scratchBuffer);
@@ -146,12 +159,8 @@ public:
 		if (scratchBuffer == nullptr) [[unlikely]]
 			throw ArgumentNotInitializedException("scratchBuffer");
 
-		// Create a buffer to store the instance data.
-		auto buildInfo = tlas.buildInfo();
-		auto instanceBuffer = device->factory().createBuffer(BufferType::Storage, ResourceHeap::Dynamic, sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size(), 1, ResourceUsage::AccelerationStructureBuildInput);
-
-		// Map the instance buffer.
-		instanceBuffer->map(buildInfo.data(), sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size());
+		// Write the instances that changed since the last build into the instance buffer of the acceleration structure.
+		auto instanceBuffer = tlas.uploadInstances(commandBuffer, update);
 
 		VkAccelerationStructureBuildRangeInfoKHR ranges { static_cast<UInt32>(tlas.instances().size()) };
 		auto rangePointer = &ranges;
@@ -204,11 +213,12 @@ public:
 
 		::vkCmdBuildAccelerationStructures(commandBuffer.handle(), 1, &inputs, &rangePointer);
 
-		// Store the acceleration structure handle.
-		tlas.updateState(device.get(), handle);
+		// Store the acceleration structure handle. The previous handle is the source of an update, so it can only be destroyed after the command buffer has
+		// been executed.
+		if (auto previous = tlas.updateState(device.get(), handle); previous != VK_NULL_HANDLE)
+			m_retiredAccelerationStructures.push_back(previous);
 
 		// Store the scratch buffer.
-		m_sharedResources.emplace_back(instanceBuffer);
 		m_sharedResources.emplace_back(scratchBuffer);
 	}
 
@@ -252,6 +262,8 @@ SharedPtr<const VulkanQueue> VulkanCommandBuffer::queue() const noexcept
 
 void VulkanCommandBuffer::begin() const
 {
+	LITEFX_PROFILE_ZONE(*m_impl->m_instrumentation, "VulkanCommandBuffer::begin");
+
 	// Set the buffer into recording state.
 	VkCommandBufferBeginInfo beginInfo {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -267,6 +279,9 @@ void VulkanCommandBuffer::begin() const
 
 	// If it was possible to reset the command buffer, we can also safely release shared resources from previous recordings.
 	m_impl->m_sharedResources.clear();
+
+	if (auto device = m_impl->m_device.lock(); device != nullptr) [[likely]]
+		m_impl->releaseRetiredAccelerationStructures(*device);
 	m_impl->m_trackedDescriptorSets.clear();
 }
 
@@ -449,6 +464,7 @@ UniquePtr<VulkanBarrier> VulkanCommandBuffer::makeBarrier(PipelineStage syncBefo
 
 void VulkanCommandBuffer::barrier(const VulkanBarrier& barrier) const noexcept
 {
+	LITEFX_PROFILE_ZONE(*m_impl->m_instrumentation, "VulkanCommandBuffer::barrier");
 	barrier.execute(*this);
 }
 
@@ -507,12 +523,12 @@ void VulkanCommandBuffer::transfer(const IVulkanBuffer& source, const IVulkanIma
 		throw ArgumentOutOfRangeException("targetElement", "The target image has only {0} sub-resources, but a transfer for {1} elements starting from element {2} has been requested.", target.elements(), elements, firstSubresource);
 
 	Array<VkBufferImageCopy> copyInfos(elements);
-	std::ranges::generate(copyInfos, [&, i = firstSubresource]() mutable {
-		UInt32 subresource = i++, layer = 0, level = 0, plane = 0;
+	std::ranges::generate(copyInfos, [&, i = 0u]() mutable {
+		UInt32 subresource = firstSubresource + i, layer = 0, level = 0, plane = 0;
 		target.resolveSubresource(subresource, plane, layer, level);
 
 		return VkBufferImageCopy {
-			.bufferOffset = source.alignedElementSize() * sourceElement,
+			.bufferOffset = source.alignedElementSize() * (sourceElement + i++),
 			.bufferRowLength = 0,
 			.bufferImageHeight = 0,
 			.imageSubresource = VkImageSubresourceLayers {
@@ -522,7 +538,7 @@ void VulkanCommandBuffer::transfer(const IVulkanBuffer& source, const IVulkanIma
 				.layerCount = 1
 			},
 			.imageOffset = { 0, 0, 0 },
-			.imageExtent = { static_cast<UInt32>(target.extent().width()), static_cast<UInt32>(target.extent().height()), static_cast<UInt32>(target.extent().depth()) }
+			.imageExtent = { static_cast<UInt32>(target.extent(level).width()), static_cast<UInt32>(target.extent(level).height()), static_cast<UInt32>(target.extent(level).depth()) }
 		};
 	});
 
@@ -589,7 +605,7 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanImag
 				.layerCount = 1
 			},
 			.dstOffset = { 0, 0, 0 },
-			.extent = { static_cast<UInt32>(source.extent().width()), static_cast<UInt32>(source.extent().height()), static_cast<UInt32>(source.extent().depth()) }
+			.extent = { static_cast<UInt32>(source.extent(sourceLevel).width()), static_cast<UInt32>(source.extent(sourceLevel).height()), static_cast<UInt32>(source.extent(sourceLevel).depth()) }
 		};
 	});
 
@@ -601,17 +617,17 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanBuff
 	if (source.elements() < firstSubresource + subresources) [[unlikely]]
 		throw ArgumentOutOfRangeException("sourceElement", "The source image has only {0} sub-resources, but a transfer for {1} sub-resources starting from sub-resource {2} has been requested.", source.elements(), subresources, firstSubresource);
 
-	if (target.elements() <= targetElement + subresources) [[unlikely]]
+	if (target.elements() < targetElement + subresources) [[unlikely]]
 		throw ArgumentOutOfRangeException("targetElement", "The target buffer has only {0} elements, but a transfer for {1} elements starting from element {2} has been requested.", target.elements(), subresources, targetElement);
 	
 	// Create a copy command and add it to the command buffer.
 	Array<VkBufferImageCopy> copyInfos(subresources);
-	std::ranges::generate(copyInfos, [&, i = targetElement]() mutable {
-		UInt32 subresource = i++, layer = 0, level = 0, plane = 0;
+	std::ranges::generate(copyInfos, [&, i = 0u]() mutable {
+		UInt32 subresource = firstSubresource + i, layer = 0, level = 0, plane = 0;
 		source.resolveSubresource(subresource, plane, layer, level);
 
 		return VkBufferImageCopy {
-			.bufferOffset = target.alignedElementSize() * subresource,
+			.bufferOffset = target.alignedElementSize() * (targetElement + i++),
 			.bufferRowLength = 0,
 			.bufferImageHeight = 0,
 			.imageSubresource = VkImageSubresourceLayers {
@@ -621,7 +637,7 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanBuff
 				.layerCount = 1
 			},
 			.imageOffset = { 0, 0, 0 },
-			.imageExtent = { static_cast<UInt32>(source.extent().width()), static_cast<UInt32>(source.extent().height()), static_cast<UInt32>(source.extent().depth()) }
+			.imageExtent = { static_cast<UInt32>(source.extent(level).width()), static_cast<UInt32>(source.extent(level).height()), static_cast<UInt32>(source.extent(level).depth()) }
 		};
 	});
 
@@ -815,6 +831,9 @@ void VulkanCommandBuffer::execute(Enumerable<SharedPtr<const VulkanCommandBuffer
 void VulkanCommandBuffer::releaseSharedState() const
 {
 	m_impl->m_sharedResources.clear();
+
+	if (auto device = m_impl->m_device.lock(); device != nullptr) [[likely]]
+		m_impl->releaseRetiredAccelerationStructures(*device);
 }
 
 void VulkanCommandBuffer::buildAccelerationStructure(VulkanBottomLevelAccelerationStructure& blas, const SharedPtr<const IVulkanBuffer>& scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset) const
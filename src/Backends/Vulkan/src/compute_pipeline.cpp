@@ -52,6 +52,7 @@ public:
 			.layout = std::as_const(*m_layout.get()).handle()
 		};
 
+		LITEFX_PROFILE_ZONE(m_device->instrumentation(), "VulkanComputePipeline::compile");
 		VkPipeline pipeline{};
 		raiseIfFailed(::vkCreateComputePipelines(m_device->handle(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline), "Unable to create compute pipeline.");
 
@@ -81,11 +82,9 @@ VulkanComputePipeline::VulkanComputePipeline(const VulkanDevice& device) noexcep
 {
 }
 
-VulkanComputePipeline::VulkanComputePipeline(VulkanComputePipeline&&) noexcept = default;
-VulkanComputePipeline& VulkanComputePipeline::operator=(VulkanComputePipeline&&) noexcept = default;
-
 VulkanComputePipeline::~VulkanComputePipeline() noexcept
 {
+	this->finishCompilation();
 	::vkDestroyPipeline(m_impl->m_device->handle(), this->handle(), nullptr);
 }
 
@@ -106,6 +105,9 @@ VkPipelineBindPoint VulkanComputePipeline::pipelineType() const noexcept
 
 void VulkanComputePipeline::use(const VulkanCommandBuffer& commandBuffer) const
 {
+	// Block until the pipeline state is compiled, if it is compiled asynchronously.
+	this->wait();
+
 	::vkCmdBindPipeline(commandBuffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, this->handle());
 }
 
@@ -127,6 +129,10 @@ void VulkanComputePipelineBuilder::build()
 	auto instance = this->instance();
 	instance->m_impl->m_layout = this->state().pipelineLayout;
 	instance->m_impl->m_program = this->state().shaderProgram;
-	instance->handle() = instance->m_impl->initialize(*instance);
+
+	if (this->state().compileAsync)
+		instance->compileAsync(instance->m_impl->m_device->scheduler(), [instance]() { return instance->m_impl->initialize(*instance); });
+	else
+		instance->handle() = instance->m_impl->initialize(*instance);
 }
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
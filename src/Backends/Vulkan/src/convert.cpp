@@ -656,11 +656,58 @@ VkFormat LiteFX::Rendering::Backends::Vk::getFormat(BufferFormat format)
 		return VK_FORMAT_R32G32B32A32_SINT;
 	case BufferFormat::XYZW32U:
 		return VK_FORMAT_R32G32B32A32_UINT;
+	case BufferFormat::XYZW8UN:
+		return VK_FORMAT_R8G8B8A8_UNORM;
+	case BufferFormat::XY16UN:
+		return VK_FORMAT_R16G16_UNORM;
+	case BufferFormat::XY16SN:
+		return VK_FORMAT_R16G16_SNORM;
+	case BufferFormat::XYZW16UN:
+		return VK_FORMAT_R16G16B16A16_UNORM;
+	case BufferFormat::XYZW16SN:
+		return VK_FORMAT_R16G16B16A16_SNORM;
 	default:
 		throw std::invalid_argument("Unsupported format.");
 	}
 }
 
+bool LiteFX::Rendering::Backends::Vk::isSRGB(Format format)
+{
+	return 
+		format == Format::A8B8G8R8_SRGB || 
+		format == Format::B8G8R8A8_SRGB || 
+		format == Format::B8G8R8_SRGB ||
+		format == Format::BC1_RGBA_SRGB ||
+		format == Format::BC1_RGB_SRGB ||
+		format == Format::BC2_SRGB ||
+		format == Format::BC3_SRGB ||
+		format == Format::BC7_SRGB ||
+		format == Format::R8G8B8A8_SRGB || 
+		format == Format::R8G8B8_SRGB || 
+		format == Format::R8G8_SRGB || 
+		format == Format::R8_SRGB;
+}
+
+Format LiteFX::Rendering::Backends::Vk::getLinearFormat(Format format)
+{
+	switch (format)
+	{
+	case Format::R8_SRGB: return Format::R8_UNORM;
+	case Format::R8G8_SRGB: return Format::R8G8_UNORM;
+	case Format::R8G8B8_SRGB: return Format::R8G8B8_UNORM;
+	case Format::B8G8R8_SRGB: return Format::B8G8R8_UNORM;
+	case Format::R8G8B8A8_SRGB: return Format::R8G8B8A8_UNORM;
+	case Format::B8G8R8A8_SRGB: return Format::B8G8R8A8_UNORM;
+	case Format::A8B8G8R8_SRGB: return Format::A8B8G8R8_UNORM;
+	case Format::BC1_RGB_SRGB: return Format::BC1_RGB_UNORM;
+	case Format::BC1_RGBA_SRGB: return Format::BC1_RGBA_UNORM;
+	case Format::BC2_SRGB: return Format::BC2_UNORM;
+	case Format::BC3_SRGB: return Format::BC3_UNORM;
+	case Format::BC7_SRGB: return Format::BC7_UNORM;
+	default: return format;
+	}
+}
+
 PolygonMode LiteFX::Rendering::Backends::Vk::getPolygonMode(const VkPolygonMode& mode)
 {
 	switch (mode)
@@ -167,7 +167,7 @@ public:
             .pNext = nullptr,
             .image = image.handle(),
             .viewType = Vk::getImageViewType(image.dimensions(), numLayers), // TODO: What if we want to bind an array with one layer only, though?!... `DescriptorLayout` should get an "isArray" property.
-            .format = Vk::getFormat(image.format()),
+            .format = Vk::getFormat(bindingType == DescriptorType::RWTexture ? Vk::getLinearFormat(image.format()) : image.format()), // Storage images do not support sRGB formats.
             .components = VkComponentMapping {
                 .r = VK_COMPONENT_SWIZZLE_IDENTITY,
                 .g = VK_COMPONENT_SWIZZLE_IDENTITY,
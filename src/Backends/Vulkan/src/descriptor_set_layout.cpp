@@ -308,6 +308,7 @@ public:
     template <typename TDescriptorBindings>
     inline auto allocate(SharedPtr<const VulkanDescriptorSetLayout> layout, UInt32 descriptors, TDescriptorBindings bindings) // NOLINT(performance-unnecessary-value-param)
     {
+        LITEFX_PROFILE_ZONE(m_device->instrumentation(), "VulkanDescriptorSetLayout::allocate");
         std::lock_guard<std::mutex> lock(m_mutex);
 
         // If no descriptor sets are free, or the descriptor set contains an unbounded descriptor array, allocate a new descriptor set.
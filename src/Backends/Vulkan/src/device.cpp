@@ -129,7 +129,10 @@ private:
 
     SharedPtr<const VulkanGraphicsAdapter> m_adapter;
     UniquePtr<VulkanSurface> m_surface;
+    VkInstance m_instance;
     SharedPtr<VulkanGraphicsFactory> m_factory;
+    TaskScheduler* m_scheduler;
+    Instrumentation* m_instrumentation;
 
 #ifndef NDEBUG
     PFN_vkDebugMarkerSetObjectNameEXT debugMarkerSetObjectName = nullptr;
@@ -141,13 +144,11 @@ private:
     mutable std::mutex m_bufferBindMutex;
 
 public:
-    VulkanDeviceImpl(const VulkanGraphicsAdapter& adapter, UniquePtr<VulkanSurface>&& surface, const GraphicsDeviceFeatures& features, Span<String> extensions, size_t globalDescriptorHeapSize) :
-        m_adapter(adapter.shared_from_this()), m_surface(std::move(surface)),
+    VulkanDeviceImpl(const VulkanBackend& backend, const VulkanGraphicsAdapter& adapter, UniquePtr<VulkanSurface>&& surface, const GraphicsDeviceFeatures& features, Span<String> extensions, size_t globalDescriptorHeapSize) :
+        m_adapter(adapter.shared_from_this()), m_surface(std::move(surface)), m_instance(backend.handle()), m_scheduler(&backend.scheduler()), m_instrumentation(&backend.instrumentation()),
         m_globalDescriptorHeapAllocator(VirtualAllocator::create<VulkanBackend>(globalDescriptorHeapSize))
     {
-        if (m_surface == nullptr)
-            throw ArgumentNotInitializedException("surface", "The surface must be initialized.");
-
+        // NOTE: If no surface is provided, the device is compute-only and does not require any presentation state.
         m_extensions.assign(std::begin(extensions), std::end(extensions));
         
         // Define mandatory extensions for provided features.
@@ -195,18 +196,22 @@ private:
         if (features.ConservativeRasterization)
             m_extensions.emplace_back(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
 
+        // Compute-only devices do not present and hence do not require any swap chain extensions.
+        if (m_surface != nullptr)
+        {
 #if defined(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN) && defined(LITEFX_BUILD_DIRECTX_12_BACKEND)
-        // Interop swap chain requires external memory access.
-        m_extensions.emplace_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
-        m_extensions.emplace_back(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
-        m_extensions.emplace_back(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
-
-        // Required to synchronize Vulkan command execution with D3D presentation.
-        m_extensions.emplace_back(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME);
-        //m_extensions.emplace_back(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME);
+            // Interop swap chain requires external memory access.
+            m_extensions.emplace_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+            m_extensions.emplace_back(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
+            m_extensions.emplace_back(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
+
+            // Required to synchronize Vulkan command execution with D3D presentation.
+            m_extensions.emplace_back(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME);
+            //m_extensions.emplace_back(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME);
 #else // defined(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN) && defined(LITEFX_BUILD_DIRECTX_12_BACKEND)
-        m_extensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+            m_extensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 #endif // defined(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN) && defined(LITEFX_BUILD_DIRECTX_12_BACKEND)
+        }
 
         auto availableExtensions = m_adapter->getAvailableDeviceExtensions();
 
@@ -256,6 +261,16 @@ public:
                 return { i++, familyProperty.queueCount, type };
             }) | std::ranges::to<std::vector>();
 
+        // Compute-only devices only create queues from families that support compute or transfer workloads. If there are dedicated compute families, graphics families 
+        // are skipped entirely, so that no graphics queues are allocated.
+        if (m_surface == nullptr)
+        {
+            std::erase_if(families, [](const auto& family) { return !LITEFX_FLAG_IS_SET(std::get<2>(family), QueueType::Compute) && !LITEFX_FLAG_IS_SET(std::get<2>(family), QueueType::Transfer); });
+
+            if (std::ranges::any_of(families, [](const auto& family) { return LITEFX_FLAG_IS_SET(std::get<2>(family), QueueType::Compute) && !LITEFX_FLAG_IS_SET(std::get<2>(family), QueueType::Graphics); }))
+                std::erase_if(families, [](const auto& family) { return LITEFX_FLAG_IS_SET(std::get<2>(family), QueueType::Graphics); });
+        }
+
         // Sort by flag popcount, so that the most specialized queues are always first.
         std::ranges::sort(families, std::less<>{}, [](const auto& family) -> int { return std::popcount(std::to_underlying(std::get<2>(family))); });
 
@@ -423,6 +438,11 @@ public:
         pDeviceFeatures->features.shaderInt64 = true;
         pDeviceFeatures->features.shaderInt16 = true;
 
+        // Enable pipeline statistics queries, if they are supported (used by `VulkanProfiler`).
+        VkPhysicalDeviceFeatures supportedFeatures{};
+        ::vkGetPhysicalDeviceFeatures(m_adapter->handle(), &supportedFeatures);
+        pDeviceFeatures->features.pipelineStatisticsQuery = supportedFeatures.pipelineStatisticsQuery;
+
         VkPhysicalDeviceVulkan13Features deviceFeatures13{ .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES, .pNext = deviceExtensionObjects };
         auto pDeviceFeatures13 = findExtension<VkPhysicalDeviceVulkan13Features>(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES, deviceExtensionObjects);
 
@@ -627,6 +647,24 @@ public:
 
     void initializeDefaultQueues(const VulkanDevice& device)
     {
+        // Compute-only devices do not have a graphics queue and fall back to the compute queue for transfers.
+        if (m_surface == nullptr)
+        {
+            m_computeQueue = this->createQueue(device, QueueType::Compute, QueuePriority::Realtime);
+            m_transferQueue = this->createQueue(device, QueueType::Transfer, QueuePriority::Realtime);
+
+            if (m_computeQueue == nullptr)
+                throw RuntimeException("Unable to find a compute queue for the compute-only device.");
+
+            if (m_transferQueue == nullptr)
+            {
+                LITEFX_INFO(VULKAN_LOG, "Unable to find dedicated transfer queue for device-device transfer. Using default compute queue instead.");
+                m_transferQueue = m_computeQueue;
+            }
+
+            return;
+        }
+
         // Initialize default queues.
         m_graphicsQueue = this->createQueue(device, QueueType::Graphics, QueuePriority::Realtime, std::as_const(*m_surface).handle());
         m_transferQueue = this->createQueue(device, QueueType::Transfer, QueuePriority::Realtime);
@@ -699,10 +737,10 @@ public:
 // Interface.
 // ------------------------------------------------------------------------------------------------
 
-VulkanDevice::VulkanDevice(const VulkanBackend& /*backend*/, const VulkanGraphicsAdapter& adapter, UniquePtr<VulkanSurface>&& surface, GraphicsDeviceFeatures features, Span<String> extensions, size_t globalDescriptorHeapSize) :
-    Resource<VkDevice>(nullptr), m_impl(adapter, std::move(surface), features, extensions, globalDescriptorHeapSize)
+VulkanDevice::VulkanDevice(const VulkanBackend& backend, const VulkanGraphicsAdapter& adapter, UniquePtr<VulkanSurface>&& surface, GraphicsDeviceFeatures features, Span<String> extensions, size_t globalDescriptorHeapSize) :
+    Resource<VkDevice>(nullptr), m_impl(backend, adapter, std::move(surface), features, extensions, globalDescriptorHeapSize)
 {
-    LITEFX_DEBUG(VULKAN_LOG, "Creating Vulkan device {{ Surface: {0}, Adapter: {1}, Extensions: {2} }}...", static_cast<void*>(m_impl->m_surface.get()), adapter.deviceId(), Join(this->enabledExtensions(), ", "));
+    LITEFX_DEBUG(VULKAN_LOG, "Creating Vulkan device {{ Surface: {0}, Adapter: {1}, Extensions: {2}, Compute-Only: {3} }}...", static_cast<void*>(m_impl->m_surface.get()), adapter.deviceId(), Join(this->enabledExtensions(), ", "), this->computeOnly());
     LITEFX_DEBUG(VULKAN_LOG, "--------------------------------------------------------------------------");
     LITEFX_DEBUG(VULKAN_LOG, "Vendor: {0:#0x}", adapter.vendorId());
     LITEFX_DEBUG(VULKAN_LOG, "Driver Version: {0:#0x}", adapter.driverVersion());
@@ -753,6 +791,32 @@ Span<const String> VulkanDevice::enabledExtensions() const noexcept
     return m_impl->m_extensions;
 }
 
+TaskScheduler& VulkanDevice::scheduler() const noexcept
+{
+    return *m_impl->m_scheduler;
+}
+
+Instrumentation& VulkanDevice::instrumentation() const noexcept
+{
+    return *m_impl->m_instrumentation;
+}
+
+const VkInstance& VulkanDevice::instance() const noexcept
+{
+    return m_impl->m_instance;
+}
+
+bool VulkanDevice::computeOnly() const noexcept
+{
+    return m_impl->m_surface == nullptr;
+}
+
+Enumerable<const VulkanQueue&> VulkanDevice::queues() const
+{
+    return m_impl->m_families | std::views::transform([](const auto& family) -> const Array<SharedPtr<VulkanQueue>>& { return family.queues(); }) | std::views::join |
+        std::views::transform([](const auto& queue) -> const VulkanQueue& { return *queue; });
+}
+
 void VulkanDevice::setDebugName([[maybe_unused]] VkDebugReportObjectTypeEXT type, [[maybe_unused]] UInt64 handle, [[maybe_unused]] StringView name) const
 {
 #ifndef NDEBUG
@@ -823,6 +887,7 @@ UInt32 VulkanDevice::descriptorSize(DescriptorType type) const
 
 VirtualAllocator::Allocation VulkanDevice::allocateGlobalDescriptors(const VulkanDescriptorSet& descriptorSet, DescriptorHeapType /*heapType*/) const
 {
+    LITEFX_PROFILE_ZONE(*m_impl->m_instrumentation, "VulkanDevice::allocateGlobalDescriptors");
     std::lock_guard<std::mutex> lock(m_impl->m_bufferBindMutex);
     return m_impl->m_globalDescriptorHeapAllocator.allocate(
         static_cast<UInt64>(descriptorSet.descriptorBuffer().size()), 
@@ -954,8 +1019,11 @@ const VulkanSwapChain& VulkanDevice::swapChain() const noexcept
     return *m_impl->m_swapChain;
 }
 
-const VulkanSurface& VulkanDevice::surface() const noexcept
+const VulkanSurface& VulkanDevice::surface() const
 {
+    if (m_impl->m_surface == nullptr) [[unlikely]]
+        throw RuntimeException("A compute-only device does not have a surface.");
+
     return *m_impl->m_surface;
 }
 
@@ -973,7 +1041,12 @@ const VulkanQueue& VulkanDevice::defaultQueue(QueueType type) const
 {
     // If the type contains the graphics flag, always return the graphics queue.
     if (LITEFX_FLAG_IS_SET(type, QueueType::Graphics))
+    {
+        if (m_impl->m_graphicsQueue == nullptr) [[unlikely]]
+            throw RuntimeException("A compute-only device does not provide a graphics queue.");
+
         return *m_impl->m_graphicsQueue;
+    }
     else if (LITEFX_FLAG_IS_SET(type, QueueType::Compute))
         return *m_impl->m_computeQueue;
     else if (LITEFX_FLAG_IS_SET(type, QueueType::Transfer))
@@ -1074,15 +1147,12 @@ void VulkanDevice::computeAccelerationStructureSizes(const VulkanBottomLevelAcce
 
 void VulkanDevice::computeAccelerationStructureSizes(const VulkanTopLevelAccelerationStructure& tlas, UInt64& bufferSize, UInt64& scratchSize, bool forUpdate) const
 {
-    auto instances = tlas.buildInfo();
-    auto instanceCount = static_cast<UInt32>(instances.size());
+    // Device builds only depend on the number of instances, so there is no need to convert the instances here.
+    auto instanceCount = static_cast<UInt32>(tlas.instances().size());
 
     VkAccelerationStructureGeometryInstancesDataKHR instanceInfo = {
         .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
-        .arrayOfPointers = false,
-        .data = {
-            .hostAddress = instances.data()
-        }
+        .arrayOfPointers = false
     };
 
     VkAccelerationStructureGeometryKHR geometryInfo = {
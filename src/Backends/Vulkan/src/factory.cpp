@@ -28,8 +28,36 @@ private:
 	SharedPtr<VulkanCommandBuffer> m_defragmentationCommandBuffer{ nullptr };
 	Queue<DefragResource> m_destroyedResources{};
 	UInt64 m_defragmentationFence{ 0u };
+	bool m_defragmentationPassActive{ false };
+	Array<std::pair<const VulkanQueue*, UInt64>> m_defragmentationQueueFences{};
 	Array<UInt32> m_queueIds;
 
+	// Background defragmentation state.
+	Optional<BackgroundDefragmentationSettings> m_backgroundDefragmentation{ std::nullopt };
+	std::chrono::nanoseconds m_backgroundDefragmentationDebt{ 0 };
+	UInt32 m_backgroundDefragmentationCooldown{ 0u };
+	bool m_backgroundDefragmentationPaused{ false };
+
+	// Memory budget state.
+	struct HeapBudgetState {
+		MemoryBudgetThresholds thresholds{};
+		MemoryBudgetLevel level{ MemoryBudgetLevel::Normal };
+	};
+
+	struct EvictionHandler {
+		UInt64 token;
+		UInt32 priority;
+		eviction_handler_type handler;
+	};
+
+	Array<HeapBudgetState> m_heapStates;
+	Array<EvictionHandler> m_evictionHandlers;
+	UInt64 m_nextEvictionToken{ 1u };
+	mutable std::mutex m_evictionMutex;
+
+	// `true`, if the device exposes a memory type for lazily allocated memory, that can back transient attachments.
+	bool m_supportsLazyAllocation{ false };
+
 public:
 	VulkanGraphicsFactoryImpl(const VulkanDevice& device) :
 		m_device(device.weak_from_this()), m_queueIds(device.queueFamilyIndices() | std::ranges::to<std::vector>())
@@ -51,13 +79,22 @@ public:
 		// Create an buffer allocator.
 		VmaAllocatorCreateInfo allocatorInfo = {};
 		allocatorInfo.physicalDevice = device.adapter().handle();
-		allocatorInfo.instance = device.surface().instance();
+		allocatorInfo.instance = device.instance();
 		allocatorInfo.device = device.handle();
 		allocatorInfo.flags = createFlags;
 		allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_4;
 
 		raiseIfFailed(::vmaCreateAllocator(&allocatorInfo, &m_allocator), "Unable to create Vulkan memory allocator.");
 
+		// Initialize the budget state of each memory heap.
+		std::array<const VkPhysicalDeviceMemoryProperties*, 1> memProps{};
+		::vmaGetMemoryProperties(m_allocator, memProps.data());
+		m_heapStates.resize(memProps[0]->memoryHeapCount); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+		// Check if there is a memory type for lazily allocated memory (typically only available on tile-based GPUs).
+		auto memoryTypes = std::span(memProps[0]->memoryTypes).first(memProps[0]->memoryTypeCount); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		m_supportsLazyAllocation = std::ranges::any_of(memoryTypes, [](const VkMemoryType& type) { return (type.propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0; });
+
 		// Listen to swap chain buffer swap events, in order to call `vmaSetCurrentFrameIndex`.
 		device.swapChain().swapped += std::bind(&VulkanGraphicsFactory::VulkanGraphicsFactoryImpl::onBackBufferSwap, this, std::placeholders::_1, std::placeholders::_2);
 	}
@@ -68,6 +105,9 @@ public:
 	VulkanGraphicsFactoryImpl& operator=(const VulkanGraphicsFactoryImpl&) = delete;
 
 	~VulkanGraphicsFactoryImpl() {
+		if (m_defragmentationContext != nullptr)
+			::vmaEndDefragmentation(m_allocator, m_defragmentationContext, nullptr);
+
 		if (m_allocator != nullptr)
 			::vmaDestroyAllocator(m_allocator);
 	}
@@ -235,9 +275,20 @@ public:
 			.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
 		};
 
-		// Properly setup usage flags.
+		// Transient attachments must not be sampled, written or copied. They are created as input attachments instead, so that they can still be transitioned into the 
+		// shader resource layout in between render passes.
+		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Transient))
+			imageDescription.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+
+		// Properly setup usage flags. Storage images with sRGB formats are written through views with the linear format, so they need to be mutable.
 		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AllowWrite))
+		{
 			imageDescription.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+
+			if (Vk::isSRGB(imageInfo.Format))
+				imageDescription.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT | VK_IMAGE_CREATE_EXTENDED_USAGE_BIT;
+		}
+
 		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferSource))
 			imageDescription.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferDestination))
@@ -341,6 +392,12 @@ public:
 		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput)) [[unlikely]]
 			throw InvalidArgumentException("usage", "Invalid resource usage has been specified: image resources cannot be used as build inputs for other acceleration structures.");
 
+		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Transient) && !LITEFX_FLAG_IS_SET(usage, ResourceUsage::RenderTarget)) [[unlikely]]
+			throw InvalidArgumentException("usage", "Invalid resource usage has been specified: transient images must be render targets.");
+
+		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Transient) && (usage & (ResourceUsage::AllowWrite | ResourceUsage::TransferSource | ResourceUsage::TransferDestination)) != ResourceUsage::None) [[unlikely]]
+			throw InvalidArgumentException("usage", "Invalid resource usage has been specified: transient images cannot be written to or copied from or into.");
+
 		// Validate dimensions.
 		constexpr UInt32 CUBE_SIDES = 6u;
 
@@ -354,156 +411,415 @@ public:
 		auto imageDescription = getCreateInfo(imageInfo, usage);
 		auto allocationDescription = getAllocationCreateInfo(ResourceHeap::Resource, allocationBehavior);
 
+		// Back transient attachments with lazily allocated memory, if available. Otherwise they are allocated from regular device memory.
+		if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Transient) && m_supportsLazyAllocation)
+			allocationDescription.usage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+
 		// Create the image and return.
 		VmaAllocationInfo allocationResult{};
 		return allocator(std::forward<TArgs>(args)..., name, imageInfo.Size, imageInfo.Format, imageInfo.Dimensions, imageInfo.Levels, imageInfo.Layers, imageInfo.Samples, usage, m_allocator, imageDescription, allocationDescription, &allocationResult);
 	}
-};
 
-// ------------------------------------------------------------------------------------------------
-// Interface.
-// ------------------------------------------------------------------------------------------------
+public:
+	void beginDefragmentation(const ICommandQueue& queue, DefragmentationStrategy strategy, UInt64 maxBytesToMove, UInt32 maxAllocationsToMove)
+	{
+		// Initialize a defragmentation context.
+		VmaDefragmentationInfo defragDesc = {
+			.maxBytesPerPass = maxBytesToMove,
+			.maxAllocationsPerPass = maxAllocationsToMove
+		};
 
-VulkanGraphicsFactory::VulkanGraphicsFactory(const VulkanDevice& device) :
-	m_impl(device)
-{
-}
+		switch (strategy)
+		{
+		case DefragmentationStrategy::Fast:
+			defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_FAST_BIT;
+			break;
+		case DefragmentationStrategy::Balanced:
+			defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+			break;
+		case DefragmentationStrategy::Full:
+			defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_FULL_BIT;
+			break;
+		}
 
-VulkanGraphicsFactory::~VulkanGraphicsFactory() noexcept = default;
+		auto result = ::vmaBeginDefragmentation(m_allocator, &defragDesc, &m_defragmentationContext);
 
-VirtualAllocator VulkanGraphicsFactory::createAllocator(UInt64 overallMemory, AllocationAlgorithm algorithm) const
-{
-	return VirtualAllocator::create<VulkanBackend>(overallMemory, algorithm);
-}
+		if (result != VK_SUCCESS)
+			throw VulkanPlatformException(result, "Unable to start defragmentation process.");
 
-void VulkanGraphicsFactory::beginDefragmentation(const ICommandQueue& queue, DefragmentationStrategy strategy, UInt64 maxBytesToMove, UInt32 maxAllocationsToMove) const
-{
-	if (m_impl->m_defragmentationContext) [[unlikely]]
-		throw RuntimeException("Another defragmentation process has been previously started and has not yet finished.");
+		// Allocate a command buffer to record the transfer commands to.
+		m_defragmentationCommandBuffer = std::dynamic_pointer_cast<VulkanCommandBuffer>(queue.createCommandBuffer(false));
+	}
 
-	// Initialize a defragmentation context.
-	VmaDefragmentationInfo defragDesc = {
-		.maxBytesPerPass = maxBytesToMove,
-		.maxAllocationsPerPass = maxAllocationsToMove
-	};
+	UInt64 beginDefragmentationPass(const VulkanGraphicsFactory& parent)
+	{
+		auto& pass = m_defragmentationPass;
+
+		auto result = ::vmaBeginDefragmentationPass(m_allocator, m_defragmentationContext, &pass);
+
+		if (result == VK_SUCCESS)
+			return 0u;
+		else if (result != VK_INCOMPLETE) [[unlikely]]
+			throw VulkanPlatformException(result, "Unable to begin new defragmentation pass.");
 
-	switch (strategy)
+		// Begin recording a command buffer for defragmentation.
+		Array<IDeviceMemory*> resources;
+		auto& commandBuffer = *m_defragmentationCommandBuffer;
+		commandBuffer.begin();
+
+		// Prepare the move operation on each resource, i.e., create a barrier to allow then to synchronize the move with their current usage.
+		VulkanBarrier barrier(PipelineStage::All, PipelineStage::Transfer);
+		IDeviceMemory::PrepareMoveEventArgs eventArgs(barrier);
+
+		for (UInt32 i{ 0u }; i < pass.moveCount; ++i)
+		{
+			// Get the source allocation.
+			auto sourceAllocation = pass.pMoves[i].srcAllocation;    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+			// Acquire the underlying resource device memory instance.
+			VmaAllocationInfo allocationInfo{};
+			::vmaGetAllocationInfo(m_allocator, sourceAllocation, &allocationInfo);
+			auto deviceMemory = static_cast<IDeviceMemory*>(allocationInfo.pUserData);
+
+			// Skip resources that cannot be moved. Acceleration structures stay bound to the buffer they have been created on and mapped memory is referenced by
+			// host pointers. 
+			// TODO: Moving render targets is currently unsupported, as it introduces way to many unpredictable synchronization issues. We should improve this in the 
+			//       future. As an alternative, we could create render targets from a separate pool.
+			auto buffer = dynamic_cast<VulkanBuffer*>(deviceMemory);
+			auto image = dynamic_cast<VulkanImage*>(deviceMemory);
+
+			if (allocationInfo.pMappedData != nullptr || (buffer != nullptr && buffer->type() == BufferType::AccelerationStructure) || 
+				(image != nullptr && LITEFX_FLAG_IS_SET(image->usage(), ResourceUsage::RenderTarget)))
+			{
+				pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				continue;
+			}
+
+			// Invoke the `prepareMove` event.
+			deviceMemory->prepareMove(&parent, eventArgs);
+		}
+
+		// Issue a barrier to transition the resources that requested it.
+		commandBuffer.barrier(barrier);
+
+		// Perform the actual move operations.
+		for (UInt32 i{ 0u }; i < pass.moveCount; ++i)
+		{
+			if (pass.pMoves[i].operation != VMA_DEFRAGMENTATION_MOVE_OPERATION_COPY) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				continue;
+
+			// Get the source allocation.
+			auto sourceAllocation = pass.pMoves[i].srcAllocation;    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			auto targetAllocation = pass.pMoves[i].dstTmpAllocation; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+			VmaAllocationInfo allocationInfo{};
+			::vmaGetAllocationInfo(m_allocator, sourceAllocation, &allocationInfo);
+
+			// Acquire the underlying resource device memory instance and add it to the list of moved-from resources.
+			auto deviceMemory = static_cast<IDeviceMemory*>(allocationInfo.pUserData);
+			resources.emplace_back(deviceMemory);
+
+			// Figure out the resource type.
+			if (auto buffer = dynamic_cast<VulkanBuffer*>(deviceMemory); buffer != nullptr)
+			{
+				auto oldHandle = std::as_const(*buffer).handle();
+
+				if (VulkanBuffer::move(buffer->shared_from_this(), targetAllocation, commandBuffer))
+					m_destroyedResources.emplace([oldHandle](VkDevice device) { ::vkDestroyBuffer(device, oldHandle, nullptr); }, buffer->shared_from_this());
+				else
+					pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+			else if (auto image = dynamic_cast<VulkanImage*>(deviceMemory); image != nullptr)
+			{
+				auto oldHandle = std::as_const(*image).handle();
+
+				if (VulkanImage::move(image->shared_from_this(), targetAllocation, commandBuffer))
+					m_destroyedResources.emplace([oldHandle](VkDevice device) { ::vkDestroyImage(device, oldHandle, nullptr); }, image->shared_from_this());
+				else
+					pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+		}
+
+		// Submit de command buffer and store the fence.
+		auto fence = m_defragmentationFence = commandBuffer.submit();
+		m_defragmentationPassActive = true;
+
+		// Invoke the `moving` event.
+		for (auto resource : resources)
+			resource->moving(&parent, { commandBuffer.queue(), fence });
+
+		// Return the current fence value.
+		return fence;
+	}
+
+	bool defragmentationPassCompleted(const VulkanDevice& device)
 	{
-	case DefragmentationStrategy::Fast:
-		defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_FAST_BIT;
-		break;
-	case DefragmentationStrategy::Balanced:
-		defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
-		break;
-	case DefragmentationStrategy::Full:
-		defragDesc.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_FULL_BIT;
-		break;
+		if (m_defragmentationCommandBuffer->queue()->lastCompletedFence() < m_defragmentationFence)
+			return false;
+
+		// Other queues may still execute work that accesses the moved-from resources. Record the current fence of each queue once the transfer has been executed and 
+		// only release the resources and their memory after all of them have completed.
+		if (m_defragmentationQueueFences.empty())
+			m_defragmentationQueueFences = device.queues() | std::views::transform([](const VulkanQueue& queue) { return std::make_pair(&queue, queue.currentFence()); }) | std::ranges::to<Array<std::pair<const VulkanQueue*, UInt64>>>();
+
+		return std::ranges::all_of(m_defragmentationQueueFences, [](const auto& queueFence) { return queueFence.first->lastCompletedFence() >= queueFence.second; });
 	}
 
-	auto result = ::vmaBeginDefragmentation(m_impl->m_allocator, &defragDesc, &m_impl->m_defragmentationContext);
+	void waitForDefragmentationPass(const VulkanDevice& device)
+	{
+		m_defragmentationCommandBuffer->queue()->waitFor(m_defragmentationFence);
 
-	if (result != VK_SUCCESS)
-		throw VulkanPlatformException(result, "Unable to start defragmentation process.");
+		if (!this->defragmentationPassCompleted(device))
+			std::ranges::for_each(m_defragmentationQueueFences, [](const auto& queueFence) { queueFence.first->waitFor(queueFence.second); });
+	}
 
-	// Allocate a command buffer to record the transfer commands to.
-	m_impl->m_defragmentationCommandBuffer = std::dynamic_pointer_cast<VulkanCommandBuffer>(queue.createCommandBuffer(false));
-}
+	bool endDefragmentationPass(const VulkanGraphicsFactory& parent, const VulkanDevice& device)
+	{
+		auto result = ::vmaEndDefragmentationPass(m_allocator, m_defragmentationContext, &m_defragmentationPass);
+		m_defragmentationPassActive = false;
+		m_defragmentationQueueFences.clear();
 
-UInt64 VulkanGraphicsFactory::beginDefragmentationPass() const
-{
-	if (!m_impl->m_defragmentationContext) [[unlikely]]
-		throw RuntimeException("There is currently no active defragmentation process.");
+		if (result != VK_SUCCESS && result != VK_INCOMPLETE) [[unlikely]]
+			throw VulkanPlatformException(result, "Unable to end defragmentation pass.");
 
-	auto& pass = m_impl->m_defragmentationPass;
+		while (!m_destroyedResources.empty())
+		{
+			// Get the resource to remove.
+			auto& resource = m_destroyedResources.front();
 
-	auto result = ::vmaBeginDefragmentationPass(m_impl->m_allocator, m_impl->m_defragmentationContext, &pass);
+			// Invoke the `moved` event.
+			resource.resource->moved(&parent, {});
 
-	if (result == VK_SUCCESS)
-		return 0u;
-	else if (result != VK_INCOMPLETE) [[unlikely]]
-		throw VulkanPlatformException(result, "Unable to begin new defragmentation pass.");
+			// Destroy the old resource.
+			resource.deleter(device.handle());
 
-	// Begin recording a command buffer for defragmentation.
-	Array<IDeviceMemory*> resources;
-	auto& commandBuffer = *m_impl->m_defragmentationCommandBuffer;
-	commandBuffer.begin();
+			// Erase the allocation from the queue.
+			m_destroyedResources.pop();
+		}
 
-	// Prepare the move operation on each resource, i.e., create a barrier to allow then to synchronize the move with their current usage.
-	VulkanBarrier barrier(PipelineStage::All, PipelineStage::Transfer);
-	IDeviceMemory::PrepareMoveEventArgs eventArgs(barrier);
+		if (result == VK_SUCCESS)
+		{
+			this->endDefragmentation();
+			return true;
+		}
+		else // if (result == VK_INCOMPLETE)
+		{
+			return false;
+		}
+	}
+
+	void endDefragmentation()
+	{
+		::vmaEndDefragmentation(m_allocator, m_defragmentationContext, nullptr);
+		m_defragmentationContext = nullptr;
+	}
 
-	for (UInt32 i{ 0u }; i < pass.moveCount; ++i)
+	Array<VmaBudget> heapBudgets() const
 	{
-		// Get the source allocation.
-		auto sourceAllocation = pass.pMoves[i].srcAllocation;    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		std::array<const VkPhysicalDeviceMemoryProperties*, 1> memProps{};
+		::vmaGetMemoryProperties(m_allocator, memProps.data());
 
-		// Acquire the underlying resource device memory instance.
-		VmaAllocationInfo allocationInfo{};
-		::vmaGetAllocationInfo(m_impl->m_allocator, sourceAllocation, &allocationInfo);
+		Array<VmaBudget> budgets(memProps[0]->memoryHeapCount); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		::vmaGetHeapBudgets(m_allocator, budgets.data());
 
-		// Invoke the `prepareMove` event.
-		static_cast<IDeviceMemory*>(allocationInfo.pUserData)->prepareMove(this, eventArgs);
+		return budgets;
 	}
 
-	// Issue a barrier to transition the resources that requested it.
-	commandBuffer.barrier(barrier);
-
-	// Perform the actual move operations.
-	for (UInt32 i{ 0u }; i < pass.moveCount; ++i)
+	void updateBackgroundDefragmentation(const VulkanGraphicsFactory& parent, const VulkanDevice& device)
 	{
-		// Get the source allocation.
-		auto sourceAllocation = pass.pMoves[i].srcAllocation;    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-		auto targetAllocation = pass.pMoves[i].dstTmpAllocation; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		using clock_type = std::chrono::steady_clock;
 
-		VmaAllocationInfo allocationInfo{};
-		::vmaGetAllocationInfo(m_impl->m_allocator, sourceAllocation, &allocationInfo);
+		const auto& settings = m_backgroundDefragmentation.value();
+		auto budget = std::chrono::duration_cast<std::chrono::nanoseconds>(settings.MaxTimePerFrame);
+
+		// Skip frames until the time previous frames spent over budget has been paid back.
+		if (m_backgroundDefragmentationDebt > std::chrono::nanoseconds::zero())
+		{
+			m_backgroundDefragmentationDebt = std::max(m_backgroundDefragmentationDebt - budget, std::chrono::nanoseconds::zero());
+			return;
+		}
 
-		// Acquire the underlying resource device memory instance and add it to the list of moved-from resources.
-		auto deviceMemory = static_cast<IDeviceMemory*>(allocationInfo.pUserData);
-		resources.emplace_back(deviceMemory);
+		auto start = clock_type::now();
 
-		// Figure out the resource type.
-		if (auto buffer = dynamic_cast<VulkanBuffer*>(deviceMemory); buffer != nullptr)
+		// Finish the pass of a previous frame, but only if it has been executed and all queues are done with the moved-from resources, so that the frame never waits 
+		// for the GPU.
+		if (m_defragmentationPassActive)
 		{
-			auto oldHandle = std::as_const(*buffer).handle();
+			if (!this->defragmentationPassCompleted(device))
+				return;
 
-			if (VulkanBuffer::move(buffer->shared_from_this(), targetAllocation, commandBuffer))
-				m_impl->m_destroyedResources.emplace([oldHandle](VkDevice device) { ::vkDestroyBuffer(device, oldHandle, nullptr); }, buffer->shared_from_this());
-			else
-				pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			if (this->endDefragmentationPass(parent, device))
+				m_backgroundDefragmentationCooldown = settings.Cooldown;
 		}
-		else if (auto image = dynamic_cast<VulkanImage*>(deviceMemory); image != nullptr)
+
+		// Pause under memory pressure, as each pass allocates the destination memory of the moved resources before releasing their source memory.
+		auto budgets = this->heapBudgets();
+		m_backgroundDefragmentationPaused = std::ranges::any_of(budgets, [&settings](const VmaBudget& heapBudget) {
+			return heapBudget.budget > 0 && static_cast<Float>(heapBudget.usage) > settings.MemoryPressureThreshold * static_cast<Float>(heapBudget.budget);
+		});
+
+		if (!m_backgroundDefragmentationPaused)
 		{
-			// TODO: Moving render targets is currently unsupported, as it introduces way to many unpredictable synchronization issues. We should 
-			//       improve this in the future. As an alternative, we could create render targets from a separate pool.
-			if (LITEFX_FLAG_IS_SET(image->usage(), ResourceUsage::RenderTarget))
-				pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-			else
+			if (m_defragmentationContext == nullptr && m_backgroundDefragmentationCooldown > 0u)
+				--m_backgroundDefragmentationCooldown;
+			else if (m_defragmentationContext == nullptr)
 			{
-				auto oldHandle = std::as_const(*image).handle();
+				// Only start a new process, if enough memory within the allocated blocks is unused.
+				auto blockBytes = std::ranges::fold_left(budgets, 0ull, [](UInt64 bytes, const VmaBudget& heapBudget) { return bytes + heapBudget.statistics.blockBytes; });
+				auto allocationBytes = std::ranges::fold_left(budgets, 0ull, [](UInt64 bytes, const VmaBudget& heapBudget) { return bytes + heapBudget.statistics.allocationBytes; });
 
-				if (VulkanImage::move(image->shared_from_this(), targetAllocation, commandBuffer))
-					m_impl->m_destroyedResources.emplace([oldHandle](VkDevice device) { ::vkDestroyImage(device, oldHandle, nullptr); }, image->shared_from_this());
+				if (blockBytes > 0 && static_cast<Float>(blockBytes - allocationBytes) > settings.FragmentationThreshold * static_cast<Float>(blockBytes))
+					this->beginDefragmentation(device.defaultQueue(QueueType::Transfer), settings.Strategy, settings.MaxBytesPerFrame, settings.MaxAllocationsPerFrame);
 				else
-					pass.pMoves[i].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					m_backgroundDefragmentationCooldown = settings.Cooldown;
+			}
+
+			// Record the pass of this frame. If there is nothing left to move, the process is finished immediately.
+			if (m_defragmentationContext != nullptr && this->beginDefragmentationPass(parent) == 0u)
+			{
+				this->endDefragmentation();
+				m_backgroundDefragmentationCooldown = settings.Cooldown;
+			}
+		}
+
+		// Remember the time spent over budget.
+		m_backgroundDefragmentationDebt = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start) - budget, std::chrono::nanoseconds::zero());
+	}
+
+	void disableBackgroundDefragmentation(const VulkanGraphicsFactory& parent, const VulkanDevice& device)
+	{
+		// Wait for the pass that is currently executed and release the moved-from resources.
+		if (m_defragmentationPassActive)
+		{
+			this->waitForDefragmentationPass(device);
+			this->endDefragmentationPass(parent, device);
+		}
+
+		if (m_defragmentationContext != nullptr)
+			this->endDefragmentation();
+
+		m_backgroundDefragmentation = std::nullopt;
+		m_backgroundDefragmentationDebt = std::chrono::nanoseconds::zero();
+		m_backgroundDefragmentationCooldown = 0u;
+		m_backgroundDefragmentationPaused = false;
+	}
+
+	UInt64 evict(UInt32 heap, UInt64 bytes) const
+	{
+		// Copy the handlers, so that they can (un-)register handlers themselves.
+		Array<EvictionHandler> handlers;
+
+		{
+			std::lock_guard<std::mutex> lock(m_evictionMutex);
+			handlers = m_evictionHandlers;
+		}
+
+		UInt64 released{ 0u };
+
+		for (const auto& handler : handlers)
+		{
+			if (released >= bytes)
+				break;
+
+			released += handler.handler(heap, bytes - released);
+		}
+
+		return released;
+	}
+
+	template <typename TResourceInfo>
+	bool evictDeviceMemory(const TResourceInfo& resourceInfo, ResourceUsage usage) const
+	{
+		auto device = m_device.lock();
+
+		if (device == nullptr) [[unlikely]]
+			return false;
+
+		// Release the size of the requested resource from each device-local heap, as the heap it will be allocated from is not known in advance.
+		auto requirements = this->getMemoryRequirements(*device, resourceInfo, usage);
+
+		std::array<const VkPhysicalDeviceMemoryProperties*, 1> memProps{};
+		::vmaGetMemoryProperties(m_allocator, memProps.data());
+		auto heaps = Span{ memProps[0]->memoryHeaps, memProps[0]->memoryHeapCount }; // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		bool released{ false };
+
+		for (UInt32 heap{ 0u }; heap < heaps.size(); ++heap)
+			if ((heaps[heap].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) == VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+				released = this->evict(heap, requirements.size) > 0u || released;
+
+		return released;
+	}
+
+	void updateMemoryBudget(const VulkanGraphicsFactory& parent)
+	{
+		auto budgets = this->heapBudgets();
+
+		for (UInt32 heap{ 0u }; heap < budgets.size() && heap < m_heapStates.size(); ++heap)
+		{
+			const auto& budget = budgets[heap];
+			auto& state = m_heapStates[heap];
+
+			auto usage = static_cast<Float>(budget.usage);
+			auto softLimit = state.thresholds.Soft * static_cast<Float>(budget.budget);
+			auto level = usage > state.thresholds.Hard * static_cast<Float>(budget.budget) ? MemoryBudgetLevel::Hard :
+				usage > softLimit ? MemoryBudgetLevel::Soft : MemoryBudgetLevel::Normal;
+
+			if (level != state.level)
+			{
+				auto previousLevel = std::exchange(state.level, level);
+				parent.memoryBudgetChanged(&parent, { heap, previousLevel, level, budget.usage, budget.budget });
 			}
+
+			// Ask the eviction handlers to get the heap back below its soft threshold.
+			if (level != MemoryBudgetLevel::Normal)
+				this->evict(heap, static_cast<UInt64>(usage - softLimit));
 		}
 	}
+};
 
-	// Submit de command buffer and store the fence.
-	auto fence = m_impl->m_defragmentationFence = commandBuffer.submit();
+// ------------------------------------------------------------------------------------------------
+// Interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanGraphicsFactory::VulkanGraphicsFactory(const VulkanDevice& device) :
+	m_impl(device)
+{
+	// Track the memory budget and advance background defragmentation once per frame.
+	device.swapChain().swapped += [this](const void* /*sender*/, const ISwapChain::BackBufferSwapEventArgs& /*e*/) { 
+		this->updateMemoryBudget();
+		this->updateBackgroundDefragmentation(); 
+	};
+}
+
+VulkanGraphicsFactory::~VulkanGraphicsFactory() noexcept = default;
+
+VirtualAllocator VulkanGraphicsFactory::createAllocator(UInt64 overallMemory, AllocationAlgorithm algorithm) const
+{
+	return VirtualAllocator::create<VulkanBackend>(overallMemory, algorithm);
+}
 
-	// Invoke the `moving` event.
-	for (auto resource : resources)
-		resource->moving(this, { commandBuffer.queue(), fence });
+void VulkanGraphicsFactory::beginDefragmentation(const ICommandQueue& queue, DefragmentationStrategy strategy, UInt64 maxBytesToMove, UInt32 maxAllocationsToMove) const
+{
+	if (m_impl->m_backgroundDefragmentation.has_value()) [[unlikely]]
+		throw RuntimeException("Defragmentation is currently performed in the background. Disable background defragmentation before starting a manual defragmentation process.");
+
+	if (m_impl->m_defragmentationContext) [[unlikely]]
+		throw RuntimeException("Another defragmentation process has been previously started and has not yet finished.");
+
+	m_impl->beginDefragmentation(queue, strategy, maxBytesToMove, maxAllocationsToMove);
+}
+
+UInt64 VulkanGraphicsFactory::beginDefragmentationPass() const
+{
+	if (!m_impl->m_defragmentationContext || m_impl->m_backgroundDefragmentation.has_value()) [[unlikely]]
+		throw RuntimeException("There is currently no active defragmentation process.");
 
-	// Return the current fence value.
-	return fence;
+	return m_impl->beginDefragmentationPass(*this);
 }
 
 bool VulkanGraphicsFactory::endDefragmentationPass() const
 {
-	if (!m_impl->m_defragmentationContext) [[unlikely]]
+	if (!m_impl->m_defragmentationContext || m_impl->m_backgroundDefragmentation.has_value()) [[unlikely]]
 		throw RuntimeException("There is currently no active defragmentation process.");
 
 	auto device = m_impl->m_device.lock();
@@ -511,38 +827,110 @@ bool VulkanGraphicsFactory::endDefragmentationPass() const
 	if (device == nullptr)
 		throw RuntimeException("Unable to acquire instance from an already released device.");
 
-	m_impl->m_defragmentationCommandBuffer->queue()->waitFor(m_impl->m_defragmentationFence);
+	m_impl->waitForDefragmentationPass(*device);
 
-	auto result = ::vmaEndDefragmentationPass(m_impl->m_allocator, m_impl->m_defragmentationContext, &m_impl->m_defragmentationPass);
+	return m_impl->endDefragmentationPass(*this, *device);
+}
 
-	if (result != VK_SUCCESS && result != VK_INCOMPLETE) [[unlikely]]
-		throw VulkanPlatformException(result, "Unable to end defragmentation pass.");
+void VulkanGraphicsFactory::enableBackgroundDefragmentation(const BackgroundDefragmentationSettings& settings) const
+{
+	if (m_impl->m_defragmentationContext != nullptr && !m_impl->m_backgroundDefragmentation.has_value()) [[unlikely]]
+		throw RuntimeException("A manual defragmentation process has been previously started and has not yet finished.");
 
-	while (!m_impl->m_destroyedResources.empty())
-	{
-		// Get the resource to remove.
-		auto& resource = m_impl->m_destroyedResources.front();
+	// If background defragmentation is already running, the new budgets apply to the next process.
+	m_impl->m_backgroundDefragmentation = settings;
+}
 
-		// Invoke the `moved` event.
-		resource.resource->moved(this, {});
+void VulkanGraphicsFactory::disableBackgroundDefragmentation() const
+{
+	if (!m_impl->m_backgroundDefragmentation.has_value())
+		return;
 
-		// Destroy the old resource.
-		resource.deleter(device->handle());
+	auto device = m_impl->m_device.lock();
 
-		// Erase the allocation from the queue.
-		m_impl->m_destroyedResources.pop();
-	}
+	if (device == nullptr)
+		throw RuntimeException("Unable to acquire instance from an already released device.");
 
-	if (result == VK_SUCCESS)
-	{
-		vmaEndDefragmentation(m_impl->m_allocator, m_impl->m_defragmentationContext, nullptr);
-		m_impl->m_defragmentationContext = nullptr;
-		return true;
-	}
-	else // if (result == VK_INCOMPLETE)
-	{
-		return false;
-	}
+	m_impl->disableBackgroundDefragmentation(*this, *device);
+}
+
+bool VulkanGraphicsFactory::backgroundDefragmentationEnabled() const noexcept
+{
+	return m_impl->m_backgroundDefragmentation.has_value();
+}
+
+bool VulkanGraphicsFactory::backgroundDefragmentationPaused() const noexcept
+{
+	return m_impl->m_backgroundDefragmentationPaused;
+}
+
+void VulkanGraphicsFactory::updateBackgroundDefragmentation() const
+{
+	if (!m_impl->m_backgroundDefragmentation.has_value())
+		return;
+
+	auto device = m_impl->m_device.lock();
+
+	if (device == nullptr) [[unlikely]]
+		throw RuntimeException("Unable to acquire instance from an already released device.");
+
+	m_impl->updateBackgroundDefragmentation(*this, *device);
+}
+
+void VulkanGraphicsFactory::setMemoryBudgetThresholds(const MemoryBudgetThresholds& thresholds) const
+{
+	for (UInt32 heap{ 0u }; heap < m_impl->m_heapStates.size(); ++heap)
+		this->setMemoryBudgetThresholds(heap, thresholds);
+}
+
+void VulkanGraphicsFactory::setMemoryBudgetThresholds(UInt32 heap, const MemoryBudgetThresholds& thresholds) const
+{
+	if (heap >= m_impl->m_heapStates.size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("heap", std::make_pair(0_ui32, static_cast<UInt32>(m_impl->m_heapStates.size()) - 1), heap, "The device does not provide a memory heap with index {0}.", heap);
+
+	if (thresholds.Soft > thresholds.Hard) [[unlikely]]
+		throw InvalidArgumentException("thresholds", "The soft threshold must not exceed the hard threshold.");
+
+	m_impl->m_heapStates[heap].thresholds = thresholds;
+}
+
+VulkanGraphicsFactory::MemoryBudgetThresholds VulkanGraphicsFactory::memoryBudgetThresholds(UInt32 heap) const
+{
+	if (heap >= m_impl->m_heapStates.size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("heap", std::make_pair(0_ui32, static_cast<UInt32>(m_impl->m_heapStates.size()) - 1), heap, "The device does not provide a memory heap with index {0}.", heap);
+
+	return m_impl->m_heapStates[heap].thresholds;
+}
+
+VulkanGraphicsFactory::MemoryBudgetLevel VulkanGraphicsFactory::memoryBudgetLevel(UInt32 heap) const
+{
+	if (heap >= m_impl->m_heapStates.size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("heap", std::make_pair(0_ui32, static_cast<UInt32>(m_impl->m_heapStates.size()) - 1), heap, "The device does not provide a memory heap with index {0}.", heap);
+
+	return m_impl->m_heapStates[heap].level;
+}
+
+UInt64 VulkanGraphicsFactory::registerEvictionHandler(UInt32 priority, eviction_handler_type handler) const
+{
+	std::lock_guard<std::mutex> lock(m_impl->m_evictionMutex);
+	auto token = m_impl->m_nextEvictionToken++;
+
+	// Keep the handlers ordered by priority. Handlers with the same priority are invoked in the order they have been registered.
+	auto position = std::ranges::upper_bound(m_impl->m_evictionHandlers, priority, {}, &VulkanGraphicsFactoryImpl::EvictionHandler::priority);
+	m_impl->m_evictionHandlers.insert(position, { token, priority, std::move(handler) });
+
+	return token;
+}
+
+bool VulkanGraphicsFactory::unregisterEvictionHandler(UInt64 token) const
+{
+	std::lock_guard<std::mutex> lock(m_impl->m_evictionMutex);
+	return std::erase_if(m_impl->m_evictionHandlers, [token](const auto& handler) { return handler.token == token; }) > 0;
+}
+
+void VulkanGraphicsFactory::updateMemoryBudget() const
+{
+	m_impl->updateMemoryBudget(*this);
 }
 
 bool VulkanGraphicsFactory::supportsResizableBaseAddressRegister() const noexcept
@@ -988,9 +1376,13 @@ bool VulkanGraphicsFactory::tryCreateBuffer(SharedPtr<IVulkanBuffer>& buffer, co
 		.Heap = heap,
 	};
 
-#ifndef NDEBUG
 	auto result = m_impl->allocateBuffer(name, bufferInfo, usage, allocationBehavior, VulkanBuffer::tryAllocate, buffer);
 
+	// Give the eviction handlers a chance to release device memory, before reporting the allocation as failed.
+	if (!result && heap == ResourceHeap::Resource && m_impl->evictDeviceMemory(bufferInfo, usage))
+		result = m_impl->allocateBuffer(name, bufferInfo, usage, allocationBehavior, VulkanBuffer::tryAllocate, buffer);
+
+#ifndef NDEBUG
 	if (result && !name.empty())
 	{
 		auto device = m_impl->m_device.lock();
@@ -998,11 +1390,9 @@ bool VulkanGraphicsFactory::tryCreateBuffer(SharedPtr<IVulkanBuffer>& buffer, co
 		if (device != nullptr) [[likely]]
 			device->setDebugName(std::as_const(*buffer).handle(), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, name);
 	}
+#endif
 
 	return result;
-#else
-	return m_impl->allocateBuffer(name, bufferInfo, usage, allocationBehavior, VulkanBuffer::tryAllocate, buffer);
-#endif
 }
 
 bool VulkanGraphicsFactory::tryCreateVertexBuffer(SharedPtr<IVulkanVertexBuffer>& buffer, const VulkanVertexBufferLayout& layout, ResourceHeap heap, UInt32 elements, ResourceUsage usage, AllocationBehavior allocationBehavior) const
@@ -1085,9 +1475,13 @@ bool VulkanGraphicsFactory::tryCreateTexture(SharedPtr<IVulkanImage>& image, con
 		.Samples = samples
 	};
 
-#ifndef NDEBUG
 	auto result = m_impl->allocateImage(name, imageInfo, usage, allocationBehavior, VulkanImage::tryAllocate, image);
 
+	// Give the eviction handlers a chance to release device memory, before reporting the allocation as failed.
+	if (!result && m_impl->evictDeviceMemory(imageInfo, usage))
+		result = m_impl->allocateImage(name, imageInfo, usage, allocationBehavior, VulkanImage::tryAllocate, image);
+
+#ifndef NDEBUG
 	if (result && !name.empty())
 	{
 		auto device = m_impl->m_device.lock();
@@ -1095,11 +1489,9 @@ bool VulkanGraphicsFactory::tryCreateTexture(SharedPtr<IVulkanImage>& image, con
 		if (device != nullptr) [[likely]]
 			device->setDebugName(std::as_const(*image).handle(), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, name);
 	}
+#endif
 
 	return result;
-#else 
-	return m_impl->allocateImage(name, imageInfo, usage, allocationBehavior, VulkanImage::tryAllocate, image);
-#endif
 }
 
 Generator<SharedPtr<IVulkanImage>> VulkanGraphicsFactory::createTextures(Format format, const Size3d& size, ImageDimensions dimension, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage, AllocationBehavior allocationBehavior) const
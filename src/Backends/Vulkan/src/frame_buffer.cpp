@@ -15,12 +15,16 @@ private:
     Dictionary<SharedPtr<const IVulkanImage>, VkImageView> m_renderTargetHandles;
     Dictionary<UInt64, SharedPtr<const IVulkanImage>> m_mappedRenderTargets;
     WeakPtr<const VulkanDevice> m_device;
-	Size2d m_size;
+	Size2d m_size, m_allocatedSize;
     Optional<allocation_callback_type> m_allocationCallback;
+    FrameBufferResizePolicy m_resizePolicy{ FrameBufferResizePolicy::Exact };
+    UInt32 m_bucketSize{ DEFAULT_BUCKET_SIZE }, m_poolSize{ DEFAULT_POOL_SIZE };
+    Array<SharedPtr<const IVulkanImage>> m_imagePool;
+    ResizeStatistics m_resizeStatistics{ };
 
 public:
     VulkanFrameBufferImpl(const VulkanDevice& device, Size2d renderArea, Optional<allocation_callback_type> allocationCallback = std::nullopt) :
-        m_device(device.weak_from_this()), m_size(std::move(renderArea)), m_allocationCallback(std::move(allocationCallback))
+        m_device(device.weak_from_this()), m_size(renderArea), m_allocatedSize(std::move(renderArea)), m_allocationCallback(std::move(allocationCallback))
 	{
 	}
 
@@ -53,6 +57,36 @@ private:
         return device.factory().createTexture(name, format, size, ImageDimensions::DIM_2, 1u, 1u, samples, usage);
     }
 
+    inline Size2d allocationSize(const Size2d& renderArea) const noexcept {
+        if (!LITEFX_FLAG_IS_SET(m_resizePolicy, FrameBufferResizePolicy::OverAllocate))
+            return renderArea;
+
+        auto bucket = [this](size_t extent) { return std::max<size_t>((extent + m_bucketSize - 1) / m_bucketSize * m_bucketSize, m_bucketSize); };
+        Size2d bucketSize{ bucket(renderArea.width()), bucket(renderArea.height()) };
+
+        // Keep the current images, if they are large enough and do not waste more than half of their memory.
+        if (m_allocatedSize.width() >= renderArea.width() && m_allocatedSize.height() >= renderArea.height() && 
+            m_allocatedSize.width() * m_allocatedSize.height() <= 2 * bucketSize.width() * bucketSize.height())
+            return m_allocatedSize;
+
+        return bucketSize;
+    }
+
+    inline SharedPtr<const IVulkanImage> reuseImage(const IVulkanImage& image, const Size2d& size) {
+        auto match = std::ranges::find_if(m_imagePool, [&](const auto& pooledImage) {
+            auto extent = pooledImage->extent();
+            return extent.width() == size.width() && extent.height() == size.height() && pooledImage->format() == image.format() && 
+                pooledImage->samples() == image.samples() && pooledImage->usage() == image.usage() && pooledImage->name() == image.name();
+        });
+
+        if (match == m_imagePool.end())
+            return nullptr;
+
+        auto pooledImage = std::move(*match);
+        m_imagePool.erase(match);
+        return pooledImage;
+    }
+
 public:
     void cleanup(const VulkanDevice& device) noexcept
     {
@@ -129,9 +163,31 @@ public:
         if (device == nullptr) [[unlikely]]
             throw RuntimeException("Cannot resize frame buffer on a released device instance.");
 
-        // Resize/Re-allocate all images.
+        using clock_type = std::chrono::steady_clock;
+        auto start = clock_type::now();
+        auto recordTime = [this, &start]() {
+            auto time = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+            m_resizeStatistics.LastResizeTime = time;
+            m_resizeStatistics.MaxResizeTime = std::max(m_resizeStatistics.MaxResizeTime, time);
+            m_resizeStatistics.TotalResizeTime += time;
+        };
+
+        m_resizeStatistics.Resizes++;
+
+        // If the images are still large enough to contain the render area, only the render area changes.
+        auto allocatedSize = this->allocationSize(renderArea);
         m_size = renderArea;
 
+        if (allocatedSize.width() == m_allocatedSize.width() && allocatedSize.height() == m_allocatedSize.height())
+        {
+            recordTime();
+            return;
+        }
+
+        // Resize/Re-allocate all images.
+        m_allocatedSize = allocatedSize;
+        auto reuseImages = LITEFX_FLAG_IS_SET(m_resizePolicy, FrameBufferResizePolicy::ReuseImages);
+
         // Recreate all resources.
         Dictionary<const IVulkanImage*, SharedPtr<const IVulkanImage>> imageReplacements;
         auto& queue = device->defaultQueue(QueueType::Graphics);
@@ -146,7 +202,16 @@ public:
                     renderTargetId = renderTarget->first;
 
                 auto format = image->format();
-                auto newImage = this->createImage(*device, renderTargetId, renderArea, image->usage(), format, image->samples(), image->name());
+                auto newImage = reuseImages ? this->reuseImage(*image, allocatedSize) : nullptr;
+
+                if (newImage != nullptr)
+                    m_resizeStatistics.ReusedImages++;
+                else
+                {
+                    newImage = this->createImage(*device, renderTargetId, allocatedSize, image->usage(), format, image->samples(), image->name());
+                    m_resizeStatistics.Reallocations++;
+                }
+
                 imageReplacements[image.get()] = newImage;
 
                 if (::hasDepth(format) || ::hasStencil(format))
@@ -166,6 +231,15 @@ public:
         // Update the mappings.
         std::ranges::for_each(m_mappedRenderTargets | std::views::values, [&imageReplacements](auto& image) { image = imageReplacements.at(image.get()); });
 
+        // Keep the replaced images for later resizes, dropping the least recently replaced ones if the pool is full.
+        if (reuseImages)
+        {
+            std::ranges::move(m_images, std::back_inserter(m_imagePool));
+
+            if (m_imagePool.size() > m_poolSize)
+                m_imagePool.erase(m_imagePool.begin(), std::next(m_imagePool.begin(), static_cast<std::ptrdiff_t>(m_imagePool.size() - m_poolSize)));
+        }
+
         // Store the new images.
         m_images = std::move(images);
 
@@ -174,6 +248,7 @@ public:
 
         // Wait for the fence to finish.
         queue.waitFor(fence);
+        recordTime();
     }
 };
 
@@ -224,6 +299,41 @@ const Size2d& VulkanFrameBuffer::size() const noexcept
 	return m_impl->m_size;
 }
 
+const Size2d& VulkanFrameBuffer::allocatedSize() const noexcept
+{
+    return m_impl->m_allocatedSize;
+}
+
+FrameBufferResizePolicy VulkanFrameBuffer::resizePolicy() const noexcept
+{
+    return m_impl->m_resizePolicy;
+}
+
+void VulkanFrameBuffer::setResizePolicy(FrameBufferResizePolicy policy, UInt32 bucketSize, UInt32 poolSize)
+{
+    if (bucketSize == 0u) [[unlikely]]
+        throw InvalidArgumentException("bucketSize", "The bucket size must be greater than 0.");
+
+    m_impl->m_resizePolicy = policy;
+    m_impl->m_bucketSize = bucketSize;
+    m_impl->m_poolSize = poolSize;
+
+    if (!LITEFX_FLAG_IS_SET(policy, FrameBufferResizePolicy::ReuseImages))
+        m_impl->m_imagePool.clear();
+    else if (m_impl->m_imagePool.size() > poolSize)
+        m_impl->m_imagePool.erase(m_impl->m_imagePool.begin(), std::next(m_impl->m_imagePool.begin(), static_cast<std::ptrdiff_t>(m_impl->m_imagePool.size() - poolSize)));
+}
+
+void VulkanFrameBuffer::releasePooledImages() noexcept
+{
+    m_impl->m_imagePool.clear();
+}
+
+VulkanFrameBuffer::ResizeStatistics VulkanFrameBuffer::resizeStatistics() const noexcept
+{
+    return m_impl->m_resizeStatistics;
+}
+
 size_t VulkanFrameBuffer::getWidth() const noexcept
 {
 	return m_impl->m_size.width();
@@ -306,7 +416,7 @@ void VulkanFrameBuffer::addImage(const String& name, Format format, MultiSamplin
         throw InvalidArgumentException("name", "Another image with the name {0} does already exist within the frame buffer.", name);
 
     // Add a new image...
-    auto newImage = m_impl->createImage(*device, nameHash, m_impl->m_size, usage, format, samples, name);
+    auto newImage = m_impl->createImage(*device, nameHash, m_impl->m_allocatedSize, usage, format, samples, name);
     m_impl->m_images.push_back(newImage);
 
     // ... and make sure it is in the right layout.
@@ -341,10 +451,20 @@ void VulkanFrameBuffer::addImage(const String& name, const RenderTarget& renderT
     if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](auto& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end()) [[unlikely]]
         throw InvalidArgumentException("name", "Another image with the name {0} does already exist within the frame buffer.", name);
 
+    // Transient render targets are not copied or written, so they can be backed by lazily allocated memory. Present targets that are not resolved from a multi-sampled 
+    // image are copied into the back buffer, so they must be allocated as regular images.
+    if (renderTarget.isTransient())
+    {
+        if (renderTarget.type() == RenderTargetType::Present && samples == MultiSamplingLevel::x1)
+            LITEFX_WARNING(VULKAN_LOG, "The present target {0} cannot be transient, as it is not multi-sampled. It is allocated as a regular image instead.", renderTarget.name());
+        else
+            usage = static_cast<ResourceUsage>(std::to_underlying(usage) & ~std::to_underlying(ResourceUsage::AllowWrite | ResourceUsage::TransferSource | ResourceUsage::TransferDestination)) | ResourceUsage::Transient;
+    }
+
     // Add a new image...
     auto index = m_impl->m_images.size();
     auto format = renderTarget.format();
-    auto newImage = m_impl->createImage(*device, nameHash, m_impl->m_size, usage, format, samples, name);
+    auto newImage = m_impl->createImage(*device, nameHash, m_impl->m_allocatedSize, usage, format, samples, name);
     m_impl->m_images.push_back(newImage);
 
     // ... and make sure it is in the right layout.
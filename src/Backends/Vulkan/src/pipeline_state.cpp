@@ -0,0 +1,64 @@
+#include <litefx/backends/vulkan.hpp>
+
+using namespace LiteFX::Rendering::Backends;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanPipelineState::VulkanPipelineStateImpl {
+public:
+    friend class VulkanPipelineState;
+
+private:
+    TaskScheduler* m_scheduler{ nullptr };
+    SharedPtr<TaskCounter> m_compilation{ };
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanPipelineState::VulkanPipelineState(VkPipeline handle) :
+    Resource<VkPipeline>(handle), m_impl()
+{
+}
+
+VulkanPipelineState::~VulkanPipelineState() noexcept = default;
+
+void VulkanPipelineState::compileAsync(TaskScheduler& scheduler, std::function<VkPipeline()> compile)
+{
+    if (m_impl->m_compilation != nullptr && !m_impl->m_compilation->done()) [[unlikely]]
+        throw RuntimeException("The pipeline state is already being compiled.");
+
+    // NOTE: Capturing `this` is safe, as pipeline states cannot be moved and every pipeline waits for a pending compilation in its destructor.
+    m_impl->m_scheduler = &scheduler;
+    m_impl->m_compilation = scheduler.schedule([this, compile = std::move(compile)]() { this->handle() = compile(); });
+}
+
+void VulkanPipelineState::finishCompilation() const noexcept
+{
+    try
+    {
+        this->wait();
+    }
+    catch (const std::exception& ex)
+    {
+        LITEFX_ERROR(VULKAN_LOG, "Pipeline state {0} could not be compiled: {1}", this->name(), ex.what());
+    }
+    catch (...)
+    {
+        LITEFX_ERROR(VULKAN_LOG, "Pipeline state {0} could not be compiled.", this->name());
+    }
+}
+
+bool VulkanPipelineState::isReady() const noexcept
+{
+    return m_impl->m_compilation == nullptr || m_impl->m_compilation->done();
+}
+
+void VulkanPipelineState::wait() const
+{
+    if (m_impl->m_compilation != nullptr)
+        m_impl->m_scheduler->wait(*m_impl->m_compilation);
+}
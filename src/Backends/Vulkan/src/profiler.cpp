@@ -0,0 +1,535 @@
+#include <litefx/backends/vulkan.hpp>
+#include <bit>
+
+using namespace LiteFX::Rendering::Backends;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanProfiler::VulkanProfilerImpl {
+public:
+    friend class VulkanProfiler;
+
+private:
+    static constexpr UInt32 INVALID_INDEX = std::numeric_limits<UInt32>::max();
+
+    // NOTE: The order of the flags determines the order of the values within the query results.
+    static constexpr VkQueryPipelineStatisticFlags GRAPHICS_STATISTICS =
+        VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT | VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT | VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+    static constexpr VkQueryPipelineStatisticFlags COMPUTE_STATISTICS = VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
+    struct ScopeRecord {
+        String name;
+        UInt32 depth;
+        UInt32 parent;
+        UInt32 statistics;
+    };
+
+    struct QueueFrame {
+        SharedPtr<const VulkanQueue> queue;
+        VkQueryPool timestamps{ VK_NULL_HANDLE };
+        VkQueryPool statistics{ VK_NULL_HANDLE };
+        UInt32 statisticsCount{ 0u };
+        UInt32 statisticsValues{ 0u };
+        UInt64 timestampMask{ 0u };
+        UInt64 fence{ 0u };
+        Array<ScopeRecord> records;
+    };
+
+    struct Frame {
+        UInt64 index{ 0u };
+        bool pending{ false };
+        Array<QueueFrame> queues;
+    };
+
+    struct OpenScope {
+        UInt32 frame;
+        UInt32 queue;
+        UInt32 record;
+    };
+
+private:
+    WeakPtr<const VulkanDevice> m_device;
+    UInt32 m_maxScopes, m_history;
+    bool m_pipelineStatistics{ false };
+    double m_ticksPerMillisecond{ 1.0 };
+    Array<UInt32> m_timestampValidBits;
+    Optional<UInt64> m_origin{ std::nullopt };
+
+    Array<Frame> m_frames;
+    UInt32 m_currentFrame{ 0u };
+    UInt64 m_frameIndex{ 0u };
+    Dictionary<VkCommandBuffer, Array<OpenScope>> m_openScopes;
+    Array<FrameTimings> m_resolvedFrames;
+    Event<ISwapChain::BackBufferSwapEventArgs>::event_token_type m_swapEventToken{ };
+    mutable std::mutex m_mutex;
+
+public:
+    VulkanProfilerImpl(const VulkanDevice& device, UInt32 maxScopes, UInt32 history) :
+        m_device(device.weak_from_this()), m_maxScopes(std::max(maxScopes, 1u)), m_history(std::max(history, 1u))
+    {
+    }
+
+    VulkanProfilerImpl(VulkanProfilerImpl&&) noexcept = delete;
+    VulkanProfilerImpl(const VulkanProfilerImpl&) = delete;
+    VulkanProfilerImpl& operator=(VulkanProfilerImpl&&) noexcept = delete;
+    VulkanProfilerImpl& operator=(const VulkanProfilerImpl&) = delete;
+
+    ~VulkanProfilerImpl() noexcept
+    {
+        auto device = m_device.lock();
+
+        if (device == nullptr) [[unlikely]]
+        {
+            LITEFX_FATAL_ERROR(VULKAN_LOG, "Invalid attempt to release profiler after parent device.");
+            return;
+        }
+
+        device->swapChain().swapped.remove(m_swapEventToken);
+
+        // Query pools of frames that did not finish executing may still be written by the GPU. Pending frames have stored the fences to wait for, whilst the
+        // current frame is not closed yet, so all work submitted to its queues so far needs to finish.
+        for (UInt32 i{ 0 }; i < m_frames.size(); ++i)
+        {
+            const auto& frame = m_frames[i]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+            if (!frame.pending && i != m_currentFrame)
+                continue;
+
+            for (const auto& queueFrame : frame.queues)
+            {
+                try
+                {
+                    queueFrame.queue->waitFor(frame.pending ? queueFrame.fence : queueFrame.queue->currentFence());
+                }
+                catch (const std::exception& ex)
+                {
+                    LITEFX_ERROR(VULKAN_LOG, "Unable to wait for profiler frame {0} to finish before releasing its query pools: {1}", frame.index, ex.what());
+                }
+            }
+        }
+
+        for (auto& frame : m_frames)
+            this->releasePools(*device, frame);
+    }
+
+public:
+    void initialize(const VulkanDevice& device, const VulkanProfiler& parent, bool pipelineStatistics)
+    {
+        m_ticksPerMillisecond = device.ticksPerMillisecond();
+
+        // Pipeline statistics are only enabled on the device, if they are supported by the adapter.
+        if (pipelineStatistics)
+        {
+            VkPhysicalDeviceFeatures features{};
+            ::vkGetPhysicalDeviceFeatures(device.adapter().handle(), &features);
+            m_pipelineStatistics = features.pipelineStatisticsQuery == VK_TRUE;
+
+            if (!m_pipelineStatistics)
+                LITEFX_WARNING(VULKAN_LOG, "Pipeline statistics queries are not supported by the device and will not be collected.");
+        }
+
+        // Store the number of valid timestamp bits for each queue family. Queues from families without valid bits do not support timestamps.
+        uint32_t queueFamilies = 0;
+        ::vkGetPhysicalDeviceQueueFamilyProperties(device.adapter().handle(), &queueFamilies, nullptr);
+
+        Array<VkQueueFamilyProperties> familyProperties(queueFamilies);
+        ::vkGetPhysicalDeviceQueueFamilyProperties(device.adapter().handle(), &queueFamilies, familyProperties.data());
+
+        m_timestampValidBits = familyProperties | std::views::transform([](const auto& family) { return family.timestampValidBits; }) | std::ranges::to<Array<UInt32>>();
+
+        // Keep one frame more than the swap chain has back buffers, so that results can be read back without waiting.
+        m_frames.resize(device.swapChain().buffers() + 1);
+
+        // Advance the frame, whenever the swap chain swaps its back buffers.
+        m_swapEventToken = device.swapChain().swapped.add([&parent](const void* /*sender*/, const ISwapChain::BackBufferSwapEventArgs& /*args*/) { parent.nextFrame(); });
+    }
+
+private:
+    void releasePools(const VulkanDevice& device, Frame& frame) noexcept
+    {
+        for (auto& queueFrame : frame.queues)
+        {
+            ::vkDestroyQueryPool(device.handle(), queueFrame.timestamps, nullptr);
+            ::vkDestroyQueryPool(device.handle(), queueFrame.statistics, nullptr);
+        }
+
+        frame.queues.clear();
+    }
+
+    UInt32 queueFrame(const VulkanDevice& device, Frame& frame, const VulkanQueue& queue)
+    {
+        if (auto match = std::ranges::find_if(frame.queues, [&queue](const auto& queueFrame) { return queueFrame.queue.get() == &queue; }); match != frame.queues.end()) [[likely]]
+            return static_cast<UInt32>(std::distance(frame.queues.begin(), match));
+
+        // Allocate the query pools for the queue. Each scope requires two timestamps.
+        auto& queueFrame = frame.queues.emplace_back(QueueFrame{ .queue = queue.shared_from_this() });
+        auto validBits = queue.familyId() < m_timestampValidBits.size() ? m_timestampValidBits[queue.familyId()] : 0u; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        queueFrame.timestampMask = validBits >= 64u ? std::numeric_limits<UInt64>::max() : (1ull << validBits) - 1ull;
+
+        if (validBits == 0u) [[unlikely]]
+        {
+            LITEFX_WARNING(VULKAN_LOG, "The queue family {0} does not support timestamps. Scopes recorded on it will be ignored.", queue.familyId());
+            return static_cast<UInt32>(frame.queues.size() - 1);
+        }
+
+        VkQueryPoolCreateInfo timestampPoolInfo {
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = m_maxScopes * 2
+        };
+
+        raiseIfFailed(::vkCreateQueryPool(device.handle(), &timestampPoolInfo, nullptr, &queueFrame.timestamps), "Unable to allocate profiler timestamp query pool.");
+        ::vkResetQueryPool(device.handle(), queueFrame.timestamps, 0, m_maxScopes * 2);
+
+        // Statistic queries with graphics flags can only be used on graphics queues. Transfer queues do not support statistics at all.
+        if (m_pipelineStatistics && (LITEFX_FLAG_IS_SET(queue.type(), QueueType::Graphics) || LITEFX_FLAG_IS_SET(queue.type(), QueueType::Compute)))
+        {
+            auto statisticFlags = LITEFX_FLAG_IS_SET(queue.type(), QueueType::Graphics) ? GRAPHICS_STATISTICS : COMPUTE_STATISTICS;
+
+            VkQueryPoolCreateInfo statisticsPoolInfo {
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+                .queryCount = m_maxScopes,
+                .pipelineStatistics = statisticFlags
+            };
+
+            raiseIfFailed(::vkCreateQueryPool(device.handle(), &statisticsPoolInfo, nullptr, &queueFrame.statistics), "Unable to allocate profiler pipeline statistics query pool.");
+            ::vkResetQueryPool(device.handle(), queueFrame.statistics, 0, m_maxScopes);
+            queueFrame.statisticsValues = static_cast<UInt32>(std::popcount(statisticFlags));
+        }
+
+        return static_cast<UInt32>(frame.queues.size() - 1);
+    }
+
+public:
+    void begin(const VulkanCommandBuffer& commandBuffer, StringView name)
+    {
+        auto device = m_device.lock();
+
+        if (device == nullptr) [[unlikely]]
+            throw RuntimeException("Cannot begin a profiler scope on a released device instance.");
+
+        auto queue = commandBuffer.queue();
+
+        if (queue == nullptr) [[unlikely]]
+            throw RuntimeException("Cannot begin a profiler scope on a command buffer of a released queue.");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& openScopes = m_openScopes[commandBuffer.handle()];
+        auto& frame = m_frames[m_currentFrame]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        auto queueIndex = this->queueFrame(*device, frame, *queue);
+        auto& queueFrame = frame.queues[queueIndex]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        // If the scope cannot be recorded, push an invalid scope, so that the matching call to `end` is ignored.
+        if (queueFrame.timestamps == VK_NULL_HANDLE || queueFrame.records.size() >= m_maxScopes) [[unlikely]]
+        {
+            if (queueFrame.records.size() == m_maxScopes)
+                LITEFX_WARNING(VULKAN_LOG, "The maximum number of {0} profiler scopes per frame has been exceeded on queue {1}. Additional scopes are ignored.", m_maxScopes, static_cast<const void*>(queue.get()));
+
+            openScopes.emplace_back(m_currentFrame, queueIndex, INVALID_INDEX);
+            return;
+        }
+
+        // Pipeline statistics queries cannot be nested, so they are only collected for top-level scopes.
+        auto recordIndex = static_cast<UInt32>(queueFrame.records.size());
+        auto parent = openScopes.empty() || openScopes.back().frame != m_currentFrame ? INVALID_INDEX : openScopes.back().record;
+        auto statistics = INVALID_INDEX;
+
+        if (openScopes.empty() && queueFrame.statistics != VK_NULL_HANDLE)
+            statistics = queueFrame.statisticsCount++;
+
+        queueFrame.records.emplace_back(String(name), static_cast<UInt32>(openScopes.size()), parent, statistics);
+        openScopes.emplace_back(m_currentFrame, queueIndex, recordIndex);
+
+        ::vkCmdWriteTimestamp2(commandBuffer.handle(), VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, queueFrame.timestamps, recordIndex * 2);
+
+        if (statistics != INVALID_INDEX)
+            ::vkCmdBeginQuery(commandBuffer.handle(), queueFrame.statistics, statistics, 0);
+    }
+
+    void end(const VulkanCommandBuffer& commandBuffer) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto match = m_openScopes.find(commandBuffer.handle());
+
+        if (match == m_openScopes.end() || match->second.empty()) [[unlikely]]
+        {
+            LITEFX_WARNING(VULKAN_LOG, "Attempting to end a profiler scope on a command buffer without open scopes.");
+            return;
+        }
+
+        auto scope = match->second.back();
+        match->second.pop_back();
+
+        if (match->second.empty())
+            m_openScopes.erase(match);
+
+        if (scope.record == INVALID_INDEX) [[unlikely]]
+            return;
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        auto& queueFrame = m_frames[scope.frame].queues[scope.queue];
+        const auto& record = queueFrame.records[scope.record];
+        // NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        if (record.statistics != INVALID_INDEX)
+            ::vkCmdEndQuery(commandBuffer.handle(), queueFrame.statistics, record.statistics);
+
+        ::vkCmdWriteTimestamp2(commandBuffer.handle(), VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, queueFrame.timestamps, scope.record * 2 + 1);
+    }
+
+    void nextFrame()
+    {
+        auto device = m_device.lock();
+
+        if (device == nullptr) [[unlikely]]
+            throw RuntimeException("Cannot advance the profiler frame on a released device instance.");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Close the current frame by storing the fences that need to be reached before all of its scopes are available.
+        auto& current = m_frames[m_currentFrame]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        current.index = m_frameIndex++;
+        current.pending = !current.queues.empty();
+        std::ranges::for_each(current.queues, [](auto& queueFrame) { queueFrame.fence = queueFrame.queue->currentFence(); });
+
+        // Resolve all frames that have finished executing, oldest first.
+        auto pendingFrames = m_frames | std::views::filter([](const auto& frame) { return frame.pending; }) | std::views::transform([](auto& frame) { return &frame; }) | std::ranges::to<Array<Frame*>>();
+        std::ranges::sort(pendingFrames, {}, [](const Frame* frame) { return frame->index; });
+
+        for (auto frame : pendingFrames)
+        {
+            if (!this->resolve(*device, *frame, false))
+                break;
+        }
+
+        // Advance to the next frame. If it did not finish executing yet, wait for it, so that its query pools can be safely reset.
+        m_currentFrame = (m_currentFrame + 1) % static_cast<UInt32>(m_frames.size());
+        auto& next = m_frames[m_currentFrame]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        if (next.pending) [[unlikely]]
+        {
+            LITEFX_DEBUG(VULKAN_LOG, "Waiting for profiler frame {0} to finish, before its queries can be reused.", next.index);
+            this->resolve(*device, next, true);
+        }
+
+        // Scopes that are still open on a command buffer refer to a closed frame, which is now being reused.
+        for (auto& openScopes : m_openScopes | std::views::values)
+            std::ranges::for_each(openScopes, [this](auto& scope) { if (scope.frame == m_currentFrame) scope.record = INVALID_INDEX; });
+
+        for (auto& queueFrame : next.queues)
+        {
+            if (queueFrame.timestamps != VK_NULL_HANDLE)
+                ::vkResetQueryPool(device->handle(), queueFrame.timestamps, 0, m_maxScopes * 2);
+
+            if (queueFrame.statistics != VK_NULL_HANDLE)
+                ::vkResetQueryPool(device->handle(), queueFrame.statistics, 0, m_maxScopes);
+
+            queueFrame.records.clear();
+            queueFrame.statisticsCount = 0;
+        }
+    }
+
+private:
+    bool resolve(const VulkanDevice& device, Frame& frame, bool wait)
+    {
+        // Check if all submitted workloads of the frame have finished.
+        if (wait)
+            std::ranges::for_each(frame.queues, [](const auto& queueFrame) { queueFrame.queue->waitFor(queueFrame.fence); });
+        else if (std::ranges::any_of(frame.queues, [](const auto& queueFrame) { return queueFrame.queue->lastCompletedFence() < queueFrame.fence; }))
+            return false;
+
+        FrameTimings timings { .Frame = frame.index };
+
+        for (const auto& queueFrame : frame.queues)
+        {
+            if (queueFrame.records.empty())
+                continue;
+
+            // Read the timestamps along with their availability. Queries that are not available at this point have been recorded into command buffers that
+            // were never submitted, so they are discarded.
+            auto records = static_cast<UInt32>(queueFrame.records.size());
+            Array<UInt64> timestamps(static_cast<size_t>(records) * 4);
+            auto result = ::vkGetQueryPoolResults(device.handle(), queueFrame.timestamps, 0, records * 2, timestamps.size() * sizeof(UInt64), timestamps.data(), 2 * sizeof(UInt64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+            if (result != VK_NOT_READY)
+                raiseIfFailed(result, "Unable to read profiler timestamps.");
+
+            Array<UInt64> statistics;
+
+            if (queueFrame.statisticsCount > 0)
+            {
+                const auto stride = static_cast<size_t>(queueFrame.statisticsValues) + 1;
+                statistics.resize(queueFrame.statisticsCount * stride);
+                result = ::vkGetQueryPoolResults(device.handle(), queueFrame.statistics, 0, queueFrame.statisticsCount, statistics.size() * sizeof(UInt64), statistics.data(), stride * sizeof(UInt64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+                if (result != VK_NOT_READY)
+                    raiseIfFailed(result, "Unable to read profiler pipeline statistics.");
+            }
+
+            // Map the record indices to indices within the resolved scopes, so that parents can be resolved.
+            Array<UInt32> resolvedIndices(records, INVALID_INDEX);
+
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            for (UInt32 i{ 0 }; i < records; ++i)
+            {
+                const auto& record = queueFrame.records[i];
+                auto begin = timestamps[i * 4], beginAvailable = timestamps[i * 4 + 1];
+                auto end = timestamps[i * 4 + 2], endAvailable = timestamps[i * 4 + 3];
+
+                if (beginAvailable == 0 || endAvailable == 0) [[unlikely]]
+                    continue;
+
+                begin &= queueFrame.timestampMask;
+                end &= queueFrame.timestampMask;
+
+                if (!m_origin.has_value()) [[unlikely]]
+                    m_origin = begin;
+
+                ScopeTiming scope {
+                    .Name = record.name,
+                    .Depth = record.depth,
+                    .Parent = record.parent == INVALID_INDEX || resolvedIndices[record.parent] == INVALID_INDEX ? std::nullopt : Optional<UInt32>{ resolvedIndices[record.parent] },
+                    .Queue = queueFrame.queue->type(),
+                    .QueueFamily = queueFrame.queue->familyId(),
+                    .QueueId = queueFrame.queue->queueId(),
+                    .Begin = (static_cast<double>(begin) - static_cast<double>(m_origin.value())) / m_ticksPerMillisecond,
+                    .End = (static_cast<double>(end) - static_cast<double>(m_origin.value())) / m_ticksPerMillisecond
+                };
+
+                if (record.statistics != INVALID_INDEX)
+                {
+                    const auto stride = static_cast<size_t>(queueFrame.statisticsValues) + 1;
+                    auto values = Span<const UInt64>(statistics).subspan(record.statistics * stride, stride);
+
+                    if (values.back() != 0)
+                    {
+                        if (queueFrame.statisticsValues == 1)
+                            scope.Statistics = PipelineStatistics{ .ComputeShaderInvocations = values[0] };
+                        else
+                            scope.Statistics = PipelineStatistics{ values[0], values[1], values[2], values[3], values[4], values[5], values[6] };
+                    }
+                }
+
+                resolvedIndices[i] = static_cast<UInt32>(timings.Scopes.size());
+                timings.Scopes.push_back(std::move(scope));
+            }
+            // NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        }
+
+        frame.pending = false;
+
+        // Store the frame in the history.
+        m_resolvedFrames.push_back(std::move(timings));
+
+        if (m_resolvedFrames.size() > m_history)
+            m_resolvedFrames.erase(m_resolvedFrames.begin(), m_resolvedFrames.begin() + static_cast<std::ptrdiff_t>(m_resolvedFrames.size() - m_history));
+
+        return true;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanProfiler::VulkanProfiler(const VulkanDevice& device, UInt32 maxScopes, bool pipelineStatistics, UInt32 history) :
+    m_impl(device, maxScopes, history)
+{
+    m_impl->initialize(device, *this, pipelineStatistics);
+}
+
+VulkanProfiler::~VulkanProfiler() noexcept = default;
+
+void VulkanProfiler::begin(const VulkanCommandBuffer& commandBuffer, StringView name) const
+{
+    m_impl->begin(commandBuffer, name);
+}
+
+void VulkanProfiler::end(const VulkanCommandBuffer& commandBuffer) const noexcept
+{
+    m_impl->end(commandBuffer);
+}
+
+void VulkanProfiler::nextFrame() const
+{
+    m_impl->nextFrame();
+}
+
+UInt64 VulkanProfiler::frame() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_frameIndex;
+}
+
+bool VulkanProfiler::collectsPipelineStatistics() const noexcept
+{
+    return m_impl->m_pipelineStatistics;
+}
+
+Optional<VulkanProfiler::FrameTimings> VulkanProfiler::lastFrame() const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+
+    if (m_impl->m_resolvedFrames.empty())
+        return std::nullopt;
+
+    return m_impl->m_resolvedFrames.back();
+}
+
+Array<VulkanProfiler::FrameTimings> VulkanProfiler::frames() const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_resolvedFrames;
+}
+
+void VulkanProfiler::exportChromeTrace(std::ostream& stream) const
+{
+    // NOTE: The events are prefixed with a separator, so start with a metadata event.
+    stream << "{\"traceEvents\":[{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":1,\"args\":{\"sort_index\":1}}";
+    this->writeChromeTraceEvents(stream);
+    stream << "],\"displayTimeUnit\":\"ms\"}";
+}
+
+void VulkanProfiler::writeChromeTraceEvents(std::ostream& stream) const
+{
+    constexpr double MICROSECONDS_PER_MILLISECOND = 1000.0;
+    constexpr UInt32 GPU_PROCESS_ID = 1;
+    auto frames = this->frames();
+
+    // Each queue is identified by its family and queue ID.
+    auto threadId = [](const ScopeTiming& scope) { return (scope.QueueFamily << 16u) | scope.QueueId; }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    Dictionary<UInt32, const ScopeTiming*> queues;
+
+    stream << std::format(",{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{0},\"args\":{{\"name\":\"GPU\"}}}}", GPU_PROCESS_ID);
+
+    for (const auto& frame : frames)
+    {
+        for (const auto& scope : frame.Scopes)
+        {
+            queues.try_emplace(threadId(scope), &scope);
+
+            stream << ",{\"name\":";
+            Instrumentation::writeJsonString(stream, scope.Name);
+            stream << std::format(",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":{0},\"tid\":{1},\"ts\":{2:.3f},\"dur\":{3:.3f},\"args\":{{\"frame\":{4},\"depth\":{5}",
+                GPU_PROCESS_ID, threadId(scope), scope.Begin * MICROSECONDS_PER_MILLISECOND, scope.duration() * MICROSECONDS_PER_MILLISECOND, frame.Frame, scope.Depth);
+
+            if (scope.Statistics.has_value())
+            {
+                const auto& statistics = scope.Statistics.value();
+                stream << std::format(",\"inputAssemblyVertices\":{0},\"inputAssemblyPrimitives\":{1},\"vertexShaderInvocations\":{2},\"clippingInvocations\":{3},\"clippingPrimitives\":{4},\"fragmentShaderInvocations\":{5},\"computeShaderInvocations\":{6}",
+                    statistics.InputAssemblyVertices, statistics.InputAssemblyPrimitives, statistics.VertexShaderInvocations, statistics.ClippingInvocations, statistics.ClippingPrimitives, statistics.FragmentShaderInvocations, statistics.ComputeShaderInvocations);
+            }
+
+            stream << "}}";
+        }
+    }
+
+    // Name the queue threads.
+    for (const auto& [id, scope] : queues)
+        stream << std::format(",{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{0},\"tid\":{1},\"args\":{{\"name\":\"{2} Queue (Family {3}, Index {4})\"}}}}", GPU_PROCESS_ID, id, scope->Queue, scope->QueueFamily, scope->QueueId);
+}
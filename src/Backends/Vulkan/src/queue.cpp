@@ -26,6 +26,7 @@ private:
 	mutable std::mutex m_mutex;
 	WeakPtr<const VulkanDevice> m_device;
 	Array<Tuple<UInt64, SharedPtr<const VulkanCommandBuffer>>> m_submittedCommandBuffers;
+	Array<VkSemaphoreSubmitInfo> m_pendingWaits;
 
 public:
 	VulkanQueueImpl(const VulkanDevice& device, QueueType type, QueuePriority priority, UInt32 familyId, UInt32 queueId) :
@@ -37,6 +38,7 @@ public:
 	void release()
 	{
 		m_submittedCommandBuffers.clear();
+		m_pendingWaits.clear();
 
 		if (m_timelineSemaphore != VK_NULL_HANDLE)
 		{
@@ -88,6 +90,42 @@ public:
 
 		this->m_submittedCommandBuffers.erase(from, to);
 	}
+
+	UInt64 submit(VkQueue queue, Span<const VkCommandBufferSubmitInfo> commandBuffers, VkSemaphore signalSemaphore)
+	{
+		auto fence = ++m_fenceValue;
+
+		// Signal the timeline semaphore and optionally a binary semaphore (e.g., for presentation).
+		std::array<VkSemaphoreSubmitInfo, 2> signalSemaphoreInfos = {
+			VkSemaphoreSubmitInfo {
+				.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+				.semaphore = m_timelineSemaphore,
+				.value = fence,
+				.stageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT
+			},
+			VkSemaphoreSubmitInfo {
+				.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+				.semaphore = signalSemaphore,
+				.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+			}
+		};
+
+		// Attach all pending waits for other queues to this submission.
+		VkSubmitInfo2 submitInfo = {
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+			.waitSemaphoreInfoCount = static_cast<UInt32>(m_pendingWaits.size()),
+			.pWaitSemaphoreInfos = m_pendingWaits.data(),
+			.commandBufferInfoCount = static_cast<UInt32>(commandBuffers.size()),
+			.pCommandBufferInfos = commandBuffers.data(),
+			.signalSemaphoreInfoCount = signalSemaphore == VK_NULL_HANDLE ? 1u : 2u,
+			.pSignalSemaphoreInfos = signalSemaphoreInfos.data()
+		};
+
+		raiseIfFailed(::vkQueueSubmit2(queue, 1, &submitInfo, VK_NULL_HANDLE), "Unable to submit command buffer to queue.");
+
+		m_pendingWaits.clear();
+		return fence;
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -173,12 +211,19 @@ SharedPtr<VulkanCommandBuffer> VulkanQueue::createCommandBuffer(bool beginRecord
 }
 
 UInt64 VulkanQueue::submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer) const
+{
+	return this->submit(commandBuffer, VK_NULL_HANDLE);
+}
+
+UInt64 VulkanQueue::submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer, VkSemaphore signalSemaphore) const
 {
 	auto device = m_impl->m_device.lock();
 
 	if (device == nullptr) [[unlikely]]
 		throw RuntimeException("Cannot submit command buffer to a queue on a released device instance.");
 
+	LITEFX_PROFILE_ZONE(device->instrumentation(), "VulkanQueue::submit");
+
 	if (commandBuffer == nullptr) [[unlikely]]
 		throw InvalidArgumentException("commandBuffer", "The command buffer must be initialized.");
 
@@ -199,33 +244,16 @@ UInt64 VulkanQueue::submit(const SharedPtr<const VulkanCommandBuffer>& commandBu
 	commandBuffer->end();
 
 	// Submit the command buffer.
-	auto fence = ++m_impl->m_fenceValue;
-
-	VkSemaphoreSubmitInfo signalSemaphoreInfo = {
-		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-		.semaphore = m_impl->m_timelineSemaphore,
-		.value = fence,
-		.stageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT
-	};
-
 	VkCommandBufferSubmitInfo commandBufferInfo = {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
 		.commandBuffer = commandBuffer->handle()
 	};
 
-	VkSubmitInfo2 submitInfo = {
-		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-		.commandBufferInfoCount = 1,
-		.pCommandBufferInfos = &commandBufferInfo,
-		.signalSemaphoreInfoCount = 1,
-		.pSignalSemaphoreInfos = &signalSemaphoreInfo
-	};
-
-	// Submit the command buffer to the transfer queue.
-	raiseIfFailed(::vkQueueSubmit2(this->handle(), 1, &submitInfo, VK_NULL_HANDLE), "Unable to submit command buffer to queue.");
+	auto fence = m_impl->submit(this->handle(), { &commandBufferInfo, 1 }, signalSemaphore);
 
 	// Add the command buffer to the submitted command buffers list.
 	m_impl->m_submittedCommandBuffers.emplace_back(fence, commandBuffer);
+	LITEFX_PROFILE_COUNTER(device->instrumentation(), "VulkanQueue::submittedCommandBuffers", m_impl->m_submittedCommandBuffers.size());
 
 	// Fire end event.
 	this->submitted(this, { fence });
@@ -239,6 +267,8 @@ UInt64 VulkanQueue::submit(Enumerable<SharedPtr<const VulkanCommandBuffer>> comm
 	if (device == nullptr) [[unlikely]]
 		throw RuntimeException("Cannot submit command buffer to a queue on a released device instance.");
 
+	LITEFX_PROFILE_ZONE(device->instrumentation(), "VulkanQueue::submit");
+
 	if (!std::ranges::all_of(commandBuffers, [](const auto& buffer) { return buffer != nullptr; })) [[unlikely]]
 		throw InvalidArgumentException("commandBuffers", "At least one command buffer is not initialized.");
 
@@ -267,29 +297,12 @@ UInt64 VulkanQueue::submit(Enumerable<SharedPtr<const VulkanCommandBuffer>> comm
 		};
 	}) | std::ranges::to<Array<VkCommandBufferSubmitInfo>>();
 
-	// Submit the command buffer.
-	auto fence = ++m_impl->m_fenceValue;
-
-	VkSemaphoreSubmitInfo signalSemaphoreInfo = {
-		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-		.semaphore = m_impl->m_timelineSemaphore,
-		.value = fence,
-		.stageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT
-	};
-
-	VkSubmitInfo2 submitInfo = {
-		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-		.commandBufferInfoCount = static_cast<UInt32>(commandBufferInfos.size()),
-		.pCommandBufferInfos = commandBufferInfos.data(),
-		.signalSemaphoreInfoCount = 1,
-		.pSignalSemaphoreInfos = &signalSemaphoreInfo
-	};
-
-	// Submit the command buffer to the transfer queue.
-	raiseIfFailed(::vkQueueSubmit2(this->handle(), 1, &submitInfo, VK_NULL_HANDLE), "Unable to submit command buffer to queue.");
+	// Submit the command buffers.
+	auto fence = m_impl->submit(this->handle(), commandBufferInfos, VK_NULL_HANDLE);
 
 	// Add the command buffers to the submitted command buffers list.
 	std::ranges::for_each(commandBuffers, [this, &fence](const SharedPtr<const VulkanCommandBuffer>& buffer) { m_impl->m_submittedCommandBuffers.emplace_back(fence, buffer); });
+	LITEFX_PROFILE_COUNTER(device->instrumentation(), "VulkanQueue::submittedCommandBuffers", m_impl->m_submittedCommandBuffers.size());
 
 	// Fire end event.
 	this->submitted(this, { fence });
@@ -323,22 +336,24 @@ void VulkanQueue::waitFor(UInt64 fence) const
 	m_impl->releaseCommandBuffers(*this, fence);
 }
 
-void VulkanQueue::waitFor(const VulkanQueue& queue, UInt64 fence) const noexcept
+void VulkanQueue::waitFor(const VulkanQueue& queue, UInt64 fence) const
 {
-	VkSemaphoreSubmitInfo waitSemaphoreInfo {
-		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-		.semaphore = queue.m_impl->m_timelineSemaphore,
-		.value = fence,
-		.stageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT
-	};
+	// If the fence has already been passed, there is nothing to wait for.
+	if (queue.lastCompletedFence() >= fence)
+		return;
 
-	VkSubmitInfo2 submitInfo {
-		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-		.waitSemaphoreInfoCount = 1,
-		.pWaitSemaphoreInfos = &waitSemaphoreInfo
-	};
+	// Record the wait, so that it gets attached to the next submission. If there already is a pending wait for the queue, only wait for the later fence.
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
 
-	::vkQueueSubmit2(this->handle(), 1, &submitInfo, VK_NULL_HANDLE);
+	if (auto match = std::ranges::find(m_impl->m_pendingWaits, queue.m_impl->m_timelineSemaphore, &VkSemaphoreSubmitInfo::semaphore); match != m_impl->m_pendingWaits.end())
+		match->value = std::max(match->value, fence);
+	else
+		m_impl->m_pendingWaits.push_back(VkSemaphoreSubmitInfo {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = queue.m_impl->m_timelineSemaphore,
+			.value = fence,
+			.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+		});
 }
 
 UInt64 VulkanQueue::currentFence() const noexcept
@@ -132,6 +132,7 @@ public:
 			.layout = std::as_const(*m_layout.get()).handle()
 		};
 
+		LITEFX_PROFILE_ZONE(m_device->instrumentation(), "VulkanRayTracingPipeline::compile");
 		VkPipeline pipeline{};
 		raiseIfFailed(::vkCreateRayTracingPipelines(m_device->handle(), VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline), "Unable to create render pipeline.");
 
@@ -191,7 +192,7 @@ public:
 			std::ranges::to<std::map>();
 
 		// Allocate a buffer for the shader binding table.
-		// NOTE: Updating the SBT to change shader-local data is currently unsupported. Instead, bind-less resources should be used.
+		// NOTE: This buffer is not meant to be updated. Use `VulkanShaderBindingTable` to update shader-local data in place.
 		auto result = m_device->factory().createBuffer(BufferType::ShaderBindingTable, ResourceHeap::Dynamic, static_cast<size_t>(recordSize), static_cast<UInt32>(totalRecordCount), ResourceUsage::TransferSource);
 
 		// Write each record group by group.
@@ -284,11 +285,9 @@ VulkanRayTracingPipeline::VulkanRayTracingPipeline(const VulkanDevice& device, S
 {
 }
 
-VulkanRayTracingPipeline::VulkanRayTracingPipeline(VulkanRayTracingPipeline&&) noexcept = default;
-VulkanRayTracingPipeline& VulkanRayTracingPipeline::operator=(VulkanRayTracingPipeline&&) noexcept = default;
-
 VulkanRayTracingPipeline::~VulkanRayTracingPipeline() noexcept
 {
+	this->finishCompilation();
 	::vkDestroyPipeline(m_impl->m_device->handle(), this->handle(), nullptr);
 }
 
@@ -324,6 +323,9 @@ UInt32 VulkanRayTracingPipeline::maxAttributeSize() const noexcept
 
 SharedPtr<IVulkanBuffer> VulkanRayTracingPipeline::allocateShaderBindingTable(ShaderBindingTableOffsets& offsets, ShaderBindingGroup groups) const
 {
+	// Shader group handles can only be queried after the pipeline state has been compiled.
+	this->wait();
+
 	return m_impl->allocateShaderBindingTable(*this, offsets, groups);
 }
 
@@ -334,6 +336,9 @@ VkPipelineBindPoint VulkanRayTracingPipeline::pipelineType() const noexcept
 
 void VulkanRayTracingPipeline::use(const VulkanCommandBuffer& commandBuffer) const
 {
+	// Block until the pipeline state is compiled, if it is compiled asynchronously.
+	this->wait();
+
 	::vkCmdBindPipeline(commandBuffer.handle(), VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this->handle());
 }
 
@@ -357,6 +362,10 @@ void VulkanRayTracingPipelineBuilder::build()
 	instance->m_impl->m_maxRecursionDepth = this->state().maxRecursionDepth;
 	instance->m_impl->m_maxPayloadSize = this->state().maxPayloadSize;
 	instance->m_impl->m_maxAttributeSize = this->state().maxAttributeSize;
-	instance->handle() = instance->m_impl->initialize(*instance);
+
+	if (this->state().compileAsync)
+		instance->compileAsync(instance->m_impl->m_device->scheduler(), [instance]() { return instance->m_impl->initialize(*instance); });
+	else
+		instance->handle() = instance->m_impl->initialize(*instance);
 }
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
@@ -12,6 +12,18 @@ public:
     friend class VulkanRenderPassBuilder;
     friend class VulkanRenderPass;
 
+    /// <summary>
+    /// The number of times a frame buffer is used, after which its command buffer pool is trimmed to the largest number of command buffers acquired in between.
+    /// </summary>
+    static constexpr UInt32 POOL_TRIM_INTERVAL = 60u;
+
+    struct CommandBufferPool {
+        Array<SharedPtr<VulkanCommandBuffer>> commandBuffers;
+        size_t acquired{ 0u };
+        size_t peak{ 0u };
+        UInt32 frames{ 0u };
+    };
+
 private:
     Array<RenderTarget> m_renderTargets;
     Array<RenderPassDependency> m_inputAttachments;
@@ -19,6 +31,8 @@ private:
     Array<size_t> m_swapChainTokens;
     Dictionary<const IFrameBuffer*, SharedPtr<VulkanCommandBuffer>> m_primaryCommandBuffers;
     Dictionary<const IFrameBuffer*, Array<SharedPtr<VulkanCommandBuffer>>> m_secondaryCommandBuffers;
+    Dictionary<const IFrameBuffer*, CommandBufferPool> m_commandBufferPools;
+    mutable std::mutex m_poolMutex;
     Dictionary<const IVulkanImage*, VkImageView> m_swapChainViews;
     UInt32 m_secondaryCommandBufferCount = 0;
     SharedPtr<const VulkanFrameBuffer> m_activeFrameBuffer = nullptr;
@@ -36,9 +50,6 @@ public:
     {
         this->mapRenderTargets(renderTargets);
         this->mapInputAttachments(inputAttachments);
-
-        if (secondaryCommandBuffers == 0) [[unlikely]]
-            LITEFX_WARNING(VULKAN_LOG, "Secondary command buffer count for this render pass is 0, which makes it prevents recording draw commands to this render pass.");
     }
 
     VulkanRenderPassImpl(const VulkanDevice& device) :
@@ -126,6 +137,10 @@ public:
 #endif
                     return commandBuffer;
                 }) | std::ranges::to<Array<SharedPtr<VulkanCommandBuffer>>>();
+
+            // Create an empty command buffer pool, that grows when command buffers are acquired.
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_commandBufferPools[interfacePointer] = {};
         }
 
         // Store the active frame buffer pointer.
@@ -143,6 +158,11 @@ public:
         m_primaryCommandBuffers.erase(interfacePointer);
         m_secondaryCommandBuffers.erase(interfacePointer);
 
+        {
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_commandBufferPools.erase(interfacePointer);
+        }
+
         // Release the token.
         m_frameBufferTokens.erase(interfacePointer);
     }
@@ -156,6 +176,28 @@ public:
         m_swapChainViews.clear();
     }
 
+    static inline bool isTransient(const VulkanFrameBuffer& frameBuffer, const RenderTarget& renderTarget)
+    {
+        // NOTE: Check the image instead of the render target flags, as the frame buffer may have fallen back to a regular image.
+        return LITEFX_FLAG_IS_SET(frameBuffer[renderTarget].usage(), ResourceUsage::Transient); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    static inline VkAttachmentLoadOp getLoadOp(const VulkanFrameBuffer& frameBuffer, const RenderTarget& renderTarget, bool clear)
+    {
+        if (clear)
+            return VK_ATTACHMENT_LOAD_OP_CLEAR;
+        else
+            return isTransient(frameBuffer, renderTarget) ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD;
+    }
+
+    static inline VkAttachmentStoreOp getStoreOp(const VulkanFrameBuffer& frameBuffer, const RenderTarget& renderTarget)
+    {
+        if (isTransient(frameBuffer, renderTarget))
+            return VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        else
+            return renderTarget.isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE;
+    }
+
     Array<VkRenderingAttachmentInfo> colorTargetContext(const VulkanFrameBuffer& frameBuffer)
     {
         return m_renderTargets | std::views::filter([](const RenderTarget& renderTarget) { return renderTarget.type() != RenderTargetType::DepthStencil; }) |
@@ -165,8 +207,8 @@ public:
                     .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
                     .imageView = frameBuffer.imageView(renderTarget),
                     .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-                    .loadOp = renderTarget.clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-                    .storeOp = renderTarget.isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+                    .loadOp = getLoadOp(frameBuffer, renderTarget, renderTarget.clearBuffer()),
+                    .storeOp = getStoreOp(frameBuffer, renderTarget),
                     .clearValue = { .color = { .float32 = { renderTarget.clearValues().x(), renderTarget.clearValues().y(), renderTarget.clearValues().z(), renderTarget.clearValues().w() } } }
                 };
 
@@ -221,8 +263,8 @@ public:
             .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
             .imageView = frameBuffer.imageView(*m_depthStencilTarget),
             .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-            .loadOp = m_depthStencilTarget->clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-            .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+            .loadOp = getLoadOp(frameBuffer, *m_depthStencilTarget, m_depthStencilTarget->clearBuffer()),
+            .storeOp = getStoreOp(frameBuffer, *m_depthStencilTarget),
             .clearValue = { .depthStencil = { .depth = m_depthStencilTarget->clearValues().x(), .stencil = 0 } }
         };
     }
@@ -236,8 +278,8 @@ public:
             .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
             .imageView = frameBuffer.imageView(*m_depthStencilTarget),
             .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-            .loadOp = m_depthStencilTarget->clearStencil() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-            .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+            .loadOp = getLoadOp(frameBuffer, *m_depthStencilTarget, m_depthStencilTarget->clearStencil()),
+            .storeOp = getStoreOp(frameBuffer, *m_depthStencilTarget),
             .clearValue = { .depthStencil = { .depth = 0.0f, .stencil = static_cast<UInt32>(m_depthStencilTarget->clearValues().y()) } }
         };
     }
@@ -251,6 +293,46 @@ public:
     {
         return m_secondaryCommandBuffers.at(static_cast<const IFrameBuffer*>(&frameBuffer));
     }
+
+    SharedPtr<VulkanCommandBuffer> acquireCommandBuffer([[maybe_unused]] const VulkanRenderPass& renderPass)
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        auto& pool = m_commandBufferPools.at(static_cast<const IFrameBuffer*>(m_activeFrameBuffer.get()));
+
+        // Grow the pool, if all command buffers are currently acquired.
+        if (pool.acquired == pool.commandBuffers.size())
+        {
+            auto commandBuffer = m_queue->createCommandBuffer(false, true);
+#ifndef NDEBUG
+            m_device->setDebugName(std::as_const(*commandBuffer).handle(), VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 
+                std::format("{0} Pooled Commands {1}", renderPass.name(), pool.commandBuffers.size()).c_str());
+#endif
+            pool.commandBuffers.push_back(commandBuffer);
+        }
+
+        return pool.commandBuffers[pool.acquired++]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    Array<SharedPtr<VulkanCommandBuffer>> releaseCommandBuffers(const VulkanFrameBuffer& frameBuffer)
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        auto& pool = m_commandBufferPools.at(static_cast<const IFrameBuffer*>(&frameBuffer));
+        auto acquired = pool.commandBuffers | std::views::take(pool.acquired) | std::ranges::to<Array<SharedPtr<VulkanCommandBuffer>>>();
+
+        // Trim the pool to the largest number of command buffers acquired within the last interval. The released command buffers have not been used since the frame 
+        // buffer has been used the last time, so they are no longer executed.
+        pool.peak = std::max(pool.peak, pool.acquired);
+
+        if (++pool.frames >= POOL_TRIM_INTERVAL)
+        {
+            pool.commandBuffers.resize(pool.peak);
+            pool.peak = 0u;
+            pool.frames = 0u;
+        }
+
+        pool.acquired = 0u;
+        return acquired;
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -327,11 +409,30 @@ Enumerable<SharedPtr<const VulkanCommandBuffer>> VulkanRenderPass::commandBuffer
     }
 }
 
+SharedPtr<const VulkanCommandBuffer> VulkanRenderPass::acquireCommandBuffer() const
+{
+    if (m_impl->m_activeFrameBuffer == nullptr) [[unlikely]]
+        throw RuntimeException("Unable to acquire command buffers on a render pass that has not been begun.");
+
+    auto commandBuffer = m_impl->acquireCommandBuffer(*this);
+    commandBuffer->begin(*this);
+    return commandBuffer;
+}
+
 UInt32 VulkanRenderPass::secondaryCommandBuffers() const noexcept
 {
     return m_impl->m_secondaryCommandBufferCount;
 }
 
+UInt32 VulkanRenderPass::pooledCommandBuffers() const noexcept
+{
+    if (m_impl->m_activeFrameBuffer == nullptr)
+        return 0u;
+
+    std::lock_guard<std::mutex> lock(m_impl->m_poolMutex);
+    return static_cast<UInt32>(m_impl->m_commandBufferPools.at(m_impl->m_activeFrameBuffer.get()).commandBuffers.size());
+}
+
 const Array<RenderTarget>& VulkanRenderPass::renderTargets() const noexcept
 {
     return m_impl->m_renderTargets;
@@ -373,6 +474,11 @@ UInt32 VulkanRenderPass::viewMask() const noexcept
     return m_impl->m_viewMask;
 }
 
+std::pair<VkAttachmentLoadOp, VkAttachmentStoreOp> VulkanRenderPass::attachmentOperations(const VulkanFrameBuffer& frameBuffer, const RenderTarget& renderTarget, bool stencil) const
+{
+    return { VulkanRenderPassImpl::getLoadOp(frameBuffer, renderTarget, stencil ? renderTarget.clearStencil() : renderTarget.clearBuffer()), VulkanRenderPassImpl::getStoreOp(frameBuffer, renderTarget) };
+}
+
 void VulkanRenderPass::begin(const VulkanFrameBuffer& frameBuffer) const
 {
     // Only begin, if we are currently not running.
@@ -456,9 +562,12 @@ UInt64 VulkanRenderPass::end() const
     auto& frameBuffer = *m_impl->m_activeFrameBuffer;
     const auto& swapChain = m_impl->m_device->swapChain();
 
-    // End secondary command buffers and end rendering.
+    // End secondary command buffers and end rendering. Only execute pooled command buffers that have been acquired.
     auto primaryCommandBuffer = m_impl->getPrimaryCommandBuffer(frameBuffer);
-    auto secondaryHandles = m_impl->getSecondaryCommandBuffers(frameBuffer) |
+    auto secondaryCommandBuffers = m_impl->getSecondaryCommandBuffers(frameBuffer);
+    auto pooledCommandBuffers = m_impl->releaseCommandBuffers(frameBuffer);
+    secondaryCommandBuffers.insert(secondaryCommandBuffers.end(), pooledCommandBuffers.begin(), pooledCommandBuffers.end());
+    auto secondaryHandles = secondaryCommandBuffers |
         std::views::transform([](auto& commandBuffer) { commandBuffer->end(); return std::as_const(*commandBuffer).handle(); }) |
         std::ranges::to<Array<VkCommandBuffer>>();
     ::vkCmdExecuteCommands(std::as_const(*primaryCommandBuffer).handle(), static_cast<UInt32>(secondaryHandles.size()), secondaryHandles.data());
@@ -513,8 +622,21 @@ UInt64 VulkanRenderPass::end() const
         beginPresentBarrier.transition(backBufferImage, ResourceAccess::None, ResourceAccess::TransferWrite, ImageLayout::Undefined, ImageLayout::CopyDestination);
         primaryCommandBuffer->barrier(beginPresentBarrier);
 
+        // Only copy the region that has been rendered to, as the frame buffer images can be larger than the frame buffer, if it over-allocates them.
         auto& presentTarget = frameBuffer[*m_impl->m_presentTarget]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
-        primaryCommandBuffer->transfer(presentTarget, backBufferImage);
+        VkImageCopy copyInfo {
+            .srcSubresource = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 },
+            .srcOffset = { 0, 0, 0 },
+            .dstSubresource = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 },
+            .dstOffset = { 0, 0, 0 },
+            .extent = { 
+                static_cast<UInt32>(std::min(frameBuffer.size().width(), backBufferImage.extent().width())), 
+                static_cast<UInt32>(std::min(frameBuffer.size().height(), backBufferImage.extent().height())), 
+                1 
+            }
+        };
+
+        ::vkCmdCopyImage(std::as_const(*primaryCommandBuffer).handle(), std::as_const(presentTarget).handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, backBufferImage.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
 
         VulkanBarrier endPresentBarrier(PipelineStage::Transfer, PipelineStage::None);
         endPresentBarrier.transition(presentTarget, ResourceAccess::TransferRead, ResourceAccess::None, ImageLayout::CopySource, ImageLayout::ShaderResource);
@@ -522,13 +644,16 @@ UInt64 VulkanRenderPass::end() const
         primaryCommandBuffer->barrier(endPresentBarrier);
     }
     
-    // Submit and store the fence.
-    auto fence = m_impl->m_queue->submit(primaryCommandBuffer);
+    // Submit and store the fence. If one render target is a present target, let the swap chain submit the command buffer, so that presentation does not require 
+    // an additional queue submission.
+    auto fence = m_impl->m_presentTarget != nullptr ? 
+        swapChain.submit(primaryCommandBuffer) : 
+        m_impl->m_queue->submit(primaryCommandBuffer);
 
     if (!this->name().empty())
         m_impl->m_queue->endDebugRegion();
 
-    // If one render target is a present target, we can present it on the swap chain.
+    // Present after the debug region has been closed, so that it only contains the submission of the render pass.
     if (m_impl->m_presentTarget != nullptr)
         swapChain.present(fence);
 
@@ -57,7 +57,7 @@ public:
 	}
 
 public:
-	VkPipeline initialize([[maybe_unused]] const VulkanRenderPipeline& parent, MultiSamplingLevel samples)
+	VkPipeline initialize([[maybe_unused]] const VulkanRenderPipeline& parent)
 	{
 		// Get the shader modules.
 		auto& modules = m_program->modules();
@@ -87,7 +87,6 @@ public:
 			| std::ranges::to<Array<VkPipelineShaderStageCreateInfo>>();
 
 		// Setup the pipeline.
-		m_samples = samples;
 		auto pipeline = this->initializeGraphicsPipeline(parent, dynamicState, shaderStages);
 
 #ifndef NDEBUG
@@ -310,6 +309,7 @@ public:
 			.subpass = 0
 		};
 
+		LITEFX_PROFILE_ZONE(m_renderPass->device().instrumentation(), "VulkanRenderPipeline::compile");
 		VkPipeline pipeline{};
 		raiseIfFailed(::vkCreateGraphicsPipelines(m_renderPass->device().handle(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline), "Unable to create render pipeline.");
 
@@ -480,7 +480,8 @@ public:
 VulkanRenderPipeline::VulkanRenderPipeline(const VulkanRenderPass& renderPass, const SharedPtr<VulkanPipelineLayout>& layout, const SharedPtr<VulkanShaderProgram>& shaderProgram, const SharedPtr<VulkanInputAssembler>& inputAssembler, const SharedPtr<VulkanRasterizer>& rasterizer, MultiSamplingLevel samples, bool enableAlphaToCoverage, const String& name) :
 	VulkanPipelineState(VK_NULL_HANDLE), m_impl(renderPass, enableAlphaToCoverage, layout, shaderProgram, inputAssembler, rasterizer)
 {
-	this->handle() = m_impl->initialize(*this, samples);
+	m_impl->m_samples = samples;
+	this->handle() = m_impl->initialize(*this);
 
 	if (!name.empty())
 		this->name() = name;
@@ -498,6 +499,7 @@ VulkanRenderPipeline::VulkanRenderPipeline(const VulkanRenderPass& renderPass, c
 
 VulkanRenderPipeline::~VulkanRenderPipeline() noexcept
 {
+	this->finishCompilation();
 	::vkDestroyPipeline(m_impl->m_renderPass->device().handle(), this->handle(), nullptr);
 }
 
@@ -533,6 +535,9 @@ MultiSamplingLevel VulkanRenderPipeline::samples() const noexcept
 
 void VulkanRenderPipeline::updateSamples(MultiSamplingLevel samples)
 {
+	// Wait for pending compilation, before the pipeline state gets replaced.
+	this->wait();
+
 	// Release all frame buffer bindings.
 	m_impl->m_inputAttachmentBindings.clear();
 
@@ -540,7 +545,8 @@ void VulkanRenderPipeline::updateSamples(MultiSamplingLevel samples)
 	::vkDestroyPipeline(m_impl->m_renderPass->device().handle(), this->handle(), nullptr);
 
 	// Rebuild the pipeline.
-	this->handle() = m_impl->initialize(*this, samples);
+	m_impl->m_samples = samples;
+	this->handle() = m_impl->initialize(*this);
 }
 
 VkPipelineBindPoint VulkanRenderPipeline::pipelineType() const noexcept
@@ -550,6 +556,9 @@ VkPipelineBindPoint VulkanRenderPipeline::pipelineType() const noexcept
 
 void VulkanRenderPipeline::use(const VulkanCommandBuffer& commandBuffer) const
 {
+	// Block until the pipeline state is compiled, if it is compiled asynchronously.
+	this->wait();
+
 	::vkCmdBindPipeline(commandBuffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, this->handle());
 
 	// Set the line width (in case it has been changed). Currently we do not expose an command buffer interface for this, since this is mostly unsupported anyway and has no D3D12 counter-part.
@@ -584,6 +593,11 @@ void VulkanRenderPipelineBuilder::build()
 	instance->m_impl->m_inputAssembler = this->state().inputAssembler;
 	instance->m_impl->m_rasterizer = this->state().rasterizer;
 	instance->m_impl->m_alphaToCoverage = this->state().enableAlphaToCoverage;
-	instance->handle() = instance->m_impl->initialize(*instance, this->state().samples);
+	instance->m_impl->m_samples = this->state().samples;
+
+	if (this->state().compileAsync)
+		instance->compileAsync(instance->m_impl->m_renderPass->device().scheduler(), [instance]() { return instance->m_impl->initialize(*instance); });
+	else
+		instance->handle() = instance->m_impl->initialize(*instance);
 }
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
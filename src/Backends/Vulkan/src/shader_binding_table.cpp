@@ -0,0 +1,378 @@
+#include <litefx/backends/vulkan.hpp>
+#include "buffer.h"
+
+using namespace LiteFX::Rendering::Backends;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+extern PFN_vkGetRayTracingShaderGroupHandlesKHR vkGetRayTracingShaderGroupHandles;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanShaderBindingTable::VulkanShaderBindingTableImpl {
+public:
+    friend class VulkanShaderBindingTable;
+
+private:
+    static constexpr UInt32 MAX_FRAMES = 64;
+
+    struct Record {
+        ShaderBindingGroup Group;
+        UInt32 ShaderGroup;
+        UInt64 Offset;
+    };
+
+    struct FrameBuffer {
+        SharedPtr<IVulkanBuffer> Buffer;
+        VmaAllocator Allocator{ nullptr };
+        VmaAllocation Allocation{ nullptr };
+        Byte* Data{ nullptr };
+        UInt32 HitGroupCapacity{ 0u };
+    };
+
+private:
+    WeakPtr<const VulkanDevice> m_device;
+    UInt32 m_frames;
+    UInt64 m_handleSize{ 0u }, m_recordSize{ 0u }, m_baseAlignment{ 1u };
+    UInt32 m_hitGroups{ 0u }, m_hitGroupCapacity{ 0u };
+    ShaderBindingTableOffsets m_offsets{ };
+    Array<Byte> m_groupHandles;
+    Array<std::optional<Record>> m_records;
+    Array<UInt64> m_staleFrames;
+    Array<Byte> m_shadow;
+    Array<FrameBuffer> m_buffers;
+    mutable std::mutex m_mutex;
+
+public:
+    VulkanShaderBindingTableImpl(const VulkanDevice& device, UInt32 frames) :
+        m_device(device.weak_from_this()), m_frames(frames), m_buffers(frames)
+    {
+        if (frames == 0u || frames > MAX_FRAMES) [[unlikely]]
+            throw ArgumentOutOfRangeException("frames", std::make_pair(1u, MAX_FRAMES), frames, "The number of frames must be between 1 and {1}, but was {0}.", frames, MAX_FRAMES);
+    }
+
+    VulkanShaderBindingTableImpl(VulkanShaderBindingTableImpl&&) noexcept = delete;
+    VulkanShaderBindingTableImpl(const VulkanShaderBindingTableImpl&) = delete;
+    VulkanShaderBindingTableImpl& operator=(VulkanShaderBindingTableImpl&&) noexcept = delete;
+    VulkanShaderBindingTableImpl& operator=(const VulkanShaderBindingTableImpl&) = delete;
+
+    ~VulkanShaderBindingTableImpl() noexcept
+    {
+        for (auto& buffer : m_buffers)
+            this->release(buffer);
+    }
+
+public:
+    void initialize(const VulkanDevice& device, const VulkanRayTracingPipeline& pipeline, UInt32 hitGroupCapacity, UInt64 maxLocalDataSize, ShaderBindingGroup groups)
+    {
+        // Get the physical device properties, as they dictate alignment rules.
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR rayTracingProperties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR };
+        VkPhysicalDeviceProperties2 deviceProperties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &rayTracingProperties };
+        ::vkGetPhysicalDeviceProperties2(device.adapter().handle(), &deviceProperties);
+
+        m_handleSize = rayTracingProperties.shaderGroupHandleSize;
+        m_baseAlignment = rayTracingProperties.shaderGroupBaseAlignment;
+
+        // Query all shader group handles at once. Shader group handles can only be queried after the pipeline state has been compiled.
+        pipeline.wait();
+        const auto& shaderRecords = pipeline.shaderRecords().shaderRecords();
+        auto groupCount = static_cast<UInt32>(shaderRecords.size());
+        m_groupHandles.resize(static_cast<size_t>(m_handleSize * groupCount));
+        raiseIfFailed(::vkGetRayTracingShaderGroupHandles(device.handle(), pipeline.handle(), 0, groupCount, m_groupHandles.size(), m_groupHandles.data()), "Unable to query shader group handles.");
+
+        // Assign each record to its shader binding group.
+        auto groupOf = [](const IShaderRecord& record) {
+            switch (record.type())
+            {
+            case ShaderRecordType::RayGeneration: return ShaderBindingGroup::RayGeneration;
+            case ShaderRecordType::Miss:          return ShaderBindingGroup::Miss;
+            case ShaderRecordType::Callable:      return ShaderBindingGroup::Callable;
+            case ShaderRecordType::Intersection:
+            case ShaderRecordType::HitGroup:      return ShaderBindingGroup::HitGroup;
+            default: std::unreachable(); // Must be caught during pipeline creation!
+            }
+        };
+
+        auto localDataSize = maxLocalDataSize;
+
+        for (const auto& record : shaderRecords | std::views::filter([&](const auto& record) { return LITEFX_FLAG_IS_SET(groups, groupOf(*record)); }))
+            localDataSize = std::max(localDataSize, record->localDataSize());
+
+        m_recordSize = Math::align<UInt64>(m_handleSize + localDataSize, rayTracingProperties.shaderGroupHandleAlignment);
+
+        // Compute the layout of each group. The hit group table is placed last, so that it can grow without moving other records.
+        m_records.resize(groupCount);
+        UInt64 offset{ 0u };
+
+        for (auto group : { ShaderBindingGroup::RayGeneration, ShaderBindingGroup::Miss, ShaderBindingGroup::Callable, ShaderBindingGroup::HitGroup })
+        {
+            if (!LITEFX_FLAG_IS_SET(groups, group))
+                continue;
+
+            offset = Math::align<UInt64>(offset, m_baseAlignment);
+            UInt32 records{ 0u };
+
+            for (UInt32 i{ 0u }; i < groupCount; ++i)
+            {
+                if (groupOf(*shaderRecords[i]) == group) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    m_records[i] = Record { .Group = group, .ShaderGroup = i, .Offset = offset + (records++) * m_recordSize }; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            }
+
+            auto size = records * m_recordSize;
+
+            switch (group)
+            {
+            case ShaderBindingGroup::RayGeneration:
+                m_offsets.RayGenerationGroupOffset = offset;
+                m_offsets.RayGenerationGroupSize = size;
+                m_offsets.RayGenerationGroupStride = m_recordSize;
+                break;
+            case ShaderBindingGroup::Miss:
+                m_offsets.MissGroupOffset = offset;
+                m_offsets.MissGroupSize = size;
+                m_offsets.MissGroupStride = m_recordSize;
+                break;
+            case ShaderBindingGroup::Callable:
+                m_offsets.CallableGroupOffset = offset;
+                m_offsets.CallableGroupSize = size;
+                m_offsets.CallableGroupStride = m_recordSize;
+                break;
+            case ShaderBindingGroup::HitGroup:
+                m_offsets.HitGroupOffset = offset;
+                m_offsets.HitGroupSize = size;
+                m_offsets.HitGroupStride = m_recordSize;
+                m_hitGroups = records;
+                break;
+            default:
+                std::unreachable();
+            }
+
+            offset += size;
+        }
+
+        // Write the initial records into the shadow copy.
+        m_hitGroupCapacity = std::max(hitGroupCapacity, m_hitGroups);
+        m_shadow.resize(static_cast<size_t>(this->tableSize(m_hitGroupCapacity)), 0x00_b);
+        m_staleFrames.resize(m_records.size(), 0u);
+
+        for (UInt32 i{ 0u }; i < groupCount; ++i)
+        {
+            if (m_records[i].has_value()) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                this->write(i, shaderRecords[i]->localData(), static_cast<size_t>(shaderRecords[i]->localDataSize())); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        }
+    }
+
+private:
+    UInt64 tableSize(UInt32 hitGroupCapacity) const noexcept
+    {
+        // The hit group table starts at `HitGroupOffset`, if hit groups are included. Otherwise the table ends after the last included group.
+        if (m_offsets.HitGroupOffset != std::numeric_limits<UInt64>::max())
+            return m_offsets.HitGroupOffset + hitGroupCapacity * m_recordSize;
+
+        return std::ranges::max({
+            m_offsets.RayGenerationGroupOffset == std::numeric_limits<UInt64>::max() ? 0u : m_offsets.RayGenerationGroupOffset + m_offsets.RayGenerationGroupSize,
+            m_offsets.MissGroupOffset == std::numeric_limits<UInt64>::max() ? 0u : m_offsets.MissGroupOffset + m_offsets.MissGroupSize,
+            m_offsets.CallableGroupOffset == std::numeric_limits<UInt64>::max() ? 0u : m_offsets.CallableGroupOffset + m_offsets.CallableGroupSize,
+            m_recordSize
+        });
+    }
+
+    const Record& record(UInt32 record) const
+    {
+        if (record >= m_records.size() || !m_records[record].has_value()) [[unlikely]] // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            throw ArgumentOutOfRangeException("record", std::make_pair(0u, static_cast<UInt32>(m_records.size())), record, "The shader binding table does not contain a record with the index {0}.", record);
+
+        return m_records[record].value(); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    void write(UInt32 index, const void* data, size_t size)
+    {
+        const auto& record = this->record(index);
+
+        if (m_handleSize + size > m_recordSize) [[unlikely]]
+            throw InvalidArgumentException("size", "The local data size of {0} bytes exceeds the local data size of the shader binding table records ({1} bytes).", size, m_recordSize - m_handleSize);
+
+        auto recordData = std::next(m_shadow.data(), static_cast<std::ptrdiff_t>(record.Offset));
+        std::memcpy(recordData, std::next(m_groupHandles.data(), static_cast<std::ptrdiff_t>(record.ShaderGroup * m_handleSize)), static_cast<size_t>(m_handleSize));
+        std::fill(std::next(recordData, static_cast<std::ptrdiff_t>(m_handleSize)), std::next(recordData, static_cast<std::ptrdiff_t>(m_recordSize)), 0x00_b);
+
+        if (size > 0u)
+            std::memcpy(std::next(recordData, static_cast<std::ptrdiff_t>(m_handleSize)), data, size);
+
+        // Mark the record as stale in all frames.
+        m_staleFrames[index] = m_frames == MAX_FRAMES ? std::numeric_limits<UInt64>::max() : (1ull << m_frames) - 1ull; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    void release(FrameBuffer& buffer) noexcept
+    {
+        if (buffer.Data != nullptr)
+            ::vmaUnmapMemory(buffer.Allocator, buffer.Allocation);
+
+        buffer = { };
+    }
+
+public:
+    void updateLocalData(UInt32 record, const void* data, size_t size)
+    {
+        this->write(record, data, size);
+    }
+
+    UInt32 appendHitGroup(UInt32 index, const void* data, size_t size)
+    {
+        auto source = this->record(index);
+
+        if (source.Group != ShaderBindingGroup::HitGroup) [[unlikely]]
+            throw InvalidArgumentException("record", "The record {0} is not a hit group record.", index);
+
+        // Grow the shadow copy, if the capacity is exhausted. The buffers of each frame are re-allocated when they are prepared next.
+        if (m_hitGroups == m_hitGroupCapacity)
+        {
+            m_hitGroupCapacity = std::max(m_hitGroupCapacity * 2u, 1u);
+            m_shadow.resize(static_cast<size_t>(this->tableSize(m_hitGroupCapacity)), 0x00_b);
+        }
+
+        auto appended = static_cast<UInt32>(m_records.size());
+        m_records.emplace_back(Record { .Group = ShaderBindingGroup::HitGroup, .ShaderGroup = source.ShaderGroup, .Offset = m_offsets.HitGroupOffset + m_hitGroups * m_recordSize });
+        m_staleFrames.push_back(0u);
+        m_hitGroups++;
+        m_offsets.HitGroupSize = m_hitGroups * m_recordSize;
+
+        this->write(appended, data, size);
+
+        return appended;
+    }
+
+    SharedPtr<const IVulkanBuffer> prepare(UInt32 frame)
+    {
+        if (frame >= m_frames) [[unlikely]]
+            throw ArgumentOutOfRangeException("frame", std::make_pair(0u, m_frames), frame, "The frame index {0} is out of range. The shader binding table only contains {1} frames.", frame, m_frames);
+
+        auto& buffer = m_buffers[frame]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        auto frameMask = 1ull << frame;
+
+        // (Re-)allocate the buffer, if it does not fit the current capacity. All records need to be written afterwards.
+        if (buffer.Buffer == nullptr || buffer.HitGroupCapacity < m_hitGroupCapacity)
+        {
+            auto device = m_device.lock();
+
+            if (device == nullptr) [[unlikely]]
+                throw RuntimeException("Unable to allocate shader binding table on a released device instance.");
+
+            this->release(buffer);
+            buffer.Buffer = device->factory().createBuffer(BufferType::ShaderBindingTable, ResourceHeap::Dynamic, m_shadow.size(), 1, ResourceUsage::TransferSource);
+            buffer.HitGroupCapacity = m_hitGroupCapacity;
+
+            // Keep the buffer memory mapped for the lifetime of the buffer.
+            const auto& vulkanBuffer = dynamic_cast<const VulkanBuffer&>(*buffer.Buffer);
+            buffer.Allocator = vulkanBuffer.allocator();
+            buffer.Allocation = vulkanBuffer.allocationInfo();
+            void* data{ nullptr };
+            raiseIfFailed(::vmaMapMemory(buffer.Allocator, buffer.Allocation, &data), "Unable to map shader binding table memory.");
+            buffer.Data = static_cast<Byte*>(data);
+
+            std::memcpy(buffer.Data, m_shadow.data(), m_shadow.size());
+            raiseIfFailed(::vmaFlushAllocation(buffer.Allocator, buffer.Allocation, 0, VK_WHOLE_SIZE), "Unable to flush shader binding table memory.");
+            std::ranges::for_each(m_staleFrames, [frameMask](auto& staleFrames) { staleFrames &= ~frameMask; });
+
+            return buffer.Buffer;
+        }
+
+        // Only write the records that changed since the last time this frame has been prepared.
+        UInt64 begin{ std::numeric_limits<UInt64>::max() }, end{ 0u };
+
+        for (auto [staleFrames, record] : std::views::zip(m_staleFrames, m_records))
+        {
+            if ((staleFrames & frameMask) == 0u)
+                continue;
+
+            auto offset = record->Offset;
+            std::memcpy(std::next(buffer.Data, static_cast<std::ptrdiff_t>(offset)), std::next(m_shadow.data(), static_cast<std::ptrdiff_t>(offset)), static_cast<size_t>(m_recordSize));
+            staleFrames &= ~frameMask;
+            begin = std::min(begin, offset);
+            end = std::max(end, offset + m_recordSize);
+        }
+
+        if (begin < end)
+            raiseIfFailed(::vmaFlushAllocation(buffer.Allocator, buffer.Allocation, begin, end - begin), "Unable to flush shader binding table memory.");
+
+        return buffer.Buffer;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanShaderBindingTable::VulkanShaderBindingTable(const VulkanDevice& device, const VulkanRayTracingPipeline& pipeline, UInt32 frames, UInt32 hitGroupCapacity, UInt64 maxLocalDataSize, ShaderBindingGroup groups) :
+    m_impl(device, frames)
+{
+    m_impl->initialize(device, pipeline, hitGroupCapacity, maxLocalDataSize, groups);
+}
+
+VulkanShaderBindingTable::~VulkanShaderBindingTable() noexcept = default;
+
+UInt32 VulkanShaderBindingTable::frames() const noexcept
+{
+    return m_impl->m_frames;
+}
+
+UInt32 VulkanShaderBindingTable::records() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return static_cast<UInt32>(m_impl->m_records.size());
+}
+
+UInt32 VulkanShaderBindingTable::hitGroups() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_hitGroups;
+}
+
+UInt32 VulkanShaderBindingTable::hitGroupCapacity() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_hitGroupCapacity;
+}
+
+UInt64 VulkanShaderBindingTable::recordSize() const noexcept
+{
+    return m_impl->m_recordSize;
+}
+
+UInt64 VulkanShaderBindingTable::recordOffset(UInt32 record) const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->record(record).Offset;
+}
+
+ShaderBindingTableOffsets VulkanShaderBindingTable::offsets() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_offsets;
+}
+
+void VulkanShaderBindingTable::updateLocalData(UInt32 record, const void* data, size_t size) const
+{
+    if (data == nullptr && size > 0u) [[unlikely]]
+        throw ArgumentNotInitializedException("data", "The data pointer must be initialized.");
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    m_impl->updateLocalData(record, data, size);
+}
+
+UInt32 VulkanShaderBindingTable::appendHitGroup(UInt32 record, const void* data, size_t size) const
+{
+    if (data == nullptr && size > 0u) [[unlikely]]
+        throw ArgumentNotInitializedException("data", "The data pointer must be initialized.");
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->appendHitGroup(record, data, size);
+}
+
+SharedPtr<const IVulkanBuffer> VulkanShaderBindingTable::prepare(UInt32 frame) const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->prepare(frame);
+}
@@ -15,7 +15,9 @@ private:
 	SharedPtr<const VulkanDevice> m_device;
 	ShaderStage m_type;
 	String m_fileName, m_entryPoint;
-	Array<UInt32> m_bytecode;
+	Array<UInt32> m_buffer;
+	SharedPtr<const ShaderArchive> m_archive;
+	Span<const UInt32> m_bytecode;
 	Optional<DescriptorBindingPoint> m_shaderLocalDescriptor;
 
 public:
@@ -25,41 +27,71 @@ public:
 	}
 
 private:
-	Array<char> readFileContents(const String& fileName)
+	void readFileContents(const String& fileName)
 	{
-		std::ifstream file(fileName, std::ios::in | std::ios::binary);
+		std::ifstream file(fileName, std::ios::in | std::ios::binary | std::ios::ate);
 		
 		if (!file.is_open())
 			throw std::runtime_error("Unable to open shader file.");
 
-		return this->readStreamContents(file);
+		// Read the file directly into the byte code buffer.
+		auto size = static_cast<size_t>(file.tellg());
+		m_buffer.resize(Math::align(size, sizeof(UInt32)) / sizeof(UInt32));
+		file.seekg(0, std::ios::beg);
+		file.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(size)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		m_bytecode = m_buffer;
 	}
 
-	Array<char> readStreamContents(std::istream& stream)
+	void readStreamContents(std::istream& stream)
 	{
-		return { std::istreambuf_iterator<char>(stream), {} };
+		Array<char> contents{ std::istreambuf_iterator<char>(stream), {} };
+
+		// TODO: We may be able to use std::start_lifetime_as here instead.
+		m_buffer.resize(Math::align(contents.size(), sizeof(UInt32)) / sizeof(UInt32));
+		std::memcpy(m_buffer.data(), contents.data(), contents.size());
+		m_bytecode = m_buffer;
+	}
+
+	void mapArchiveContents(const SharedPtr<const ShaderArchive>& archive)
+	{
+		if (archive == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+		auto data = archive->find(m_fileName);
+
+		if (data.size() % sizeof(UInt32) != 0) [[unlikely]]
+			throw InvalidArgumentException("name", "The shader archive entry {0} does not contain valid SPIR-V byte code.", m_fileName);
+
+		// NOTE: Archive entries are aligned to ShaderArchive::ALIGNMENT, so it is safe to interpret the mapped memory as 32 bit words.
+		m_archive = archive;
+		m_bytecode = { reinterpret_cast<const UInt32*>(data.data()), data.size() / sizeof(UInt32) }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
 	}
 
 public:
 	VkShaderModule initialize()
 	{
-		return this->initialize(this->readFileContents(m_fileName));
+		this->readFileContents(m_fileName);
+		return this->createModule();
 	}
 
 	VkShaderModule initialize(std::istream& stream)
 	{
-		return this->initialize(this->readStreamContents(stream));
+		this->readStreamContents(stream);
+		return this->createModule();
 	}
 
-	VkShaderModule initialize(const Array<char>& fileContents)
+	VkShaderModule initialize(const SharedPtr<const ShaderArchive>& archive)
 	{
-		// TODO: We may be able to use std::start_lifetime_as here instead.
-		m_bytecode.resize(Math::align(fileContents.size(), sizeof(UInt32)) / sizeof(UInt32));
-		std::memcpy(m_bytecode.data(), fileContents.data(), fileContents.size());
+		this->mapArchiveContents(archive);
+		return this->createModule();
+	}
 
+private:
+	VkShaderModule createModule()
+	{
 		VkShaderModuleCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		createInfo.codeSize = fileContents.size();
+		createInfo.codeSize = m_bytecode.size_bytes();
 		createInfo.pCode = m_bytecode.data();
 
 		VkShaderModule module{};
@@ -91,6 +123,12 @@ VulkanShaderModule::VulkanShaderModule(const VulkanDevice& device, ShaderStage t
 	this->handle() = m_impl->initialize(stream);
 }
 
+VulkanShaderModule::VulkanShaderModule(const VulkanDevice& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) :
+	Resource<VkShaderModule>(VK_NULL_HANDLE), m_impl(device, type, name, entryPoint, shaderLocalDescriptor)
+{
+	this->handle() = m_impl->initialize(archive);
+}
+
 VulkanShaderModule::VulkanShaderModule(VulkanShaderModule&&) noexcept = default;
 VulkanShaderModule& VulkanShaderModule::operator=(VulkanShaderModule&&) noexcept = default;
 
@@ -114,7 +152,7 @@ const String& VulkanShaderModule::entryPoint() const noexcept
 	return m_impl->m_entryPoint;
 }
 
-const Array<UInt32>& VulkanShaderModule::bytecode() const noexcept
+Span<const UInt32> VulkanShaderModule::bytecode() const noexcept
 {
 	return m_impl->m_bytecode;
 }
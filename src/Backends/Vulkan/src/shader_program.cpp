@@ -1,6 +1,8 @@
 #include <litefx/backends/vulkan.hpp>
 #include <litefx/backends/vulkan_builders.hpp>
 #include <spirv_reflect.h>
+#include <bit>
+#include <cstring>
 #include <fstream>
 #include <numeric>
 
@@ -69,7 +71,7 @@ private:
         SharedPtr<IVulkanSampler> staticSampler{};
         bool unbounded{false};
 
-        bool equals(const DescriptorInfo& rhs)
+        bool equals(const DescriptorInfo& rhs) const
         {
             return
                 this->location == rhs.location &&
@@ -94,6 +96,57 @@ private:
         UInt32 size;
     };
 
+    struct ModuleReflection {
+    public:
+        struct SetInfo {
+        public:
+            UInt32 space{};
+            Array<DescriptorInfo> descriptors;
+        };
+
+        struct RangeInfo {
+        public:
+            UInt32 offset{};
+            UInt32 size{};
+        };
+
+        Array<SetInfo> descriptorSets;
+        Array<RangeInfo> pushConstants;
+    };
+
+    struct ReflectionKey {
+    public:
+        std::array<UInt32, 8> digest{};
+        UInt64 size{};
+
+        auto operator<=>(const ReflectionKey&) const noexcept = default;
+    };
+
+    struct ReflectionCache {
+    public:
+        std::mutex mutex;
+        std::map<ReflectionKey, SharedPtr<const ModuleReflection>> entries;
+    };
+
+    struct ReflectionCacheReader {
+    public:
+        Span<const char> data;
+
+        template <typename T>
+        bool read(T& value) noexcept
+        {
+            if (data.size() < sizeof(T))
+                return false;
+
+            std::memcpy(&value, data.data(), sizeof(T));
+            data = data.subspan(sizeof(T));
+            return true;
+        }
+    };
+
+    static constexpr UInt32 REFLECTION_CACHE_MAGIC = 0x4352464C; // "LFRC"
+    static constexpr UInt32 REFLECTION_CACHE_VERSION = 3;
+
 public:
     VulkanShaderProgramImpl(const VulkanDevice& device, Enumerable<UniquePtr<const VulkanShaderModule>>&& modules) :
         m_device(device.shared_from_this())
@@ -197,127 +250,443 @@ public:
             throw InvalidArgumentException("modules", "A shader program that contains only a fragment/pixel shader is not valid.");
     }
 
-    SharedPtr<VulkanPipelineLayout> reflectPipelineLayout(Enumerable<PipelineBindingHint> hints)
+    static SharedPtr<const ModuleReflection> reflectModule(Span<const UInt32> bytecode)
     {
-        // Put the hints into a map so we can easier look them up.
-        auto hintsMap = hints
-            | std::views::transform([](const auto& hint) -> std::pair<DescriptorBindingPoint, PipelineBindingHint> { return { hint.Binding, hint }; })
-            | std::ranges::to<std::map>();
+        // Initialize a reflection module.
+        spv_reflect::ShaderModule reflection(bytecode.size_bytes(), bytecode.data());
+        auto result = reflection.GetResult();
 
-        // First, filter the descriptor sets and push constant ranges.
-        Dictionary<UInt32, DescriptorSetInfo> descriptorSetLayouts;
-        Array<PushConstantRangeInfo> pushConstantRanges;
+        if (result != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to reflect shader module (Error {0:x}).", static_cast<UInt32>(reflection.GetResult()));
 
-        // Extract reflection data from all shader modules.
-        std::ranges::for_each(m_modules, [&](auto& shaderModule) {
-            // Read the file and initialize a reflection module.
-            auto bytecode = shaderModule->bytecode();
-            spv_reflect::ShaderModule reflection(bytecode.size() * sizeof(UInt32), bytecode.data());
-            auto result = reflection.GetResult();
+        // Get the number of descriptor sets and push constants.
+        UInt32 descriptorSetCount{}, pushConstantCount{};
 
-            if (result != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to reflect shader module (Error {0:x}).", static_cast<UInt32>(reflection.GetResult()));
+        // NOLINTBEGIN(bugprone-assignment-in-if-condition)
+        if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to get descriptor set count (Error {0:x}).", static_cast<UInt32>(result));
 
-            // Get the number of descriptor sets and push constants.
-            UInt32 descriptorSetCount{}, pushConstantCount{};
+        if ((result = reflection.EnumeratePushConstantBlocks(&pushConstantCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to get push constants count (Error {0:x}).", static_cast<UInt32>(result));
 
-            // NOLINTBEGIN(bugprone-assignment-in-if-condition)
-            if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to get descriptor set count (Error {0:x}).", static_cast<UInt32>(result));
+        // Acquire the descriptor sets and push constants.
+        Array<SpvReflectDescriptorSet*> descriptorSets(descriptorSetCount);
+        Array<SpvReflectBlockVariable*> pushConstants(pushConstantCount);
 
-            if ((result = reflection.EnumeratePushConstantBlocks(&pushConstantCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to get push constants count (Error {0:x}).", static_cast<UInt32>(result));
+        if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, descriptorSets.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to enumerate descriptor sets (Error {0:x}).", static_cast<UInt32>(result));
 
-            // Acquire the descriptor sets and push constants.
-            Array<SpvReflectDescriptorSet*> descriptorSets(descriptorSetCount);
-            Array<SpvReflectBlockVariable*> pushConstants(pushConstantCount);
+        if ((result = reflection.EnumeratePushConstantBlocks(&pushConstantCount, pushConstants.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to enumerate push constants (Error {0:x}).", static_cast<UInt32>(result));
+        // NOLINTEND(bugprone-assignment-in-if-condition)
 
-            if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, descriptorSets.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to enumerate descriptor sets (Error {0:x}).", static_cast<UInt32>(result));
+        auto moduleReflection = makeShared<ModuleReflection>();
 
-            if ((result = reflection.EnumeratePushConstantBlocks(&pushConstantCount, pushConstants.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to enumerate push constants (Error {0:x}).", static_cast<UInt32>(result));
-            // NOLINTEND(bugprone-assignment-in-if-condition)
-            
-            // Parse the descriptor sets.
-            std::ranges::for_each(descriptorSets, [&shaderModule, &descriptorSetLayouts](const SpvReflectDescriptorSet* descriptorSet) {
-                // Get all descriptor layouts.
-                Array<DescriptorInfo> descriptors(descriptorSet->binding_count);
+        // Parse the descriptor sets.
+        std::ranges::for_each(descriptorSets, [&moduleReflection](const SpvReflectDescriptorSet* descriptorSet) {
+            // Get all descriptor layouts.
+            Array<DescriptorInfo> descriptors(descriptorSet->binding_count);
 
-                std::ranges::generate(descriptors, [&descriptorSet, i = 0]() mutable {
-                    auto descriptor = descriptorSet->bindings[i++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::ranges::generate(descriptors, [&descriptorSet, i = 0]() mutable {
+                auto descriptor = descriptorSet->bindings[i++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-                    // Filter the descriptor type.
-                    DescriptorType type{ DescriptorType::ConstantBuffer };
-                    UInt32 inputAttachmentIndex = 0;
+                // Filter the descriptor type.
+                DescriptorType type{ DescriptorType::ConstantBuffer };
+                UInt32 inputAttachmentIndex = 0;
 
-                    switch (descriptor->descriptor_type)
-                    {
-                    default: throw RuntimeException("Unsupported descriptor type detected.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     throw RuntimeException("The shader exposes a combined image samplers, which is currently not supported.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:     throw RuntimeException("The shader exposes a dynamic buffer, which is currently not supported.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           type = DescriptorType::InputAttachment; inputAttachmentIndex = descriptor->input_attachment_index; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLER:                    type = DescriptorType::Sampler; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              type = DescriptorType::Texture; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_IMAGE:              type = DescriptorType::RWTexture; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             type = DescriptorType::ConstantBuffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       type = DescriptorType::Buffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       type = DescriptorType::RWBuffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: type = DescriptorType::AccelerationStructure; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                    {
-                        // NOTE: Storage buffers need special care here. For more information see: 
-                        //       https://github.com/microsoft/DirectXShaderCompiler/blob/main/docs/SPIR-V.rst#constant-texture-structured-byte-buffers.
-                        //       Structured buffers and byte address buffers all translate into storage buffers, which in Vulkan terms only differ in how they are bound. We still try to approximate 
-                        //       which buffer type was used for compilation, but at least for how Vulkan is concerned it does not matter anyway.
-                        // TODO: There's also  `TextureBuffer`/`tbuffer`, that lands here. But how does it relate to texel buffers?
-                        
-                        // All buffers should have at least one member that stores the type info about the contained type. Descriptor arrays are of type `SpvOpTypeRuntimeArray`. To differentiate
-                        // between `ByteAddressBuffer` and `StructuredBuffer`, we check the type flags of the first member. If it identifies an array of DWORDs, we treat the descriptor as 
-                        // `ByteAddressBuffer`, though it could be a flavor of `StructuredBuffer<int>`. This is conceptually identical, so it ultimately makes no difference.
-                        if ((descriptor->type_description->members[0].type_flags & SPV_REFLECT_TYPE_FLAG_STRUCT) == SPV_REFLECT_TYPE_FLAG_STRUCT) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                            type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::StructuredBuffer : DescriptorType::RWStructuredBuffer;
-                        else
-                            type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::ByteAddressBuffer : DescriptorType::RWByteAddressBuffer;
+                switch (descriptor->descriptor_type)
+                {
+                default: throw RuntimeException("Unsupported descriptor type detected.");
+                case SPV_REFLECT_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     throw RuntimeException("The shader exposes a combined image samplers, which is currently not supported.");
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:     throw RuntimeException("The shader exposes a dynamic buffer, which is currently not supported.");
+                case SPV_REFLECT_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           type = DescriptorType::InputAttachment; inputAttachmentIndex = descriptor->input_attachment_index; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLER:                    type = DescriptorType::Sampler; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              type = DescriptorType::Texture; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_IMAGE:              type = DescriptorType::RWTexture; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             type = DescriptorType::ConstantBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       type = DescriptorType::Buffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       type = DescriptorType::RWBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: type = DescriptorType::AccelerationStructure; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                {
+                    // NOTE: Storage buffers need special care here. For more information see: 
+                    //       https://github.com/microsoft/DirectXShaderCompiler/blob/main/docs/SPIR-V.rst#constant-texture-structured-byte-buffers.
+                    //       Structured buffers and byte address buffers all translate into storage buffers, which in Vulkan terms only differ in how they are bound. We still try to approximate 
+                    //       which buffer type was used for compilation, but at least for how Vulkan is concerned it does not matter anyway.
+                    // TODO: There's also  `TextureBuffer`/`tbuffer`, that lands here. But how does it relate to texel buffers?
+                    
+                    // All buffers should have at least one member that stores the type info about the contained type. Descriptor arrays are of type `SpvOpTypeRuntimeArray`. To differentiate
+                    // between `ByteAddressBuffer` and `StructuredBuffer`, we check the type flags of the first member. If it identifies an array of DWORDs, we treat the descriptor as 
+                    // `ByteAddressBuffer`, though it could be a flavor of `StructuredBuffer<int>`. This is conceptually identical, so it ultimately makes no difference.
+                    if ((descriptor->type_description->members[0].type_flags & SPV_REFLECT_TYPE_FLAG_STRUCT) == SPV_REFLECT_TYPE_FLAG_STRUCT) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::StructuredBuffer : DescriptorType::RWStructuredBuffer;
+                    else
+                        type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::ByteAddressBuffer : DescriptorType::RWByteAddressBuffer;
 
-                        break;
-                    }
-                    }
+                    break;
+                }
+                }
 
-                    // Count the array elements.
-                    // NOTE: Actually there is a difference between declaring a descriptor an array (e.g. `StructuredBuffer<T> buffers[10]`) and declaring an array of descriptors 
-                    //       (e.g. `StructuredBuffer<T> buffers[]`). The first variant only takes up a single descriptor, to which a buffer array can be bound. The second variant describes an 
-                    //       variable-sized array of descriptors (aka runtime array). In the engine we treat both identically. A runtime array is defined as a descriptor with 0xFFFFFFFF elements.
-                    //       Theoretically, we could bind a buffer array to an descriptor within a descriptor array, which is currently an unsupported use case. In the future, we might want to have
-                    //       a separate descriptor flag for descriptor arrays and array descriptors and also provide methods to bind them both.
-                    UInt32 descriptors = 1;
+                // Count the array elements.
+                // NOTE: Actually there is a difference between declaring a descriptor an array (e.g. `StructuredBuffer<T> buffers[10]`) and declaring an array of descriptors 
+                //       (e.g. `StructuredBuffer<T> buffers[]`). The first variant only takes up a single descriptor, to which a buffer array can be bound. The second variant describes an 
+                //       variable-sized array of descriptors (aka runtime array). In the engine we treat both identically. A runtime array is defined as a descriptor with 0xFFFFFFFF elements.
+                //       Theoretically, we could bind a buffer array to an descriptor within a descriptor array, which is currently an unsupported use case. In the future, we might want to have
+                //       a separate descriptor flag for descriptor arrays and array descriptors and also provide methods to bind them both.
+                UInt32 descriptors = 1;
 
-                    if (descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray)
-                        descriptors = std::numeric_limits<UInt32>::max();
-                    else
-                        for (UInt32 d(0); d < descriptor->array.dims_count; ++d)
-                            descriptors *= descriptor->array.dims[d];
+                if (descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray)
+                    descriptors = std::numeric_limits<UInt32>::max();
+                else
+                    for (UInt32 d(0); d < descriptor->array.dims_count; ++d)
+                        descriptors *= descriptor->array.dims[d];
+
+                // Create the descriptor layout.
+                return DescriptorInfo { .location = descriptor->binding, .elementSize = descriptor->block.padded_size, .elements = descriptors, .inputAttachmentIndex = inputAttachmentIndex, .type = type, .unbounded = descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray };
+            });
 
-                    // Create the descriptor layout.
-                    return DescriptorInfo { .location = descriptor->binding, .elementSize = descriptor->block.padded_size, .elements = descriptors, .inputAttachmentIndex = inputAttachmentIndex, .type = type, .unbounded = descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray };
-                });
+            moduleReflection->descriptorSets.emplace_back(descriptorSet->set, std::move(descriptors));
+        });
+
+        // Parse push constants.
+        std::ranges::for_each(pushConstants, [&moduleReflection](const SpvReflectBlockVariable* pushConstant) {
+            moduleReflection->pushConstants.emplace_back(pushConstant->absolute_offset, pushConstant->padded_size);
+        });
+
+        return moduleReflection;
+    }
+
+    static ReflectionCache& reflectionCache() noexcept
+    {
+        // NOTE: Reflection results only depend on the module bytecode, so the cache can be shared between all devices.
+        static ReflectionCache cache;
+        return cache;
+    }
+
+    static ReflectionKey reflectionKey(Span<const UInt32> bytecode) noexcept
+    {
+        // NOTE: The key is the SHA-256 digest of the bytecode together with its size, so that cached reflections can be identified without storing the bytecode.
+        static constexpr std::array<UInt32, 64> ROUND_CONSTANTS {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+
+        ReflectionKey key { .digest = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }, .size = bytecode.size_bytes() };
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-avoid-magic-numbers)
+        auto compress = [&state = key.digest](const std::array<UInt8, 64>& block) {
+            std::array<UInt32, 64> words{};
+
+            for (UInt32 i{ 0 }; i < 16; ++i)
+                words[i] = (static_cast<UInt32>(block[i * 4]) << 24) | (static_cast<UInt32>(block[i * 4 + 1]) << 16) | (static_cast<UInt32>(block[i * 4 + 2]) << 8) | static_cast<UInt32>(block[i * 4 + 3]);
+
+            for (UInt32 i{ 16 }; i < 64; ++i)
+                words[i] = words[i - 16] + (std::rotr(words[i - 15], 7) ^ std::rotr(words[i - 15], 18) ^ (words[i - 15] >> 3)) + words[i - 7] + (std::rotr(words[i - 2], 17) ^ std::rotr(words[i - 2], 19) ^ (words[i - 2] >> 10));
+
+            auto [a, b, c, d, e, f, g, h] = state;
+
+            for (UInt32 i{ 0 }; i < 64; ++i)
+            {
+                auto t1 = h + (std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25)) + ((e & f) ^ (~e & g)) + ROUND_CONSTANTS[i] + words[i];
+                auto t2 = (std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                h = g; g = f; f = e; e = d + t1; d = c; c = b; b = a; a = t1 + t2;
+            }
+
+            state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        };
+
+        auto bytes = std::as_bytes(bytecode);
+        std::array<UInt8, 64> block{};
+        size_t offset{ 0 };
+
+        for (; offset + block.size() <= bytes.size(); offset += block.size())
+        {
+            std::memcpy(block.data(), std::next(bytes.data(), static_cast<std::ptrdiff_t>(offset)), block.size());
+            compress(block);
+        }
+
+        // Pad the last block and append the message length in bits.
+        auto remaining = bytes.size() - offset;
+        block.fill(0);
+        std::memcpy(block.data(), std::next(bytes.data(), static_cast<std::ptrdiff_t>(offset)), remaining);
+        block[remaining] = 0x80;
+
+        if (remaining >= 56)
+        {
+            compress(block);
+            block.fill(0);
+        }
+
+        const auto bits = static_cast<UInt64>(bytes.size()) * 8;
+
+        for (UInt32 i{ 0 }; i < 8; ++i)
+            block[63 - i] = static_cast<UInt8>(bits >> (i * 8));
+
+        compress(block);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-avoid-magic-numbers)
+
+        return key;
+    }
+
+    static bool isValidDescriptorType(UInt32 type) noexcept
+    {
+        switch (static_cast<DescriptorType>(type))
+        {
+        case DescriptorType::ConstantBuffer:
+        case DescriptorType::StructuredBuffer:
+        case DescriptorType::RWStructuredBuffer:
+        case DescriptorType::Texture:
+        case DescriptorType::RWTexture:
+        case DescriptorType::Sampler:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::Buffer:
+        case DescriptorType::RWBuffer:
+        case DescriptorType::ByteAddressBuffer:
+        case DescriptorType::RWByteAddressBuffer:
+        case DescriptorType::AccelerationStructure:
+        case DescriptorType::ResourceDescriptorHeap:
+        case DescriptorType::SamplerDescriptorHeap:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static SharedPtr<const ModuleReflection> reflect(const VulkanShaderModule& shaderModule)
+    {
+        auto& cache = reflectionCache();
+        auto bytecode = shaderModule.bytecode();
+        auto key = reflectionKey(bytecode);
+
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+
+            if (auto match = cache.entries.find(key); match != cache.entries.end())
+                return match->second;
+        }
+
+        // Reflect the module outside of the lock, so that programs can be built concurrently.
+        LITEFX_TRACE(VULKAN_LOG, "Reflecting shader module {0} ({1} bytes).", shaderModule.fileName(), key.size);
+        auto reflection = reflectModule(bytecode);
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.entries.insert_or_assign(key, reflection);
+
+        return reflection;
+    }
+
+    static void saveReflectionCache(const String& fileName)
+    {
+        std::ofstream stream(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
 
-                if (!descriptorSetLayouts.contains(descriptorSet->set))
-                    descriptorSetLayouts.insert(std::make_pair(descriptorSet->set, DescriptorSetInfo{ .space = descriptorSet->set, .stage = shaderModule->type(), .descriptors = descriptors }));
+        if (!stream.is_open()) [[unlikely]]
+            throw RuntimeException("Unable to open reflection cache {0} for writing.", fileName);
+
+        auto write = [&stream](auto value) { stream.write(reinterpret_cast<const char*>(&value), sizeof(value)); }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto append = [](Array<char>& record, auto value) { record.insert(record.end(), reinterpret_cast<const char*>(&value), std::next(reinterpret_cast<const char*>(&value), sizeof(value))); }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto& cache = reflectionCache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        write(REFLECTION_CACHE_MAGIC);
+        write(REFLECTION_CACHE_VERSION);
+        write(static_cast<UInt32>(cache.entries.size()));
+        write(UInt32{ 0 });
+
+        // Each entry is stored as its key, followed by the size of the record and the record itself, so that the size can be validated when loading it.
+        Array<char> record;
+
+        for (const auto& [key, reflection] : cache.entries)
+        {
+            record.clear();
+            append(record, static_cast<UInt32>(reflection->descriptorSets.size()));
+            append(record, static_cast<UInt32>(reflection->pushConstants.size()));
+
+            for (const auto& descriptorSet : reflection->descriptorSets)
+            {
+                append(record, descriptorSet.space);
+                append(record, static_cast<UInt32>(descriptorSet.descriptors.size()));
+
+                for (const auto& descriptor : descriptorSet.descriptors)
+                {
+                    append(record, descriptor.location);
+                    append(record, descriptor.elementSize);
+                    append(record, descriptor.elements);
+                    append(record, descriptor.inputAttachmentIndex);
+                    append(record, static_cast<UInt32>(descriptor.type));
+                    append(record, static_cast<UInt32>(descriptor.unbounded));
+                }
+            }
+
+            for (const auto& pushConstants : reflection->pushConstants)
+            {
+                append(record, pushConstants.offset);
+                append(record, pushConstants.size);
+            }
+
+            write(key.digest);
+            write(key.size);
+            write(static_cast<UInt32>(record.size()));
+            stream.write(record.data(), static_cast<std::streamsize>(record.size()));
+        }
+
+        if (!stream.good()) [[unlikely]]
+            throw RuntimeException("Unable to write reflection cache {0}.", fileName);
+
+        LITEFX_DEBUG(VULKAN_LOG, "Stored {0} shader module reflections in {1}.", cache.entries.size(), fileName);
+    }
+
+    static SharedPtr<const ModuleReflection> parseReflection(ReflectionCacheReader record)
+    {
+        auto reflection = makeShared<ModuleReflection>();
+        UInt32 descriptorSets{}, pushConstants{};
+
+        if (!record.read(descriptorSets) || !record.read(pushConstants))
+            return nullptr;
+
+        for (UInt32 s{ 0 }; s < descriptorSets; ++s)
+        {
+            UInt32 space{}, descriptors{};
+
+            if (!record.read(space) || !record.read(descriptors))
+                return nullptr;
+
+            auto& descriptorSet = reflection->descriptorSets.emplace_back(space);
+
+            for (UInt32 d{ 0 }; d < descriptors; ++d)
+            {
+                auto& descriptor = descriptorSet.descriptors.emplace_back();
+                UInt32 type{}, unbounded{};
+
+                if (!record.read(descriptor.location) || !record.read(descriptor.elementSize) || !record.read(descriptor.elements) || !record.read(descriptor.inputAttachmentIndex) ||
+                    !record.read(type) || !record.read(unbounded) || !isValidDescriptorType(type) || unbounded > 1)
+                    return nullptr;
+
+                descriptor.type = static_cast<DescriptorType>(type);
+                descriptor.unbounded = unbounded != 0;
+            }
+        }
+
+        for (UInt32 p{ 0 }; p < pushConstants; ++p)
+        {
+            UInt32 offset{}, size{};
+
+            if (!record.read(offset) || !record.read(size))
+                return nullptr;
+
+            reflection->pushConstants.emplace_back(offset, size);
+        }
+
+        // The record must be consumed entirely, otherwise it has been written with a different layout.
+        return record.data.empty() ? reflection : nullptr;
+    }
+
+    static bool loadReflectionCache(const String& fileName)
+    {
+        std::ifstream stream(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+
+        if (!stream.is_open()) [[unlikely]]
+            throw RuntimeException("Unable to open reflection cache {0}.", fileName);
+
+        Array<char> data(static_cast<size_t>(stream.tellg()));
+        stream.seekg(0);
+
+        if (!stream.read(data.data(), static_cast<std::streamsize>(data.size()))) [[unlikely]]
+            throw RuntimeException("Unable to read reflection cache {0}.", fileName);
+
+        // If the file does not match the expected layout, it is ignored and modules are reflected again. All entries are parsed before publishing them, so
+        // that a corrupted file does not leave the cache in a partial state.
+        ReflectionCacheReader reader{ data };
+        UInt32 magic{}, version{}, entries{}, reserved{};
+
+        if (!reader.read(magic) || magic != REFLECTION_CACHE_MAGIC || !reader.read(version) || !reader.read(entries) || !reader.read(reserved)) [[unlikely]]
+        {
+            LITEFX_WARNING(VULKAN_LOG, "The file {0} is not a valid reflection cache and is ignored.", fileName);
+            return false;
+        }
+
+        if (version != REFLECTION_CACHE_VERSION) [[unlikely]]
+        {
+            LITEFX_WARNING(VULKAN_LOG, "The reflection cache {0} uses an unsupported format version ({1}, expected {2}) and is ignored.", fileName, version, REFLECTION_CACHE_VERSION);
+            return false;
+        }
+
+        Array<std::pair<ReflectionKey, SharedPtr<const ModuleReflection>>> reflections;
+
+        for (UInt32 i{ 0 }; i < entries; ++i)
+        {
+            ReflectionKey key{};
+            UInt32 recordSize{};
+
+            if (!reader.read(key.digest) || !reader.read(key.size) || !reader.read(recordSize) || recordSize > reader.data.size()) [[unlikely]]
+            {
+                LITEFX_WARNING(VULKAN_LOG, "The reflection cache {0} is truncated and is ignored.", fileName);
+                return false;
+            }
+
+            auto reflection = parseReflection({ reader.data.first(recordSize) });
+            reader.data = reader.data.subspan(recordSize);
+
+            if (reflection == nullptr) [[unlikely]]
+            {
+                LITEFX_WARNING(VULKAN_LOG, "The reflection cache {0} contains an invalid record and is ignored.", fileName);
+                return false;
+            }
+
+            reflections.emplace_back(key, std::move(reflection));
+        }
+
+        auto& cache = reflectionCache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        for (auto& [key, reflection] : reflections)
+            cache.entries.insert_or_assign(key, std::move(reflection));
+
+        LITEFX_DEBUG(VULKAN_LOG, "Loaded {0} shader module reflections from {1}.", entries, fileName);
+        return true;
+    }
+
+    static void clearReflectionCache() noexcept
+    {
+        auto& cache = reflectionCache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.entries.clear();
+    }
+
+    SharedPtr<VulkanPipelineLayout> reflectPipelineLayout(Enumerable<PipelineBindingHint> hints)
+    {
+        // Put the hints into a map so we can easier look them up.
+        auto hintsMap = hints
+            | std::views::transform([](const auto& hint) -> std::pair<DescriptorBindingPoint, PipelineBindingHint> { return { hint.Binding, hint }; })
+            | std::ranges::to<std::map>();
+
+        // First, filter the descriptor sets and push constant ranges.
+        Dictionary<UInt32, DescriptorSetInfo> descriptorSetLayouts;
+        Array<PushConstantRangeInfo> pushConstantRanges;
+
+        // Extract reflection data from all shader modules. Modules with known bytecode are served from the reflection cache.
+        std::ranges::for_each(m_modules, [&](auto& shaderModule) {
+            auto reflection = reflect(*shaderModule);
+
+            // Merge the descriptor sets.
+            std::ranges::for_each(reflection->descriptorSets, [&shaderModule, &descriptorSetLayouts](const auto& descriptorSet) {
+                if (!descriptorSetLayouts.contains(descriptorSet.space))
+                    descriptorSetLayouts.insert(std::make_pair(descriptorSet.space, DescriptorSetInfo{ .space = descriptorSet.space, .stage = shaderModule->type(), .descriptors = descriptorSet.descriptors }));
                 else
                 {
                     // If the set already exists in another stage, merge it.
-                    auto& layout = descriptorSetLayouts[descriptorSet->set];
+                    auto& layout = descriptorSetLayouts[descriptorSet.space];
 
-                    for (auto& descriptor : descriptors)
+                    for (auto& descriptor : descriptorSet.descriptors)
                     {
                         // Add the descriptor, if no other descriptor has been bound to the location. Otherwise, check if the descriptors are equal and drop it, if they aren't.
                         if (auto match = std::ranges::find_if(layout.descriptors, [&descriptor](const DescriptorInfo& element) { return element.location == descriptor.location; }); match == layout.descriptors.end())
                             layout.descriptors.push_back(descriptor);
                         else if (!descriptor.equals(*match))
                             LITEFX_WARNING(VULKAN_LOG, "Mismatching descriptors detected: the descriptor at location {0} ({3} elements with size of {4} bytes) of the descriptor set {1} in shader stage {2} conflicts with a descriptor from at least one other shader stage and will be dropped (conflicts with descriptor of type {8} in stage/s {5} with {6} elements of {7} bytes).",
-                                descriptor.location, descriptorSet->set, shaderModule->type(), descriptor.elements, descriptor.elementSize, layout.stage, match->elements, match->elementSize, match->type);
+                                descriptor.location, descriptorSet.space, shaderModule->type(), descriptor.elements, descriptor.elementSize, layout.stage, match->elements, match->elementSize, match->type);
                     }
 
                     // Store the stage.
@@ -325,9 +694,9 @@ public:
                 }
             });
 
-            // Parse push constants.
-            std::ranges::for_each(pushConstants, [&shaderModule, &pushConstantRanges](const SpvReflectBlockVariable* pushConstant) {
-                pushConstantRanges.emplace_back(shaderModule->type(), pushConstant->absolute_offset, pushConstant->padded_size);
+            // Collect push constants.
+            std::ranges::for_each(reflection->pushConstants, [&shaderModule, &pushConstantRanges](const auto& pushConstant) {
+                pushConstantRanges.emplace_back(shaderModule->type(), pushConstant.offset, pushConstant.size);
             });
         });
 
@@ -535,6 +904,21 @@ SharedPtr<VulkanPipelineLayout> VulkanShaderProgram::reflectPipelineLayout(Enume
     return m_impl->reflectPipelineLayout(hints);
 }
 
+bool VulkanShaderProgram::loadReflectionCache(const String& fileName)
+{
+    return VulkanShaderProgramImpl::loadReflectionCache(fileName);
+}
+
+void VulkanShaderProgram::saveReflectionCache(const String& fileName)
+{
+    VulkanShaderProgramImpl::saveReflectionCache(fileName);
+}
+
+void VulkanShaderProgram::clearReflectionCache() noexcept
+{
+    VulkanShaderProgramImpl::clearReflectionCache();
+}
+
 #if defined(LITEFX_BUILD_DEFINE_BUILDERS)
 // ------------------------------------------------------------------------------------------------
 // Shader program builder shared interface.
@@ -565,4 +949,9 @@ UniquePtr<VulkanShaderModule> VulkanShaderProgramBuilder::makeShaderModule(Shade
 {
     return makeUnique<VulkanShaderModule>(*this->instance()->m_impl->m_device, type, stream, name, entryPoint, shaderLocalDescriptor);
 }
+
+UniquePtr<VulkanShaderModule> VulkanShaderProgramBuilder::makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor)
+{
+    return makeUnique<VulkanShaderModule>(*this->instance()->m_impl->m_device, type, archive, name, entryPoint, shaderLocalDescriptor);
+}
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
@@ -10,6 +10,123 @@ using namespace LiteFX::Rendering::Backends;
 
 // NOTE: It is important to keep private variable names equal between implementation classes in order for the debug visualizers to work.
 
+// ------------------------------------------------------------------------------------------------
+// Present modes and frame latency tracking.
+// ------------------------------------------------------------------------------------------------
+
+static constexpr bool isVsyncMode(VkPresentModeKHR presentMode) noexcept
+{
+	return presentMode == VK_PRESENT_MODE_FIFO_KHR || presentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+}
+
+static constexpr StringView presentModeName(VkPresentModeKHR presentMode) noexcept
+{
+	switch (presentMode)
+	{
+	case VK_PRESENT_MODE_IMMEDIATE_KHR: return "Immediate";
+	case VK_PRESENT_MODE_MAILBOX_KHR: return "Mailbox";
+	case VK_PRESENT_MODE_FIFO_KHR: return "FIFO";
+	case VK_PRESENT_MODE_FIFO_RELAXED_KHR: return "FIFO (relaxed)";
+	default: return "Other";
+	}
+}
+
+/// <summary>
+/// Limits the number of frames the CPU can queue ahead of the GPU and measures the time between input sampling and presentation.
+/// </summary>
+class FrameLatencyTracker {
+private:
+	using clock_type = std::chrono::steady_clock;
+
+	UInt32 m_maxFrameLatency{ 0 };
+	Queue<std::pair<const VulkanQueue*, UInt64>> m_frames;
+	clock_type::time_point m_inputTime{ clock_type::now() };
+	std::chrono::nanoseconds m_latency{ 0 };
+
+public:
+	UInt32 maxFrameLatency() const noexcept
+	{
+		return m_maxFrameLatency;
+	}
+
+	void setMaxFrameLatency(UInt32 frames) noexcept
+	{
+		m_maxFrameLatency = frames;
+	}
+
+	std::chrono::nanoseconds latency() const noexcept
+	{
+		return m_latency;
+	}
+
+	void markInput() noexcept
+	{
+		m_inputTime = clock_type::now();
+	}
+
+	void throttle()
+	{
+		// Block on the oldest frames, until queuing another one does not exceed the latency limit.
+		while (m_maxFrameLatency > 0 && m_frames.size() >= m_maxFrameLatency)
+		{
+			auto [queue, fence] = m_frames.front();
+			m_frames.pop();
+			queue->waitFor(fence);
+		}
+
+		// Drop frames that have already completed, so that the history does not grow if no limit is set.
+		while (!m_frames.empty() && m_frames.front().first->lastCompletedFence() >= m_frames.front().second)
+			m_frames.pop();
+
+		// Input is usually sampled right after the back buffer has been swapped, so this is the default starting point for latency measurement.
+		this->markInput();
+	}
+
+	void presented(const VulkanQueue& queue, UInt64 fence)
+	{
+		m_latency = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - m_inputTime);
+		m_frames.emplace(&queue, fence);
+	}
+
+	void clear() noexcept
+	{
+		m_frames = {};
+	}
+};
+
+/// <summary>
+/// Paces the frames of compute-only devices, which do not own a swap chain, by the fences of the default compute and transfer queues.
+/// </summary>
+class ComputeFrameRing {
+private:
+	Array<std::pair<UInt64, UInt64>> m_frameFences;
+	UInt32 m_currentFrame{ 0 };
+
+public:
+	void reset(UInt32 frames)
+	{
+		m_frameFences.assign(frames, { 0, 0 });
+		m_currentFrame = 0;
+	}
+
+	UInt32 swap(const VulkanDevice& device)
+	{
+		// Store the fences of the current frame, advance to the next one and wait for the workloads that have been submitted when it was last used.
+		// NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		const auto& computeQueue = device.defaultQueue(QueueType::Compute);
+		const auto& transferQueue = device.defaultQueue(QueueType::Transfer);
+		m_frameFences[m_currentFrame] = { computeQueue.currentFence(), transferQueue.currentFence() };
+		m_currentFrame = (m_currentFrame + 1) % static_cast<UInt32>(m_frameFences.size());
+
+		auto [computeFence, transferFence] = m_frameFences[m_currentFrame];
+		computeQueue.waitFor(computeFence);
+		transferQueue.waitFor(transferFence);
+		// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+		return m_currentFrame;
+	}
+};
+
 #if !defined(USE_VULKAN_INTEROP_SWAP_CHAIN)
 // ------------------------------------------------------------------------------------------------
 // Default implementation.
@@ -37,10 +154,22 @@ private:
 	VkQueryPool m_currentQueryPool{};
 	bool m_supportsTiming = false;
 	bool m_vsync = false;
+	VkPresentModeKHR m_presentMode{ VK_PRESENT_MODE_FIFO_KHR };
+	Optional<VkPresentModeKHR> m_requestedPresentMode{ };
+	FrameLatencyTracker m_latency;
+
+	// The queue and fence of the last submission of the current frame. If it has been submitted to the present queue, it signals the workload semaphore itself.
+	SharedPtr<const VulkanQueue> m_frameQueue;
+	UInt64 m_frameFence{ 0 };
+	bool m_frameSignalsWorkload = false;
+
+	// Compute-only devices do not own a swap chain. Instead, frames are paced by the fences of the default compute and transfer queues.
+	bool m_computeOnly = false;
+	ComputeFrameRing m_frameRing;
 
 public:
 	VulkanSwapChainImpl(const VulkanDevice& device) :
-		m_device(device.weak_from_this()), m_presentQueue(device.defaultQueue(QueueType::Graphics).shared_from_this())
+		m_device(device.weak_from_this()), m_presentQueue(device.defaultQueue(device.computeOnly() ? QueueType::Compute : QueueType::Graphics).shared_from_this()), m_computeOnly(device.computeOnly())
 	{
 		m_supportsTiming = device.adapter().limits().timestampComputeAndGraphics;
 
@@ -70,8 +199,9 @@ public:
 			//std::ranges::for_each(m_presentImages, [device](const auto& image) { ::vkDestroyImage(device->handle(), std::as_const(*image).handle(), nullptr); });
 			m_presentImages.clear();
 
-			// Destroy the swap chain itself.
-			::vkDestroySwapchainKHR(device->handle(), m_handle, nullptr);
+			// Destroy the swap chain itself (compute-only devices do not own one).
+			if (m_handle != VK_NULL_HANDLE)
+				::vkDestroySwapchainKHR(device->handle(), m_handle, nullptr);
 
 			// Destroy the fences and semaphores used to wait for image acquisition.
 			::vkDestroyFence(device->handle(), m_waitForImage, nullptr);
@@ -91,6 +221,12 @@ public:
 		if (format == Format::Other || format == Format::None) [[unlikely]]
 			throw InvalidArgumentException("format", "The provided surface format it not a valid value.");
 
+		if (m_computeOnly)
+		{
+			this->initializeFrames(format, renderArea, buffers, vsync);
+			return;
+		}
+
 		auto adapter = device.adapter().handle();
 		auto surface = device.surface().handle();
 
@@ -127,11 +263,16 @@ public:
 		createInfo.imageExtent.height = std::max<UInt32>(1u, std::clamp(static_cast<UInt32>(renderArea.height()), deviceCaps.minImageExtent.height, deviceCaps.maxImageExtent.height));
 		createInfo.imageExtent.width = std::max<UInt32>(1u, std::clamp(static_cast<UInt32>(renderArea.width()), deviceCaps.minImageExtent.width, deviceCaps.maxImageExtent.width));
 
-		// Set the present mode to VK_PRESENT_MODE_MAILBOX_KHR, since it offers best performance without tearing. For VSync use VK_PRESENT_MODE_FIFO_KHR, which is also the only one guaranteed to be available.
-		createInfo.presentMode = vsync ? VK_PRESENT_MODE_FIFO_KHR : VK_PRESENT_MODE_IMMEDIATE_KHR;/* VK_PRESENT_MODE_MAILBOX_KHR;*/
+		// Select the present mode. An explicitly requested mode only applies as long as it agrees with the vsync setting, otherwise the default mode for the setting is used.
+		if (m_requestedPresentMode.has_value() && isVsyncMode(m_requestedPresentMode.value()) != vsync)
+			m_requestedPresentMode.reset();
+
+		auto requestedPresentMode = m_requestedPresentMode.value_or(vsync ? VK_PRESENT_MODE_FIFO_KHR : VK_PRESENT_MODE_IMMEDIATE_KHR);
+		createInfo.presentMode = this->selectPresentMode(adapter, surface, requestedPresentMode);
+		m_presentMode = createInfo.presentMode;
 		m_vsync = vsync;
 
-		LITEFX_TRACE(VULKAN_LOG, "Creating swap chain for device {0} {{ Images: {1}, Extent: {2}x{3} Px, Format: {4}, VSync: {5} }}...", static_cast<const void*>(&m_device), images, createInfo.imageExtent.width, createInfo.imageExtent.height, selectedFormat, vsync);
+		LITEFX_TRACE(VULKAN_LOG, "Creating swap chain for device {0} {{ Images: {1}, Extent: {2}x{3} Px, Format: {4}, VSync: {5}, Present Mode: {6} }}...", static_cast<const void*>(&m_device), images, createInfo.imageExtent.width, createInfo.imageExtent.height, selectedFormat, vsync, presentModeName(createInfo.presentMode));
 
 		// Log if something needed to be changed.
 		[[unlikely]] if (selectedFormat != format)
@@ -143,6 +284,9 @@ public:
 		[[unlikely]] if (images != buffers)
 			LITEFX_INFO(VULKAN_LOG, "The number of buffers has been adjusted from {0} to {1}.", buffers, images);
 
+		[[unlikely]] if (createInfo.presentMode != requestedPresentMode)
+			LITEFX_INFO(VULKAN_LOG, "The present mode {0} is not supported and has been changed to {1}.", presentModeName(requestedPresentMode), presentModeName(createInfo.presentMode));
+
 		// Create the swap chain instance.
 		VkSwapchainKHR swapChain{};
 		raiseIfFailed(::vkCreateSwapchainKHR(device.handle(), &createInfo, nullptr, &swapChain), "Swap chain could not be created.");
@@ -181,6 +325,23 @@ public:
 			this->resetQueryPools(m_timingEvents);
 	}
 
+	void initializeFrames(Format format, const Size2d& renderArea, UInt32 buffers, bool vsync)
+	{
+		LITEFX_TRACE(VULKAN_LOG, "Creating frame ring for compute-only device {0} {{ Frames: {1} }}...", static_cast<const void*>(&m_device), buffers);
+
+		// Without a surface, there are no images to acquire. The back buffers only exist to track the workloads of each frame.
+		m_renderArea = renderArea;
+		m_format = format;
+		m_vsync = vsync;
+		m_buffers = std::max(buffers, 1u);
+		m_currentImage = 0;
+		m_frameRing.reset(m_buffers);
+
+		// Initialize the query pools.
+		if (m_timingQueryPools.size() != m_buffers)
+			this->resetQueryPools(m_timingEvents);
+	}
+
 	void resetQueryPools(const Array<SharedPtr<const TimingEvent>>& timingEvents)
 	{
 		// No events - no pools.
@@ -226,6 +387,14 @@ public:
 		if (device == nullptr) [[unlikely]]
 			throw RuntimeException("Unable to reset swap chain on a released device instance.");
 
+		if (m_computeOnly)
+		{
+			// Wait for all frames to finish, before re-creating the frame ring.
+			device->wait();
+			this->initializeFrames(format, renderArea, buffers, vsync);
+			return;
+		}
+
 		// Destroy the swap chain itself.
 		::vkDestroySwapchainKHR(device->handle(), m_handle, nullptr);
 
@@ -238,6 +407,8 @@ public:
 		m_renderArea = {};
 		m_format = Format::None;
 		m_currentImage = 0;
+		m_latency.clear();
+		m_frameQueue = nullptr;
 
 		// Reinitialize the swap chain.
 		this->initialize(*device, format, renderArea, buffers, vsync);
@@ -251,11 +422,19 @@ public:
 		if (device == nullptr) [[unlikely]]
 			throw RuntimeException("Cannot swap back buffers on a released device instance.");
 
-		// Queue an image acquisition request, then wait for the fence and reset it for the next iteration. Note how this is similar to the DirectX behavior, where the swap call blocks until the 
-		// image is acquired and ready.
-		raiseIfFailed(::vkAcquireNextImageKHR(device->handle(), m_handle, UINT64_MAX, VK_NULL_HANDLE, m_waitForImage, &m_currentImage), "Unable to swap front buffer. Make sure that all previously acquired images are actually presented before acquiring another image.");
-		raiseIfFailed(::vkWaitForFences(device->handle(), 1, &m_waitForImage, VK_TRUE, UINT64_MAX), "Unable to wait for image acquisition.");
-		raiseIfFailed(::vkResetFences(device->handle(), 1, &m_waitForImage), "Unable to reset image acquisition fence.");
+		if (m_computeOnly)
+			m_currentImage = m_frameRing.swap(*device);
+		else
+		{
+			// Make sure the CPU does not run ahead of the GPU by more than the maximum frame latency, before acquiring the next image.
+			m_latency.throttle();
+
+			// Queue an image acquisition request, then wait for the fence and reset it for the next iteration. Note how this is similar to the DirectX behavior, where the swap call blocks until the 
+			// image is acquired and ready.
+			raiseIfFailed(::vkAcquireNextImageKHR(device->handle(), m_handle, UINT64_MAX, VK_NULL_HANDLE, m_waitForImage, &m_currentImage), "Unable to swap front buffer. Make sure that all previously acquired images are actually presented before acquiring another image.");
+			raiseIfFailed(::vkWaitForFences(device->handle(), 1, &m_waitForImage, VK_TRUE, UINT64_MAX), "Unable to wait for image acquisition.");
+			raiseIfFailed(::vkResetFences(device->handle(), 1, &m_waitForImage), "Unable to reset image acquisition fence.");
+		}
 
 		// Query the timing events.
 		// TODO: In rare situations, and only when using this swap chain implementation, the validation layers will complain about query pools not being reseted, when writing time stamps. I could
@@ -277,12 +456,33 @@ public:
 
 	void present(UInt64 fence) 
 	{
-		// Draw the frame, if the result of the render pass it should be presented to the swap chain.
-		auto swapChains = std::array { m_handle };
-		const auto bufferIndex = m_currentImage;
+		if (m_computeOnly) [[unlikely]]
+			throw RuntimeException("A compute-only device cannot present.");
 
-		// Wait for the workload semaphore before performing the actual presentation.
-		auto workloadSemaphore = m_waitForWorkload[bufferIndex];
+		// If the fence belongs to the last submission of the frame, present after the queue that executed it.
+		if (auto queue = std::exchange(m_frameQueue, nullptr); queue != nullptr && fence == m_frameFence)
+		{
+			if (!m_frameSignalsWorkload)
+				this->present(*queue, fence);
+			else
+			{
+				this->queuePresent(m_waitForWorkload[m_currentImage]);
+				m_latency.presented(*queue, fence);
+			}
+		}
+		else
+		{
+			this->present(*m_presentQueue, fence);
+		}
+	}
+
+	void present(const VulkanQueue& queue, UInt64 fence)
+	{
+		if (m_computeOnly) [[unlikely]]
+			throw RuntimeException("A compute-only device cannot present.");
+
+		// Presentation can only wait for binary semaphores, so submit a wait for the timeline semaphore of the queue that signals the workload semaphore.
+		auto workloadSemaphore = m_waitForWorkload[m_currentImage];
 		VkPipelineStageFlags synchronizationPoint = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 		
 		VkTimelineSemaphoreSubmitInfo workloadFenceInfo = {
@@ -295,7 +495,7 @@ public:
 			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
 			.pNext = &workloadFenceInfo,
 			.waitSemaphoreCount = 1,
-			.pWaitSemaphores = &m_presentQueue->timelineSemaphore(),
+			.pWaitSemaphores = &queue.timelineSemaphore(),
 			.pWaitDstStageMask = &synchronizationPoint,
 			.signalSemaphoreCount = 1,
 			.pSignalSemaphores = &workloadSemaphore
@@ -303,6 +503,37 @@ public:
 
 		raiseIfFailed(::vkQueueSubmit(m_presentQueue->handle(), 1, &submitInfo, VK_NULL_HANDLE), "Unable to submit workload semaphore.");
 
+		this->queuePresent(workloadSemaphore);
+		m_latency.presented(queue, fence);
+	}
+
+	UInt64 submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer)
+	{
+		if (m_computeOnly) [[unlikely]]
+			throw RuntimeException("A compute-only device cannot present.");
+
+		if (commandBuffer == nullptr) [[unlikely]]
+			throw InvalidArgumentException("commandBuffer", "The command buffer must be initialized.");
+
+		auto queue = commandBuffer->queue();
+
+		if (queue == nullptr) [[unlikely]]
+			throw RuntimeException("Cannot present a command buffer from a released queue.");
+
+		// If the command buffer is executed on the present queue, let the submission signal the workload semaphore directly. Otherwise presentation uses a separate wait.
+		m_frameSignalsWorkload = queue == m_presentQueue;
+		m_frameFence = m_frameSignalsWorkload ? m_presentQueue->submit(commandBuffer, m_waitForWorkload[m_currentImage]) : queue->submit(commandBuffer);
+		m_frameQueue = queue;
+
+		return m_frameFence;
+	}
+
+private:
+	void queuePresent(VkSemaphore workloadSemaphore)
+	{
+		auto swapChains = std::array { m_handle };
+		const auto bufferIndex = m_currentImage;
+
 		VkPresentInfoKHR presentInfo = {
 			.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
 			.waitSemaphoreCount = 1,
@@ -316,6 +547,7 @@ public:
 		raiseIfFailed(::vkQueuePresentKHR(m_presentQueue->handle(), &presentInfo), "Unable to present swap chain.");
 	}
 
+public:
 	const VkQueryPool& currentTimestampQueryPool()
 	{
 		return m_currentQueryPool;
@@ -348,6 +580,52 @@ public:
 
 		return VK_COLOR_SPACE_MAX_ENUM_KHR;
 	}
+
+	Array<VkPresentModeKHR> presentModes() const
+	{
+		// Check if the device is still valid.
+		auto device = m_device.lock();
+
+		if (device == nullptr) [[unlikely]]
+			throw RuntimeException("Cannot query present modes from a released device instance.");
+
+		// Compute-only devices do not have a surface to present to.
+		if (m_computeOnly)
+			return { };
+
+		return this->getPresentModes(device->adapter().handle(), device->surface().handle());
+	}
+
+	Array<VkPresentModeKHR> getPresentModes(const VkPhysicalDevice adapter, const VkSurfaceKHR surface) const
+	{
+		uint32_t modes{};
+		::vkGetPhysicalDeviceSurfacePresentModesKHR(adapter, surface, &modes, nullptr);
+
+		Array<VkPresentModeKHR> presentModes(modes);
+		::vkGetPhysicalDeviceSurfacePresentModesKHR(adapter, surface, &modes, presentModes.data());
+
+		return presentModes;
+	}
+
+	VkPresentModeKHR selectPresentMode(const VkPhysicalDevice adapter, const VkSurfaceKHR surface, VkPresentModeKHR presentMode) const
+	{
+		// Fall back to the closest mode that keeps the latency characteristics of the requested one. FIFO is the only mode that is guaranteed to be available.
+		auto presentModes = this->getPresentModes(adapter, surface);
+		Array<VkPresentModeKHR> candidates;
+
+		switch (presentMode)
+		{
+		case VK_PRESENT_MODE_MAILBOX_KHR: candidates = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR }; break;
+		case VK_PRESENT_MODE_IMMEDIATE_KHR: candidates = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR }; break;
+		case VK_PRESENT_MODE_FIFO_RELAXED_KHR: candidates = { VK_PRESENT_MODE_FIFO_RELAXED_KHR }; break;
+		default: break;
+		}
+
+		if (auto match = std::ranges::find_if(candidates, [&presentModes](VkPresentModeKHR mode) { return std::ranges::contains(presentModes, mode); }); match != candidates.end())
+			return *match;
+
+		return VK_PRESENT_MODE_FIFO_KHR;
+	}
 };
 #else // !defined(USE_VULKAN_INTEROP_SWAP_CHAIN)
 #include <litefx/backends/dx12_api.hpp>
@@ -429,6 +707,9 @@ private:
 	
 	bool m_supportsTearing = false;
 	bool m_vsync = false;
+	VkPresentModeKHR m_presentMode{ VK_PRESENT_MODE_FIFO_KHR };
+	Optional<VkPresentModeKHR> m_requestedPresentMode{ };
+	FrameLatencyTracker m_latency;
 	HANDLE m_fenceHandle{};
 
 	Array<SharedPtr<const TimingEvent>> m_timingEvents;
@@ -438,15 +719,23 @@ private:
 
 	PFN_vkImportSemaphoreWin32HandleKHR importSemaphoreWin32HandleKHR = nullptr;
 
+	// Compute-only devices do not own a swap chain, so no interop device is created for them. Instead, frames are paced by the fences of the default compute and 
+	// transfer queues, just like with the default swap chain.
+	bool m_computeOnly = false;
+	ComputeFrameRing m_frameRing;
+
 public:
 	VulkanSwapChainImpl(const VulkanDevice& device) :
-		m_device(device.weak_from_this())
+		m_device(device.weak_from_this()), m_computeOnly(device.computeOnly())
 	{
 		m_supportsTiming = device.adapter().limits().timestampComputeAndGraphics;
 
 		if (!m_supportsTiming)
 			LITEFX_WARNING(VULKAN_LOG, "Timestamp queries are not supported and will be disabled. Reading timestamps will always return 0.");
 
+		if (m_computeOnly)
+			return;
+
 		importSemaphoreWin32HandleKHR = reinterpret_cast<PFN_vkImportSemaphoreWin32HandleKHR>(::vkGetDeviceProcAddr(device.handle(), "vkImportSemaphoreWin32HandleKHR")); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
 
 		if (importSemaphoreWin32HandleKHR == nullptr) [[unlikely]]
@@ -477,7 +766,9 @@ public:
 			// Destroy the swap chain and interop device and resources.
 			try
 			{
-				this->waitForInteropDevice();
+				if (m_d3dDevice != nullptr)
+					this->waitForInteropDevice();
+
 				m_imageResources.clear();
 				m_presentImages.clear();
 				m_swapChain.Reset();
@@ -504,6 +795,12 @@ public:
 		if (format == Format::Other || format == Format::None) [[unlikely]]
 			throw InvalidArgumentException("format", "The provided surface format it not a valid value.");
 
+		if (m_computeOnly)
+		{
+			this->initializeFrames(format, renderArea, buffers, vsync);
+			return;
+		}
+
 		// Query the swap chain surface format.
 		auto surfaceFormats = this->getSurfaceFormats(device.adapter().handle(), device.surface().handle());
 		Format selectedFormat{ Format::None };
@@ -538,7 +835,6 @@ public:
 		// Create a D3D12 factory.
 		ComPtr<IDXGIFactory7> factory;
 		UInt32 tearingSupport = 0;
-		m_vsync = vsync;
 #ifndef NDEBUG
 		D3D::raiseIfFailed(::CreateDXGIFactory2(DXGI_CREATE_FACTORY_DEBUG, IID_PPV_ARGS(&factory)), "Unable to crate D3D12 factory for interop.");
 #else
@@ -611,8 +907,13 @@ public:
 
 		ComPtr<IDXGISwapChain1> swapChain;
 		auto hwnd = device.surface().windowHandle();
+
+		if (hwnd == nullptr) [[unlikely]]
+			throw RuntimeException("The interop swap chain requires a surface that is bound to a window. Headless surfaces are not supported.");
+
 		D3D::raiseIfFailed(factory->CreateSwapChainForHwnd(m_presentQueue.Get(), hwnd, &swapChainDesc, nullptr, nullptr, &swapChain), "Unable to create interop swap chain.");
 		D3D::raiseIfFailed(swapChain.As(&m_swapChain), "The interop swap chain does not implement the IDXGISwapChain4 interface.");
+		this->selectPresentMode(vsync);
 
 		// Initialize swap chain images.
 		this->createImages(device, selectedFormat, extent, images);
@@ -662,6 +963,14 @@ public:
 		if (device == nullptr) [[unlikely]]
 			throw RuntimeException("Cannot reset swap chain on a released device instance.");
 
+		if (m_computeOnly)
+		{
+			// Wait for all frames to finish, before re-creating the frame ring.
+			device->wait();
+			this->initializeFrames(format, renderArea, buffers, vsync);
+			return;
+		}
+
 		// Release the image memory of the previously allocated images.
 		std::ranges::for_each(m_presentImages, [device](const auto& image) { ::vkDestroyImage(device->handle(), std::as_const(*image).handle(), nullptr); });
 
@@ -726,10 +1035,45 @@ public:
 			// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 		}
 
-		// Store vsync flag.
+		// Store vsync flag and select the present mode.
+		m_latency.clear();
+		this->selectPresentMode(vsync);
+	}
+
+	void selectPresentMode(bool vsync)
+	{
+		// An explicitly requested mode only applies as long as it agrees with the vsync setting, otherwise the default mode for the setting is used.
+		if (m_requestedPresentMode.has_value() && isVsyncMode(m_requestedPresentMode.value()) != vsync)
+			m_requestedPresentMode.reset();
+
+		// Flip model swap chains present with a sync interval of 1 for FIFO, without sync interval for mailbox and additionally allow tearing for immediate mode.
+		auto requestedPresentMode = m_requestedPresentMode.value_or(vsync ? VK_PRESENT_MODE_FIFO_KHR : VK_PRESENT_MODE_IMMEDIATE_KHR);
+
+		if (vsync)
+			m_presentMode = VK_PRESENT_MODE_FIFO_KHR;
+		else if (requestedPresentMode == VK_PRESENT_MODE_IMMEDIATE_KHR && m_supportsTearing)
+			m_presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+		else
+			m_presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+
+		[[unlikely]] if (m_presentMode != requestedPresentMode)
+			LITEFX_INFO(VULKAN_LOG, "The present mode {0} is not supported and has been changed to {1}.", presentModeName(requestedPresentMode), presentModeName(m_presentMode));
+
 		m_vsync = vsync;
 	}
 
+	Array<VkPresentModeKHR> presentModes() const
+	{
+		// Compute-only devices do not have a surface to present to.
+		if (m_computeOnly)
+			return { };
+
+		if (m_supportsTearing)
+			return { VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+		else
+			return { VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR };
+	}
+
 	void createImages(const VulkanDevice& device, Format format, const Size2d& renderArea, UInt32 buffers)
 	{
 		// NOTE: We maintain two sets of images: the swap chain back buffers and separate image resources that are shared and written to by the Vulkan renderer. During present
@@ -849,6 +1193,23 @@ public:
 		m_currentImage = 0;
 	}
 
+	void initializeFrames(Format format, const Size2d& renderArea, UInt32 buffers, bool vsync)
+	{
+		LITEFX_TRACE(VULKAN_LOG, "Creating frame ring for compute-only device {0} {{ Frames: {1} }}...", static_cast<const void*>(&m_device), buffers);
+
+		// Without a surface, there are no images to acquire. The back buffers only exist to track the workloads of each frame.
+		m_renderArea = renderArea;
+		m_format = format;
+		m_vsync = vsync;
+		m_buffers = std::max(buffers, 1u);
+		m_currentImage = 0;
+		m_frameRing.reset(m_buffers);
+
+		// Initialize the query pools.
+		if (m_timingQueryPools.size() != m_buffers)
+			this->resetQueryPools(m_timingEvents);
+	}
+
 	void resetQueryPools(const Array<SharedPtr<const TimingEvent>>& timingEvents)
 	{
 		// No events - no pools.
@@ -895,11 +1256,40 @@ public:
 		if (device == nullptr) [[unlikely]]
 			throw RuntimeException("Cannot swap back buffers on a released device instance.");
 
+		if (m_computeOnly)
+			m_currentImage = m_frameRing.swap(*device);
+		else
+			this->acquireBackBuffer(*device);
+
+		// Query the timing events.
+		if (m_supportsTiming && !m_timingEvents.empty()) [[likely]]
+		{
+			auto result = ::vkGetQueryPoolResults(device->handle(), m_timingQueryPools[m_currentImage], 0, static_cast<UInt32>(m_timestamps.size()), m_timestamps.size() * sizeof(UInt64), m_timestamps.data(), sizeof(UInt64), VK_QUERY_RESULT_64_BIT);
+
+			if (result != VK_NOT_READY)	// Initial frames do not yet contain query results.
+				raiseIfFailed(result, "Unable to query timing events.");
+
+			// Reset the query pool.
+			::vkResetQueryPool(device->handle(), m_timingQueryPools[m_currentImage], 0, static_cast<UInt32>(m_timestamps.size()));
+		}
+
+		// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+		// Return the new back buffer index.
+		return m_currentImage;
+	}
+
+	void acquireBackBuffer(const VulkanDevice& device)
+	{
+		// NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		// Make sure the CPU does not run ahead of the GPU by more than the maximum frame latency.
+		m_latency.throttle();
+
 		// Get the current back buffer index.
 		m_currentImage = m_swapChain->GetCurrentBackBufferIndex();
 
 		// Wait for all workloads on this image to finish in order to be able to re-use the associated command buffers.
-		device->defaultQueue(QueueType::Graphics).waitFor(m_presentFences[m_currentImage]);
+		device.defaultQueue(QueueType::Graphics).waitFor(m_presentFences[m_currentImage]);
 
 		// Wait for the last presentation on the current image to finish, so that we can re-use the command buffers associated with it.
 		if (m_presentationFence->GetCompletedValue() < m_presentFences[m_currentImage])
@@ -913,27 +1303,37 @@ public:
 			::CloseHandle(eventHandle);
 			raiseIfFailed(hr, "Unable to register presentation fence completion event.");
 		}
+		// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+	}
 
-		// Query the timing events.
-		if (m_supportsTiming && !m_timingEvents.empty()) [[likely]]
-		{
-			auto result = ::vkGetQueryPoolResults(device->handle(), m_timingQueryPools[m_currentImage], 0, static_cast<UInt32>(m_timestamps.size()), m_timestamps.size() * sizeof(UInt64), m_timestamps.data(), sizeof(UInt64), VK_QUERY_RESULT_64_BIT);
+	UInt64 submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer)
+	{
+		if (m_computeOnly) [[unlikely]]
+			throw RuntimeException("A compute-only device cannot present.");
 
-			if (result != VK_NOT_READY)	// Initial frames do not yet contain query results.
-				raiseIfFailed(result, "Unable to query timing events.");
+		if (commandBuffer == nullptr) [[unlikely]]
+			throw InvalidArgumentException("commandBuffer", "The command buffer must be initialized.");
 
-			// Reset the query pool.
-			::vkResetQueryPool(device->handle(), m_timingQueryPools[m_currentImage], 0, static_cast<UInt32>(m_timestamps.size()));
-		}
+		auto queue = commandBuffer->queue();
 
-		// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+		if (queue == nullptr) [[unlikely]]
+			throw RuntimeException("Cannot present a command buffer from a released queue.");
 
-		// Return the new back buffer index.
-		return m_currentImage;
+		// The interop swap chain presents on a DirectX 12 queue, that waits for the shared fence, so the submission cannot signal the presentation directly.
+		return queue->submit(commandBuffer);
 	}
 
 	void present(UInt64 fence)
 	{
+		if (m_computeOnly) [[unlikely]]
+			throw RuntimeException("A compute-only device cannot present.");
+
+		// Check if the device is still valid.
+		auto device = m_device.lock();
+
+		if (device == nullptr) [[unlikely]]
+			throw RuntimeException("Cannot present on a released device instance.");
+
 		// Wait for all commands to finish on the default graphics queue. We assume that this is the last queue that receives (synchronized) workloads, as it is expected to
 		// handle presentation by convention. Note that this performs a GPU-side wait for the fence and does not block.
 		// NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
@@ -990,12 +1390,13 @@ public:
 		m_presentQueue->ExecuteCommandLists(1u, &commandBuffer);
 
 		// Do the presentation.
-		if (m_vsync)
+		if (m_presentMode == VK_PRESENT_MODE_FIFO_KHR)
 			D3D::raiseIfFailed(m_swapChain->Present(1, 0), "Unable to queue present event on swap chain.");
 		else
-			D3D::raiseIfFailed(m_swapChain->Present(0, m_supportsTearing ? DXGI_PRESENT_ALLOW_TEARING : 0), "Unable to queue present event on swap chain.");
+			D3D::raiseIfFailed(m_swapChain->Present(0, m_presentMode == VK_PRESENT_MODE_IMMEDIATE_KHR ? DXGI_PRESENT_ALLOW_TEARING : 0), "Unable to queue present event on swap chain.");
 
 		D3D::raiseIfFailed(m_presentQueue->Signal(m_presentationFence.Get(), m_presentFences[m_currentImage]), "Unable to signal presentation fence.");
+		m_latency.presented(device->defaultQueue(QueueType::Graphics), fence);
 		// NOLINTEND(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 	}
 	
@@ -1157,6 +1558,42 @@ bool VulkanSwapChain::verticalSynchronization() const noexcept
 	return m_impl->m_vsync;
 }
 
+VkPresentModeKHR VulkanSwapChain::presentMode() const noexcept
+{
+	return m_impl->m_presentMode;
+}
+
+Enumerable<VkPresentModeKHR> VulkanSwapChain::presentModes() const
+{
+	return m_impl->presentModes();
+}
+
+void VulkanSwapChain::setPresentMode(VkPresentModeKHR presentMode)
+{
+	m_impl->m_requestedPresentMode = presentMode;
+	this->reset(m_impl->m_format, m_impl->m_renderArea, m_impl->m_buffers, isVsyncMode(presentMode));
+}
+
+UInt32 VulkanSwapChain::maxFrameLatency() const noexcept
+{
+	return m_impl->m_latency.maxFrameLatency();
+}
+
+void VulkanSwapChain::setMaxFrameLatency(UInt32 frames) noexcept
+{
+	m_impl->m_latency.setMaxFrameLatency(frames);
+}
+
+void VulkanSwapChain::markInput() const noexcept
+{
+	m_impl->m_latency.markInput();
+}
+
+std::chrono::nanoseconds VulkanSwapChain::presentLatency() const noexcept
+{
+	return m_impl->m_latency.latency();
+}
+
 IVulkanImage* VulkanSwapChain::image(UInt32 backBuffer) const
 {
 	if (backBuffer >= m_impl->m_presentImages.size()) [[unlikely]]
@@ -1165,8 +1602,11 @@ IVulkanImage* VulkanSwapChain::image(UInt32 backBuffer) const
 	return m_impl->m_presentImages[backBuffer].get(); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 }
 
-const IVulkanImage& VulkanSwapChain::image() const noexcept
+const IVulkanImage& VulkanSwapChain::image() const
 {
+	if (m_impl->m_computeOnly) [[unlikely]]
+		throw RuntimeException("The swap chain of a compute-only device does not provide back buffer images.");
+
 	return *m_impl->m_presentImages[m_impl->m_currentImage]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
 }
 
@@ -1180,6 +1620,18 @@ void VulkanSwapChain::present(UInt64 fence) const
 	m_impl->present(fence);
 }
 
+UInt64 VulkanSwapChain::present(const SharedPtr<const VulkanCommandBuffer>& commandBuffer) const
+{
+	auto fence = m_impl->submit(commandBuffer);
+	m_impl->present(fence);
+	return fence;
+}
+
+UInt64 VulkanSwapChain::submit(const SharedPtr<const VulkanCommandBuffer>& commandBuffer) const
+{
+	return m_impl->submit(commandBuffer);
+}
+
 Enumerable<Format> VulkanSwapChain::getSurfaceFormats() const
 {
 	// Check if the device is still valid.
@@ -1188,6 +1640,10 @@ Enumerable<Format> VulkanSwapChain::getSurfaceFormats() const
 	if (device == nullptr) [[unlikely]]
 		throw RuntimeException("Cannot query surface formats from a released device instance.");
 
+	// Compute-only devices do not have a surface to query.
+	if (device->computeOnly())
+		return { };
+
 	return m_impl->getSurfaceFormats(device->adapter().handle(), device->surface().handle());
 }
 
@@ -2,6 +2,7 @@
 
 using namespace LiteFX::Rendering::Backends;
 using Instance = ITopLevelAccelerationStructure::Instance;
+using instance_handle = VulkanTopLevelAccelerationStructure::instance_handle;
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
 extern PFN_vkCreateAccelerationStructureKHR vkCreateAccelerationStructure;
@@ -17,13 +18,30 @@ class VulkanTopLevelAccelerationStructure::VulkanTopLevelAccelerationStructureIm
 public:
     friend class VulkanTopLevelAccelerationStructure;
 
+private:
+    struct InstanceSlot {
+        UInt32 Index { FREE_SLOT };
+        UInt32 Generation { 0 };
+    };
+
+    static constexpr UInt32 FREE_SLOT = std::numeric_limits<UInt32>::max();
+
 private:
     Array<Instance> m_instances { };
+    Array<UInt32> m_instanceSlots { };
+    Array<InstanceSlot> m_slots { };
+    Array<UInt32> m_freeSlots { };
+    UInt32 m_builtInstances { 0 };
     AccelerationStructureFlags m_flags;
     SharedPtr<const IVulkanBuffer> m_buffer;
     UInt64 m_offset { }, m_size { };
     const VulkanDevice* m_device { nullptr };
     VkQueryPool m_queryPool { VK_NULL_HANDLE };
+    SharedPtr<const IVulkanBuffer> m_instanceBuffer;
+    SharedPtr<IVulkanBuffer> m_stagingBuffer;
+    Array<std::pair<UInt32, UInt32>> m_dirtyRanges { };
+    Optional<std::pair<UInt32, UInt32>> m_movedRange { };
+    Array<VkAccelerationStructureInstanceKHR> m_uploadData { };
 
 public:
     VulkanTopLevelAccelerationStructureImpl(AccelerationStructureFlags flags) :
@@ -34,22 +52,213 @@ public:
     }
 
 public:
-    Array<VkAccelerationStructureInstanceKHR> buildInfo() const
+    static inline void convert(const Instance& instance, VkAccelerationStructureInstanceKHR& desc) noexcept
     {
-        return m_instances | std::views::transform([](const Instance& instance) { 
-            const auto& blasBuffer = instance.BottomLevelAccelerationStructure->buffer();
-
-            auto desc = VkAccelerationStructureInstanceKHR {
-                .instanceCustomIndex = instance.Id,
-                .mask = instance.Mask,
-                .instanceShaderBindingTableRecordOffset = instance.HitGroupOffset,
-                .flags = std::bit_cast<VkGeometryInstanceFlagsKHR>(instance.Flags),
-                .accelerationStructureReference = blasBuffer == nullptr ? 0ull : blasBuffer->virtualAddress() + instance.BottomLevelAccelerationStructure->offset()
-            };
+        static_assert(sizeof(Instance::Transform) == sizeof(VkTransformMatrixKHR), "The instance transform must match the layout of `VkTransformMatrixKHR`.");
+
+        const auto& blasBuffer = instance.BottomLevelAccelerationStructure->buffer();
+
+        // Both transforms are stored as row-major 3x4 matrices, so the transform can be copied as a whole, which compilers turn into a few vector moves.
+        std::memcpy(desc.transform.matrix, std::addressof(instance.Transform), sizeof(VkTransformMatrixKHR)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+        desc.instanceCustomIndex = instance.Id;
+        desc.mask = instance.Mask;
+        desc.instanceShaderBindingTableRecordOffset = instance.HitGroupOffset;
+        desc.flags = std::bit_cast<VkGeometryInstanceFlagsKHR>(instance.Flags);
+        desc.accelerationStructureReference = blasBuffer == nullptr ? 0ull : blasBuffer->virtualAddress() + instance.BottomLevelAccelerationStructure->offset();
+    }
+
+    instance_handle add(const Instance& instance)
+    {
+        // Re-use a released slot, if available. The generation of the slot has been incremented when it was released, so that old handles do not resolve to it.
+        UInt32 slot{};
+
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            // Reserve a free slot for each slot, so that releasing slots never allocates.
+            slot = static_cast<UInt32>(m_slots.size());
+            m_freeSlots.reserve(m_slots.size() + 1);
+            m_slots.emplace_back();
+        }
+
+        auto index = static_cast<UInt32>(m_instances.size());
+        m_instances.push_back(instance);
+        m_instanceSlots.push_back(slot);
+        m_slots[slot].Index = index; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        this->invalidate(index, 1);
+
+        return static_cast<instance_handle>(m_slots[slot].Generation) << 32 | slot; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access,cppcoreguidelines-avoid-magic-numbers)
+    }
+
+    void remove(UInt32 index) noexcept
+    {
+        // Move the last instance into the gap, so that only a single instance needs to be re-written.
+        auto slot = m_instanceSlots[index]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        auto last = static_cast<UInt32>(m_instances.size()) - 1;
+
+        if (index != last)
+        {
+            m_instances[index] = std::move(m_instances.back()); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            m_instanceSlots[index] = m_instanceSlots.back(); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            m_slots[m_instanceSlots[index]].Index = index; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+            // Moved instances are tracked in a single range, which is added to the dirty ranges on the next upload, so that removing instances does not allocate.
+            m_movedRange = m_movedRange.has_value() ? std::make_pair(std::min(m_movedRange->first, index), std::max(m_movedRange->second, index + 1)) : std::make_pair(index, index + 1);
+        }
+
+        m_instances.pop_back();
+        m_instanceSlots.pop_back();
+
+        // Release the slot.
+        m_slots[slot].Index = FREE_SLOT; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        m_slots[slot].Generation++; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        m_freeSlots.push_back(slot);
+    }
 
-            std::memcpy(desc.transform.matrix, std::addressof(instance.Transform), sizeof(instance.Transform)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-            return desc;
-        }) | std::ranges::to<Array<VkAccelerationStructureInstanceKHR>>();
+    void clear() noexcept
+    {
+        for (auto slot : m_instanceSlots)
+        {
+            m_slots[slot].Index = FREE_SLOT; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            m_slots[slot].Generation++; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            m_freeSlots.push_back(slot);
+        }
+
+        m_instances.clear();
+        m_instanceSlots.clear();
+        m_dirtyRanges.clear();
+        m_movedRange.reset();
+    }
+
+    std::optional<UInt32> find(instance_handle handle) const noexcept
+    {
+        auto slot = static_cast<UInt32>(handle & 0xFFFFFFFF); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        auto generation = static_cast<UInt32>(handle >> 32); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+        if (slot >= m_slots.size() || m_slots[slot].Generation != generation || m_slots[slot].Index == FREE_SLOT) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            return std::nullopt;
+
+        return m_slots[slot].Index; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }
+
+    UInt32 index(instance_handle handle) const
+    {
+        if (auto match = this->find(handle); match.has_value()) [[likely]]
+            return match.value();
+
+        throw InvalidArgumentException("handle", "The handle {0:#x} does not refer to an instance of the acceleration structure.", handle);
+    }
+
+    void invalidate(UInt32 first, UInt32 count)
+    {
+        if (count > 0)
+            m_dirtyRanges.emplace_back(first, first + count);
+    }
+
+    void invalidate()
+    {
+        m_dirtyRanges.clear();
+        m_movedRange.reset();
+        this->invalidate(0, static_cast<UInt32>(m_instances.size()));
+    }
+
+    SharedPtr<const IVulkanBuffer> uploadInstances(const VulkanCommandBuffer& commandBuffer, bool update)
+    {
+        constexpr auto stride = sizeof(VkAccelerationStructureInstanceKHR);
+        auto instances = static_cast<UInt32>(m_instances.size());
+        const auto& factory = commandBuffer.queue()->device()->factory();
+
+        // Grow the instance buffer geometrically, if it cannot hold all instances anymore. The new buffer does not contain any instances yet.
+        // NOTE: The buffer stores a single element, as the element size of storage buffers gets aligned, which would break the tight packing required for instance data. It
+        //       can be used as a transfer source, so that the uploaded instances can be read back for debugging.
+        if (m_instanceBuffer == nullptr || m_instanceBuffer->size() < stride * instances)
+        {
+            auto capacity = std::max(std::max(instances, 1u), m_instanceBuffer == nullptr ? 0u : static_cast<UInt32>(2 * (m_instanceBuffer->size() / stride)));
+            m_instanceBuffer = factory.createBuffer(BufferType::Storage, ResourceHeap::Resource, stride * capacity, 1, ResourceUsage::AccelerationStructureBuildInput | ResourceUsage::TransferDestination | ResourceUsage::TransferSource);
+            this->invalidate();
+        }
+
+        // Full builds re-write all instances, since the bottom-level acceleration structures may have been re-built into other buffers in the meantime.
+        if (!update)
+            this->invalidate();
+
+        commandBuffer.track(m_instanceBuffer);
+
+        if (m_movedRange.has_value())
+        {
+            m_dirtyRanges.push_back(m_movedRange.value());
+            m_movedRange.reset();
+        }
+
+        if (m_dirtyRanges.empty())
+            return m_instanceBuffer;
+
+        // Merge overlapping and adjacent ranges and drop ranges of instances that have been removed.
+        std::ranges::sort(m_dirtyRanges);
+        Array<VkBufferCopy> regions;
+        UInt32 dirtyInstances { 0 };
+
+        for (auto [first, last] : m_dirtyRanges)
+        {
+            last = std::min(last, instances);
+
+            if (first >= last)
+                continue;
+            else if (!regions.empty() && first <= regions.back().dstOffset / stride + regions.back().size / stride)
+            {
+                auto& region = regions.back();
+                auto end = std::max(region.dstOffset / stride + region.size / stride, static_cast<UInt64>(last));
+                dirtyInstances += static_cast<UInt32>(end - (region.dstOffset + region.size) / stride);
+                region.size = end * stride - region.dstOffset;
+            }
+            else
+            {
+                regions.push_back({ .srcOffset = dirtyInstances * stride, .dstOffset = first * stride, .size = (last - first) * stride });
+                dirtyInstances += last - first;
+            }
+        }
+
+        m_dirtyRanges.clear();
+
+        if (regions.empty())
+            return m_instanceBuffer;
+
+        // Convert only the dirty instances into a tightly packed staging buffer.
+        m_uploadData.resize(dirtyInstances);
+        auto data = m_uploadData.begin();
+
+        for (const auto& region : regions)
+            for (auto instance = region.dstOffset / stride; instance < (region.dstOffset + region.size) / stride; ++instance)
+                convert(m_instances[instance], *data++); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        // The staging buffer is kept between uploads and only re-allocated, if it is too small or still tracked by a command buffer, that may not have been executed yet.
+        auto capacity = m_stagingBuffer == nullptr ? 0u : static_cast<UInt32>(m_stagingBuffer->size() / stride);
+
+        if (capacity < dirtyInstances || m_stagingBuffer.use_count() > 1)
+        {
+            capacity = capacity < dirtyInstances ? std::max(dirtyInstances, 2 * capacity) : capacity;
+            m_stagingBuffer = factory.createBuffer(BufferType::Other, ResourceHeap::Staging, stride * capacity, 1);
+        }
+
+        m_stagingBuffer->map(m_uploadData.data(), stride * dirtyInstances, 0);
+        commandBuffer.track(m_stagingBuffer);
+
+        // Copy the dirty ranges into the instance buffer, after previous builds finished reading from it.
+        VulkanBarrier barrier(PipelineStage::AccelerationStructureBuild, PipelineStage::Transfer);
+        barrier.transition(*m_instanceBuffer, ResourceAccess::ShaderRead, ResourceAccess::TransferWrite);
+        commandBuffer.barrier(barrier);
+
+        ::vkCmdCopyBuffer(commandBuffer.handle(), m_stagingBuffer->handle(), m_instanceBuffer->handle(), static_cast<UInt32>(regions.size()), regions.data());
+
+        barrier = VulkanBarrier(PipelineStage::Transfer, PipelineStage::AccelerationStructureBuild);
+        barrier.transition(*m_instanceBuffer, ResourceAccess::TransferWrite, ResourceAccess::ShaderRead);
+        commandBuffer.barrier(barrier);
+
+        return m_instanceBuffer;
     }
 };
 
@@ -141,6 +350,7 @@ void VulkanTopLevelAccelerationStructure::build(const VulkanCommandBuffer& comma
 
     // Perform the build.
     commandBuffer.buildAccelerationStructure(*this, scratch, *memory, offset);
+    m_impl->m_builtInstances = static_cast<UInt32>(m_impl->m_instances.size());
 
     // Store the buffer and the offset.
     m_impl->m_offset = offset;
@@ -166,6 +376,9 @@ void VulkanTopLevelAccelerationStructure::update(const VulkanCommandBuffer& comm
     if (!LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowUpdate)) [[unlikely]]
         throw RuntimeException("The acceleration structure does not allow updates. Specify `AccelerationStructureFlags::AllowUpdate` during creation.");
 
+    if (m_impl->m_instances.size() != m_impl->m_builtInstances) [[unlikely]]
+        throw RuntimeException("Instances have been added or removed since the last build ({0} instances built, {1} instances present). The acceleration structure needs to be re-built.", m_impl->m_builtInstances, m_impl->m_instances.size());
+
     // Validate the arguments and create the buffers if required.
     UInt64 requiredMemory{}, requiredScratchMemory{};
     auto device = commandBuffer.queue()->device();
@@ -287,7 +500,15 @@ void VulkanTopLevelAccelerationStructure::copy(const VulkanCommandBuffer& comman
 
     // Copy build data, if requested.
     if (copyBuildInfo)
+    {
         destination.m_impl->m_instances = m_impl->m_instances;
+        destination.m_impl->m_instanceSlots = m_impl->m_instanceSlots;
+        destination.m_impl->m_slots = m_impl->m_slots;
+        destination.m_impl->m_freeSlots = m_impl->m_freeSlots;
+        destination.m_impl->m_freeSlots.reserve(m_impl->m_slots.size());
+        destination.m_impl->m_builtInstances = m_impl->m_builtInstances;
+        destination.m_impl->invalidate();
+    }
 }
 
 const Array<Instance>& VulkanTopLevelAccelerationStructure::instances() const noexcept
@@ -297,40 +518,95 @@ const Array<Instance>& VulkanTopLevelAccelerationStructure::instances() const no
 
 void VulkanTopLevelAccelerationStructure::addInstance(const Instance& instance)
 {
-    if (m_impl->m_buffer != nullptr) [[unlikely]]
-        throw RuntimeException("An acceleration structure cannot be modified after buffers for it have been created.");
-
-    m_impl->m_instances.push_back(instance);
+    m_impl->add(instance);
 }
 
 void VulkanTopLevelAccelerationStructure::clear() noexcept
 {
-    m_impl->m_instances.clear();
+    m_impl->clear();
 }
 
 bool VulkanTopLevelAccelerationStructure::remove(const Instance& instance) noexcept
 {
-    if (auto match = std::ranges::find_if(m_impl->m_instances, [&instance](const auto& e) { return std::addressof(e) == std::addressof(instance); }); match != m_impl->m_instances.end())
+    // The instance must be stored in the instance array, so its index can be computed from its address.
+    const auto& instances = m_impl->m_instances;
+
+    if (instances.empty() || std::addressof(instance) < instances.data() || std::addressof(instance) >= instances.data() + instances.size()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return false;
+
+    m_impl->remove(static_cast<UInt32>(std::addressof(instance) - instances.data()));
+    return true;
+}
+
+VulkanTopLevelAccelerationStructure::instance_handle VulkanTopLevelAccelerationStructure::insert(const Instance& instance)
+{
+    return m_impl->add(instance);
+}
+
+bool VulkanTopLevelAccelerationStructure::remove(instance_handle handle) noexcept
+{
+    if (auto index = m_impl->find(handle); index.has_value())
     {
-        m_impl->m_instances.erase(match);
+        m_impl->remove(index.value());
         return true;
     }
 
     return false;
 }
 
-Array<VkAccelerationStructureInstanceKHR> VulkanTopLevelAccelerationStructure::buildInfo() const
+bool VulkanTopLevelAccelerationStructure::contains(instance_handle handle) const noexcept
 {
-    return m_impl->buildInfo();
+    return m_impl->find(handle).has_value();
 }
 
-void VulkanTopLevelAccelerationStructure::updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept
+const Instance& VulkanTopLevelAccelerationStructure::instance(instance_handle handle) const
 {
-    if (this->handle() != VK_NULL_HANDLE)
-        ::vkDestroyAccelerationStructure(m_impl->m_device->handle(), handle, nullptr);
+    return m_impl->m_instances[m_impl->index(handle)]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+}
+
+void VulkanTopLevelAccelerationStructure::updateInstance(instance_handle handle, const Instance& instance)
+{
+    auto index = m_impl->index(handle);
+    m_impl->m_instances[index] = instance; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    m_impl->invalidate(index, 1);
+}
+
+void VulkanTopLevelAccelerationStructure::updateTransform(instance_handle handle, const TMatrix3x4<Float>& transform)
+{
+    auto index = m_impl->index(handle);
+    m_impl->m_instances[index].Transform = transform; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    m_impl->invalidate(index, 1);
+}
 
+void VulkanTopLevelAccelerationStructure::updateMask(instance_handle handle, UInt8 mask)
+{
+    auto index = m_impl->index(handle);
+    m_impl->m_instances[index].Mask = mask; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    m_impl->invalidate(index, 1);
+}
+
+void VulkanTopLevelAccelerationStructure::updateFlags(instance_handle handle, InstanceFlags flags)
+{
+    auto index = m_impl->index(handle);
+    m_impl->m_instances[index].Flags = flags; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    m_impl->invalidate(index, 1);
+}
+
+SharedPtr<const IVulkanBuffer> VulkanTopLevelAccelerationStructure::instanceBuffer() const noexcept
+{
+    return m_impl->m_instanceBuffer;
+}
+
+SharedPtr<const IVulkanBuffer> VulkanTopLevelAccelerationStructure::uploadInstances(const VulkanCommandBuffer& commandBuffer, bool update)
+{
+    return m_impl->uploadInstances(commandBuffer, update);
+}
+
+VkAccelerationStructureKHR VulkanTopLevelAccelerationStructure::updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept
+{
+    // The previous handle may still be used by the GPU (e.g., as the source of an update), so the caller is responsible for releasing it.
     m_impl->m_device = device;
-    this->handle() = handle;
+    return std::exchange(this->handle(), handle);
 }
 
 SharedPtr<const IBuffer> VulkanTopLevelAccelerationStructure::getBuffer() const noexcept
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <format>
+
+#include <litefx/litefx.h>
+#include <litefx/core.h>
+#include <litefx/math.hpp>
+#include <litefx/logging.hpp>
+
+using namespace LiteFX;
+using namespace LiteFX::Math;
+
+constexpr char BENCHMARK_LOG[] = "Benchmarks";
+
+/// <summary>
+/// Prevents the compiler from optimizing away the computation of the value pointed to by <paramref name="pointer" />.
+/// </summary>
+/// <remarks>
+/// The function is defined in a separate translation unit, so the compiler has to assume that the value escapes.
+/// </remarks>
+void escape(const volatile void* pointer) noexcept;
+
+template <typename T>
+inline void doNotOptimize(const T& value) noexcept {
+    escape(&value);
+}
+
+/// <summary>
+/// Runs benchmarks, collects their results and writes them in the JSON format of Google Benchmark.
+/// </summary>
+/// <remarks>
+/// Each benchmark is first calibrated by doubling the number of iterations until a single sample takes at least the minimum sample time. Afterwards the benchmark
+/// is sampled multiple times with the calibrated number of iterations. All timings are reported in nanoseconds per iteration.
+/// 
+/// A benchmark can state a budget for the median time per iteration. If the budget is exceeded, the run is marked as failed, so that the executable returns an
+/// error. Budgets are not checked, if the minimum sample time is zero, as single iterations are dominated by the timer overhead.
+/// </remarks>
+class BenchmarkRunner final {
+public:
+    struct Result {
+        String Name;
+        UInt64 Iterations;
+        UInt32 Samples;
+        UInt64 ItemsPerIteration;
+        double Mean;
+        double Median;
+        double Min;
+        double StdDev;
+    };
+
+private:
+    String m_filter;
+    std::chrono::duration<double> m_sampleTime;
+    UInt32 m_samples;
+    Array<Result> m_results;
+    Array<std::pair<String, String>> m_context;
+    bool m_failed{ false };
+
+public:
+    BenchmarkRunner(String filter, double sampleTime, UInt32 samples) :
+        m_filter(std::move(filter)), m_sampleTime(sampleTime), m_samples(std::max(samples, 1u)) { }
+
+public:
+    inline bool enabled(StringView name) const noexcept {
+        return m_filter.empty() || name.find(m_filter) != StringView::npos;
+    }
+
+    inline void context(const String& key, const String& value) {
+        m_context.emplace_back(key, value);
+    }
+
+    inline const Array<Result>& results() const noexcept {
+        return m_results;
+    }
+
+    inline bool failed() const noexcept {
+        return m_failed;
+    }
+
+    /// <summary>
+    /// Runs a benchmark, where <paramref name="callback" /> executes the benchmarked operation for a given number of iterations.
+    /// </summary>
+    /// <param name="budget">The optional maximum median time per iteration in nanoseconds.</param>
+    template <typename TCallback> requires
+        std::invocable<TCallback, UInt64>
+    void run(StringView name, TCallback callback, UInt64 itemsPerIteration = 1, Optional<double> budget = std::nullopt) {
+        if (!this->enabled(name))
+            return;
+
+        using clock = std::chrono::steady_clock;
+
+        auto sample = [&callback](UInt64 iterations) {
+            auto start = clock::now();
+            callback(iterations);
+            return std::chrono::duration<double>(clock::now() - start);
+        };
+
+        // Calibrate the number of iterations.
+        UInt64 iterations{ 1 };
+
+        for (auto elapsed = sample(iterations); elapsed < m_sampleTime && iterations < (1ull << 40); elapsed = sample(iterations))
+            iterations *= 2;
+
+        // Sample the benchmark.
+        Array<double> timings(m_samples);
+
+        for (auto& timing : timings)
+            timing = std::chrono::duration<double, std::nano>(sample(iterations)).count() / static_cast<double>(iterations);
+
+        std::ranges::sort(timings);
+        auto mean = std::ranges::fold_left(timings, 0.0, std::plus<>{}) / static_cast<double>(timings.size());
+        auto variance = std::ranges::fold_left(timings, 0.0, [mean](double sum, double timing) { return sum + (timing - mean) * (timing - mean); }) / static_cast<double>(timings.size());
+
+        auto& result = m_results.emplace_back(Result {
+            .Name = String(name),
+            .Iterations = iterations,
+            .Samples = m_samples,
+            .ItemsPerIteration = itemsPerIteration,
+            .Mean = mean,
+            .Median = timings[timings.size() / 2],
+            .Min = timings.front(),
+            .StdDev = std::sqrt(variance)
+        });
+
+        // Write the results to the console directly, so that they do not end up in the sinks measured by the logging benchmarks.
+        std::cout << std::format("{0:<56} {1:>14.1f} ns {2:>14.1f} ns (median) {3:>12} iterations", result.Name, result.Mean, result.Median, result.Iterations) << std::endl;
+
+        if (budget.has_value() && m_sampleTime.count() > 0.0 && result.Median > *budget)
+        {
+            std::cerr << std::format("{0} exceeds its budget of {1:.1f} ns per iteration.", result.Name, *budget) << std::endl;
+            m_failed = true;
+        }
+    }
+
+    /// <summary>
+    /// Writes the results in the JSON format of Google Benchmark, so that they can be compared against a baseline using its `compare.py` tool.
+    /// </summary>
+    void writeJson(std::ostream& stream) const;
+};
+
+void runCoreBenchmarks(BenchmarkRunner& runner);
+void runMathBenchmarks(BenchmarkRunner& runner);
+void runLoggingBenchmarks(BenchmarkRunner& runner);
+
+#ifdef LITEFX_BUILD_VULKAN_BACKEND
+#include <litefx/backends/vulkan.hpp>
+#include <litefx/backends/vulkan_builders.hpp>
+
+void runVulkanBenchmarks(BenchmarkRunner& runner, const LiteFX::Rendering::Backends::VulkanDevice& device, const LiteFX::Rendering::Backends::VulkanDevice* graphicsDevice, bool rayTracing);
+#endif // LITEFX_BUILD_VULKAN_BACKEND
@@ -0,0 +1,122 @@
+#include "benchmark.h"
+#include <litefx/app.hpp>
+#include <numeric>
+
+constexpr UInt32 ELEMENTS = 1024;
+
+struct BenchmarkEventArgs : public EventArgs {
+    UInt32 Value;
+
+    BenchmarkEventArgs(UInt32 value) : EventArgs(), Value(value) { }
+};
+
+void runCoreBenchmarks(BenchmarkRunner& runner)
+{
+    // Iterating a range through an enumerable type-erases the iterator, so compare it against the underlying container.
+    Array<UInt32> values(ELEMENTS);
+    std::ranges::iota(values, 0u);
+
+    runner.run("Core/Iterate/Array", [&values](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            UInt64 sum{ 0 };
+
+            for (auto value : values)
+                sum += value;
+
+            doNotOptimize(sum);
+        }
+    }, ELEMENTS);
+
+    runner.run("Core/Iterate/Enumerable", [&values](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            Enumerable<const UInt32&> enumerable = values;
+            UInt64 sum{ 0 };
+
+            for (auto value : enumerable)
+                sum += value;
+
+            doNotOptimize(sum);
+        }
+    }, ELEMENTS);
+
+    runner.run("Core/Iterate/EnumerableFiltered", [&values](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            Enumerable<const UInt32&> enumerable = values | std::views::filter([](UInt32 value) { return value % 2 == 0; });
+            UInt64 sum{ 0 };
+
+            for (auto value : enumerable)
+                sum += value;
+
+            doNotOptimize(sum);
+        }
+    }, ELEMENTS);
+
+    // Invoke events with different numbers of subscribers.
+    for (UInt32 subscribers : { 1u, 8u })
+    {
+        Event<BenchmarkEventArgs> event;
+        UInt64 sum{ 0 };
+
+        for (UInt32 s{ 0 }; s < subscribers; ++s)
+            event += [&sum](const void* /*sender*/, BenchmarkEventArgs args) { sum += args.Value; };
+
+        runner.run(std::format("Core/Event/Invoke/{0}", subscribers), [&event, &sum](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+                event.invoke(nullptr, BenchmarkEventArgs(static_cast<UInt32>(i)));
+
+            doNotOptimize(sum);
+        });
+    }
+
+    // Measure the overhead of scheduling and waiting for a parallel loop.
+    {
+        TaskScheduler scheduler;
+        Array<UInt64> results(ELEMENTS);
+
+        runner.run("Core/Scheduler/ParallelFor", [&scheduler, &results](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+            {
+                auto counter = scheduler.parallelFor(results.size(), [&results, i](std::size_t index) { results[index] = index * i; });
+                scheduler.wait(*counter);
+            }
+
+            doNotOptimize(results);
+        }, ELEMENTS);
+    }
+
+    // Measure the cost of instrumentation zones, both while idle and while capturing. Idle zones are annotated throughout the hot paths, so they must stay below
+    // 50ns each. Optimized builds only take a few nanoseconds, the budget is generous so that it also holds for debug builds.
+    {
+        constexpr double IDLE_ZONE_BUDGET = 50.0;
+        Instrumentation instrumentation;
+
+        runner.run("Core/Instrumentation/IdleZone", [&instrumentation](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+            {
+                InstrumentationZone zone(instrumentation, "Benchmark");
+                doNotOptimize(i);
+            }
+        }, 1, IDLE_ZONE_BUDGET);
+
+        instrumentation.start();
+
+        runner.run("Core/Instrumentation/CapturingZone", [&instrumentation](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+            {
+                {
+                    InstrumentationZone zone(instrumentation, "Benchmark");
+                    doNotOptimize(i);
+                }
+
+                // Drain the buffer before it runs full, which would turn the benchmark into a measurement of dropped events.
+                if ((i & (Instrumentation::DEFAULT_BUFFER_SIZE / 2 - 1)) == 0) [[unlikely]]
+                    instrumentation.clear();
+            }
+        });
+
+        instrumentation.stop();
+    }
+}
@@ -0,0 +1,22 @@
+#include "benchmark.h"
+
+constexpr char LOGGING_BENCHMARK_LOG[] = "Benchmarks.Logging";
+
+void runLoggingBenchmarks(BenchmarkRunner& runner)
+{
+    // Messages below the level of the logger are discarded before they are formatted, but the arguments are still evaluated.
+    runner.run("Logging/Filtered", [](UInt64 iterations) {
+        auto log = Logger::get(LOGGING_BENCHMARK_LOG);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+            log.log(LogLevel::Trace, "Filtered message {0}.", i);
+    });
+
+    // Messages at the info level are formatted and written to the rolling file sink (the console sink only accepts warnings).
+    runner.run("Logging/FileSink", [](UInt64 iterations) {
+        auto log = Logger::get(LOGGING_BENCHMARK_LOG);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+            log.log(LogLevel::Info, "Benchmark message {0} with a floating point value {1:.3f}.", i, static_cast<double>(i) * 0.5);
+    });
+}
@@ -0,0 +1,218 @@
+#include "benchmark.h"
+#include <litefx/app.hpp>
+
+// CLI11 parses optional values as double by default, which yields an implicit-cast warning.
+#pragma warning(disable: 4244)
+
+#include <CLI/CLI.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#ifdef LITEFX_BUILD_VULKAN_BACKEND
+using namespace LiteFX::Rendering;
+using namespace LiteFX::Rendering::Backends;
+#endif // LITEFX_BUILD_VULKAN_BACKEND
+
+void escape(const volatile void* /*pointer*/) noexcept
+{
+}
+
+void BenchmarkRunner::writeJson(std::ostream& stream) const
+{
+    stream << "{\n  \"context\": {\n";
+    stream << std::format("    \"date\": \"{0:%Y-%m-%dT%H:%M:%S}\",\n", std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+    stream << std::format("    \"num_cpus\": {0},\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    stream << "    \"library_build_type\": \"release\",\n";
+#else
+    stream << "    \"library_build_type\": \"debug\",\n";
+#endif
+
+    for (const auto& [key, value] : m_context)
+    {
+        stream << "    ";
+        Instrumentation::writeJsonString(stream, key);
+        stream << ": ";
+        Instrumentation::writeJsonString(stream, value);
+        stream << ",\n";
+    }
+
+    stream << "    \"litefx_version\": \"" LITEFX_VERSION "\"\n  },\n  \"benchmarks\": [";
+
+    for (bool first{ true }; const auto& result : m_results)
+    {
+        stream << (first ? "\n" : ",\n") << "    {\n      \"name\": ";
+        Instrumentation::writeJsonString(stream, result.Name);
+        stream << ",\n      \"run_name\": ";
+        Instrumentation::writeJsonString(stream, result.Name);
+        stream << std::format(",\n      \"run_type\": \"iteration\",\n      \"repetitions\": {0},\n      \"threads\": 1,\n      \"iterations\": {1},\n", result.Samples, result.Iterations);
+        stream << std::format("      \"real_time\": {0:.3f},\n      \"cpu_time\": {0:.3f},\n      \"time_unit\": \"ns\",\n", result.Mean);
+        stream << std::format("      \"median\": {0:.3f},\n      \"min\": {1:.3f},\n      \"stddev\": {2:.3f},\n", result.Median, result.Min, result.StdDev);
+        stream << std::format("      \"items_per_second\": {0:.3f}\n    }}", static_cast<double>(result.ItemsPerIteration) * 1.e9 / result.Mean);
+        first = false;
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+#ifdef LITEFX_BUILD_VULKAN_BACKEND
+class BenchmarkApp : public LiteFX::App {
+public:
+    static StringView Name() noexcept { return "LiteFX Benchmarks"; }
+    StringView name() const noexcept override { return Name(); }
+
+    static AppVersion Version() noexcept { return AppVersion(1, 0, 0, 0); }
+    AppVersion version() const noexcept override { return Version(); }
+
+private:
+    BenchmarkRunner& m_runner;
+    Optional<UInt64> m_adapterId;
+    bool m_headless;
+    SharedPtr<VulkanDevice> m_device, m_graphicsDevice;
+
+public:
+    BenchmarkApp(BenchmarkRunner& runner, Optional<UInt64> adapterId, bool headless) :
+        App(), m_runner(runner), m_adapterId(adapterId), m_headless(headless)
+    {
+        this->initializing += std::bind(&BenchmarkApp::onInit, this);
+    }
+
+private:
+    void onInit()
+    {
+        auto startCallback = [this](VulkanBackend* backend) {
+            // Prefer a software adapter, so that results are comparable between machines (e.g. in CI), unless an adapter has been requested explicitly.
+            const VulkanGraphicsAdapter* adapter{ nullptr };
+
+            if (!m_adapterId.has_value())
+            {
+                const auto& adapters = backend->adapters();
+
+                if (auto match = std::ranges::find_if(adapters, [](const auto& adapter) { return adapter->type() == GraphicsAdapterType::Software; }); match != adapters.end())
+                    adapter = match->get();
+            }
+
+            if (adapter == nullptr)
+                adapter = backend->findAdapter(m_adapterId);
+
+            if (adapter == nullptr)
+                throw RuntimeException("No suitable graphics adapter found.");
+
+            m_runner.context("adapter", adapter->name());
+
+            // Enable ray tracing, if the adapter supports it, so that the acceleration structure benchmarks can run.
+            const std::array<String, 4> rayTracingExtensions { VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME, VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME, VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME, VK_KHR_RAY_TRACING_MAINTENANCE_1_EXTENSION_NAME };
+            auto rayTracing = adapter->validateDeviceExtensions(rayTracingExtensions);
+            m_runner.context("ray_tracing", rayTracing ? "true" : "false");
+
+            // Create a compute-only device, as the benchmarks do not present.
+            m_device = backend->createDevice("Benchmarks", *adapter, nullptr, GraphicsDeviceFeatures { .RayTracing = rayTracing }).shared_from_this();
+
+            // Benchmarks that require a graphics queue run on a second device with a headless surface, if available.
+            if (m_headless)
+                m_graphicsDevice = backend->createDevice("Benchmarks.Graphics", *adapter, backend->createHeadlessSurface(), Format::B8G8R8A8_UNORM, Size2d { 1280, 720 }, 3, false).shared_from_this(); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            runVulkanBenchmarks(m_runner, *m_device, m_graphicsDevice.get(), rayTracing);
+
+            return true;
+        };
+
+        auto stopCallback = [this](VulkanBackend* backend) {
+            m_device.reset();
+            backend->releaseDevice("Benchmarks");
+
+            if (m_graphicsDevice != nullptr)
+            {
+                m_graphicsDevice.reset();
+                backend->releaseDevice("Benchmarks.Graphics");
+            }
+        };
+
+        this->onBackendStart<VulkanBackend>(startCallback);
+        this->onBackendStop<VulkanBackend>(stopCallback);
+    }
+};
+#endif // LITEFX_BUILD_VULKAN_BACKEND
+
+int main(const int argc, const char** argv)
+{
+    // Parse the command line parameters.
+    CLI::App commandLine{ "Runs the LiteFX benchmarks and writes the results in the JSON format of Google Benchmark.", "LiteFX.Benchmarks" };
+
+    String output{ "benchmarks.json" };
+    String filter{ };
+    double minTime{ 0.1 };
+    UInt32 samples{ 10 };
+    Optional<UInt64> adapterId;
+    commandLine.add_option("-o,--out", output, "The file to write the results to.")->take_first();
+    commandLine.add_option("-f,--filter", filter, "Only runs benchmarks whose name contains the filter.")->take_first();
+    commandLine.add_option("-t,--min-time", minTime, "The minimum duration of a single sample in seconds.")->take_first();
+    commandLine.add_option("-s,--samples", samples, "The number of samples taken for each benchmark.")->take_first();
+    commandLine.add_option("-a,--adapter", adapterId, "The unique ID of the graphics adapter. Defaults to a software adapter, if available.")->take_first();
+
+    try
+    {
+        commandLine.parse(argc, argv);
+    }
+    catch (const CLI::ParseError& ex)
+    {
+        return commandLine.exit(ex);
+    }
+
+    // Set the current path, so that shaders are found relative to the executable. The output path is resolved relative to the original working directory.
+    auto outputPath = std::filesystem::absolute(output);
+    std::filesystem::current_path(std::filesystem::absolute(std::filesystem::path(argv[0])).remove_filename());
+
+    // Register the sinks before any log is created. The console only receives warnings, so that the file sink can be measured in isolation.
+    auto consoleSink = makeUnique<ConsoleSink>(LogLevel::Warning);
+    auto fileSink = makeUnique<RollingFileSink>("benchmarks.log", LogLevel::Info, "%+", true);
+    Logger::sinkTo(consoleSink.get());
+    Logger::sinkTo(fileSink.get());
+
+    BenchmarkRunner runner(filter, minTime, samples);
+    runner.context("executable", argv[0]);
+
+    try
+    {
+        runCoreBenchmarks(runner);
+        runMathBenchmarks(runner);
+        runLoggingBenchmarks(runner);
+
+#ifdef LITEFX_BUILD_VULKAN_BACKEND
+        // Run the backend benchmarks without validation layers, as they would dominate the timings.
+        Array<String> extensions { };
+        Array<String> layers { };
+
+        // Headless surfaces are only supported by the native swap chain, not by the interop swap chain.
+#if !defined(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN) || !defined(LITEFX_BUILD_DIRECTX_12_BACKEND)
+        if (Array<String> headlessExtensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME }; VulkanBackend::validateInstanceExtensions(headlessExtensions))
+            extensions = std::move(headlessExtensions);
+#endif
+
+        UniquePtr<App> app = App::build<BenchmarkApp>(runner, adapterId, !extensions.empty())
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+#endif // LITEFX_BUILD_VULKAN_BACKEND
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream stream(outputPath, std::ios::out | std::ios::trunc);
+
+    if (!stream.is_open())
+    {
+        std::cerr << "Unable to write results to " << outputPath.string() << '.' << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    runner.writeJson(stream);
+    std::cout << "Results written to " << outputPath.string() << '.' << std::endl;
+
+    return runner.failed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
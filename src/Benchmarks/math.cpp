@@ -0,0 +1,62 @@
+#include "benchmark.h"
+
+void runMathBenchmarks(BenchmarkRunner& runner)
+{
+    TMatrix4<Float> matrix = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f };
+
+    runner.run("Math/Matrix4/Transpose", [&matrix](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            matrix = matrix.transpose();
+            doNotOptimize(matrix);
+        }
+    });
+
+    runner.run("Math/Matrix4/Column", [&matrix](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            auto column = matrix.column(i % 4);
+            doNotOptimize(column);
+        }
+    });
+
+    runner.run("Math/Matrix4/Multiply", [&matrix](UInt64 iterations) {
+        auto result = TMatrix4<Float>::identity();
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            TMatrix4<Float> product{ 0.f };
+
+            for (size_t r{ 0 }; r < 4; ++r)
+                for (size_t c{ 0 }; c < 4; ++c)
+                    for (size_t k{ 0 }; k < 4; ++k)
+                        product[r, c] += result[r, k] * matrix[k, c];
+
+            result = product;
+            doNotOptimize(result);
+        }
+    });
+
+    runner.run("Math/Vector4f/Construct", [](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            auto value = static_cast<Float>(i);
+            Vector4f vector(value, value + 1.f, value + 2.f, 1.f);
+            doNotOptimize(vector);
+        }
+    });
+
+#ifdef LITEFX_BUILD_WITH_GLM
+    runner.run("Math/Vector4f/GlmRoundTrip", [](UInt64 iterations) {
+        Vector4f vector(1.f, 2.f, 3.f, 4.f);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            glm::f32vec4 converted = vector;
+            converted.w += 1.f;
+            vector = Vector4f(converted);
+            doNotOptimize(vector);
+        }
+    });
+#endif // LITEFX_BUILD_WITH_GLM
+}
@@ -0,0 +1,15 @@
+#pragma pack_matrix(row_major)
+
+struct Parameters
+{
+    float4 Scale;
+};
+
+ConstantBuffer<Parameters> Constants : register(b0, space0);
+RWStructuredBuffer<float> Data       : register(u1, space0);
+
+[numthreads(64, 1, 1)]
+void main(uint3 id : SV_DispatchThreadID)
+{
+    Data[id.x] = Data[id.x] * Constants.Scale.x + Constants.Scale.y;
+}
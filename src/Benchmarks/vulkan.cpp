@@ -0,0 +1,322 @@
+#include "benchmark.h"
+
+#ifdef LITEFX_BUILD_VULKAN_BACKEND
+
+using namespace LiteFX::Rendering;
+using namespace LiteFX::Rendering::Backends;
+
+constexpr UInt32 COMMANDS_PER_BUFFER = 64;
+constexpr UInt32 SUBMITS_PER_BATCH = 16;
+constexpr UInt32 PIPELINES_PER_BATCH = 8;
+constexpr UInt32 ALLOCATIONS = 256;
+constexpr UInt32 BUFFER_ELEMENTS = 1024;
+constexpr UInt32 TLAS_INSTANCES = 100000;
+constexpr UInt32 TLAS_DIRTY_INSTANCES = 1000;
+constexpr UInt32 RESIZE_STEPS = 100;
+
+static void runAllocatorBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    // Allocate and immediately release a block, which is the common pattern for transient sub-allocations.
+    runner.run("Vulkan/VirtualAllocator/AllocateFree", [&device](UInt64 iterations) {
+        auto allocator = device.factory().createAllocator(64 * 1024 * 1024);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+            allocator.free(allocator.allocate(256, 16, AllocationStrategy::OptimizeTime));
+    });
+
+    // Allocate into a fragmented allocator, where every other block has been released.
+    runner.run("Vulkan/VirtualAllocator/AllocateFragmented", [&device](UInt64 iterations) {
+        auto allocator = device.factory().createAllocator(64 * 1024 * 1024);
+        Array<VirtualAllocator::Allocation> allocations;
+        allocations.reserve(ALLOCATIONS);
+
+        for (UInt32 a{ 0 }; a < ALLOCATIONS; ++a)
+            allocations.push_back(allocator.allocate(static_cast<UInt64>(a % 16 + 1) * 256, 16));
+
+        for (UInt32 a{ 0 }; a < ALLOCATIONS; a += 2)
+            allocator.free(std::move(allocations[a]));
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+            allocator.free(allocator.allocate(512, 16, AllocationStrategy::OptimizePacking));
+
+        for (UInt32 a{ 1 }; a < ALLOCATIONS; a += 2)
+            allocator.free(std::move(allocations[a]));
+    });
+
+    // Allocate with the linear algorithm, which is used for ring buffers that are reset each frame.
+    runner.run("Vulkan/VirtualAllocator/Linear", [&device](UInt64 iterations) {
+        auto allocator = device.factory().createAllocator(64 * 1024 * 1024, AllocationAlgorithm::Linear);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+            allocator.free(allocator.allocate(256, 16, AllocationStrategy::OptimizeTime));
+    });
+}
+
+static void runDescriptorBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    SharedPtr<VulkanPipelineLayout> layout = device.buildPipelineLayout()
+        .descriptorSet(0, ShaderStage::Any)
+            .withConstantBuffer(0, sizeof(Float) * 4)
+            .withStructuredBuffer(1, true)
+            .add();
+
+    const IDescriptorSetLayout& descriptorSetLayout = layout->descriptorSet(0);
+
+    // Releasing a descriptor set returns it to the layout, so after the first iteration this measures recycling.
+    runner.run("Vulkan/DescriptorSet/AllocateRecycle", [&descriptorSetLayout](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            auto descriptorSet = descriptorSetLayout.allocate();
+            doNotOptimize(descriptorSet);
+        }
+    });
+
+    runner.run("Vulkan/DescriptorSet/AllocateBatch", [&descriptorSetLayout](UInt64 iterations) {
+        Array<UniquePtr<IDescriptorSet>> descriptorSets(COMMANDS_PER_BUFFER);
+
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            for (auto& descriptorSet : descriptorSets)
+                descriptorSet = descriptorSetLayout.allocate();
+
+            doNotOptimize(descriptorSets);
+        }
+    }, COMMANDS_PER_BUFFER);
+}
+
+static void runCommandBufferBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    auto& queue = device.defaultQueue(QueueType::Compute);
+    auto source = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, sizeof(Float), BUFFER_ELEMENTS, ResourceUsage::TransferSource);
+    auto target = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, sizeof(Float), BUFFER_ELEMENTS, ResourceUsage::TransferDestination);
+
+    runner.run("Vulkan/CommandBuffer/Create", [&queue](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            auto commandBuffer = queue.createCommandBuffer(true);
+            commandBuffer->end();
+        }
+    });
+
+    auto commandBuffer = queue.createCommandBuffer(false);
+
+    runner.run("Vulkan/CommandBuffer/RecordBarriers", [&device, &commandBuffer](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            commandBuffer->begin();
+
+            for (UInt32 c{ 0 }; c < COMMANDS_PER_BUFFER; ++c)
+            {
+                auto barrier = device.makeBarrier(PipelineStage::Compute, PipelineStage::Compute);
+                barrier->wait(ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead);
+                commandBuffer->barrier(*barrier);
+            }
+
+            commandBuffer->end();
+        }
+    }, COMMANDS_PER_BUFFER);
+
+    runner.run("Vulkan/CommandBuffer/RecordTransfers", [&commandBuffer, &source, &target](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            commandBuffer->begin();
+
+            for (UInt32 c{ 0 }; c < COMMANDS_PER_BUFFER; ++c)
+                commandBuffer->transfer(*source, *target, c, c, 1);
+
+            commandBuffer->end();
+        }
+    }, COMMANDS_PER_BUFFER);
+
+    // Submit small command buffers and only wait for the last one in each batch, which measures the submission overhead rather than the GPU latency.
+    runner.run("Vulkan/Queue/Submit", [&queue, &source, &target](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            UInt64 fence{ 0 };
+
+            for (UInt32 s{ 0 }; s < SUBMITS_PER_BATCH; ++s)
+            {
+                auto commandBuffer = queue.createCommandBuffer(true);
+                commandBuffer->transfer(*source, *target, s, s, 1);
+                fence = queue.submit(commandBuffer);
+            }
+
+            queue.waitFor(fence);
+        }
+    }, SUBMITS_PER_BATCH);
+
+    device.wait();
+}
+
+static void runPipelineBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    // Loading a program without a cached reflection runs SPIR-V reflection for each module.
+    runner.run("Vulkan/ShaderProgram/ReflectCold", [&device](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            VulkanShaderProgram::clearReflectionCache();
+            SharedPtr<VulkanShaderProgram> shaderProgram = device.buildShaderProgram()
+                .withComputeShaderModule("shaders/benchmark_cs.spv");
+
+            auto layout = shaderProgram->reflectPipelineLayout();
+            doNotOptimize(layout);
+        }
+    });
+
+    runner.run("Vulkan/ShaderProgram/ReflectCached", [&device](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            SharedPtr<VulkanShaderProgram> shaderProgram = device.buildShaderProgram()
+                .withComputeShaderModule("shaders/benchmark_cs.spv");
+
+            auto layout = shaderProgram->reflectPipelineLayout();
+            doNotOptimize(layout);
+        }
+    });
+
+    SharedPtr<VulkanShaderProgram> shaderProgram = device.buildShaderProgram()
+        .withComputeShaderModule("shaders/benchmark_cs.spv");
+    auto layout = shaderProgram->reflectPipelineLayout();
+
+    // Compile a batch of pipelines, either one after another or in parallel on the app task scheduler. The difference between both is the load-time win of
+    // asynchronous compilation.
+    for (bool async : { false, true })
+    {
+        runner.run(async ? "Vulkan/ComputePipeline/CompileAsync" : "Vulkan/ComputePipeline/Compile", [&device, &shaderProgram, &layout, async](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+            {
+                Array<UniquePtr<VulkanComputePipeline>> pipelines(PIPELINES_PER_BATCH);
+
+                for (auto& pipeline : pipelines)
+                    pipeline = device.buildComputePipeline("Benchmark")
+                        .layout(layout)
+                        .shaderProgram(shaderProgram)
+                        .compileAsync(async);
+
+                for (auto& pipeline : pipelines)
+                    pipeline->wait();
+            }
+        }, PIPELINES_PER_BATCH);
+    }
+}
+
+static void runFrameBufferBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    // Emulates dragging a window border from 1280x720 to 1917x1063 and back again, which resizes the frame buffer once per step.
+    auto dragSize = [](UInt32 step) {
+        auto offset = static_cast<size_t>(step < RESIZE_STEPS / 2 ? step : RESIZE_STEPS - step);
+        return Size2d { 1280 + 13 * offset, 720 + 7 * offset }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    };
+
+    for (auto [name, policy] : std::initializer_list<std::pair<StringView, FrameBufferResizePolicy>> {
+        { "Vulkan/FrameBuffer/ResizeExact", FrameBufferResizePolicy::Exact },
+        { "Vulkan/FrameBuffer/ResizeOverAllocate", FrameBufferResizePolicy::OverAllocate },
+        { "Vulkan/FrameBuffer/ResizeReuseImages", FrameBufferResizePolicy::ReuseImages },
+        { "Vulkan/FrameBuffer/ResizeOverAllocateReuseImages", FrameBufferResizePolicy::OverAllocate | FrameBufferResizePolicy::ReuseImages } })
+    {
+        if (!runner.enabled(name))
+            continue;
+
+        auto frameBuffer = VulkanFrameBuffer::create(device, dragSize(0), "Frame Buffer");
+        frameBuffer->addImage("Color", Format::B8G8R8A8_UNORM);
+        frameBuffer->addImage("Depth", Format::D32_SFLOAT);
+        frameBuffer->setResizePolicy(policy);
+
+        runner.run(name, [&frameBuffer, &dragSize](UInt64 iterations) {
+            for (UInt64 i{ 0 }; i < iterations; ++i)
+                for (UInt32 step{ 1 }; step <= RESIZE_STEPS; ++step)
+                    frameBuffer->resize(dragSize(step % RESIZE_STEPS));
+        }, RESIZE_STEPS);
+
+        // Report the allocations and hitches, as the mean time alone hides the cost of the individual resizes that re-allocate.
+        auto statistics = frameBuffer->resizeStatistics();
+        runner.context(std::format("{0}/ReallocationsPerResize", name), std::format("{0:.3f}", static_cast<double>(statistics.Reallocations) / static_cast<double>(statistics.Resizes)));
+        runner.context(std::format("{0}/ReusedImagesPerResize", name), std::format("{0:.3f}", static_cast<double>(statistics.ReusedImages) / static_cast<double>(statistics.Resizes)));
+        runner.context(std::format("{0}/MaxResizeTime", name), std::format("{0:.3f} ms", statistics.MaxResizeTime));
+
+        std::cout << std::format("{0:<56} {1:>14.3f} reallocations/resize {2:>8.3f} ms (max)", name, static_cast<double>(statistics.Reallocations) / static_cast<double>(statistics.Resizes), statistics.MaxResizeTime) << std::endl;
+    }
+
+    device.wait();
+}
+
+static void runAccelerationStructureBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device)
+{
+    auto& queue = device.defaultQueue(QueueType::Compute);
+
+    // Instances reference a bottom-level acceleration structure that is never built, which turns them into inactive instances. This keeps the GPU work to a minimum,
+    // so that the benchmarks measure the CPU time spent on preparing the instance data.
+    auto blas = LiteFX::asShared(device.factory().createBottomLevelAccelerationStructure("BLAS"));
+    auto tlas = device.factory().createTopLevelAccelerationStructure("TLAS", AccelerationStructureFlags::AllowUpdate | AccelerationStructureFlags::PreferFastBuild);
+
+    Array<VulkanTopLevelAccelerationStructure::instance_handle> handles;
+    handles.reserve(TLAS_INSTANCES);
+
+    for (UInt32 i{ 0 }; i < TLAS_INSTANCES; ++i)
+        handles.push_back(tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = i }));
+
+    UInt64 size{}, scratchSize{};
+    device.computeAccelerationStructureSizes(*tlas, size, scratchSize);
+    auto buffer = device.factory().createBuffer(BufferType::AccelerationStructure, ResourceHeap::Resource, static_cast<size_t>(size), 1, ResourceUsage::AllowWrite);
+    auto scratchBuffer = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, static_cast<size_t>(scratchSize), 1, ResourceUsage::AllowWrite);
+
+    auto commandBuffer = queue.createCommandBuffer(true);
+    tlas->build(*commandBuffer, scratchBuffer, buffer, 0, size);
+    queue.waitFor(commandBuffer->submit());
+
+    // Move a subset of the instances each frame and record the update, which only converts and uploads the moved instances.
+    auto recordUpdates = [&](UInt64 iterations, UInt32 dirtyInstances) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            commandBuffer->begin();
+
+            for (UInt32 d{ 0 }; d < dirtyInstances; ++d)
+            {
+                auto handle = handles[(i * dirtyInstances + d) % TLAS_INSTANCES];
+                auto transform = TMatrix3x4<Float>::identity();
+                transform.at(0, 3) = static_cast<Float>(i);
+                tlas->updateTransform(handle, transform);
+            }
+
+            tlas->update(*commandBuffer, scratchBuffer, buffer, 0, size);
+            commandBuffer->end();
+        }
+    };
+
+    runner.run("Vulkan/TopLevelAccelerationStructure/UpdateAll", [&recordUpdates](UInt64 iterations) { recordUpdates(iterations, TLAS_INSTANCES); }, TLAS_INSTANCES);
+    runner.run("Vulkan/TopLevelAccelerationStructure/UpdateSparse", [&recordUpdates](UInt64 iterations) { recordUpdates(iterations, TLAS_DIRTY_INSTANCES); }, TLAS_DIRTY_INSTANCES);
+
+    // Remove and re-insert a subset of the instances each frame, as dynamic scenes do when objects spawn and despawn.
+    runner.run("Vulkan/TopLevelAccelerationStructure/InsertRemove", [&tlas, &blas, &handles](UInt64 iterations) {
+        for (UInt64 i{ 0 }; i < iterations; ++i)
+        {
+            for (UInt32 d{ 0 }; d < TLAS_DIRTY_INSTANCES; ++d)
+            {
+                auto& handle = handles[(i * TLAS_DIRTY_INSTANCES + d) % TLAS_INSTANCES];
+                tlas->remove(handle);
+                handle = tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = d });
+            }
+        }
+    }, TLAS_DIRTY_INSTANCES);
+
+    device.wait();
+}
+
+void runVulkanBenchmarks(BenchmarkRunner& runner, const VulkanDevice& device, const VulkanDevice* graphicsDevice, bool rayTracing)
+{
+    runAllocatorBenchmarks(runner, device);
+    runDescriptorBenchmarks(runner, device);
+    runCommandBufferBenchmarks(runner, device);
+    runPipelineBenchmarks(runner, device);
+
+    // Frame buffers transition their images on the graphics queue, which compute-only devices do not provide.
+    if (graphicsDevice != nullptr)
+        runFrameBufferBenchmarks(runner, *graphicsDevice);
+    else if (runner.enabled("Vulkan/FrameBuffer/"))
+        std::cout << "Skipping frame buffer benchmarks, as headless surfaces are not available." << std::endl;
+
+    if (rayTracing)
+        runAccelerationStructureBenchmarks(runner, device);
+}
+
+#endif // LITEFX_BUILD_VULKAN_BACKEND
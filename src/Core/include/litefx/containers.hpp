@@ -15,6 +15,7 @@
 #include <queue>
 #include <tuple>
 #include <memory>
+#include <new>
 #include <functional>
 #include <variant>
 #include <ranges>
@@ -764,6 +765,136 @@ namespace LiteFX {
 		}
 	};
 
+	/// <summary>
+	/// A smart pointer that stores an implementation instance for a public interface class within a fixed-size inline buffer.
+	/// </summary>
+	/// <remarks>
+	/// Other than <see cref="PimplPtr" />, this pointer does not allocate the implementation instance on the heap. Instead, the instance is constructed into a buffer of 
+	/// <typeparamref name="Size" /> bytes that is stored directly within the public interface class. This makes it well suited for types that are created and destroyed
+	/// frequently, such as logs or barriers. The size and alignment of the implementation are validated with a `static_assert` when the pointer is constructed, 
+	/// which happens at the implementation site where the implementation type is complete. If the assertion fails, the storage size provided to the 
+	/// <see cref="LITEFX_INLINE_IMPLEMENTATION" /> declaration needs to be increased.
+	/// 
+	/// Note that moving a pointer moves the implementation instance itself, so the implementation must be move-constructible and must not store references to its 
+	/// own address.
+	/// </remarks>
+	/// <typeparam name="pImpl">The type of the implementation class.</typeparam>
+	/// <typeparam name="Size">The size of the inline storage in bytes.</typeparam>
+	/// <typeparam name="Alignment">The alignment of the inline storage.</typeparam>
+	template <class pImpl, std::size_t Size, std::size_t Alignment = alignof(std::max_align_t)>
+	class InlinePimplPtr final {
+	private:
+		/// <summary>
+		/// Stores the implementation instance.
+		/// </summary>
+		alignas(Alignment) std::array<std::byte, Size> m_storage;
+
+	private:
+		inline pImpl* get() const noexcept {
+			return std::launder(reinterpret_cast<pImpl*>(const_cast<std::byte*>(m_storage.data()))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-type-const-cast)
+		}
+
+		static consteval void validate() noexcept {
+			static_assert(sizeof(pImpl) <= Size, "The inline storage is too small to hold the implementation. Increase the storage size of the implementation declaration.");
+			static_assert(Alignment % alignof(pImpl) == 0, "The inline storage alignment is not compatible with the implementation alignment.");
+		}
+
+	public:
+		/// <summary>
+		/// Initializes a new implementation instance.
+		/// </summary>
+		InlinePimplPtr() /*requires std::is_default_constructible_v<pImpl>*/ {
+			validate();
+			std::construct_at(this->get());
+		}
+
+		/// <summary>
+		/// Initializes a new implementation instance.
+		/// </summary>
+		/// <remarks>
+		/// The constructor does not participate in overload resolution for a single argument of type <see cref="InlinePimplPtr" />, so that copies and moves 
+		/// are not forwarded to the implementation constructor.
+		/// </remarks>
+		/// <typeparam name="...TArgs">The types of the arguments passed to the implementation constructor.</typeparam>
+		/// <param name="...args">The arguments passed to the implementation constructor.</param>
+		template <typename... TArgs>
+			requires (!(sizeof...(TArgs) == 1 && (std::same_as<std::remove_cvref_t<TArgs>, InlinePimplPtr> && ...))) && std::constructible_from<pImpl, TArgs...>
+		InlinePimplPtr(TArgs&&... args) {
+			validate();
+			std::construct_at(this->get(), std::forward<TArgs>(args)...); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+		}
+
+		/// <summary>
+		/// Initializes a new implementation instance by copying the implementation instance stored by <paramref name="src" />.
+		/// </summary>
+		/// <param name="src">The source pointer to copy the implementation instance from.</param>
+		InlinePimplPtr(const InlinePimplPtr& src) /*requires std::copy_constructible<pImpl>*/ {
+			std::construct_at(this->get(), *src);
+		}
+
+		/// <summary>
+		/// Initializes a new implementation instance by moving the implementation instance stored by <paramref name="src" />.
+		/// </summary>
+		/// <param name="src">The source pointer to move the implementation instance from.</param>
+		InlinePimplPtr(InlinePimplPtr&& src) noexcept {
+			std::construct_at(this->get(), std::move(*src));
+		}
+
+		/// <summary>
+		/// Replaces the implementation instance with a copy of the implementation instance stored by <paramref name="src" />.
+		/// </summary>
+		/// <param name="src">The source pointer to copy the implementation instance from.</param>
+		/// <returns>A reference to the current pointer instance.</returns>
+		InlinePimplPtr& operator=(const InlinePimplPtr& src) /*requires std::copy_constructible<pImpl>*/
+		{
+			if (&src != this)
+			{
+				pImpl copy(*src);
+				std::destroy_at(this->get());
+				std::construct_at(this->get(), std::move(copy));
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// Replaces the implementation instance by moving the implementation instance stored by <paramref name="src" />.
+		/// </summary>
+		/// <param name="src">The source pointer to move the implementation instance from.</param>
+		/// <returns>A reference to the current pointer instance.</returns>
+		InlinePimplPtr& operator=(InlinePimplPtr&& src) noexcept
+		{
+			if (&src != this)
+			{
+				std::destroy_at(this->get());
+				std::construct_at(this->get(), std::move(*src));
+			}
+
+			return *this;
+		}
+
+		~InlinePimplPtr() noexcept {
+			std::destroy_at(this->get());
+		}
+
+	public:
+		/// <summary>
+		/// Returns a reference to the managed implementation instance.
+		/// </summary>
+		/// <returns>A reference to the managed implementation instance.</returns>
+		pImpl& operator* () const noexcept {
+			return *this->get();
+		}
+
+		/// <summary>
+		/// Returns a pointer to the managed implementation instance.
+		/// </summary>
+		/// <returns>A pointer to the managed implementation instance.</returns>
+		pImpl* operator-> () const noexcept {
+			return this->get();
+		}
+	};
+
 	// NOLINTBEGIN(cppcoreguidelines-macro-usage)
 
 	/// <summary>
@@ -780,6 +911,20 @@ namespace LiteFX {
 	friend class PimplPtr<impl>; \
 	friend class impl;
 
+	/// <summary>
+	/// Declares the implementation for the public interface of a class, that is stored in <paramref name="size" /> bytes of inline storage.
+	/// </summary>
+	/// <remarks>
+	/// Use this declaration instead of <see cref="LITEFX_IMPLEMENTATION" /> for types that are created frequently, in order to avoid a heap allocation for each
+	/// instance. A class can access the instance of the implementation using `m_impl`, just as it would for the default declaration.
+	/// </remarks>
+	/// <seealso cref="InlinePimplPtr" />
+#  define LITEFX_INLINE_IMPLEMENTATION(impl, size) private: \
+	class impl; \
+	InlinePimplPtr<impl, size> m_impl; \
+	friend class InlinePimplPtr<impl, size>; \
+	friend class impl;
+
 	// NOLINTEND(cppcoreguidelines-macro-usage)
 #endif
 
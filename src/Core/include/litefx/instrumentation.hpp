@@ -0,0 +1,249 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+#include <litefx/config.h>
+#include "containers.hpp"
+
+namespace LiteFX {
+
+	/// <summary>
+	/// Collects CPU timing zones and counters from multiple threads and exports them as Chrome trace events.
+	/// </summary>
+	/// <remarks>
+	/// Each thread that records events writes them into its own lock-free single-producer/single-consumer ring buffer, so recording never blocks or contends with
+	/// other threads. The buffers are drained by <see cref="collect" />, which should be called regularly (e.g. once per frame) while capturing, in order to avoid
+	/// dropping events. If a ring buffer runs full, new events are discarded and counted (see <see cref="dropped" />).
+	///
+	/// Recording is only performed while capturing (see <see cref="start" />). Zones that are created while not capturing only perform a single relaxed atomic load.
+	/// If the engine is built without `LITEFX_BUILD_INSTRUMENTATION`, the <see cref="LITEFX_PROFILE_ZONE" /> and <see cref="LITEFX_PROFILE_COUNTER" /> macros do
+	/// not generate any code at all.
+	///
+	/// Zone and counter names are not copied and must be string literals or otherwise outlive the instrumentation instance. Similar to the
+	/// <see cref="TaskScheduler" />, the ring buffers are owned by the instance, which is owned by the application (see <see cref="App::instrumentation" />), so
+	/// that events from all modules end up in the same trace. Each module only caches the ring buffer of the calling thread in thread-local storage.
+	/// </remarks>
+	/// <seealso cref="InstrumentationZone" />
+	class Instrumentation final {
+		LITEFX_IMPLEMENTATION(InstrumentationImpl);
+
+	public:
+		/// <summary>
+		/// The default number of events that can be stored in the ring buffer of a single thread.
+		/// </summary>
+		static constexpr std::uint32_t DEFAULT_BUFFER_SIZE = 16384u;
+
+		/// <summary>
+		/// Describes the type of a recorded event.
+		/// </summary>
+		enum class EventType : std::uint32_t {
+			/// <summary>
+			/// A timed zone.
+			/// </summary>
+			Zone = 0x01,
+
+			/// <summary>
+			/// A counter value.
+			/// </summary>
+			Counter = 0x02
+		};
+
+		/// <summary>
+		/// Stores a recorded event.
+		/// </summary>
+		struct Event {
+			/// <summary>
+			/// The name of the zone or counter.
+			/// </summary>
+			const char* Name;
+
+			/// <summary>
+			/// The time stamp (in nanoseconds since the instrumentation instance has been created), at which the zone has begun or the counter has been recorded.
+			/// </summary>
+			std::uint64_t Timestamp;
+
+			/// <summary>
+			/// The duration of the zone in nanoseconds, or the value of the counter.
+			/// </summary>
+			std::int64_t Value;
+
+			/// <summary>
+			/// The index of the thread that recorded the event.
+			/// </summary>
+			std::uint32_t Thread;
+
+			/// <summary>
+			/// The type of the event.
+			/// </summary>
+			EventType Type;
+		};
+
+		/// <summary>
+		/// A callback that writes additional Chrome trace events during <see cref="exportChromeTrace" />. Each event must be prefixed by a comma.
+		/// </summary>
+		using trace_writer_type = std::function<void(std::ostream&)>;
+
+	private:
+		std::atomic_bool m_capturing{ false };
+		std::chrono::steady_clock::time_point m_origin{ std::chrono::steady_clock::now() };
+
+	public:
+		/// <summary>
+		/// Initializes a new instrumentation instance.
+		/// </summary>
+		/// <param name="bufferSize">The number of events that can be stored in the ring buffer of each thread. Rounded up to the next power of two.</param>
+		/// <exception cref="InvalidArgumentException">Thrown, if <paramref name="bufferSize" /> is `0`.</exception>
+		explicit Instrumentation(std::uint32_t bufferSize = DEFAULT_BUFFER_SIZE);
+		Instrumentation(const Instrumentation&) = delete;
+		Instrumentation(Instrumentation&&) noexcept = delete;
+		Instrumentation& operator=(const Instrumentation&) = delete;
+		Instrumentation& operator=(Instrumentation&&) noexcept = delete;
+		~Instrumentation() noexcept;
+
+	public:
+		/// <summary>
+		/// Returns `true`, if events are currently recorded.
+		/// </summary>
+		/// <returns>`true`, if events are currently recorded, `false` otherwise.</returns>
+		inline bool capturing() const noexcept {
+			return m_capturing.load(std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Starts recording events.
+		/// </summary>
+		void start() noexcept;
+
+		/// <summary>
+		/// Stops recording events. Events that have already been recorded are kept until they are cleared.
+		/// </summary>
+		void stop() noexcept;
+
+		/// <summary>
+		/// Returns the current time stamp in nanoseconds since the instrumentation instance has been created.
+		/// </summary>
+		/// <returns>The current time stamp.</returns>
+		inline std::uint64_t now() const noexcept {
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin).count());
+		}
+
+		/// <summary>
+		/// Records a zone on the calling thread.
+		/// </summary>
+		/// <param name="name">The name of the zone.</param>
+		/// <param name="begin">The time stamp at which the zone has begun.</param>
+		/// <param name="end">The time stamp at which the zone has ended.</param>
+		/// <seealso cref="InstrumentationZone" />
+		void zone(const char* name, std::uint64_t begin, std::uint64_t end) noexcept;
+
+		/// <summary>
+		/// Records the value of a counter on the calling thread, if events are currently recorded.
+		/// </summary>
+		/// <param name="name">The name of the counter.</param>
+		/// <param name="value">The current value of the counter.</param>
+		void counter(const char* name, std::int64_t value) noexcept;
+
+		/// <summary>
+		/// Drains the ring buffers of all threads into the list of collected events.
+		/// </summary>
+		/// <remarks>
+		/// This method can be called from any thread, while other threads are still recording.
+		/// </remarks>
+		void collect();
+
+		/// <summary>
+		/// Collects all pending events and returns all events that have been collected so far, ordered by their time stamp.
+		/// </summary>
+		/// <returns>The collected events.</returns>
+		Array<Event> events();
+
+		/// <summary>
+		/// Returns the number of events that have been dropped, because a ring buffer was full.
+		/// </summary>
+		/// <returns>The number of dropped events.</returns>
+		std::uint64_t dropped() const noexcept;
+
+		/// <summary>
+		/// Discards all collected and pending events.
+		/// </summary>
+		void clear();
+
+		/// <summary>
+		/// Collects all pending events and writes them as Chrome trace events, that can be loaded in `chrome://tracing` or Perfetto.
+		/// </summary>
+		/// <remarks>
+		/// CPU events are written as threads of a process named "CPU". Additional events, such as GPU timings, can be merged into the same trace by providing
+		/// <paramref name="writers" />.
+		/// </remarks>
+		/// <param name="stream">The stream to write the trace to.</param>
+		/// <param name="writers">Callbacks that write additional events into the trace.</param>
+		void exportChromeTrace(std::ostream& stream, Span<const trace_writer_type> writers = {});
+
+		/// <summary>
+		/// Writes <paramref name="text" /> as a quoted JSON string, escaping all characters that are not allowed within JSON strings.
+		/// </summary>
+		/// <remarks>
+		/// Trace writers passed to <see cref="exportChromeTrace" /> can use this method to write names that are not known to be valid JSON.
+		/// </remarks>
+		/// <param name="stream">The stream to write the string to.</param>
+		/// <param name="text">The text to write.</param>
+		static void writeJsonString(std::ostream& stream, StringView text);
+	};
+
+	/// <summary>
+	/// Records a zone from its construction until it is destroyed, if the instrumentation is capturing when the zone is created.
+	/// </summary>
+	/// <remarks>
+	/// Use the <see cref="LITEFX_PROFILE_ZONE" /> macro instead of creating zones manually, so that they can be removed at compile time.
+	/// </remarks>
+	/// <seealso cref="Instrumentation" />
+	class InstrumentationZone final {
+	private:
+		Instrumentation* m_instrumentation;
+		const char* m_name;
+		std::uint64_t m_begin{ 0 };
+
+	public:
+		/// <summary>
+		/// Begins a new zone.
+		/// </summary>
+		/// <param name="instrumentation">The instrumentation to record the zone with.</param>
+		/// <param name="name">The name of the zone.</param>
+		inline InstrumentationZone(Instrumentation& instrumentation, const char* name) noexcept :
+			m_instrumentation(instrumentation.capturing() ? &instrumentation : nullptr), m_name(name)
+		{
+			if (m_instrumentation != nullptr) [[unlikely]]
+				m_begin = m_instrumentation->now();
+		}
+
+		InstrumentationZone(const InstrumentationZone&) = delete;
+		InstrumentationZone(InstrumentationZone&&) noexcept = delete;
+		InstrumentationZone& operator=(const InstrumentationZone&) = delete;
+		InstrumentationZone& operator=(InstrumentationZone&&) noexcept = delete;
+
+		/// <summary>
+		/// Ends the zone and records it.
+		/// </summary>
+		inline ~InstrumentationZone() noexcept {
+			if (m_instrumentation != nullptr) [[unlikely]]
+				m_instrumentation->zone(m_name, m_begin, m_instrumentation->now());
+		}
+	};
+
+}
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+#ifdef LITEFX_BUILD_INSTRUMENTATION
+#  define LITEFX_PROFILE_CONCAT_IMPL(a, b) a##b
+#  define LITEFX_PROFILE_CONCAT(a, b) LITEFX_PROFILE_CONCAT_IMPL(a, b)
+#  define LITEFX_PROFILE_ZONE(instrumentation, name) const ::LiteFX::InstrumentationZone LITEFX_PROFILE_CONCAT(_litefxZone, __LINE__)(instrumentation, name)
+#  define LITEFX_PROFILE_COUNTER(instrumentation, name, value) (instrumentation).counter(name, static_cast<std::int64_t>(value))
+#else
+#  define LITEFX_PROFILE_ZONE(instrumentation, name)
+#  define LITEFX_PROFILE_COUNTER(instrumentation, name, value)
+#endif // LITEFX_BUILD_INSTRUMENTATION
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
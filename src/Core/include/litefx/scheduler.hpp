@@ -0,0 +1,167 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <exception>
+
+#include "containers.hpp"
+
+namespace LiteFX {
+
+	class TaskScheduler;
+
+	/// <summary>
+	/// Tracks the completion of a group of tasks that have been scheduled on a <see cref="TaskScheduler" />.
+	/// </summary>
+	/// <remarks>
+	/// A counter is incremented each time a task is scheduled for it and decremented as soon as the task has been executed. A counter is considered done, if it
+	/// does not track any pending tasks. Counters can be passed as dependencies to other tasks, in which case the dependent tasks are only executed after the
+	/// counter completed. If any of the tasks tracked by a counter throws an exception, the first exception is stored and re-thrown when waiting on the counter
+	/// using <see cref="TaskScheduler::wait" />.
+	/// </remarks>
+	/// <seealso cref="TaskScheduler" />
+	class TaskCounter final {
+		friend class TaskScheduler;
+
+	private:
+		std::atomic_size_t m_pending{ 0 };
+		mutable std::mutex m_mutex{};
+		Array<std::function<void()>> m_continuations{};
+		std::exception_ptr m_exception{};
+
+	public:
+		/// <summary>
+		/// Initializes a new task counter.
+		/// </summary>
+		TaskCounter() noexcept = default;
+		TaskCounter(const TaskCounter&) = delete;
+		TaskCounter(TaskCounter&&) noexcept = delete;
+		TaskCounter& operator=(const TaskCounter&) = delete;
+		TaskCounter& operator=(TaskCounter&&) noexcept = delete;
+		~TaskCounter() noexcept = default;
+
+	public:
+		/// <summary>
+		/// Returns the number of tasks tracked by the counter that have not yet been executed.
+		/// </summary>
+		/// <returns>The number of pending tasks.</returns>
+		inline std::size_t pending() const noexcept {
+			return m_pending.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Returns `true`, if all tasks tracked by the counter have been executed.
+		/// </summary>
+		/// <returns>`true`, if all tasks tracked by the counter have been executed, `false` otherwise.</returns>
+		inline bool done() const noexcept {
+			return this->pending() == 0;
+		}
+	};
+
+	/// <summary>
+	/// A work-stealing scheduler that executes tasks on a fixed pool of worker threads.
+	/// </summary>
+	/// <remarks>
+	/// Each worker thread owns a local task queue. Tasks scheduled from a worker are pushed to the back of its local queue and are executed in LIFO order by the
+	/// worker, which improves cache locality for nested work. Idle workers steal tasks from the front of the queues of other workers. Tasks scheduled from
+	/// threads outside of the pool are placed into a shared queue, that all workers pull from.
+	///
+	/// Waiting on a <see cref="TaskCounter" /> using <see cref="wait" /> does not block the calling thread. Instead, the waiting thread helps executing pending
+	/// tasks until the counter completes. This makes it safe to wait from within a task, without starving the pool.
+	///
+	/// Note that the scheduler does not store any static or thread-local state. This allows to share one instance between modules, which is why the application
+	/// owns the scheduler instance (see <see cref="App::scheduler" />).
+	/// </remarks>
+	/// <seealso cref="TaskCounter" />
+	class TaskScheduler final {
+		LITEFX_IMPLEMENTATION(TaskSchedulerImpl);
+
+	public:
+		/// <summary>
+		/// Initializes a new task scheduler.
+		/// </summary>
+		/// <param name="workers">The number of worker threads. If set to `0`, the number of worker threads is derived from the hardware concurrency.</param>
+		explicit TaskScheduler(std::uint32_t workers = 0);
+		TaskScheduler(const TaskScheduler&) = delete;
+		TaskScheduler(TaskScheduler&&) noexcept = delete;
+		TaskScheduler& operator=(const TaskScheduler&) = delete;
+		TaskScheduler& operator=(TaskScheduler&&) noexcept = delete;
+
+		/// <summary>
+		/// Waits for all worker threads to finish the remaining tasks and releases the scheduler.
+		/// </summary>
+		~TaskScheduler() noexcept;
+
+	public:
+		/// <summary>
+		/// Returns the number of worker threads of the scheduler.
+		/// </summary>
+		/// <returns>The number of worker threads of the scheduler.</returns>
+		std::uint32_t workers() const noexcept;
+
+		/// <summary>
+		/// Returns the index of the worker thread that calls this method, or `std::nullopt`, if the calling thread does not belong to the scheduler.
+		/// </summary>
+		/// <returns>The index of the calling worker thread, or `std::nullopt`, if the calling thread does not belong to the scheduler.</returns>
+		Optional<std::uint32_t> workerIndex() const noexcept;
+
+		/// <summary>
+		/// Schedules a task and tracks its completion in <paramref name="counter" />.
+		/// </summary>
+		/// <remarks>
+		/// The task is only executed after all counters in <paramref name="dependencies" /> are done. The <paramref name="counter" /> is incremented immediately, so
+		/// waiting on it also waits for tasks that are still blocked by their dependencies.
+		/// </remarks>
+		/// <param name="counter">The counter that tracks the completion of the task.</param>
+		/// <param name="task">The task to execute.</param>
+		/// <param name="dependencies">The counters that need to be done before the task is executed.</param>
+		/// <exception cref="InvalidArgumentException">Thrown, if <paramref name="counter" /> or any of the <paramref name="dependencies" /> is not initialized.</exception>
+		void schedule(const SharedPtr<TaskCounter>& counter, std::function<void()> task, Span<const SharedPtr<TaskCounter>> dependencies = {});
+
+		/// <summary>
+		/// Schedules a task and returns a new counter that tracks its completion.
+		/// </summary>
+		/// <param name="task">The task to execute.</param>
+		/// <param name="dependencies">The counters that need to be done before the task is executed.</param>
+		/// <returns>A counter that tracks the completion of the task.</returns>
+		/// <exception cref="InvalidArgumentException">Thrown, if any of the <paramref name="dependencies" /> is not initialized.</exception>
+		inline SharedPtr<TaskCounter> schedule(std::function<void()> task, Span<const SharedPtr<TaskCounter>> dependencies = {}) {
+			auto counter = makeShared<TaskCounter>();
+			this->schedule(counter, std::move(task), dependencies);
+			return counter;
+		}
+
+		/// <summary>
+		/// Waits for all tasks tracked by <paramref name="counter" /> to complete and helps executing pending tasks in the meantime.
+		/// </summary>
+		/// <param name="counter">The counter to wait for.</param>
+		/// <exception cref="Exception">Re-throws the first exception that has been thrown by a task tracked by <paramref name="counter" />.</exception>
+		void wait(const TaskCounter& counter);
+
+		/// <summary>
+		/// Splits the range `[0, count)` into chunks and schedules one task per chunk that invokes <paramref name="callback" /> for each index in the chunk.
+		/// </summary>
+		/// <typeparam name="TCallback">The type of the callback.</typeparam>
+		/// <param name="count">The number of indices to process.</param>
+		/// <param name="callback">The callback invoked for each index.</param>
+		/// <param name="chunkSize">The number of indices processed by a single task. If set to `0`, the range is split evenly between the worker threads.</param>
+		/// <returns>A counter that tracks the completion of all chunks.</returns>
+		template <typename TCallback> requires
+			std::invocable<TCallback, std::size_t>
+		inline SharedPtr<TaskCounter> parallelFor(std::size_t count, TCallback callback, std::size_t chunkSize = 0) {
+			auto counter = makeShared<TaskCounter>();
+
+			if (chunkSize == 0)
+				chunkSize = std::max<std::size_t>(1, (count + this->workers()) / (static_cast<std::size_t>(this->workers()) + 1));
+
+			for (std::size_t begin = 0; begin < count; begin += chunkSize)
+				this->schedule(counter, [callback, begin, end = std::min(begin + chunkSize, count)]() {
+					for (auto i = begin; i < end; ++i)
+						callback(i);
+				});
+
+			return counter;
+		}
+	};
+
+}
@@ -0,0 +1,257 @@
+#include <litefx/instrumentation.hpp>
+#include <bit>
+#include <format>
+
+using namespace LiteFX;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class Instrumentation::InstrumentationImpl {
+public:
+	friend class Instrumentation;
+
+private:
+	/// <summary>
+	/// A single-producer/single-consumer ring buffer that is written by exactly one thread and drained while holding the collection lock.
+	/// </summary>
+	struct ThreadBuffer {
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		std::thread::id threadId;
+		std::uint32_t index;
+		Array<Event> events;
+		alignas(CACHE_LINE_SIZE) std::atomic_uint64_t head{ 0 };
+		alignas(CACHE_LINE_SIZE) std::atomic_uint64_t tail{ 0 };
+
+		ThreadBuffer(std::thread::id threadId, std::uint32_t index, std::uint32_t size) :
+			threadId(threadId), index(index), events(size) { }
+
+		bool push(const Event& event) noexcept
+		{
+			auto position = head.load(std::memory_order_relaxed);
+
+			if (position - tail.load(std::memory_order_acquire) >= events.size()) [[unlikely]]
+				return false;
+
+			events[position & (events.size() - 1)] = event;
+			head.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		void drain(Array<Event>& target)
+		{
+			auto position = tail.load(std::memory_order_relaxed);
+			auto end = head.load(std::memory_order_acquire);
+
+			for (; position != end; ++position)
+				target.push_back(events[position & (events.size() - 1)]);
+
+			tail.store(position, std::memory_order_release);
+		}
+	};
+
+	/// <summary>
+	/// Caches the ring buffer of the calling thread. The generation prevents re-using a buffer of a destroyed instance that has been allocated at the same address.
+	/// </summary>
+	struct ThreadCache {
+		const InstrumentationImpl* owner{ nullptr };
+		std::uint64_t generation{ 0 };
+		ThreadBuffer* buffer{ nullptr };
+	};
+
+	static thread_local ThreadCache t_cache;
+
+private:
+	std::uint32_t m_bufferSize;
+	std::uint64_t m_generation;
+	mutable std::mutex m_mutex{};
+	Array<UniquePtr<ThreadBuffer>> m_buffers{};
+	Array<Event> m_events{};
+	std::atomic_uint64_t m_dropped{ 0 };
+
+public:
+	InstrumentationImpl(std::uint32_t bufferSize) :
+		m_bufferSize(std::bit_ceil(bufferSize)), m_generation(nextGeneration())
+	{
+	}
+
+	InstrumentationImpl(const InstrumentationImpl&) = delete;
+	InstrumentationImpl(InstrumentationImpl&&) noexcept = delete;
+	InstrumentationImpl& operator=(const InstrumentationImpl&) = delete;
+	InstrumentationImpl& operator=(InstrumentationImpl&&) noexcept = delete;
+	~InstrumentationImpl() noexcept = default;
+
+private:
+	static std::uint64_t nextGeneration() noexcept
+	{
+		static std::atomic_uint64_t generation{ 0 };
+		return ++generation;
+	}
+
+public:
+	ThreadBuffer* threadBuffer() noexcept
+	{
+		if (t_cache.owner == this && t_cache.generation == m_generation) [[likely]]
+			return t_cache.buffer;
+
+		// Look up the buffer of the thread, which may already have been created by another module.
+		auto id = std::this_thread::get_id();
+
+		try
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto match = std::ranges::find_if(m_buffers, [&id](const auto& buffer) { return buffer->threadId == id; });
+			auto buffer = match != m_buffers.end() ? match->get() :
+				m_buffers.emplace_back(makeUnique<ThreadBuffer>(id, static_cast<std::uint32_t>(m_buffers.size()), m_bufferSize)).get();
+
+			t_cache = { this, m_generation, buffer };
+			return buffer;
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	void record(const char* name, std::uint64_t timestamp, std::int64_t value, EventType type) noexcept
+	{
+		auto buffer = this->threadBuffer();
+
+		if (buffer == nullptr || !buffer->push({ .Name = name, .Timestamp = timestamp, .Value = value, .Thread = buffer->index, .Type = type })) [[unlikely]]
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void collect()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		for (auto& buffer : m_buffers)
+			buffer->drain(m_events);
+	}
+};
+
+thread_local Instrumentation::InstrumentationImpl::ThreadCache Instrumentation::InstrumentationImpl::t_cache{};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+Instrumentation::Instrumentation(std::uint32_t bufferSize) :
+	m_impl(bufferSize)
+{
+	if (bufferSize == 0) [[unlikely]]
+		throw InvalidArgumentException("bufferSize", "The ring buffer size must be greater than zero.");
+}
+
+Instrumentation::~Instrumentation() noexcept = default;
+
+void Instrumentation::start() noexcept
+{
+	m_capturing.store(true, std::memory_order_relaxed);
+}
+
+void Instrumentation::stop() noexcept
+{
+	m_capturing.store(false, std::memory_order_relaxed);
+}
+
+void Instrumentation::zone(const char* name, std::uint64_t begin, std::uint64_t end) noexcept
+{
+	m_impl->record(name, begin, static_cast<std::int64_t>(end - begin), EventType::Zone);
+}
+
+void Instrumentation::counter(const char* name, std::int64_t value) noexcept
+{
+	if (this->capturing())
+		m_impl->record(name, this->now(), value, EventType::Counter);
+}
+
+void Instrumentation::collect()
+{
+	m_impl->collect();
+}
+
+Array<Instrumentation::Event> Instrumentation::events()
+{
+	m_impl->collect();
+
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+	auto events = m_impl->m_events;
+	std::ranges::stable_sort(events, {}, &Event::Timestamp);
+	return events;
+}
+
+std::uint64_t Instrumentation::dropped() const noexcept
+{
+	return m_impl->m_dropped.load(std::memory_order_relaxed);
+}
+
+void Instrumentation::clear()
+{
+	m_impl->collect();
+
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+	m_impl->m_events.clear();
+	m_impl->m_dropped.store(0, std::memory_order_relaxed);
+}
+
+void Instrumentation::exportChromeTrace(std::ostream& stream, Span<const trace_writer_type> writers)
+{
+	constexpr double NANOSECONDS_PER_MICROSECOND = 1000.0;
+	constexpr std::uint32_t CPU_PROCESS_ID = 0;
+	auto events = this->events();
+
+	stream << "{\"traceEvents\":[";
+	stream << std::format("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{0},\"args\":{{\"name\":\"CPU\"}}}}", CPU_PROCESS_ID);
+
+	{
+		std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+
+		for (const auto& buffer : m_impl->m_buffers)
+			stream << std::format(",{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{0},\"tid\":{1},\"args\":{{\"name\":\"Thread {1}\"}}}}", CPU_PROCESS_ID, buffer->index);
+	}
+
+	for (const auto& event : events)
+	{
+		stream << ",{\"name\":";
+		Instrumentation::writeJsonString(stream, event.Name);
+
+		if (event.Type == EventType::Zone)
+			stream << std::format(",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":{0},\"tid\":{1},\"ts\":{2:.3f},\"dur\":{3:.3f}}}",
+				CPU_PROCESS_ID, event.Thread, static_cast<double>(event.Timestamp) / NANOSECONDS_PER_MICROSECOND, static_cast<double>(event.Value) / NANOSECONDS_PER_MICROSECOND);
+		else
+			stream << std::format(",\"cat\":\"cpu\",\"ph\":\"C\",\"pid\":{0},\"tid\":{1},\"ts\":{2:.3f},\"args\":{{\"value\":{3}}}}}",
+				CPU_PROCESS_ID, event.Thread, static_cast<double>(event.Timestamp) / NANOSECONDS_PER_MICROSECOND, event.Value);
+	}
+
+	for (const auto& writer : writers)
+		writer(stream);
+
+	stream << "],\"displayTimeUnit\":\"ms\"}";
+}
+
+void Instrumentation::writeJsonString(std::ostream& stream, StringView text)
+{
+	stream << '"';
+
+	for (auto c : text)
+	{
+		switch (c)
+		{
+		case '"': stream << "\\\""; break;
+		case '\\': stream << "\\\\"; break;
+		case '\n': stream << "\\n"; break;
+		case '\r': stream << "\\r"; break;
+		case '\t': stream << "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20)
+				stream << std::format("\\u{0:04x}", static_cast<unsigned>(c));
+			else
+				stream << c;
+		}
+	}
+
+	stream << '"';
+}
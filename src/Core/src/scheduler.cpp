@@ -0,0 +1,315 @@
+#include <litefx/scheduler.hpp>
+#include <deque>
+#include <condition_variable>
+
+using namespace LiteFX;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class TaskScheduler::TaskSchedulerImpl {
+public:
+	friend class TaskScheduler;
+
+private:
+	struct Task {
+		std::function<void()> work;
+		SharedPtr<TaskCounter> counter;
+	};
+
+	struct WorkQueue {
+		std::mutex mutex{};
+		std::deque<Task> tasks{};
+	};
+
+	struct PendingTask {
+		Task task;
+		std::atomic_size_t dependencies;
+
+		PendingTask(Task&& task, std::size_t dependencies) noexcept :
+			task(std::move(task)), dependencies(dependencies) { }
+	};
+
+private:
+	Array<std::jthread> m_threads{};
+	Array<std::thread::id> m_threadIds{};
+	Array<UniquePtr<WorkQueue>> m_queues{};
+	WorkQueue m_sharedQueue{};
+	std::atomic_size_t m_queuedTasks{ 0 };
+	std::mutex m_signalMutex{};
+	std::condition_variable m_signal{};
+	std::atomic_bool m_stop{ false };
+
+public:
+	TaskSchedulerImpl() = default;
+	TaskSchedulerImpl(const TaskSchedulerImpl&) = delete;
+	TaskSchedulerImpl(TaskSchedulerImpl&&) noexcept = delete;
+	TaskSchedulerImpl& operator=(const TaskSchedulerImpl&) = delete;
+	TaskSchedulerImpl& operator=(TaskSchedulerImpl&&) noexcept = delete;
+
+	~TaskSchedulerImpl() noexcept
+	{
+		this->shutdown();
+	}
+
+public:
+	void initialize(std::uint32_t workers)
+	{
+		if (workers == 0)
+			workers = std::max(2u, std::thread::hardware_concurrency()) - 1u;
+
+		m_queues.reserve(workers);
+		m_threadIds.resize(workers);
+
+		for (std::uint32_t i = 0; i < workers; ++i)
+			m_queues.push_back(makeUnique<WorkQueue>());
+
+		// NOTE: Workers only look up their thread ids when executing tasks, which can only be scheduled after the scheduler has been initialized.
+		for (std::uint32_t i = 0; i < workers; ++i)
+		{
+			m_threads.emplace_back([this, i]() { this->work(i); });
+			m_threadIds[i] = m_threads.back().get_id();
+		}
+	}
+
+	void shutdown() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_signalMutex);
+			m_stop = true;
+		}
+
+		m_signal.notify_all();
+		m_threads.clear();
+	}
+
+	Optional<std::uint32_t> workerIndex() const noexcept
+	{
+		auto id = std::this_thread::get_id();
+
+		if (auto match = std::ranges::find(m_threadIds, id); match != m_threadIds.end())
+			return static_cast<std::uint32_t>(std::distance(m_threadIds.begin(), match));
+
+		return std::nullopt;
+	}
+
+	void enqueue(Task&& task)
+	{
+		auto worker = this->workerIndex();
+		auto& queue = worker.has_value() ? *m_queues[worker.value()] : m_sharedQueue;
+
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+
+		// Acquire the signal lock before notifying, so that threads that are just about to go to sleep do not miss the signal.
+		{
+			std::lock_guard<std::mutex> lock(m_signalMutex);
+			m_queuedTasks.fetch_add(1, std::memory_order_release);
+		}
+
+		m_signal.notify_one();
+	}
+
+	Optional<Task> dequeue(Optional<std::uint32_t> worker)
+	{
+		if (m_queuedTasks.load(std::memory_order_acquire) == 0)
+			return std::nullopt;
+
+		auto take = [this](WorkQueue& queue, bool back) -> Optional<Task> {
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (queue.tasks.empty())
+				return std::nullopt;
+
+			Task task;
+
+			if (back)
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+			}
+
+			m_queuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+			return task;
+		};
+
+		// Prefer the most recent task from the local queue.
+		if (worker.has_value())
+			if (auto task = take(*m_queues[worker.value()], true); task.has_value())
+				return task;
+
+		// Continue with tasks scheduled from outside of the pool.
+		if (auto task = take(m_sharedQueue, false); task.has_value())
+			return task;
+
+		// Steal the oldest task from another worker.
+		const auto workers = m_queues.size();
+		const auto first = worker.has_value() ? worker.value() + 1 : 0;
+
+		for (std::size_t i = 0; i < workers; ++i)
+			if (auto task = take(*m_queues[(first + i) % workers], false); task.has_value())
+				return task;
+
+		return std::nullopt;
+	}
+
+	void execute(Task& task)
+	{
+		try
+		{
+			task.work();
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(task.counter->m_mutex);
+
+			if (!task.counter->m_exception)
+				task.counter->m_exception = std::current_exception();
+		}
+
+		this->complete(*task.counter);
+	}
+
+	void complete(TaskCounter& counter)
+	{
+		Array<std::function<void()>> continuations;
+		bool done = false;
+
+		{
+			std::lock_guard<std::mutex> lock(counter.m_mutex);
+
+			if (done = counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1; done)
+				continuations.swap(counter.m_continuations);
+		}
+
+		if (!done)
+			return;
+
+		for (auto& continuation : continuations)
+			continuation();
+
+		// Wake up all threads that may wait for the counter.
+		{
+			std::lock_guard<std::mutex> lock(m_signalMutex);
+		}
+
+		m_signal.notify_all();
+	}
+
+	void continueWith(TaskCounter& counter, std::function<void()> continuation)
+	{
+		{
+			std::lock_guard<std::mutex> lock(counter.m_mutex);
+
+			if (counter.m_pending.load(std::memory_order_acquire) > 0)
+			{
+				counter.m_continuations.push_back(std::move(continuation));
+				return;
+			}
+		}
+
+		// The counter is already done, so the continuation can run immediately.
+		continuation();
+	}
+
+	void work(std::uint32_t worker)
+	{
+		while (true)
+		{
+			if (auto task = this->dequeue(worker); task.has_value())
+			{
+				this->execute(task.value());
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_signalMutex);
+
+			if (m_stop && m_queuedTasks.load(std::memory_order_acquire) == 0)
+				break;
+
+			m_signal.wait(lock, [this]() { return m_stop || m_queuedTasks.load(std::memory_order_acquire) > 0; });
+		}
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+TaskScheduler::TaskScheduler(std::uint32_t workers) :
+	m_impl()
+{
+	m_impl->initialize(workers);
+}
+
+TaskScheduler::~TaskScheduler() noexcept = default;
+
+std::uint32_t TaskScheduler::workers() const noexcept
+{
+	return static_cast<std::uint32_t>(m_impl->m_queues.size());
+}
+
+Optional<std::uint32_t> TaskScheduler::workerIndex() const noexcept
+{
+	return m_impl->workerIndex();
+}
+
+void TaskScheduler::schedule(const SharedPtr<TaskCounter>& counter, std::function<void()> task, Span<const SharedPtr<TaskCounter>> dependencies)
+{
+	if (counter == nullptr) [[unlikely]]
+		throw InvalidArgumentException("counter", "The task counter must be initialized.");
+
+	if (std::ranges::any_of(dependencies, [](const auto& dependency) { return dependency == nullptr; })) [[unlikely]]
+		throw InvalidArgumentException("dependencies", "All task dependencies must be initialized.");
+
+	counter->m_pending.fetch_add(1, std::memory_order_acq_rel);
+
+	if (dependencies.empty())
+	{
+		m_impl->enqueue({ std::move(task), counter });
+		return;
+	}
+
+	// Hold back the task until all dependencies are done. The additional dependency is released after all continuations have been registered, which prevents
+	// the task from being scheduled while we are still iterating the dependencies.
+	auto pendingTask = makeShared<TaskSchedulerImpl::PendingTask>(TaskSchedulerImpl::Task{ std::move(task), counter }, dependencies.size() + 1);
+	auto release = [impl = &(*m_impl), pendingTask]() {
+		if (pendingTask->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			impl->enqueue(std::move(pendingTask->task));
+	};
+
+	for (auto& dependency : dependencies)
+		m_impl->continueWith(*dependency, release);
+
+	release();
+}
+
+void TaskScheduler::wait(const TaskCounter& counter)
+{
+	auto worker = m_impl->workerIndex();
+
+	while (!counter.done())
+	{
+		if (auto task = m_impl->dequeue(worker); task.has_value())
+		{
+			m_impl->execute(task.value());
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_impl->m_signalMutex);
+		m_impl->m_signal.wait(lock, [&]() { return counter.done() || m_impl->m_queuedTasks.load(std::memory_order_acquire) > 0; });
+	}
+
+	std::lock_guard<std::mutex> lock(counter.m_mutex);
+
+	if (counter.m_exception)
+		std::rethrow_exception(counter.m_exception);
+}
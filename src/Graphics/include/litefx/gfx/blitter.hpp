@@ -14,6 +14,31 @@
 namespace LiteFX::Graphics {
     using namespace LiteFX;
 
+    /// <summary>
+    /// Describes how the texels of a mip map level are computed from the texels of the level above.
+    /// </summary>
+    /// <remarks>
+    /// Each texel of a level is computed from a 2x2 block of texels of the level above. For levels with an odd size, the last row or column of the level above does not
+    /// contribute to the next level. Depth pyramids that are used for conservative occlusion culling should therefore have power-of-two sizes.
+    /// </remarks>
+    /// <seealso cref="Blitter::generateMipMaps" />
+    enum class MipMapReduction {
+        /// <summary>
+        /// Averages the texels, which is the common way to generate mip maps for textures.
+        /// </summary>
+        Average = 0x00000000,
+
+        /// <summary>
+        /// Keeps the minimum of the texels, for example to build a depth pyramid for reversed depth buffers.
+        /// </summary>
+        Minimum = 0x00000001,
+
+        /// <summary>
+        /// Keeps the maximum of the texels, for example to build a hierarchical depth buffer (Hi-Z) for occlusion culling.
+        /// </summary>
+        Maximum = 0x00000002
+    };
+
     //class IBlitter {
     //    virtual blit(IImage, ICommandBuffer)
     //    virtual generateMipMaps(IImage, ICommandBuffer)
@@ -25,6 +50,9 @@ namespace LiteFX::Graphics {
     /// <remarks>
     /// This utility class can be used to generate mip maps for images. Note however, that it is more efficient to pre-compute mip maps if possible. Also note that if 
     /// you need a direct copy of a image, use a <see cref="ICommandBuffer::transfer" /> command instead.
+    /// 
+    /// Mip maps are generated by a compute shader, that produces up to 12 levels of each array layer within a single dispatch. Each work group reduces a tile of the 
+    /// base level in group shared memory and the last work group to finish produces the remaining levels.
     /// </remarks>
     /// <typeparam name="TBackend">The type of render backend that implements the blitter.</typeparam>
     template <render_backend TBackend>
@@ -67,7 +95,23 @@ namespace LiteFX::Graphics {
 
     public:
         //void blit(TBackend::image_type& image, TBackend::command_buffer_type& commandBuffer
-        void generateMipMaps(TBackend::image_type& image, TBackend::command_buffer_type& commandBuffer) /*override*/;
+
+        /// <summary>
+        /// Records commands to generate all mip map levels of <paramref name="image" /> from its first level.
+        /// </summary>
+        /// <remarks>
+        /// The image must be a 2D image (or an array of 2D images) that has been created with <see cref="ResourceUsage::AllowWrite" />, so that its levels can be written
+        /// by the compute shader, and the command buffer must be recorded on a queue that supports compute workloads. sRGB images are filtered in linear space. After the 
+        /// commands have been executed, all levels are in the <see cref="ImageLayout::ShaderResource" /> layout.
+        /// 
+        /// The Vulkan backend falls back to blitting each level if the image does not allow write access, which only supports the average reduction and requires a graphics 
+        /// queue.
+        /// </remarks>
+        /// <param name="image">The image to generate the mip map levels for.</param>
+        /// <param name="commandBuffer">The command buffer to record the commands into.</param>
+        /// <param name="reduction">The reduction mode used to compute the texels of each level.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the image does not support compute generation and the blit fallback is not available for the backend or reduction mode.</exception>
+        void generateMipMaps(TBackend::image_type& image, TBackend::command_buffer_type& commandBuffer, MipMapReduction reduction = MipMapReduction::Average) /*override*/;
     };
 
 #ifdef LITEFX_LINK_SHARED
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <litefx/graphics_api.hpp>
+#include <litefx/gfx/vertex.hpp>
+
+namespace LiteFX::Graphics {
+    using namespace LiteFX;
+    using namespace LiteFX::Math;
+    using namespace LiteFX::Rendering;
+
+    /// <summary>
+    /// Describes a meshlet, i.e., a small cluster of triangles that is processed by a single mesh shader work group.
+    /// </summary>
+    /// <remarks>
+    /// The layout of this structure matches a structured buffer element in a shader, so an array of meshlets can be uploaded directly.
+    /// </remarks>
+    /// <seealso cref="MeshletMesh" />
+    struct LITEFX_GRAPHICS_API alignas(16) Meshlet { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        /// <summary>
+        /// The index of the first element in <see cref="MeshletMesh::VertexIndices" /> that belongs to the meshlet.
+        /// </summary>
+        UInt32 VertexOffset{ };
+
+        /// <summary>
+        /// The number of vertices of the meshlet.
+        /// </summary>
+        UInt32 VertexCount{ };
+
+        /// <summary>
+        /// The index of the first element in <see cref="MeshletMesh::Primitives" /> that belongs to the meshlet.
+        /// </summary>
+        UInt32 PrimitiveOffset{ };
+
+        /// <summary>
+        /// The number of triangles of the meshlet.
+        /// </summary>
+        UInt32 PrimitiveCount{ };
+    };
+
+    /// <summary>
+    /// Stores the bounding sphere and normal cone of a meshlet, which can be used to cull meshlets in a task (or amplification) shader.
+    /// </summary>
+    /// <remarks>
+    /// A meshlet is outside of the view frustum, if its bounding sphere is. A meshlet is back-facing and can be culled, if
+    /// `dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff` holds. Meshlets whose triangles face too many different directions have a
+    /// <see cref="ConeCutoff" /> of `1`, so that they are never culled by this test.
+    ///
+    /// The structure is padded to 48 bytes, so that an array of bounds can be uploaded directly and read from a structured buffer with the following element type:
+    ///
+    /// <code>
+    /// struct MeshletBounds {
+    ///     float3 Center;
+    ///     float Radius;
+    ///     float3 ConeAxis;
+    ///     float ConeCutoff;
+    ///     float3 ConeApex;
+    ///     float Padding;
+    /// };
+    /// </code>
+    /// </remarks>
+    /// <seealso cref="MeshletMesh" />
+    struct LITEFX_GRAPHICS_API alignas(16) MeshletBounds { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        /// <summary>
+        /// The center of the bounding sphere.
+        /// </summary>
+        Vector3f Center{ };
+
+        /// <summary>
+        /// The radius of the bounding sphere.
+        /// </summary>
+        Float Radius{ };
+
+        /// <summary>
+        /// The axis of the normal cone.
+        /// </summary>
+        Vector3f ConeAxis{ };
+
+        /// <summary>
+        /// The sine of the half-angle of the normal cone.
+        /// </summary>
+        Float ConeCutoff{ 1.0f };
+
+        /// <summary>
+        /// The apex of the normal cone.
+        /// </summary>
+        Vector3f ConeApex{ };
+
+        /// <summary>
+        /// Unused padding, that aligns the structure to 16 bytes.
+        /// </summary>
+        Float Padding{ };
+    };
+
+    static_assert(sizeof(MeshletBounds) == 48, "The layout of the meshlet bounds must match the structured buffer element in shaders."); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+    /// <summary>
+    /// Stores the meshlets of a mesh, generated by a <see cref="MeshletBuilder" />.
+    /// </summary>
+    /// <remarks>
+    /// All arrays can be uploaded as structured buffers. The vertex indices refer to the vertex buffer of the original mesh, which is not modified and can still be packed
+    /// using a <see cref="VertexPacker" />. Each primitive stores the three meshlet-local vertex indices of a triangle in the lower three bytes.
+    ///
+    /// A mesh shader typically processes one meshlet per work group. Use <see cref="MeshletMesh::dispatchBatch" /> to obtain the number of work groups to pass to
+    /// <see cref="ICommandBuffer::dispatchMesh" /> or to write into an indirect buffer for <see cref="ICommandBuffer::dispatchMeshIndirect" />.
+    /// </remarks>
+    /// <seealso cref="MeshletBuilder" />
+    struct MeshletMesh {
+    public:
+        /// <summary>
+        /// The meshlets of the mesh.
+        /// </summary>
+        Array<Meshlet> Meshlets;
+
+        /// <summary>
+        /// The bounds of each meshlet in <see cref="Meshlets" />.
+        /// </summary>
+        Array<MeshletBounds> Bounds;
+
+        /// <summary>
+        /// The indices into the original vertex buffer, referenced by the meshlets.
+        /// </summary>
+        Array<UInt32> VertexIndices;
+
+        /// <summary>
+        /// The packed triangles of the meshlets.
+        /// </summary>
+        Array<UInt32> Primitives;
+
+    public:
+        /// <summary>
+        /// Returns the indirect dispatch batch that launches one work group for each <paramref name="meshletsPerGroup" /> meshlets.
+        /// </summary>
+        /// <param name="meshletsPerGroup">The number of meshlets processed by each work group, for example, by a task shader that culls meshlets.</param>
+        /// <returns>The indirect dispatch batch that processes all meshlets of the mesh.</returns>
+        inline IndirectDispatchBatch dispatchBatch(UInt32 meshletsPerGroup = 1) const noexcept {
+            meshletsPerGroup = std::max(meshletsPerGroup, 1u);
+            return { .X = (static_cast<UInt32>(Meshlets.size()) + meshletsPerGroup - 1) / meshletsPerGroup };
+        }
+    };
+
+    /// <summary>
+    /// Splits triangle meshes into meshlets that can be rendered by mesh shaders.
+    /// </summary>
+    /// <remarks>
+    /// The builder grows each meshlet greedily from the triangles that are adjacent to it, preferring triangles that add the fewest new vertices and are closest to the
+    /// meshlet's center. This keeps vertex re-use within a meshlet high and produces compact meshlets, which improves the efficiency of the bounds and normal cones used
+    /// for culling.
+    ///
+    /// The default limits (64 vertices and 124 triangles) are a good fit for most hardware. Both limits are at most 256, as the primitives store 8 bit local indices.
+    /// </remarks>
+    /// <seealso cref="MeshletMesh" />
+    class LITEFX_GRAPHICS_API MeshletBuilder final {
+        LITEFX_IMPLEMENTATION(MeshletBuilderImpl);
+
+    public:
+        /// <summary>
+        /// The maximum number of vertices or triangles of a meshlet.
+        /// </summary>
+        static constexpr UInt32 MAX_MESHLET_SIZE = 256u;
+
+        /// <summary>
+        /// Describes a mesh that is passed to the builder.
+        /// </summary>
+        struct Mesh {
+            /// <summary>
+            /// The vertices of the mesh.
+            /// </summary>
+            Span<const Vertex> Vertices;
+
+            /// <summary>
+            /// The triangle list indices of the mesh.
+            /// </summary>
+            Span<const UInt32> Indices;
+        };
+
+    public:
+        /// <summary>
+        /// Initializes a new meshlet builder.
+        /// </summary>
+        /// <param name="maxVertices">The maximum number of vertices of a meshlet.</param>
+        /// <param name="maxPrimitives">The maximum number of triangles of a meshlet.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="maxVertices" /> is not within `[3, 256]` or <paramref name="maxPrimitives" /> is not within `[1, 256]`.</exception>
+        explicit MeshletBuilder(UInt32 maxVertices = 64, UInt32 maxPrimitives = 124);
+
+        /// <inheritdoc />
+        MeshletBuilder(MeshletBuilder&&) noexcept;
+
+        /// <inheritdoc />
+        MeshletBuilder(const MeshletBuilder&) = delete;
+
+        /// <inheritdoc />
+        MeshletBuilder& operator=(MeshletBuilder&&) noexcept;
+
+        /// <inheritdoc />
+        MeshletBuilder& operator=(const MeshletBuilder&) = delete;
+
+        /// <inheritdoc />
+        ~MeshletBuilder() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the maximum number of vertices of a meshlet.
+        /// </summary>
+        /// <returns>The maximum number of vertices of a meshlet.</returns>
+        UInt32 maxVertices() const noexcept;
+
+        /// <summary>
+        /// Returns the maximum number of triangles of a meshlet.
+        /// </summary>
+        /// <returns>The maximum number of triangles of a meshlet.</returns>
+        UInt32 maxPrimitives() const noexcept;
+
+        /// <summary>
+        /// Splits a mesh into meshlets.
+        /// </summary>
+        /// <param name="vertices">The vertices of the mesh.</param>
+        /// <param name="indices">The triangle list indices of the mesh.</param>
+        /// <returns>The meshlets of the mesh.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of 3.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index refers to a vertex that does not exist.</exception>
+        MeshletMesh build(Span<const Vertex> vertices, Span<const UInt32> indices) const;
+
+        /// <summary>
+        /// Splits multiple meshes into meshlets in parallel.
+        /// </summary>
+        /// <param name="meshes">The meshes to split into meshlets.</param>
+        /// <param name="scheduler">The scheduler that is used to build the meshlets of each mesh on a separate task.</param>
+        /// <returns>The meshlets of each mesh, in the order of <paramref name="meshes" />.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices of a mesh is not a multiple of 3.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index of a mesh refers to a vertex that does not exist.</exception>
+        Array<MeshletMesh> build(Span<const Mesh> meshes, TaskScheduler& scheduler) const;
+    };
+
+}
@@ -2,10 +2,12 @@
 
 #include <litefx/graphics_api.hpp>
 #include <litefx/math.hpp>
+#include <litefx/rendering_api.hpp>
 
 namespace LiteFX::Graphics {
     using namespace LiteFX;
     using namespace LiteFX::Math;
+    using namespace LiteFX::Rendering;
 
     /// <summary>
     /// Default definition for a simple vertex.
@@ -33,4 +35,195 @@ namespace LiteFX::Graphics {
         Vector2f TextureCoordinate0;
     };
 
+    /// <summary>
+    /// Describes which vertex attributes and indices are compressed by a <see cref="VertexPacker" />.
+    /// </summary>
+    /// <seealso cref="VertexPacker" />
+    enum class VertexCompression : UInt32 {
+        /// <summary>
+        /// No attribute is compressed and all attributes are stored as 32 bit floats.
+        /// </summary>
+        None = 0x00000000,
+
+        /// <summary>
+        /// Positions are stored as half-precision floats (<see cref="BufferFormat::XYZW16F" />), where the fourth component is always `1.0`.
+        /// </summary>
+        /// <remarks>
+        /// Half-precision floats provide 11 bits of precision, so positions should be stored relative to the origin of the mesh.
+        /// </remarks>
+        Position = 0x00000001,
+
+        /// <summary>
+        /// Normals and tangents are encoded as octahedral vectors in 16 bit normalized integers (<see cref="BufferFormat::XY16SN" />).
+        /// </summary>
+        /// <remarks>
+        /// Tangents are stored as <see cref="BufferFormat::XYZW16SN" />, where the fourth component contains the sign of the bi-tangent.
+        /// </remarks>
+        Normal = 0x00000002,
+
+        /// <summary>
+        /// Texture coordinates are stored as 16 bit normalized integers (<see cref="BufferFormat::XY16UN" />).
+        /// </summary>
+        /// <remarks>
+        /// If any texture coordinate of a mesh is outside the range `[0, 1]`, texture coordinates are stored as half-precision floats (<see cref="BufferFormat::XY16F" />) instead.
+        /// </remarks>
+        TextureCoordinate = 0x00000004,
+
+        /// <summary>
+        /// Colors are stored as 8 bit normalized integers (<see cref="BufferFormat::XYZW8UN" />).
+        /// </summary>
+        Color = 0x00000008,
+
+        /// <summary>
+        /// Indices are stored as 16 bit integers, if the mesh contains few enough vertices.
+        /// </summary>
+        Index = 0x00000010,
+
+        /// <summary>
+        /// All attributes and indices are compressed.
+        /// </summary>
+        All = Position | Normal | TextureCoordinate | Color | Index
+    };
+
+    LITEFX_DEFINE_FLAGS(VertexCompression);
+
+    /// <summary>
+    /// Stores a mesh that has been packed by a <see cref="VertexPacker" />.
+    /// </summary>
+    /// <seealso cref="VertexPacker" />
+    struct PackedMesh {
+    public:
+        /// <summary>
+        /// The interleaved vertex data.
+        /// </summary>
+        Array<Byte> Vertices;
+
+        /// <summary>
+        /// The size of a single vertex in bytes.
+        /// </summary>
+        UInt32 VertexSize { 0u };
+
+        /// <summary>
+        /// The number of vertices in <see cref="Vertices" />.
+        /// </summary>
+        UInt32 VertexCount { 0u };
+
+        /// <summary>
+        /// The attributes that describe the layout of a vertex.
+        /// </summary>
+        Array<BufferAttribute> Attributes;
+
+        /// <summary>
+        /// The index data, which is empty, if no indices have been packed.
+        /// </summary>
+        Array<Byte> Indices;
+
+        /// <summary>
+        /// The type of the indices in <see cref="Indices" />.
+        /// </summary>
+        IndexType IndexFormat { IndexType::UInt32 };
+
+        /// <summary>
+        /// The number of indices in <see cref="Indices" />.
+        /// </summary>
+        UInt32 IndexCount { 0u };
+
+    public:
+        /// <summary>
+        /// Creates a vertex buffer layout that describes the packed vertices.
+        /// </summary>
+        /// <typeparam name="TVertexBufferLayout">The type of the vertex buffer layout, for example `VulkanVertexBufferLayout` or `DirectX12VertexBufferLayout`.</typeparam>
+        /// <param name="binding">The binding point of the vertex buffer.</param>
+        /// <returns>The vertex buffer layout that describes the packed vertices.</returns>
+        template <typename TVertexBufferLayout> requires
+            meta::implements<TVertexBufferLayout, IVertexBufferLayout>
+        inline auto vertexBufferLayout(UInt32 binding = 0) const {
+            return TVertexBufferLayout::create(VertexSize, Attributes, binding);
+        }
+
+        /// <summary>
+        /// Creates an index buffer layout that describes the packed indices.
+        /// </summary>
+        /// <typeparam name="TIndexBufferLayout">The type of the index buffer layout, for example `VulkanIndexBufferLayout` or `DirectX12IndexBufferLayout`.</typeparam>
+        /// <returns>The index buffer layout that describes the packed indices.</returns>
+        template <typename TIndexBufferLayout> requires
+            meta::implements<TIndexBufferLayout, IIndexBufferLayout>
+        inline auto indexBufferLayout() const {
+            return TIndexBufferLayout::create(IndexFormat);
+        }
+    };
+
+    /// <summary>
+    /// Converts meshes of <see cref="Vertex" /> elements into compressed, interleaved vertex data and generates the matching buffer attributes.
+    /// </summary>
+    /// <remarks>
+    /// The packer stores the attributes of a vertex in the order position, color, normal, texture coordinate and (optionally) tangent. The attributes are bound to consecutive
+    /// locations, starting at the location provided to the constructor, and each attribute is aligned to 4 bytes. With all compression enabled, a <see cref="Vertex" /> shrinks
+    /// from 48 to 20 bytes.
+    /// 
+    /// Attributes stored in normalized or half-precision formats are converted to floats by the input assembler, so shaders can read them without changes. Octahedral normals 
+    /// and tangents, however, must be decoded in the shader:
+    /// 
+    /// <code>
+    /// float3 decodeOctahedral(float2 e) {
+    ///     float3 v = float3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    ///     float t = saturate(-v.z);
+    ///     v.xy += select(v.xy >= 0.0, -t, t);
+    ///     return normalize(v);
+    /// }
+    /// </code>
+    /// </remarks>
+    /// <seealso cref="VertexCompression" />
+    /// <seealso cref="PackedMesh" />
+    class LITEFX_GRAPHICS_API VertexPacker final {
+        LITEFX_IMPLEMENTATION(VertexPackerImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new vertex packer.
+        /// </summary>
+        /// <param name="compression">The attributes and indices to compress.</param>
+        /// <param name="location">The location of the first vertex attribute.</param>
+        explicit VertexPacker(VertexCompression compression = VertexCompression::All, UInt32 location = 0);
+
+        /// <inheritdoc />
+        VertexPacker(VertexPacker&&) noexcept;
+
+        /// <inheritdoc />
+        VertexPacker(const VertexPacker&) = delete;
+
+        /// <inheritdoc />
+        VertexPacker& operator=(VertexPacker&&) noexcept;
+
+        /// <inheritdoc />
+        VertexPacker& operator=(const VertexPacker&) = delete;
+
+        /// <inheritdoc />
+        ~VertexPacker() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the attributes and indices that are compressed by the packer.
+        /// </summary>
+        /// <returns>The attributes and indices that are compressed by the packer.</returns>
+        VertexCompression compression() const noexcept;
+
+        /// <summary>
+        /// Returns the location of the first vertex attribute.
+        /// </summary>
+        /// <returns>The location of the first vertex attribute.</returns>
+        UInt32 location() const noexcept;
+
+        /// <summary>
+        /// Packs a mesh into compressed, interleaved vertex and index data.
+        /// </summary>
+        /// <param name="vertices">The vertices of the mesh.</param>
+        /// <param name="indices">The indices of the mesh. If empty, the packed mesh does not contain any indices.</param>
+        /// <param name="tangents">The tangents of the mesh, where the fourth component contains the sign of the bi-tangent. If empty, no tangent attribute is emitted.</param>
+        /// <returns>The packed mesh.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="tangents" /> is not empty and does not contain a tangent for each vertex, or if the mesh contains more vertices than can be indexed.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index refers to a vertex that does not exist.</exception>
+        PackedMesh pack(Span<const Vertex> vertices, Span<const UInt32> indices = {}, Span<const Vector4f> tangents = {}) const;
+    };
+
 }
\ No newline at end of file
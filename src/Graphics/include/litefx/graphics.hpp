@@ -2,4 +2,5 @@
 
 #include <litefx/graphics_api.hpp>
 #include <litefx/gfx/blitter.hpp>
+#include <litefx/gfx/meshlet.hpp>
 #include <litefx/gfx/vertex.hpp>
\ No newline at end of file
@@ -0,0 +1,202 @@
+// Single-pass mip chain generation. Each work group reduces a 64x64 tile of the source level into up to six mip levels using group shared memory. The last work group
+// that finishes (tracked by a global atomic counter) then reduces the sixth level into up to six more levels, so that up to 12 levels are generated by one dispatch.
+// Based on the idea of AMD FidelityFX SPD: https://github.com/GPUOpen-Effects/FidelityFX-SPD.
+
+#define REDUCTION_AVERAGE 0
+#define REDUCTION_MIN 1
+#define REDUCTION_MAX 2
+
+#define TILE_SIZE 64
+#define GROUP_SIZE 256
+
+struct DownsampleParameters
+{
+	uint2 Size;			// Size of the source level in texels.
+	uint Mips;			// Number of levels to generate (1 to 12).
+	uint WorkGroups;	// Number of work groups in the dispatch.
+	uint Reduction;		// One of the REDUCTION_* modes.
+	uint IsSRGB;		// Non-zero, if the levels are stored in sRGB encoding.
+	uint2 Padding;
+};
+
+ConstantBuffer<DownsampleParameters> input			: register(b0, space0);
+Texture2D<float4>							source	: register(t1, space0);
+globallycoherent RWStructuredBuffer<uint>	counter	: register(u2, space0);
+RWTexture2D<float4>							mip1	: register(u3, space0);
+RWTexture2D<float4>							mip2	: register(u4, space0);
+RWTexture2D<float4>							mip3	: register(u5, space0);
+RWTexture2D<float4>							mip4	: register(u6, space0);
+RWTexture2D<float4>							mip5	: register(u7, space0);
+globallycoherent RWTexture2D<float4>		mip6	: register(u8, space0);
+RWTexture2D<float4>							mip7	: register(u9, space0);
+RWTexture2D<float4>							mip8	: register(u10, space0);
+RWTexture2D<float4>							mip9	: register(u11, space0);
+RWTexture2D<float4>							mip10	: register(u12, space0);
+RWTexture2D<float4>							mip11	: register(u13, space0);
+RWTexture2D<float4>							mip12	: register(u14, space0);
+
+groupshared float4 intermediate[TILE_SIZE / 2][TILE_SIZE / 2];
+groupshared uint isLastGroup;
+
+float3 applySRGB(float3 x)
+{
+	// See: https://github.com/Microsoft/DirectX-Graphics-Samples/blob/master/MiniEngine/Core/Shaders/GenerateMipsCS.hlsli#L55
+	return float3(
+		x.r < 0.0031308 ? 12.92 * x.r : 1.13005 * sqrt(abs(x.r - 0.00228)) - 0.13448 * x.r + 0.005719,
+		x.g < 0.0031308 ? 12.92 * x.g : 1.13005 * sqrt(abs(x.g - 0.00228)) - 0.13448 * x.g + 0.005719,
+		x.b < 0.0031308 ? 12.92 * x.b : 1.13005 * sqrt(abs(x.b - 0.00228)) - 0.13448 * x.b + 0.005719
+	);
+}
+
+float3 removeSRGB(float3 x)
+{
+	return float3(
+		x.r < 0.04045 ? x.r / 12.92 : pow((x.r + 0.055) / 1.055, 2.4),
+		x.g < 0.04045 ? x.g / 12.92 : pow((x.g + 0.055) / 1.055, 2.4),
+		x.b < 0.04045 ? x.b / 12.92 : pow((x.b + 0.055) / 1.055, 2.4)
+	);
+}
+
+float4 packColor(float4 color)
+{
+	return input.IsSRGB != 0 ? float4(applySRGB(color.rgb), color.a) : color;
+}
+
+float4 unpackColor(float4 color)
+{
+	return input.IsSRGB != 0 ? float4(removeSRGB(color.rgb), color.a) : color;
+}
+
+float4 reduce(float4 v0, float4 v1, float4 v2, float4 v3)
+{
+	switch (input.Reduction)
+	{
+	case REDUCTION_MIN: return min(min(v0, v1), min(v2, v3));
+	case REDUCTION_MAX: return max(max(v0, v1), max(v2, v3));
+	default: return (v0 + v1 + v2 + v3) * 0.25;
+	}
+}
+
+uint2 levelSize(uint level)
+{
+	return max(input.Size >> level, 1);
+}
+
+void store(uint mip, uint2 texel, float4 color)
+{
+	// Level sizes are rounded down, so tiles at the edges can contain texels that are out of bounds.
+	if (mip > input.Mips || any(texel >= levelSize(mip)))
+		return;
+
+	color = packColor(color);
+
+	switch (mip)
+	{
+	case 1:  mip1[texel] = color; break;
+	case 2:  mip2[texel] = color; break;
+	case 3:  mip3[texel] = color; break;
+	case 4:  mip4[texel] = color; break;
+	case 5:  mip5[texel] = color; break;
+	case 6:  mip6[texel] = color; break;
+	case 7:  mip7[texel] = color; break;
+	case 8:  mip8[texel] = color; break;
+	case 9:  mip9[texel] = color; break;
+	case 10: mip10[texel] = color; break;
+	case 11: mip11[texel] = color; break;
+	case 12: mip12[texel] = color; break;
+	}
+}
+
+float4 load(uint level, uint2 texel)
+{
+	// Clamp to the edge, so that odd sizes re-use the last row or column instead of reading out of bounds.
+	texel = min(texel, levelSize(level) - 1);
+
+	// The source level is sampled through an SRV that decodes sRGB, whilst the sixth level is read back from the UAV it has been written to.
+	if (level == 0)
+		return source.Load(int3(texel, 0));
+	else
+		return unpackColor(mip6[texel]);
+}
+
+void downsampleTile(uint2 tile, uint threadIndex, uint baseLevel)
+{
+	// Reduce the 64x64 texels of the base level into the 32x32 texels of the first level, four texels per thread.
+	for (uint i = 0; i < 4; ++i)
+	{
+		uint index = threadIndex + i * GROUP_SIZE;
+		uint2 local = uint2(index % (TILE_SIZE / 2), index / (TILE_SIZE / 2));
+		uint2 texel = tile * (TILE_SIZE / 2) + local;
+
+		float4 color = reduce(
+			load(baseLevel, texel * 2 + uint2(0, 0)),
+			load(baseLevel, texel * 2 + uint2(1, 0)),
+			load(baseLevel, texel * 2 + uint2(0, 1)),
+			load(baseLevel, texel * 2 + uint2(1, 1)));
+
+		store(baseLevel + 1, texel, color);
+		intermediate[local.y][local.x] = color;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	// Reduce the remaining levels from group shared memory, halving the number of active threads each time.
+	[unroll]
+	for (uint level = 2, size = TILE_SIZE / 4; level <= 6; ++level, size /= 2)
+	{
+		float4 color = 0;
+		uint2 local = uint2(threadIndex % size, threadIndex / size);
+		bool active = threadIndex < size * size;
+
+		if (active)
+		{
+			color = reduce(
+				intermediate[local.y * 2 + 0][local.x * 2 + 0],
+				intermediate[local.y * 2 + 0][local.x * 2 + 1],
+				intermediate[local.y * 2 + 1][local.x * 2 + 0],
+				intermediate[local.y * 2 + 1][local.x * 2 + 1]);
+		}
+
+		// Wait for all threads to read the previous level, before overwriting it.
+		GroupMemoryBarrierWithGroupSync();
+
+		if (active)
+		{
+			store(baseLevel + level, tile * size + local, color);
+			intermediate[local.y][local.x] = color;
+		}
+
+		GroupMemoryBarrierWithGroupSync();
+	}
+}
+
+[numthreads(GROUP_SIZE, 1, 1)]
+void main(uint3 groupId : SV_GroupID, uint threadIndex : SV_GroupIndex)
+{
+	// Generate the first six levels from the tile of the source level.
+	downsampleTile(groupId.xy, threadIndex, 0);
+
+	if (input.Mips <= 6)
+		return;
+
+	// Make the sixth level visible to other work groups, then find out if this is the last work group to finish.
+	DeviceMemoryBarrierWithGroupSync();
+
+	if (threadIndex == 0)
+	{
+		uint previous;
+		InterlockedAdd(counter[0], 1, previous);
+		isLastGroup = previous == input.WorkGroups - 1 ? 1 : 0;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (isLastGroup == 0)
+		return;
+
+	// Reset the counter for the next dispatch and generate the remaining levels from the sixth level, which is at most 64x64 texels.
+	if (threadIndex == 0)
+		counter[0] = 0;
+
+	downsampleTile(uint2(0, 0), threadIndex, 6);
+}
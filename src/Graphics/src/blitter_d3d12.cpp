@@ -6,6 +6,7 @@ using namespace LiteFX::Rendering::Backends;
 #ifdef LITEFX_BUILD_DIRECTX_12_BACKEND
 
 #include <shader_resources.hpp>
+#include "downsample.h"
 
 // ------------------------------------------------------------------------------------------------
 // Implementation.
@@ -28,32 +29,123 @@ public:
 public:
 	void initialize(const DirectX12Device& device)
 	{
-		// Create the sampler state.
-		auto sampler = device.factory().createSampler(FilterMode::Linear, FilterMode::Linear, BorderMode::ClampToEdge, BorderMode::ClampToEdge, BorderMode::ClampToEdge);
-
 		// Allocate shader module.
-		auto blitShader = LiteFX::Graphics::Shaders::blit_dxi::open();
+		auto downsampleShader = LiteFX::Graphics::Shaders::downsample_dxi::open();
 		Array<UniquePtr<DirectX12ShaderModule>> modules;
-		modules.push_back(makeUnique<DirectX12ShaderModule>(device, ShaderStage::Compute, blitShader, LiteFX::Graphics::Shaders::blit_dxi::name(), "main"));
+		modules.push_back(makeUnique<DirectX12ShaderModule>(device, ShaderStage::Compute, downsampleShader, LiteFX::Graphics::Shaders::downsample_dxi::name(), "main"));
 		auto shaderProgram = DirectX12ShaderProgram::create(device, modules | std::views::as_rvalue);
 
 		// Allocate descriptor set layouts.
-		// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
-		auto bufferLayouts = Array<DirectX12DescriptorLayout>{ 
-			{ DescriptorType::ConstantBuffer, 0, 16 }, 
+		auto descriptorLayouts = Array<DirectX12DescriptorLayout>{ 
+			{ DescriptorType::ConstantBuffer, 0, sizeof(DownsampleParameters) }, 
 			{ DescriptorType::Texture, 1, 0 }, 
-			{ DescriptorType::RWTexture, 2, 0 },
-			{ *sampler, 3 } // Static sampler at s3.
+			{ DescriptorType::RWStructuredBuffer, 2, sizeof(UInt32) }
 		};
+
+		for (UInt32 mip{ 0 }; mip < DOWNSAMPLE_MAX_MIPS; ++mip)
+			descriptorLayouts.emplace_back(DescriptorType::RWTexture, DOWNSAMPLE_FIRST_MIP_BINDING + mip, 0);
+
 		Array<SharedPtr<DirectX12DescriptorSetLayout>> descriptorSetLayouts;
-		descriptorSetLayouts.push_back(DirectX12DescriptorSetLayout::create(device, bufferLayouts, 0, ShaderStage::Compute));
-		// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+		descriptorSetLayouts.push_back(DirectX12DescriptorSetLayout::create(device, descriptorLayouts, 0, ShaderStage::Compute));
 
 		// Create a pipeline layout.
 		auto pipelineLayout = DirectX12PipelineLayout::create(device, descriptorSetLayouts, nullptr);
 
 		// Create the pipeline.
-		m_pipeline = makeUnique<DirectX12ComputePipeline>(device, pipelineLayout, shaderProgram, "Blit");
+		m_pipeline = makeUnique<DirectX12ComputePipeline>(device, pipelineLayout, shaderProgram, "Downsample");
+	}
+
+	bool supportsDownsampling(const IDirectX12Image& image) const noexcept
+	{
+		return image.dimensions() == ImageDimensions::DIM_2 && image.samples() == MultiSamplingLevel::x1 && LITEFX_FLAG_IS_SET(image.usage(), ResourceUsage::AllowWrite);
+	}
+
+	void downsample(const DirectX12Device& device, IDirectX12Image& image, DirectX12CommandBuffer& commandBuffer, MipMapReduction reduction)
+	{
+		// Each pass is dispatched once for each layer.
+		auto passes = planDownsamplePasses(image);
+		auto parametersData = getDownsampleParameters(image, passes, reduction, DX12::isSRGB(image.format()));
+		auto dispatches = static_cast<UInt32>(parametersData.size());
+
+		auto parametersBlock = parametersData |
+			std::views::transform([](const DownsampleParameters& parameters) { return static_cast<const void*>(&parameters); }) |
+			std::ranges::to<Array<const void*>>();
+
+		// Set the active pipeline state.
+		auto& pipeline = *m_pipeline;
+		commandBuffer.use(pipeline);
+
+		// Create and bind the parameters.
+		const auto& resourceBindingsLayout = pipeline.layout()->descriptorSet(0);
+		auto resourceBindings = resourceBindingsLayout.allocate(dispatches) | std::ranges::to<std::vector>();
+		const auto& parametersLayout = resourceBindingsLayout.descriptor(0);
+		auto parameters = device.factory().createBuffer(parametersLayout.type(), ResourceHeap::Dynamic, parametersLayout.elementSize(), dispatches);
+		parameters->map(parametersBlock, sizeof(DownsampleParameters));
+		commandBuffer.track(parameters);
+
+		// Create the atomic counters used to find the last work group of each dispatch. The shader resets them, but they need to be zero initially.
+		Array<UInt32> countersData(dispatches, 0u);
+		auto countersBlock = countersData |
+			std::views::transform([](const UInt32& counter) { return static_cast<const void*>(&counter); }) |
+			std::ranges::to<Array<const void*>>();
+
+		auto counters = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, sizeof(UInt32), dispatches, ResourceUsage::AllowWrite | ResourceUsage::TransferDestination);
+		commandBuffer.transfer(countersBlock, sizeof(UInt32), *counters);
+		commandBuffer.track(counters);
+
+		// Transition the first level into a shader resource and all other levels into read/write state.
+		DirectX12Barrier startBarrier(PipelineStage::All, PipelineStage::Compute);
+		startBarrier.transition(*counters, ResourceAccess::TransferWrite, ResourceAccess::ShaderReadWrite);
+		startBarrier.transition(image, 0, 1, 0, image.layers(), 0, ResourceAccess::TransferWrite, ResourceAccess::ShaderRead, ImageLayout::ShaderResource);
+		startBarrier.transition(image, 1, image.levels() - 1, 0, image.layers(), 0, ResourceAccess::None, ResourceAccess::ShaderReadWrite, ImageLayout::Undefined, ImageLayout::ReadWrite);
+		commandBuffer.barrier(startBarrier);
+		auto resourceBinding = resourceBindings.begin();
+		UInt32 dispatch{ 0 };
+
+		for (const auto& pass : passes)
+		{
+			for (UInt32 layer(0); layer < image.layers(); ++layer, ++dispatch, ++resourceBinding)
+			{
+				auto resource = std::move(*resourceBinding);
+
+				// Update the invocation parameters and counter.
+				resource->update(parametersLayout.binding(), *parameters, dispatch, 1);
+				resource->update(2, *counters, dispatch, 1);
+
+				// Bind the base level to the SRV at binding point 1.
+				resource->update(1, image, 0, pass.BaseLevel, 1, layer, 1);
+
+				// Bind the generated levels to the UAVs. Levels that are not generated by this pass are never written, so they simply point to the last generated level.
+				for (UInt32 mip{ 1 }; mip <= DOWNSAMPLE_MAX_MIPS; ++mip)
+					resource->update(DOWNSAMPLE_FIRST_MIP_BINDING + mip - 1, image, 0, pass.BaseLevel + std::min(mip, pass.Mips), 1, layer, 1);
+
+				// Dispatch the pipeline and track the resource binding until the command buffer finished.
+				commandBuffer.bind(*resource, pipeline);
+				commandBuffer.dispatch(pass.WorkGroups);
+				commandBuffer.track(std::move(resource));
+			}
+
+			// Wait for all writes to the last level of the pass, which is the base level of the next pass.
+			if (&pass != &passes.back())
+			{
+				DirectX12Barrier passBarrier(PipelineStage::Compute, PipelineStage::Compute);
+				passBarrier.transition(image, pass.BaseLevel + pass.Mips, 1, 0, image.layers(), 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
+				commandBuffer.barrier(passBarrier);
+			}
+		}
+
+		// Transition all levels that are still in read/write state into shader resources.
+		DirectX12Barrier endBarrier(PipelineStage::Compute, PipelineStage::All);
+
+		for (const auto& pass : passes)
+		{
+			auto levels = &pass == &passes.back() ? pass.Mips : pass.Mips - 1;
+
+			if (levels > 0)
+				endBarrier.transition(image, pass.BaseLevel + 1, levels, 0, image.layers(), 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
+		}
+
+		commandBuffer.barrier(endBarrier);
 	}
 };
 
@@ -69,91 +161,20 @@ Blitter<DirectX12Backend>::Blitter(const DirectX12Device& device) :
 }
 
 template <>
-void Blitter<DirectX12Backend>::generateMipMaps(IDirectX12Image& image, DirectX12CommandBuffer& commandBuffer)
+void Blitter<DirectX12Backend>::generateMipMaps(IDirectX12Image& image, DirectX12CommandBuffer& commandBuffer, MipMapReduction reduction)
 {
 	auto device = m_impl->m_device.lock();
 
 	if (device == nullptr) [[unlikely]]
 		throw RuntimeException("Unable to generate mip maps on a device that has been released.");
 
-	struct Parameters {
-		Float sizeX;
-		Float sizeY;
-		Float sRGB;
-		Float padding;
-	};
-
-	// Create the array of parameter data.
-	Array<Parameters> parametersData(image.levels());
-
-	std::ranges::generate(parametersData, [&image, i = 0]() mutable {
-		auto level = i++;
-
-		return Parameters{
-			.sizeX = 1.f / static_cast<Float>(std::max<size_t>(image.extent(level).width(), 1)),
-			.sizeY = 1.f / static_cast<Float>(std::max<size_t>(image.extent(level).height(), 1)),
-			.sRGB = DX12::isSRGB(image.format()) ? 1.f : 0.f
-		};
-	});
-
-	auto parametersBlock = parametersData |
-		std::views::transform([](const Parameters& parameters) { return static_cast<const void*>(&parameters); }) |
-		std::ranges::to<Array<const void*>>();
-
-	// Set the active pipeline state.
-	auto& pipeline = *m_impl->m_pipeline;
-	commandBuffer.use(pipeline);
-
-	// Create and bind the parameters.
-	const auto& resourceBindingsLayout = pipeline.layout()->descriptorSet(0);
-	auto resourceBindings = resourceBindingsLayout.allocate(image.levels() * image.layers()) | std::ranges::to<std::vector>();
-	const auto& parametersLayout = resourceBindingsLayout.descriptor(0);
-	auto parameters = device->factory().createBuffer(parametersLayout.type(), ResourceHeap::Dynamic, parametersLayout.elementSize(), image.levels());
-	parameters->map(parametersBlock, sizeof(Parameters));
-	commandBuffer.track(parameters);
-
-	// Transition the texture into a read/write state.
-	DirectX12Barrier startBarrier(PipelineStage::All, PipelineStage::Compute);
-	startBarrier.transition(image, ResourceAccess::None, ResourceAccess::ShaderReadWrite, ImageLayout::Undefined, ImageLayout::ReadWrite);
-	commandBuffer.barrier(startBarrier);
-	auto resourceBinding = resourceBindings.begin();
-
-	for (UInt32 l(0); l < image.layers(); ++l)
-	{
-		auto size = image.extent();
-
-		for (UInt32 i(1); i < image.levels(); ++i, size /= 2)
-		{
-			auto resource = std::move(*resourceBinding);
-
-			// Update the invocation parameters.
-			resource->update(parametersLayout.binding(), *parameters, i, 1);
+	if (image.levels() < 2)
+		return;
 
-			// Bind the previous mip map level to the SRV at binding point 1.
-			resource->update(1, image, 0, i - 1, 1, l, 1);
+	if (!m_impl->supportsDownsampling(image)) [[unlikely]]
+		throw InvalidArgumentException("image", "Mip maps can only be generated for single-sampled 2D images that allow write access.");
 
-			// Bind the current level to the UAV at binding point 2.
-			resource->update(2, image, 0, i, 1, l, 1);
-
-			// Dispatch the pipeline.
-			commandBuffer.bind(*resource, pipeline);
-			commandBuffer.dispatch({ std::max<UInt32>(static_cast<UInt32>(size.width()) / 8, 1), std::max<UInt32>(static_cast<UInt32>(size.height()) / 8, 1), 1 }); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
-
-			// Wait for all writes.
-			DirectX12Barrier subBarrier(PipelineStage::Compute, PipelineStage::Compute);
-			subBarrier.transition(image, i, 1, l, 1, 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
-			commandBuffer.barrier(subBarrier);
-
-			// Advance to the next resource binding and track the current one until the command buffer finished.
-			commandBuffer.track(std::move(resource));
-			resourceBinding++;
-		}
-
-		// Original sub-resource also needs to be transitioned.
-		DirectX12Barrier endBarrier(PipelineStage::Compute, PipelineStage::All);
-		endBarrier.transition(image, 0, 1, l, 1, 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
-		commandBuffer.barrier(endBarrier);
-	}
+	m_impl->downsample(*device, image, commandBuffer, reduction);
 }
 
 // ------------------------------------------------------------------------------------------------
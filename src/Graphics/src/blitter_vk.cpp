@@ -5,6 +5,9 @@ using namespace LiteFX::Rendering::Backends;
 
 #ifdef LITEFX_BUILD_VULKAN_BACKEND
 
+#include <shader_resources.hpp>
+#include "downsample.h"
+
 // ------------------------------------------------------------------------------------------------
 // Implementation.
 // ------------------------------------------------------------------------------------------------
@@ -13,9 +16,195 @@ template<>
 class Blitter<VulkanBackend>::BlitImpl {
     friend class Blitter<VulkanBackend>;
 
+private:
+	WeakPtr<const VulkanDevice> m_device;
+	UniquePtr<VulkanComputePipeline> m_pipeline;
+
 public:
+	BlitImpl(const VulkanDevice& device) :
+		m_device(device.weak_from_this())
+	{
+	}
 
-private:
+public:
+	void initialize(const VulkanDevice& device)
+	{
+		// Allocate shader module.
+		auto downsampleShader = LiteFX::Graphics::Shaders::downsample_spv::open();
+		Array<UniquePtr<VulkanShaderModule>> modules;
+		modules.push_back(makeUnique<VulkanShaderModule>(device, ShaderStage::Compute, downsampleShader, LiteFX::Graphics::Shaders::downsample_spv::name(), "main"));
+		auto shaderProgram = VulkanShaderProgram::create(device, modules | std::views::as_rvalue);
+
+		// Allocate descriptor set layouts.
+		auto descriptorLayouts = Array<VulkanDescriptorLayout>{ 
+			{ DescriptorType::ConstantBuffer, 0, sizeof(DownsampleParameters) }, 
+			{ DescriptorType::Texture, 1, 0 }, 
+			{ DescriptorType::RWStructuredBuffer, 2, sizeof(UInt32) }
+		};
+
+		for (UInt32 mip{ 0 }; mip < DOWNSAMPLE_MAX_MIPS; ++mip)
+			descriptorLayouts.emplace_back(DescriptorType::RWTexture, DOWNSAMPLE_FIRST_MIP_BINDING + mip, 0);
+
+		Array<SharedPtr<VulkanDescriptorSetLayout>> descriptorSetLayouts;
+		descriptorSetLayouts.push_back(VulkanDescriptorSetLayout::create(device, descriptorLayouts, 0, ShaderStage::Compute));
+
+		// Create a pipeline layout.
+		auto pipelineLayout = VulkanPipelineLayout::create(device, descriptorSetLayouts, nullptr);
+
+		// Create the pipeline.
+		m_pipeline = makeUnique<VulkanComputePipeline>(device, pipelineLayout, shaderProgram, "Downsample");
+	}
+
+	bool supportsDownsampling(const IVulkanImage& image) const noexcept
+	{
+		return image.dimensions() == ImageDimensions::DIM_2 && image.samples() == MultiSamplingLevel::x1 && LITEFX_FLAG_IS_SET(image.usage(), ResourceUsage::AllowWrite);
+	}
+
+	void downsample(const VulkanDevice& device, IVulkanImage& image, VulkanCommandBuffer& commandBuffer, MipMapReduction reduction)
+	{
+		// Each pass is dispatched once for each layer.
+		auto passes = planDownsamplePasses(image);
+		auto parametersData = getDownsampleParameters(image, passes, reduction, Vk::isSRGB(image.format()));
+		auto dispatches = static_cast<UInt32>(parametersData.size());
+
+		auto parametersBlock = parametersData |
+			std::views::transform([](const DownsampleParameters& parameters) { return static_cast<const void*>(&parameters); }) |
+			std::ranges::to<Array<const void*>>();
+
+		// Set the active pipeline state.
+		auto& pipeline = *m_pipeline;
+		commandBuffer.use(pipeline);
+
+		// Create and bind the parameters.
+		const auto& resourceBindingsLayout = pipeline.layout()->descriptorSet(0);
+		auto resourceBindings = resourceBindingsLayout.allocate(dispatches) | std::ranges::to<std::vector>();
+		const auto& parametersLayout = resourceBindingsLayout.descriptor(0);
+		auto parameters = device.factory().createBuffer(parametersLayout.type(), ResourceHeap::Dynamic, parametersLayout.elementSize(), dispatches);
+		parameters->map(parametersBlock, sizeof(DownsampleParameters));
+		commandBuffer.track(parameters);
+
+		// Create the atomic counters used to find the last work group of each dispatch. The shader resets them, but they need to be zero initially.
+		Array<UInt32> countersData(dispatches, 0u);
+		auto countersBlock = countersData |
+			std::views::transform([](const UInt32& counter) { return static_cast<const void*>(&counter); }) |
+			std::ranges::to<Array<const void*>>();
+
+		auto counters = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, sizeof(UInt32), dispatches, ResourceUsage::AllowWrite | ResourceUsage::TransferDestination);
+		commandBuffer.transfer(countersBlock, sizeof(UInt32), *counters);
+		commandBuffer.track(counters);
+
+		// Transition the first level into a shader resource and all other levels into read/write state.
+		VulkanBarrier startBarrier(PipelineStage::All, PipelineStage::Compute);
+		startBarrier.transition(*counters, ResourceAccess::TransferWrite, ResourceAccess::ShaderReadWrite);
+		startBarrier.transition(image, 0, 1, 0, image.layers(), 0, ResourceAccess::TransferWrite, ResourceAccess::ShaderRead, ImageLayout::ShaderResource);
+		startBarrier.transition(image, 1, image.levels() - 1, 0, image.layers(), 0, ResourceAccess::None, ResourceAccess::ShaderReadWrite, ImageLayout::Undefined, ImageLayout::ReadWrite);
+		commandBuffer.barrier(startBarrier);
+		auto resourceBinding = resourceBindings.begin();
+		UInt32 dispatch{ 0 };
+
+		for (const auto& pass : passes)
+		{
+			for (UInt32 layer(0); layer < image.layers(); ++layer, ++dispatch, ++resourceBinding)
+			{
+				auto resource = std::move(*resourceBinding);
+
+				// Update the invocation parameters and counter.
+				resource->update(parametersLayout.binding(), *parameters, dispatch, 1);
+				resource->update(2, *counters, dispatch, 1);
+
+				// Bind the base level to the SRV at binding point 1.
+				resource->update(1, image, 0, pass.BaseLevel, 1, layer, 1);
+
+				// Bind the generated levels to the UAVs. Levels that are not generated by this pass are never written, so they simply point to the last generated level.
+				for (UInt32 mip{ 1 }; mip <= DOWNSAMPLE_MAX_MIPS; ++mip)
+					resource->update(DOWNSAMPLE_FIRST_MIP_BINDING + mip - 1, image, 0, pass.BaseLevel + std::min(mip, pass.Mips), 1, layer, 1);
+
+				// Dispatch the pipeline and track the resource binding until the command buffer finished.
+				commandBuffer.bind(*resource, pipeline);
+				commandBuffer.dispatch(pass.WorkGroups);
+				commandBuffer.track(std::move(resource));
+			}
+
+			// Wait for all writes to the last level of the pass, which is the base level of the next pass.
+			if (&pass != &passes.back())
+			{
+				VulkanBarrier passBarrier(PipelineStage::Compute, PipelineStage::Compute);
+				passBarrier.transition(image, pass.BaseLevel + pass.Mips, 1, 0, image.layers(), 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
+				commandBuffer.barrier(passBarrier);
+			}
+		}
+
+		// Transition all levels that are still in read/write state into shader resources.
+		VulkanBarrier endBarrier(PipelineStage::Compute, PipelineStage::All);
+
+		for (const auto& pass : passes)
+		{
+			auto levels = &pass == &passes.back() ? pass.Mips : pass.Mips - 1;
+
+			if (levels > 0)
+				endBarrier.transition(image, pass.BaseLevel + 1, levels, 0, image.layers(), 0, ResourceAccess::ShaderReadWrite, ResourceAccess::ShaderRead, ImageLayout::ReadWrite, ImageLayout::ShaderResource);
+		}
+
+		commandBuffer.barrier(endBarrier);
+	}
+
+	void blit(IVulkanImage& image, VulkanCommandBuffer& commandBuffer)
+	{
+		VulkanBarrier startBarrier(PipelineStage::None, PipelineStage::Transfer);
+		startBarrier.transition(image, ResourceAccess::None, ResourceAccess::TransferWrite, ImageLayout::Undefined, ImageLayout::CopyDestination);
+		commandBuffer.barrier(startBarrier);
+
+		for (UInt32 layer(0); layer < image.layers(); ++layer)
+		{
+			Int32 mipWidth = static_cast<Int32>(image.extent().width());
+			Int32 mipHeight = static_cast<Int32>(image.extent().height());
+			Int32 mipDepth = static_cast<Int32>(image.extent().depth());
+
+			for (UInt32 level(1); level < image.levels(); ++level)
+			{
+				VulkanBarrier subBarrier(PipelineStage::Transfer, PipelineStage::Transfer);
+				subBarrier.transition(image, level - 1, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
+				commandBuffer.barrier(subBarrier);
+
+				// Blit the image of the previous level into the current level.
+				VkImageBlit blit{
+					.srcSubresource = VkImageSubresourceLayers {
+						.aspectMask = image.aspectMask(),
+						.mipLevel = level - 1,
+						.baseArrayLayer = layer,
+						.layerCount = 1
+					},
+					.dstSubresource = VkImageSubresourceLayers {
+						.aspectMask = image.aspectMask(),
+						.mipLevel = level,
+						.baseArrayLayer = layer,
+						.layerCount = 1
+					}
+				};
+
+				blit.srcOffsets[0] = { 0, 0, 0 };
+				blit.srcOffsets[1] = { mipWidth, mipHeight, mipDepth };
+				blit.dstOffsets[0] = { 0, 0, 0 };
+				blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, mipDepth > 1 ? mipDepth / 2 : 1 };
+
+				::vkCmdBlitImage(std::as_const(commandBuffer).handle(), std::as_const(image).handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, std::as_const(image).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+				// Compute the new size.
+				mipWidth = std::max(mipWidth / 2, 1);
+				mipHeight = std::max(mipHeight / 2, 1);
+				mipDepth = std::max(mipDepth / 2, 1);
+			}
+
+			VulkanBarrier subBarrier(PipelineStage::Transfer, PipelineStage::Transfer);
+			subBarrier.transition(image, image.levels() - 1, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
+			subBarrier.transition(image, 0, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
+			commandBuffer.barrier(subBarrier);
+		}
+
+		VulkanBarrier endBarrier(PipelineStage::Transfer, PipelineStage::All);
+		endBarrier.transition(image, ResourceAccess::TransferRead | ResourceAccess::TransferWrite, ResourceAccess::ShaderRead, ImageLayout::ShaderResource);
+		commandBuffer.barrier(endBarrier);
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -23,68 +212,29 @@ private:
 // ------------------------------------------------------------------------------------------------
 
 template <>
-Blitter<VulkanBackend>::Blitter(const VulkanDevice& /*device*/) :
-	m_impl()
+Blitter<VulkanBackend>::Blitter(const VulkanDevice& device) :
+	m_impl(device)
 {
+	m_impl->initialize(device);
 }
 
 template <>
-void Blitter<VulkanBackend>::generateMipMaps(IVulkanImage& image, VulkanCommandBuffer& commandBuffer)
+void Blitter<VulkanBackend>::generateMipMaps(IVulkanImage& image, VulkanCommandBuffer& commandBuffer, MipMapReduction reduction)
 {
-	VulkanBarrier startBarrier(PipelineStage::None, PipelineStage::Transfer);
-	startBarrier.transition(image, ResourceAccess::None, ResourceAccess::TransferWrite, ImageLayout::Undefined, ImageLayout::CopyDestination);
-	commandBuffer.barrier(startBarrier);
-
-	for (UInt32 layer(0); layer < image.layers(); ++layer)
-	{
-		Int32 mipWidth = static_cast<Int32>(image.extent().width());
-		Int32 mipHeight = static_cast<Int32>(image.extent().height());
-		Int32 mipDepth = static_cast<Int32>(image.extent().depth());
-
-		for (UInt32 level(1); level < image.levels(); ++level)
-		{
-			VulkanBarrier subBarrier(PipelineStage::Transfer, PipelineStage::Transfer);
-			subBarrier.transition(image, level - 1, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
-			commandBuffer.barrier(subBarrier);
+	auto device = m_impl->m_device.lock();
 
-			// Blit the image of the previous level into the current level.
-			VkImageBlit blit{
-				.srcSubresource = VkImageSubresourceLayers {
-					.aspectMask = image.aspectMask(),
-					.mipLevel = level - 1,
-					.baseArrayLayer = layer,
-					.layerCount = 1
-				},
-				.dstSubresource = VkImageSubresourceLayers {
-					.aspectMask = image.aspectMask(),
-					.mipLevel = level,
-					.baseArrayLayer = layer,
-					.layerCount = 1
-				}
-			};
-
-			blit.srcOffsets[0] = { 0, 0, 0 };
-			blit.srcOffsets[1] = { mipWidth, mipHeight, mipDepth };
-			blit.dstOffsets[0] = { 0, 0, 0 };
-			blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, mipDepth > 1 ? mipDepth / 2 : 1 };
-
-			::vkCmdBlitImage(std::as_const(commandBuffer).handle(), std::as_const(image).handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, std::as_const(image).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
-
-			// Compute the new size.
-			mipWidth = std::max(mipWidth / 2, 1);
-			mipHeight = std::max(mipHeight / 2, 1);
-			mipDepth = std::max(mipDepth / 2, 1);
-		}
+	if (device == nullptr) [[unlikely]]
+		throw RuntimeException("Unable to generate mip maps on a device that has been released.");
 
-		VulkanBarrier subBarrier(PipelineStage::Transfer, PipelineStage::Transfer);
-		subBarrier.transition(image, image.levels() - 1, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
-		subBarrier.transition(image, 0, 1, layer, 1, 0, ResourceAccess::TransferWrite, ResourceAccess::TransferRead, ImageLayout::CopySource);
-		commandBuffer.barrier(subBarrier);
-	}
+	if (image.levels() < 2)
+		return;
 
-	VulkanBarrier endBarrier(PipelineStage::Transfer, PipelineStage::All);
-	endBarrier.transition(image, ResourceAccess::TransferRead | ResourceAccess::TransferWrite, ResourceAccess::ShaderRead, ImageLayout::ShaderResource);
-	commandBuffer.barrier(endBarrier);
+	if (m_impl->supportsDownsampling(image))
+		m_impl->downsample(*device, image, commandBuffer, reduction);
+	else if (reduction != MipMapReduction::Average) [[unlikely]]
+		throw InvalidArgumentException("reduction", "Only 2D images that allow write access support reduction modes other than average.");
+	else
+		m_impl->blit(image, commandBuffer);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <litefx/gfx/blitter.hpp>
+
+namespace LiteFX::Graphics {
+
+	/// <summary>
+	/// The size of the tile of the base level that is reduced by a single work group of the downsampling shader.
+	/// </summary>
+	constexpr UInt32 DOWNSAMPLE_TILE_SIZE = 64;
+
+	/// <summary>
+	/// The maximum number of levels that are generated by a single dispatch of the downsampling shader.
+	/// </summary>
+	constexpr UInt32 DOWNSAMPLE_MAX_MIPS = 12;
+
+	/// <summary>
+	/// The binding of the first level written by the downsampling shader. The following levels are bound to the subsequent bindings.
+	/// </summary>
+	constexpr UInt32 DOWNSAMPLE_FIRST_MIP_BINDING = 3;
+
+	/// <summary>
+	/// Mirrors the parameters constant buffer of the downsampling shader.
+	/// </summary>
+	struct DownsampleParameters {
+		UInt32 SizeX;
+		UInt32 SizeY;
+		UInt32 Mips;
+		UInt32 WorkGroups;
+		UInt32 Reduction;
+		UInt32 IsSRGB;
+		UInt32 Padding[2];
+	};
+
+	/// <summary>
+	/// Describes a single dispatch of the downsampling shader for each layer of an image.
+	/// </summary>
+	struct DownsamplePass {
+		UInt32 BaseLevel;
+		UInt32 Mips;
+		Vector3u WorkGroups;
+	};
+
+	/// <summary>
+	/// Returns the passes required to generate all levels of <paramref name="image" />.
+	/// </summary>
+	/// <remarks>
+	/// A single pass generates up to 12 levels, as long as the sixth level fits into the tile that is reduced by the last work group, which is true for images of up to
+	/// 4096 texels. Larger base levels only generate six levels, before the next pass continues with the last generated level as base level.
+	/// </remarks>
+	/// <param name="image">The image to generate the levels for.</param>
+	/// <returns>The passes required to generate all levels of the image.</returns>
+	inline Array<DownsamplePass> planDownsamplePasses(const IImage& image)
+	{
+		Array<DownsamplePass> passes;
+
+		for (UInt32 level{ 0 }; level + 1 < image.levels(); )
+		{
+			auto size = image.extent(level);
+			auto width = std::max(static_cast<UInt32>(size.width()), 1u);
+			auto height = std::max(static_cast<UInt32>(size.height()), 1u);
+			auto mips = std::min(image.levels() - level - 1, std::max(width, height) > DOWNSAMPLE_TILE_SIZE * DOWNSAMPLE_TILE_SIZE ? DOWNSAMPLE_MAX_MIPS / 2 : DOWNSAMPLE_MAX_MIPS);
+
+			passes.push_back({
+				.BaseLevel = level,
+				.Mips = mips,
+				.WorkGroups = { (width + DOWNSAMPLE_TILE_SIZE - 1) / DOWNSAMPLE_TILE_SIZE, (height + DOWNSAMPLE_TILE_SIZE - 1) / DOWNSAMPLE_TILE_SIZE, 1 }
+			});
+
+			level += mips;
+		}
+
+		return passes;
+	}
+
+	/// <summary>
+	/// Returns the parameters for each dispatch, ordered by pass first and layer second.
+	/// </summary>
+	/// <param name="image">The image to generate the levels for.</param>
+	/// <param name="passes">The passes returned by <see cref="planDownsamplePasses" />.</param>
+	/// <param name="reduction">The reduction mode used to compute the texels of each level.</param>
+	/// <param name="isSRGB">`true`, if the image stores color values in sRGB encoding.</param>
+	/// <returns>The parameters for each dispatch.</returns>
+	inline Array<DownsampleParameters> getDownsampleParameters(const IImage& image, const Array<DownsamplePass>& passes, MipMapReduction reduction, bool isSRGB)
+	{
+		Array<DownsampleParameters> parameters;
+		parameters.reserve(passes.size() * image.layers());
+
+		for (const auto& pass : passes)
+		{
+			auto size = image.extent(pass.BaseLevel);
+
+			for (UInt32 layer{ 0 }; layer < image.layers(); ++layer)
+			{
+				parameters.push_back({
+					.SizeX = std::max(static_cast<UInt32>(size.width()), 1u),
+					.SizeY = std::max(static_cast<UInt32>(size.height()), 1u),
+					.Mips = pass.Mips,
+					.WorkGroups = pass.WorkGroups.x() * pass.WorkGroups.y(),
+					.Reduction = static_cast<UInt32>(reduction),
+					.IsSRGB = isSRGB ? 1u : 0u
+				});
+			}
+		}
+
+		return parameters;
+	}
+
+}
@@ -0,0 +1,318 @@
+#include <litefx/gfx/meshlet.hpp>
+#include <cmath>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class MeshletBuilder::MeshletBuilderImpl {
+public:
+    friend class MeshletBuilder;
+
+    // Marks a vertex that is not (yet) part of the current meshlet.
+    static constexpr UInt32 INVALID_INDEX = std::numeric_limits<UInt32>::max();
+
+    // If the triangle normals of a meshlet diverge by more than this (cosine), the normal cone is too wide to be useful for culling.
+    static constexpr Float MIN_CONE_SPREAD = 0.1f;
+
+    // Triangle normals with a smaller length are considered degenerate and do not contribute to the normal cone.
+    static constexpr Float MIN_NORMAL_LENGTH = 1e-12f;
+
+private:
+    using Float3 = std::array<Float, 3>;
+
+    UInt32 m_maxVertices, m_maxPrimitives;
+
+public:
+    MeshletBuilderImpl(UInt32 maxVertices, UInt32 maxPrimitives) :
+        m_maxVertices(maxVertices), m_maxPrimitives(maxPrimitives)
+    {
+    }
+
+private:
+    static inline Float3 toFloat3(const Vector3f& v) noexcept
+    {
+        return { v.x(), v.y(), v.z() };
+    }
+
+    static inline Float3 subtract(const Float3& a, const Float3& b) noexcept
+    {
+        return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+    }
+
+    static inline Float dot(const Float3& a, const Float3& b) noexcept
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    static inline Float3 cross(const Float3& a, const Float3& b) noexcept
+    {
+        return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+    }
+
+    static MeshletBounds computeBounds(Span<const Vertex> vertices, const MeshletMesh& mesh, const Meshlet& meshlet)
+    {
+        MeshletBounds bounds{};
+        auto meshletVertices = Span<const UInt32>(mesh.VertexIndices).subspan(meshlet.VertexOffset, meshlet.VertexCount);
+        auto meshletPrimitives = Span<const UInt32>(mesh.Primitives).subspan(meshlet.PrimitiveOffset, meshlet.PrimitiveCount);
+        auto position = [&](UInt32 localIndex) { return toFloat3(vertices[meshletVertices[localIndex]].Position); }; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        // Compute the bounding sphere around the center of the bounding box.
+        Float3 min { std::numeric_limits<Float>::max(), std::numeric_limits<Float>::max(), std::numeric_limits<Float>::max() };
+        Float3 max { std::numeric_limits<Float>::lowest(), std::numeric_limits<Float>::lowest(), std::numeric_limits<Float>::lowest() };
+
+        for (UInt32 i{ 0u }; i < meshlet.VertexCount; ++i)
+        {
+            auto p = position(i);
+            min = { std::min(min[0], p[0]), std::min(min[1], p[1]), std::min(min[2], p[2]) };
+            max = { std::max(max[0], p[0]), std::max(max[1], p[1]), std::max(max[2], p[2]) };
+        }
+
+        Float3 center { (min[0] + max[0]) * 0.5f, (min[1] + max[1]) * 0.5f, (min[2] + max[2]) * 0.5f };
+        Float radius{ 0.0f };
+
+        for (UInt32 i{ 0u }; i < meshlet.VertexCount; ++i)
+        {
+            auto d = subtract(position(i), center);
+            radius = std::max(radius, dot(d, d));
+        }
+
+        bounds.Center = Vector3f(center[0], center[1], center[2]);
+        bounds.Radius = std::sqrt(radius);
+        bounds.ConeApex = bounds.Center;
+
+        // Compute the triangle normals and their average direction.
+        Array<Float3> normals;
+        Array<Float3> corners;
+        normals.reserve(meshlet.PrimitiveCount);
+        corners.reserve(meshlet.PrimitiveCount);
+        Float3 axis{ 0.0f, 0.0f, 0.0f };
+
+        for (auto primitive : meshletPrimitives)
+        {
+            auto a = position(primitive & 0xFF), b = position((primitive >> 8) & 0xFF), c = position((primitive >> 16) & 0xFF); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            auto normal = cross(subtract(b, a), subtract(c, a));
+            auto length = std::sqrt(dot(normal, normal));
+
+            if (length < MIN_NORMAL_LENGTH)
+                continue;
+
+            normal = { normal[0] / length, normal[1] / length, normal[2] / length };
+            axis = { axis[0] + normal[0], axis[1] + normal[1], axis[2] + normal[2] };
+            normals.push_back(normal);
+            corners.push_back(a);
+        }
+
+        auto axisLength = std::sqrt(dot(axis, axis));
+
+        if (normals.empty() || axisLength < MIN_NORMAL_LENGTH)
+            return bounds;
+
+        axis = { axis[0] / axisLength, axis[1] / axisLength, axis[2] / axisLength };
+        bounds.ConeAxis = Vector3f(axis[0], axis[1], axis[2]);
+
+        auto spread = std::ranges::min(normals | std::views::transform([&](const Float3& normal) { return dot(normal, axis); }));
+
+        if (spread <= MIN_CONE_SPREAD)
+            return bounds;
+
+        // Move the apex back along the axis, until it is behind all triangle planes.
+        Float offset{ 0.0f };
+
+        for (auto [normal, corner] : std::views::zip(normals, corners))
+            offset = std::max(offset, dot(subtract(center, corner), normal) / dot(axis, normal));
+
+        bounds.ConeApex = Vector3f(center[0] - axis[0] * offset, center[1] - axis[1] * offset, center[2] - axis[2] * offset);
+        bounds.ConeCutoff = std::sqrt(1.0f - spread * spread);
+
+        return bounds;
+    }
+
+public:
+    MeshletMesh build(Span<const Vertex> vertices, Span<const UInt32> indices) const
+    {
+        MeshletMesh mesh{};
+        const auto vertexCount = static_cast<UInt32>(vertices.size());
+        const auto triangleCount = static_cast<UInt32>(indices.size() / 3);
+
+        if (triangleCount == 0u)
+            return mesh;
+
+        // Build the vertex-to-triangle adjacency, stored as offsets into a flat list of triangles.
+        Array<UInt32> triangleOffsets(vertexCount + 1, 0u), triangles(indices.size());
+
+        for (auto index : indices)
+            ++triangleOffsets[index + 1]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        for (UInt32 v{ 0u }; v < vertexCount; ++v)
+            triangleOffsets[v + 1] += triangleOffsets[v]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+        {
+            Array<UInt32> cursors(triangleOffsets.begin(), triangleOffsets.end() - 1);
+
+            for (UInt32 i{ 0u }; i < indices.size(); ++i)
+                triangles[cursors[indices[i]]++] = i / 3; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        }
+
+        // Compute the triangle centroids, used to keep meshlets compact.
+        Array<Float3> centroids(triangleCount);
+
+        for (UInt32 t{ 0u }; t < triangleCount; ++t)
+        {
+            auto a = toFloat3(vertices[indices[t * 3]].Position), b = toFloat3(vertices[indices[t * 3 + 1]].Position), c = toFloat3(vertices[indices[t * 3 + 2]].Position); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            centroids[t] = { (a[0] + b[0] + c[0]) / 3.0f, (a[1] + b[1] + c[1]) / 3.0f, (a[2] + b[2] + c[2]) / 3.0f }; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        }
+
+        Array<UInt8> emitted(triangleCount, 0);
+        Array<UInt32> localIndices(vertexCount, INVALID_INDEX);
+        Meshlet meshlet{};
+        Float3 center{ 0.0f, 0.0f, 0.0f };
+        UInt32 seed{ 0u }, remaining{ triangleCount };
+
+        auto newVertices = [&](UInt32 triangle) {
+            return static_cast<UInt32>(std::ranges::count(indices.subspan(triangle * 3, 3) | std::views::transform([&](UInt32 index) { return localIndices[index]; }), INVALID_INDEX)); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+        };
+
+        auto finish = [&]() {
+            mesh.Bounds.push_back(computeBounds(vertices, mesh, meshlet));
+            mesh.Meshlets.push_back(meshlet);
+
+            for (auto index : Span<const UInt32>(mesh.VertexIndices).subspan(meshlet.VertexOffset))
+                localIndices[index] = INVALID_INDEX; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+            meshlet = { .VertexOffset = static_cast<UInt32>(mesh.VertexIndices.size()), .PrimitiveOffset = static_cast<UInt32>(mesh.Primitives.size()) };
+        };
+
+        while (remaining > 0u)
+        {
+            // Find the triangle adjacent to the meshlet that adds the fewest vertices and is closest to its center.
+            UInt32 best{ INVALID_INDEX }, bestVertices{ INVALID_INDEX };
+            Float bestDistance{ std::numeric_limits<Float>::max() };
+
+            for (auto vertex : Span<const UInt32>(mesh.VertexIndices).subspan(meshlet.VertexOffset))
+            {
+                for (auto triangle : Span<const UInt32>(triangles).subspan(triangleOffsets[vertex], triangleOffsets[vertex + 1] - triangleOffsets[vertex])) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                {
+                    if (emitted[triangle]) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                        continue;
+
+                    auto added = newVertices(triangle);
+
+                    if (meshlet.VertexCount + added > m_maxVertices || added > bestVertices)
+                        continue;
+
+                    auto d = subtract(centroids[triangle], center); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    auto distance = dot(d, d);
+
+                    if (added < bestVertices || distance < bestDistance)
+                        std::tie(best, bestVertices, bestDistance) = std::make_tuple(triangle, added, distance);
+                }
+            }
+
+            // If there is no adjacent triangle, continue with the next triangle in index order, which usually is close by.
+            if (best == INVALID_INDEX)
+            {
+                while (emitted[seed]) // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    ++seed;
+
+                if (meshlet.VertexCount + newVertices(seed) > m_maxVertices)
+                {
+                    finish();
+                    continue;
+                }
+
+                best = seed;
+            }
+
+            // Add the triangle to the meshlet.
+            UInt32 primitive{ 0u };
+
+            for (UInt32 i{ 0u }; i < 3u; ++i)
+            {
+                auto index = indices[best * 3 + i];   // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                auto& localIndex = localIndices[index]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+                if (localIndex == INVALID_INDEX)
+                {
+                    localIndex = meshlet.VertexCount++;
+                    mesh.VertexIndices.push_back(index);
+                }
+
+                primitive |= localIndex << (i * 8);
+            }
+
+            mesh.Primitives.push_back(primitive);
+            emitted[best] = 1; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            --remaining;
+
+            // Update the running center of the meshlet.
+            const auto& centroid = centroids[best]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            const auto weight = 1.0f / static_cast<Float>(++meshlet.PrimitiveCount);
+            center = { center[0] + (centroid[0] - center[0]) * weight, center[1] + (centroid[1] - center[1]) * weight, center[2] + (centroid[2] - center[2]) * weight };
+
+            if (meshlet.PrimitiveCount == m_maxPrimitives)
+                finish();
+        }
+
+        if (meshlet.PrimitiveCount > 0u)
+            finish();
+
+        return mesh;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+MeshletBuilder::MeshletBuilder(UInt32 maxVertices, UInt32 maxPrimitives) :
+    m_impl(maxVertices, maxPrimitives)
+{
+    if (maxVertices < 3u || maxVertices > MAX_MESHLET_SIZE) [[unlikely]]
+        throw ArgumentOutOfRangeException("maxVertices", std::make_pair(3u, MAX_MESHLET_SIZE), maxVertices, "A meshlet must be able to store at least one triangle and local vertex indices must fit into 8 bits.");
+
+    if (maxPrimitives < 1u || maxPrimitives > MAX_MESHLET_SIZE) [[unlikely]]
+        throw ArgumentOutOfRangeException("maxPrimitives", std::make_pair(1u, MAX_MESHLET_SIZE), maxPrimitives, "A meshlet must be able to store at least one triangle and at most 256 triangles.");
+}
+
+MeshletBuilder::MeshletBuilder(MeshletBuilder&&) noexcept = default;
+MeshletBuilder& MeshletBuilder::operator=(MeshletBuilder&&) noexcept = default;
+MeshletBuilder::~MeshletBuilder() noexcept = default;
+
+UInt32 MeshletBuilder::maxVertices() const noexcept
+{
+    return m_impl->m_maxVertices;
+}
+
+UInt32 MeshletBuilder::maxPrimitives() const noexcept
+{
+    return m_impl->m_maxPrimitives;
+}
+
+MeshletMesh MeshletBuilder::build(Span<const Vertex> vertices, Span<const UInt32> indices) const
+{
+    if (indices.size() % 3 != 0) [[unlikely]]
+        throw InvalidArgumentException("indices", "The number of indices ({0}) must be a multiple of 3.", indices.size());
+
+    if (vertices.size() >= std::numeric_limits<UInt32>::max()) [[unlikely]]
+        throw InvalidArgumentException("vertices", "The mesh contains more vertices ({0}) than can be indexed.", vertices.size());
+
+    if (auto index = std::ranges::find_if(indices, [&](UInt32 i) { return i >= vertices.size(); }); index != indices.end()) [[unlikely]]
+        throw ArgumentOutOfRangeException("indices", std::make_pair<size_t, size_t>(0u, vertices.size()), static_cast<size_t>(*index), "The index buffer refers to a vertex that does not exist.");
+
+    return m_impl->build(vertices, indices);
+}
+
+Array<MeshletMesh> MeshletBuilder::build(Span<const Mesh> meshes, TaskScheduler& scheduler) const
+{
+    Array<MeshletMesh> results(meshes.size());
+
+    // Each mesh is built by its own task, as meshes are usually large enough to amortize the scheduling overhead.
+    scheduler.wait(*scheduler.parallelFor(meshes.size(), [&](size_t i) {
+        results[i] = this->build(meshes[i].Vertices, meshes[i].Indices); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+    }, 1));
+
+    return results;
+}
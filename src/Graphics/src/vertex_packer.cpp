@@ -0,0 +1,264 @@
+#include <litefx/gfx/vertex.hpp>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Conversion kernels.
+// ------------------------------------------------------------------------------------------------
+
+// The kernels below are branch-free (apart from the half-float special cases) and operate on whole attribute streams, so that compilers can vectorize them for the
+// target instruction set.
+namespace {
+    constexpr Float SNORM16_SCALE = 32767.0f;
+    constexpr Float UNORM16_SCALE = 65535.0f;
+    constexpr Float UNORM8_SCALE = 255.0f;
+
+    // Converts a 32 bit float into a half-precision float, rounding to the nearest even value.
+    inline UInt16 toHalf(Float value) noexcept
+    {
+        constexpr UInt32 F32_INFINITY = 255u << 23;
+        constexpr UInt32 F16_MAX = (127u + 16u) << 23;
+        constexpr UInt32 F16_DENORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        constexpr UInt32 F16_MIN_NORMAL = 113u << 23;
+        constexpr UInt32 F16_REBIAS = 0xC8000FFFu; // ((15 - 127) << 23) + 0xFFF
+
+        auto bits = std::bit_cast<UInt32>(value);
+        const auto sign = bits & 0x80000000u;
+        bits ^= sign;
+        UInt32 half{ 0u };
+
+        if (bits >= F16_MAX) [[unlikely]]
+            half = bits > F32_INFINITY ? 0x7E00u : 0x7C00u;
+        else if (bits < F16_MIN_NORMAL) [[unlikely]]
+            half = std::bit_cast<UInt32>(std::bit_cast<Float>(bits) + std::bit_cast<Float>(F16_DENORMAL_MAGIC)) - F16_DENORMAL_MAGIC;
+        else
+            half = (bits + F16_REBIAS + ((bits >> 13) & 1u)) >> 13;
+
+        return static_cast<UInt16>(half | (sign >> 16));
+    }
+
+    inline Int16 toSnorm16(Float value) noexcept
+    {
+        return static_cast<Int16>(std::lround(std::clamp(value, -1.0f, 1.0f) * SNORM16_SCALE));
+    }
+
+    inline UInt16 toUnorm16(Float value) noexcept
+    {
+        return static_cast<UInt16>(std::lround(std::clamp(value, 0.0f, 1.0f) * UNORM16_SCALE));
+    }
+
+    inline UInt8 toUnorm8(Float value) noexcept
+    {
+        return static_cast<UInt8>(std::lround(std::clamp(value, 0.0f, 1.0f) * UNORM8_SCALE));
+    }
+
+    // Projects a unit vector onto an octahedron and unfolds it into the [-1, 1] square.
+    inline std::array<Int16, 2> toOctahedral(Float x, Float y, Float z) noexcept
+    {
+        const auto length = std::abs(x) + std::abs(y) + std::abs(z);
+        const auto scale = length > 0.0f ? 1.0f / length : 0.0f;
+        x *= scale;
+        y *= scale;
+
+        // Fold the lower hemisphere over the diagonals.
+        const auto fold = z < 0.0f;
+        const auto u = fold ? (1.0f - std::abs(y)) * std::copysign(1.0f, x) : x;
+        const auto v = fold ? (1.0f - std::abs(x)) * std::copysign(1.0f, y) : y;
+
+        return { toSnorm16(u), toSnorm16(v) };
+    }
+
+    template <typename T>
+    inline void write(Byte* vertex, UInt32 offset, const T& value) noexcept
+    {
+        std::memcpy(vertex + offset, &value, sizeof(T)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    template <typename TKernel>
+    inline void forEachVertex(PackedMesh& mesh, UInt32 offset, TKernel kernel) noexcept
+    {
+        auto data = mesh.Vertices.data();
+
+        for (UInt32 i{ 0u }; i < mesh.VertexCount; ++i, data += mesh.VertexSize) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            kernel(data, offset, i);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VertexPacker::VertexPackerImpl {
+public:
+    friend class VertexPacker;
+
+private:
+    VertexCompression m_compression;
+    UInt32 m_location;
+
+public:
+    VertexPackerImpl(VertexCompression compression, UInt32 location) :
+        m_compression(compression), m_location(location)
+    {
+    }
+
+public:
+    inline bool compress(VertexCompression attribute) const noexcept
+    {
+        return LITEFX_FLAG_IS_SET(m_compression, attribute);
+    }
+
+    UInt32 addAttribute(PackedMesh& mesh, BufferFormat format, AttributeSemantic semantic) const
+    {
+        auto offset = mesh.VertexSize;
+        auto size = getBufferFormatChannels(format) * getBufferFormatChannelSize(format) / 8;
+        mesh.Attributes.emplace_back(m_location + static_cast<UInt32>(mesh.Attributes.size()), offset, format, semantic);
+        mesh.VertexSize += (size + 3u) & ~3u; // Align attributes to 4 bytes.
+        return offset;
+    }
+
+    PackedMesh pack(Span<const Vertex> vertices, Span<const UInt32> indices, Span<const Vector4f> tangents) const
+    {
+        PackedMesh mesh { .VertexCount = static_cast<UInt32>(vertices.size()) };
+
+        // Setup the attributes first, as they determine the vertex size.
+        auto compressTextureCoordinates = this->compress(VertexCompression::TextureCoordinate);
+        auto normalizedTextureCoordinates = std::ranges::all_of(vertices, [](const Vertex& vertex) {
+            return vertex.TextureCoordinate0.x() >= 0.0f && vertex.TextureCoordinate0.x() <= 1.0f && vertex.TextureCoordinate0.y() >= 0.0f && vertex.TextureCoordinate0.y() <= 1.0f;
+        });
+
+        auto position = this->addAttribute(mesh, this->compress(VertexCompression::Position) ? BufferFormat::XYZW16F : BufferFormat::XYZ32F, AttributeSemantic::Position);
+        auto color = this->addAttribute(mesh, this->compress(VertexCompression::Color) ? BufferFormat::XYZW8UN : BufferFormat::XYZW32F, AttributeSemantic::Color);
+        auto normal = this->addAttribute(mesh, this->compress(VertexCompression::Normal) ? BufferFormat::XY16SN : BufferFormat::XYZ32F, AttributeSemantic::Normal);
+        auto textureCoordinate = this->addAttribute(mesh, compressTextureCoordinates ? (normalizedTextureCoordinates ? BufferFormat::XY16UN : BufferFormat::XY16F) : BufferFormat::XY32F, AttributeSemantic::TextureCoordinate);
+        auto tangent = tangents.empty() ? 0u : this->addAttribute(mesh, this->compress(VertexCompression::Normal) ? BufferFormat::XYZW16SN : BufferFormat::XYZW32F, AttributeSemantic::Tangent);
+
+        mesh.Vertices.resize(static_cast<size_t>(mesh.VertexSize) * mesh.VertexCount);
+
+        // Convert each attribute stream.
+        if (this->compress(VertexCompression::Position))
+            forEachVertex(mesh, position, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& p = vertices[i].Position; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<UInt16, 4> { toHalf(p.x()), toHalf(p.y()), toHalf(p.z()), toHalf(1.0f) });
+            });
+        else
+            forEachVertex(mesh, position, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& p = vertices[i].Position; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<Float, 3> { p.x(), p.y(), p.z() });
+            });
+
+        if (this->compress(VertexCompression::Color))
+            forEachVertex(mesh, color, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& c = vertices[i].Color; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<UInt8, 4> { toUnorm8(c.x()), toUnorm8(c.y()), toUnorm8(c.z()), toUnorm8(c.w()) });
+            });
+        else
+            forEachVertex(mesh, color, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& c = vertices[i].Color; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<Float, 4> { c.x(), c.y(), c.z(), c.w() });
+            });
+
+        if (this->compress(VertexCompression::Normal))
+            forEachVertex(mesh, normal, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& n = vertices[i].Normal; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, toOctahedral(n.x(), n.y(), n.z()));
+            });
+        else
+            forEachVertex(mesh, normal, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& n = vertices[i].Normal; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<Float, 3> { n.x(), n.y(), n.z() });
+            });
+
+        if (!compressTextureCoordinates)
+            forEachVertex(mesh, textureCoordinate, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& t = vertices[i].TextureCoordinate0; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<Float, 2> { t.x(), t.y() });
+            });
+        else if (normalizedTextureCoordinates)
+            forEachVertex(mesh, textureCoordinate, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& t = vertices[i].TextureCoordinate0; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<UInt16, 2> { toUnorm16(t.x()), toUnorm16(t.y()) });
+            });
+        else
+            forEachVertex(mesh, textureCoordinate, [&](Byte* data, UInt32 offset, UInt32 i) {
+                const auto& t = vertices[i].TextureCoordinate0; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                write(data, offset, std::array<UInt16, 2> { toHalf(t.x()), toHalf(t.y()) });
+            });
+
+        if (!tangents.empty())
+        {
+            if (this->compress(VertexCompression::Normal))
+                forEachVertex(mesh, tangent, [&](Byte* data, UInt32 offset, UInt32 i) {
+                    const auto& t = tangents[i]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    auto encoded = toOctahedral(t.x(), t.y(), t.z());
+                    write(data, offset, std::array<Int16, 4> { encoded[0], encoded[1], 0, toSnorm16(std::copysign(1.0f, t.w())) });
+                });
+            else
+                forEachVertex(mesh, tangent, [&](Byte* data, UInt32 offset, UInt32 i) {
+                    const auto& t = tangents[i]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    write(data, offset, std::array<Float, 4> { t.x(), t.y(), t.z(), t.w() });
+                });
+        }
+
+        // Convert the indices. 16 bit indices are only used, if the primitive restart value (0xFFFF) is not a valid vertex index.
+        if (!indices.empty())
+        {
+            mesh.IndexCount = static_cast<UInt32>(indices.size());
+            mesh.IndexFormat = this->compress(VertexCompression::Index) && mesh.VertexCount < std::numeric_limits<UInt16>::max() ? IndexType::UInt16 : IndexType::UInt32;
+
+            if (mesh.IndexFormat == IndexType::UInt16)
+            {
+                mesh.Indices.resize(indices.size() * sizeof(UInt16));
+                auto data = reinterpret_cast<UInt16*>(mesh.Indices.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                std::ranges::transform(indices, data, [](UInt32 index) { return static_cast<UInt16>(index); });
+            }
+            else
+            {
+                mesh.Indices.resize(indices.size_bytes());
+                std::memcpy(mesh.Indices.data(), indices.data(), indices.size_bytes());
+            }
+        }
+
+        return mesh;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VertexPacker::VertexPacker(VertexCompression compression, UInt32 location) :
+    m_impl(compression, location)
+{
+}
+
+VertexPacker::VertexPacker(VertexPacker&&) noexcept = default;
+VertexPacker& VertexPacker::operator=(VertexPacker&&) noexcept = default;
+VertexPacker::~VertexPacker() noexcept = default;
+
+VertexCompression VertexPacker::compression() const noexcept
+{
+    return m_impl->m_compression;
+}
+
+UInt32 VertexPacker::location() const noexcept
+{
+    return m_impl->m_location;
+}
+
+PackedMesh VertexPacker::pack(Span<const Vertex> vertices, Span<const UInt32> indices, Span<const Vector4f> tangents) const
+{
+    if (!tangents.empty() && tangents.size() != vertices.size()) [[unlikely]]
+        throw InvalidArgumentException("tangents", "The number of tangents ({0}) must match the number of vertices ({1}).", tangents.size(), vertices.size());
+
+    if (vertices.size() > std::numeric_limits<UInt32>::max()) [[unlikely]]
+        throw InvalidArgumentException("vertices", "The mesh contains more vertices ({0}) than can be indexed.", vertices.size());
+
+    if (auto index = std::ranges::find_if(indices, [&](UInt32 i) { return i >= vertices.size(); }); index != indices.end()) [[unlikely]]
+        throw ArgumentOutOfRangeException("indices", std::make_pair<size_t, size_t>(0u, vertices.size()), static_cast<size_t>(*index), "The index buffer refers to a vertex that does not exist.");
+
+    return m_impl->pack(vertices, indices, tangents);
+}
@@ -212,7 +212,7 @@ namespace LiteFX::Logging {
     /// want to log such messages, you have to specify the log level explicitly by calling <see cref="Log::log" />.
     /// </remarks>
     class LITEFX_LOGGING_API Log {
-        LITEFX_IMPLEMENTATION(LogImpl);
+        LITEFX_INLINE_IMPLEMENTATION(LogImpl, 64);
 
     public:
         /// <summary>
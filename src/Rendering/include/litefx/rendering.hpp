@@ -1201,6 +1201,9 @@ namespace LiteFX::Rendering {
         /// <inheritdoc />
         virtual SharedPtr<const command_buffer_type> commandBuffer(UInt32 index) const = 0;
 
+        /// <inheritdoc />
+        virtual SharedPtr<const command_buffer_type> acquireCommandBuffer() const = 0;
+
         /// <inheritdoc />
         virtual void begin(const frame_buffer_type& frameBuffer) const = 0;
 
@@ -1221,6 +1224,10 @@ namespace LiteFX::Rendering {
             return this->commandBuffers();
         }
 
+        inline SharedPtr<const ICommandBuffer> getPooledCommandBuffer() const override {
+            return this->acquireCommandBuffer();
+        }
+
         inline void beginRenderPass(const IFrameBuffer& frameBuffer) const override {
             this->begin(dynamic_cast<const frame_buffer_type&>(frameBuffer));
         }
@@ -1578,7 +1585,7 @@ namespace LiteFX::Rendering {
 
     public:
         /// <inheritdoc />
-        const surface_type& surface() const noexcept override = 0;
+        const surface_type& surface() const override = 0;
 
         /// <inheritdoc />
         const adapter_type& adapter() const noexcept override = 0;
@@ -387,7 +387,12 @@ namespace LiteFX::Rendering {
         XYZ32U = 0x20000403,
         XYZW32F = 0x20000104,
         XYZW32I = 0x20000204,
-        XYZW32U = 0x20000404
+        XYZW32U = 0x20000404,
+        XYZW8UN = 0x08000804,
+        XY16UN = 0x10000802,
+        XY16SN = 0x10001002,
+        XYZW16UN = 0x10000804,
+        XYZW16SN = 0x10001004
     };
 
     /// <summary>
@@ -846,7 +851,19 @@ namespace LiteFX::Rendering {
         /// <seealso cref="IDeviceMemory::volatileMove" />
         /// <seealso cref="IDeviceMemory::moving" />
         /// <seealso cref="IDeviceMemory::moved" />
-        Volatile = 0x1000
+        Volatile = 0x1000,
+
+        /// <summary>
+        /// Marks a render target image as transient, i.e., its contents only live within a single render pass.
+        /// </summary>
+        /// <remarks>
+        /// Transient images can be backed by lazily allocated memory on devices that support it (typically tile-based GPUs), where they may never be committed to physical memory
+        /// at all. This is a good fit for multi-sampled color targets that get resolved and depth/stencil targets that are not read after the render pass. If the device does not 
+        /// provide lazily allocated memory, the image is allocated from regular device memory instead. The flag requires <see cref="RenderTarget" /> to be set and cannot be 
+        /// combined with <see cref="AllowWrite" />, <see cref="TransferSource" /> or <see cref="TransferDestination" />, as transient images cannot be sampled, written or copied.
+        /// </remarks>
+        /// <seealso cref="RenderTargetFlags::Transient" />
+        Transient = 0x2000
     };
 
     /// <summary>
@@ -1302,7 +1319,18 @@ namespace LiteFX::Rendering {
         /// When this flag is set, the render target storage is freed after the render pass has finished. The main use of this is to have depth/stencil targets on a render 
         /// pass that are only required during this render pass. It is not valid to attempt accessing the render target before or after the render pass.
         /// </remarks>
-        Volatile = 0x04
+        Volatile = 0x04,
+
+        /// <summary>
+        /// If enabled, the frame buffer image for the render target is created as a transient attachment, that may be backed by lazily allocated memory.
+        /// </summary>
+        /// <remarks>
+        /// Transient render targets are never stored, so their contents are undefined when the render pass ends. Use this for multi-sampled targets that get resolved and 
+        /// depth/stencil targets that are not sampled afterwards. Present targets that are not multi-sampled are copied into the back buffer and are thus allocated as regular
+        /// images instead.
+        /// </remarks>
+        /// <seealso cref="ResourceUsage::Transient" />
+        Transient = 0x08
     };
 
     /// <summary>
@@ -2115,6 +2143,36 @@ namespace LiteFX::Rendering {
         ForceNonOpaque = 0x08
     };
 
+    /// <summary>
+    /// Describes how a frame buffer allocates its images when it gets resized.
+    /// </summary>
+    /// <remarks>
+    /// By default, a frame buffer re-allocates all images whenever it gets resized. When dragging a window, this can happen many times per second. The other policies
+    /// reduce the number of allocations and can be combined.
+    /// </remarks>
+    /// <seealso cref="IFrameBuffer::resize" />
+    enum class FrameBufferResizePolicy {
+        /// <summary>
+        /// Re-allocates all images with the exact size of the frame buffer on each resize.
+        /// </summary>
+        Exact = 0x00,
+
+        /// <summary>
+        /// Allocates images with a size rounded up to the next multiple of a bucket size and renders into the sub-rectangle that matches the frame buffer size. Images 
+        /// are only re-allocated if the frame buffer grows beyond the allocated size, or shrinks far below it.
+        /// </summary>
+        /// <remarks>
+        /// Shaders that sample the images must scale their texture coordinates by the ratio between the frame buffer size and the allocated image size and should clamp
+        /// them to the sub-rectangle, as texels outside of it are undefined. Copies of the present target into the swap chain back buffer only cover the sub-rectangle.
+        /// </remarks>
+        OverAllocate = 0x01,
+
+        /// <summary>
+        /// Keeps a limited number of images that have been replaced during a resize and reuses them, if a later resize requests images with the same size and format.
+        /// </summary>
+        ReuseImages = 0x02
+    };
+
     // NOLINTEND(performance-enum-size)
 
 #pragma endregion
@@ -2133,6 +2191,7 @@ namespace LiteFX::Rendering {
     LITEFX_DEFINE_FLAGS(AccelerationStructureFlags);
     LITEFX_DEFINE_FLAGS(InstanceFlags);
     LITEFX_DEFINE_FLAGS(ShaderBindingGroup);
+    LITEFX_DEFINE_FLAGS(FrameBufferResizePolicy);
 
 #pragma endregion
 
@@ -3487,6 +3546,103 @@ namespace LiteFX::Rendering {
         virtual const Optional<DescriptorBindingPoint>& shaderLocalDescriptor() const noexcept = 0;
     };
 
+    /// <summary>
+    /// A read-only archive that packs multiple shader binaries into a single file, which is memory mapped when opening it.
+    /// </summary>
+    /// <remarks>
+    /// Shader archives are produced at build time using the `ADD_SHADER_ARCHIVE` CMake function. Shader modules that are created from an archive reference the 
+    /// mapped memory directly, which avoids opening a file and copying the bytecode for each shader module. Each module keeps a reference to the archive, so the 
+    /// archive stays mapped as long as any of its modules are alive.
+    /// 
+    /// An archive starts with a 16 byte header, that contains the magic number (<see cref="MAGIC" />), the format version (<see cref="VERSION" />) and the number 
+    /// of entries, followed by a reserved 32 bit value. The header is followed by an index, that stores for each entry the offset and size of the shader binary 
+    /// as 64 bit values, followed by the offset and length of the entry name as 32 bit values. The entry names are stored after the index. Finally, the shader 
+    /// binaries are stored, each one aligned to <see cref="ALIGNMENT" /> bytes. All offsets are relative to the beginning of the file and all values are stored 
+    /// in little-endian byte order.
+    /// </remarks>
+    /// <seealso cref="IShaderModule" />
+    class LITEFX_RENDERING_API ShaderArchive final : public SharedObject {
+        LITEFX_IMPLEMENTATION(ShaderArchiveImpl);
+        friend struct SharedObject::Allocator<ShaderArchive>;
+
+    public:
+        /// <summary>
+        /// The magic number that identifies a shader archive (`LFSA`).
+        /// </summary>
+        static constexpr UInt32 MAGIC = 0x4153464C; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+        /// <summary>
+        /// The version of the shader archive format.
+        /// </summary>
+        static constexpr UInt32 VERSION = 1;
+
+        /// <summary>
+        /// The alignment of the shader binaries within the archive.
+        /// </summary>
+        static constexpr UInt32 ALIGNMENT = 16; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+    private:
+        /// <summary>
+        /// Initializes a new shader archive by memory mapping a file.
+        /// </summary>
+        /// <param name="fileName">The file name of the shader archive.</param>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be mapped or does not contain a valid shader archive.</exception>
+        explicit ShaderArchive(const String& fileName);
+
+    public:
+        /// <summary>
+        /// Releases the shader archive and unmaps the file.
+        /// </summary>
+        ~ShaderArchive() noexcept override;
+
+        ShaderArchive(ShaderArchive&&) noexcept = delete;
+        ShaderArchive(const ShaderArchive&) = delete;
+        auto operator=(ShaderArchive&&) noexcept = delete;
+        auto operator=(const ShaderArchive&) = delete;
+
+    public:
+        /// <summary>
+        /// Opens a shader archive.
+        /// </summary>
+        /// <param name="fileName">The file name of the shader archive.</param>
+        /// <returns>A shared pointer to the shader archive instance.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be mapped or does not contain a valid shader archive.</exception>
+        static inline auto open(const String& fileName) -> SharedPtr<const ShaderArchive> {
+            return SharedObject::create<ShaderArchive>(fileName);
+        }
+
+    public:
+        /// <summary>
+        /// Returns the file name of the shader archive.
+        /// </summary>
+        /// <returns>The file name of the shader archive.</returns>
+        const String& fileName() const noexcept;
+
+        /// <summary>
+        /// Returns the names of all entries in the shader archive.
+        /// </summary>
+        /// <returns>The names of all entries in the shader archive.</returns>
+        Array<StringView> names() const;
+
+        /// <summary>
+        /// Returns `true`, if the archive contains an entry with the provided <paramref name="name" />.
+        /// </summary>
+        /// <param name="name">The name of the entry.</param>
+        /// <returns>`true`, if the archive contains an entry with the provided <paramref name="name" />, `false` otherwise.</returns>
+        bool contains(StringView name) const noexcept;
+
+        /// <summary>
+        /// Returns the mapped memory of the shader binary stored with the provided <paramref name="name" />.
+        /// </summary>
+        /// <remarks>
+        /// The returned memory is only valid as long as the archive is alive.
+        /// </remarks>
+        /// <param name="name">The name of the entry.</param>
+        /// <returns>The mapped memory of the shader binary.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain an entry with the provided <paramref name="name" />.</exception>
+        Span<const std::byte> find(StringView name) const;
+    };
+
     /// <summary>
     /// Represents a render target, i.e. an abstract view of the output of an <see cref="RenderPass" />.
     /// </summary>
@@ -3646,6 +3802,18 @@ namespace LiteFX::Rendering {
         /// <seealso cref="RenderTargetFlags" />
         virtual bool isVolatile() const noexcept = 0;
 
+        /// <summary>
+        /// Returns <c>true</c>, if the frame buffer image of the target only needs to live during the render pass and can be backed by lazily allocated memory.
+        /// </summary>
+        /// <remarks>
+        /// Transient targets are never stored at the end of a render pass. Different from volatile targets, the image itself is created as a transient attachment, which 
+        /// allows the device to avoid committing physical memory for it.
+        /// </remarks>
+        /// <returns><c>true</c>, if the frame buffer image of the target is transient.</returns>
+        /// <seealso cref="flags" />
+        /// <seealso cref="RenderTargetFlags" />
+        virtual bool isTransient() const noexcept = 0;
+
         /// <summary>
         /// Returns the render targets blend state.
         /// </summary>
@@ -3750,6 +3918,9 @@ namespace LiteFX::Rendering {
         /// <inheritdoc />
         bool isVolatile() const noexcept override;
 
+        /// <inheritdoc />
+        bool isTransient() const noexcept override;
+
         /// <inheritdoc />
         const BlendState& blendState() const noexcept override;
     };
@@ -7743,6 +7914,28 @@ namespace LiteFX::Rendering {
             return this->getLayout();
         }
 
+        /// <summary>
+        /// Returns `true`, if the pipeline state has been compiled and can be used.
+        /// </summary>
+        /// <remarks>
+        /// Pipelines that are compiled asynchronously are not immediately ready after they have been built. Using a pipeline that is not ready blocks 
+        /// the calling thread until compilation has finished. Pipelines that are compiled synchronously are always ready.
+        /// </remarks>
+        /// <returns>`true`, if the pipeline state has been compiled, `false` otherwise.</returns>
+        /// <seealso cref="wait" />
+        virtual bool isReady() const noexcept = 0;
+
+        /// <summary>
+        /// Waits until the pipeline state has been compiled.
+        /// </summary>
+        /// <remarks>
+        /// While waiting, the calling thread helps executing pending tasks on the scheduler that compiles the pipeline. If the pipeline is already ready, 
+        /// this method returns immediately.
+        /// </remarks>
+        /// <exception cref="RuntimeException">Thrown, if the pipeline state could not be compiled.</exception>
+        /// <seealso cref="isReady" />
+        virtual void wait() const = 0;
+
     private:
         virtual SharedPtr<const IShaderProgram> getProgram() const noexcept = 0;
         virtual SharedPtr<const IPipelineLayout> getLayout() const noexcept = 0;
@@ -9466,12 +9659,79 @@ namespace LiteFX::Rendering {
             return this->getCommandBuffer(index);
         }
 
+        /// <summary>
+        /// Acquires a secondary command buffer from the command buffer pool of the active frame buffer, that can be used to record commands in the render pass.
+        /// </summary>
+        /// <remarks>
+        /// In addition to the fixed set of secondary command buffers returned by <see cref="commandBuffer" />, each frame buffer owns a pool of secondary command buffers,
+        /// that can be acquired on demand, for example one for each recording thread. This method is thread-safe, however each acquired command buffer must only be 
+        /// recorded by one thread at a time. The command buffer is returned to the pool when the render pass ends. The pool grows, if more command buffers are acquired
+        /// than it currently holds, and shrinks to the largest number of command buffers used within a frame, if command buffers have not been used for a number of
+        /// frames.
+        /// 
+        /// When the render pass ends, only the acquired command buffers are executed, in the order they have been acquired, after the command buffers returned by
+        /// <see cref="commandBuffer" />.
+        /// </remarks>
+        /// <returns>A secondary command buffer that can be used to record commands in the render pass.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the render pass has not been begun.</exception>
+        /// <seealso cref="pooledCommandBuffers" />
+        /// <seealso cref="recordParallel" />
+        inline SharedPtr<const ICommandBuffer> acquireCommandBuffer() const {
+            return this->getPooledCommandBuffer();
+        }
+
+        /// <summary>
+        /// Records <paramref name="draws" /> draws in parallel, by distributing them across secondary command buffers acquired from the pool of the render pass.
+        /// </summary>
+        /// <remarks>
+        /// The draws are split into contiguous ranges, one for each worker of <paramref name="scheduler" />. For each range a command buffer is acquired by calling 
+        /// <see cref="acquireCommandBuffer" /> and recorded by a task on <paramref name="scheduler" />, so that each command buffer is only accessed by a single thread 
+        /// at a time. The <paramref name="callback" /> is invoked for each draw with the command buffer to record the draw into and the index of the draw. The method 
+        /// returns after all draws have been recorded. The render pass must have been started by calling <see cref="begin" /> before.
+        /// </remarks>
+        /// <typeparam name="TCallback">The type of the callback that records a draw.</typeparam>
+        /// <param name="scheduler">The scheduler to execute the recording tasks on.</param>
+        /// <param name="draws">The number of draws to record.</param>
+        /// <param name="callback">The callback that records an individual draw.</param>
+        /// <exception cref="RuntimeException">Thrown, if the render pass has not been begun.</exception>
+        /// <seealso cref="App::scheduler" />
+        /// <seealso cref="acquireCommandBuffer" />
+        template <typename TCallback> requires
+            std::invocable<TCallback, const ICommandBuffer&, UInt32>
+        inline void recordParallel(TaskScheduler& scheduler, UInt32 draws, TCallback callback) const {
+            if (draws == 0)
+                return;
+
+            const auto buffers = std::min(std::max(scheduler.workers(), 1u), draws);
+            auto counter = makeShared<TaskCounter>();
+
+            for (UInt32 i = 0; i < buffers; ++i)
+            {
+                scheduler.schedule(counter, [commandBuffer = this->acquireCommandBuffer(), first = i * draws / buffers, last = (i + 1) * draws / buffers, &callback]() {
+                    for (auto draw = first; draw < last; ++draw)
+                        callback(*commandBuffer, draw);
+                });
+            }
+
+            scheduler.wait(*counter);
+        }
+
         /// <summary>
         /// Returns the number of secondary command buffers the render pass stores for multi-threaded command recording.
         /// </summary>
         /// <returns>The number of secondary command buffers the render pass stores for multi-threaded command recording.</returns>
         virtual UInt32 secondaryCommandBuffers() const noexcept = 0;
 
+        /// <summary>
+        /// Returns the number of secondary command buffers in the pool of the active frame buffer.
+        /// </summary>
+        /// <remarks>
+        /// The number includes command buffers that are currently not acquired. If the render pass is currently not active, the method returns `0`.
+        /// </remarks>
+        /// <returns>The number of secondary command buffers in the pool of the active frame buffer.</returns>
+        /// <seealso cref="acquireCommandBuffer" />
+        virtual UInt32 pooledCommandBuffers() const noexcept = 0;
+
         /// <summary>
         /// Returns the list of render targets, the render pass renders into.
         /// </summary>
@@ -9548,6 +9808,258 @@ namespace LiteFX::Rendering {
         virtual const ICommandQueue& getCommandQueue() const noexcept = 0;
         virtual SharedPtr<const ICommandBuffer> getCommandBuffer(UInt32 index) const noexcept = 0;
         virtual Enumerable<SharedPtr<const ICommandBuffer>> getCommandBuffers() const = 0;
+        virtual SharedPtr<const ICommandBuffer> getPooledCommandBuffer() const = 0;
+    };
+
+    /// <summary>
+    /// Collects draw packets and records them sorted by their state, so that the number of state changes between draws is minimized.
+    /// </summary>
+    /// <remarks>
+    /// Draw packets can be submitted in any order. When a packet is submitted, <see cref="submit" /> computes a 64-bit sort key for it, that contains (from the most 
+    /// to the least significant bits) identifiers for the pipeline, the combination of descriptor sets, the vertex buffer, the index buffer, the push constants and the 
+    /// draw range. Calling <see cref="sort" /> then orders the packets by their keys using a radix sort, that is executed in parallel on a <see cref="TaskScheduler" /> 
+    /// for large lists. As the sort is stable, packets with equal keys keep their submission order. Afterwards, consecutive packets that only differ in their instance 
+    /// range are merged into a single instanced draw, if their instance ranges are adjacent.
+    /// 
+    /// Note that sorting changes the order in which draws are executed. Passes whose result depends on the draw order, for example passes that blend transparent 
+    /// geometry back to front, must not use a draw list, or must record each group of order-dependent draws with a separate draw list.
+    /// 
+    /// Identifiers are assigned in the order in which states are first submitted. If there are more distinct states than a key field can represent, identifiers
+    /// wrap around. This only makes sorting less effective, as recording still compares the actual states to skip redundant state changes.
+    /// 
+    /// The draw list does not take ownership of any of the resources referenced by the draw packets. All of them, including the push constants memory, need to 
+    /// stay valid until the draw list is recorded.
+    /// </remarks>
+    /// <seealso cref="ICommandBuffer" />
+    /// <seealso cref="IRenderPass::acquireCommandBuffer" />
+    class LITEFX_RENDERING_API DrawList final {
+        LITEFX_IMPLEMENTATION(DrawListImpl);
+
+    public:
+        /// <summary>
+        /// The maximum number of descriptor sets that can be bound by a single draw packet.
+        /// </summary>
+        static constexpr UInt32 MAX_DESCRIPTOR_SETS = 4u;
+
+        /// <summary>
+        /// Describes a single draw call and the state it requires.
+        /// </summary>
+        struct DrawPacket final {
+            /// <summary>
+            /// The pipeline used by the draw. Must not be `nullptr`.
+            /// </summary>
+            const IRenderPipeline* Pipeline { nullptr };
+
+            /// <summary>
+            /// The descriptor sets bound for the draw. Unused entries must be set to `nullptr`.
+            /// </summary>
+            std::array<const IDescriptorSet*, MAX_DESCRIPTOR_SETS> DescriptorSets { };
+
+            /// <summary>
+            /// The vertex buffer bound for the draw, or `nullptr`, if the draw does not use a vertex buffer.
+            /// </summary>
+            const IVertexBuffer* VertexBuffer { nullptr };
+
+            /// <summary>
+            /// The index buffer bound for the draw, or `nullptr`, if the draw is not indexed.
+            /// </summary>
+            const IIndexBuffer* IndexBuffer { nullptr };
+
+            /// <summary>
+            /// The layout of the push constants, or `nullptr`, if the draw does not use push constants.
+            /// </summary>
+            const IPushConstantsLayout* PushConstantsLayout { nullptr };
+
+            /// <summary>
+            /// A pointer to the push constants memory. Draws are only merged, if they share the same memory.
+            /// </summary>
+            const void* PushConstants { nullptr };
+
+            /// <summary>
+            /// The number of indices for indexed draws, or the number of vertices otherwise.
+            /// </summary>
+            UInt32 Elements { 0u };
+
+            /// <summary>
+            /// The first index for indexed draws, or the first vertex otherwise.
+            /// </summary>
+            UInt32 FirstElement { 0u };
+
+            /// <summary>
+            /// The offset added to each index for indexed draws. Ignored for non-indexed draws.
+            /// </summary>
+            Int32 VertexOffset { 0 };
+
+            /// <summary>
+            /// The number of instances to draw.
+            /// </summary>
+            UInt32 Instances { 1u };
+
+            /// <summary>
+            /// The first instance to draw.
+            /// </summary>
+            UInt32 FirstInstance { 0u };
+        };
+
+        /// <summary>
+        /// Stores statistics about the last sort and recording of the draw list.
+        /// </summary>
+        struct Statistics final {
+            /// <summary>
+            /// The number of draw packets that have been submitted.
+            /// </summary>
+            UInt32 Packets { 0u };
+
+            /// <summary>
+            /// The number of draws that remain after merging instanced draws.
+            /// </summary>
+            UInt32 Draws { 0u };
+
+            /// <summary>
+            /// The number of times a pipeline has been bound.
+            /// </summary>
+            UInt32 PipelineChanges { 0u };
+
+            /// <summary>
+            /// The number of times a descriptor set has been bound.
+            /// </summary>
+            UInt32 DescriptorSetChanges { 0u };
+
+            /// <summary>
+            /// The number of times a vertex buffer has been bound.
+            /// </summary>
+            UInt32 VertexBufferChanges { 0u };
+
+            /// <summary>
+            /// The number of times an index buffer has been bound.
+            /// </summary>
+            UInt32 IndexBufferChanges { 0u };
+
+            /// <summary>
+            /// The number of times push constants have been updated.
+            /// </summary>
+            UInt32 PushConstantChanges { 0u };
+
+            /// <summary>
+            /// The CPU time spent on sorting and merging the draw packets in milliseconds.
+            /// </summary>
+            double SortTime { 0.0 };
+
+            /// <summary>
+            /// The CPU time spent on recording the draws in milliseconds.
+            /// </summary>
+            double RecordTime { 0.0 };
+
+            /// <summary>
+            /// Returns the total number of state changes.
+            /// </summary>
+            /// <returns>The total number of state changes.</returns>
+            constexpr UInt32 stateChanges() const noexcept {
+                return PipelineChanges + DescriptorSetChanges + VertexBufferChanges + IndexBufferChanges + PushConstantChanges;
+            }
+        };
+
+    public:
+        /// <summary>
+        /// Initializes a new draw list.
+        /// </summary>
+        /// <param name="capacity">The number of draw packets to reserve memory for.</param>
+        explicit DrawList(UInt32 capacity = 0u);
+
+        /// <summary>
+        /// Takes over another draw list.
+        /// </summary>
+        /// <param name="_other">The draw list to take over.</param>
+        DrawList(DrawList&& _other) noexcept;
+
+        /// <summary>
+        /// Assigns a draw list by taking it over.
+        /// </summary>
+        /// <param name="_other">The draw list to take over.</param>
+        /// <returns>A reference to the current draw list.</returns>
+        DrawList& operator=(DrawList&& _other) noexcept;
+
+        /// <summary>
+        /// Releases the draw list.
+        /// </summary>
+        ~DrawList() noexcept;
+
+        DrawList(const DrawList&) = delete;
+        DrawList& operator=(const DrawList&) = delete;
+
+    public:
+        /// <summary>
+        /// Submits a draw packet to the draw list.
+        /// </summary>
+        /// <remarks>
+        /// Packets without instances or elements are ignored.
+        /// </remarks>
+        /// <param name="packet">The draw packet to submit.</param>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if the pipeline of <paramref name="packet" /> is not initialized.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="packet" /> provides push constants memory without a layout.</exception>
+        void submit(const DrawPacket& packet);
+
+        /// <summary>
+        /// Removes all draw packets from the draw list and resets the statistics, but keeps the allocated memory.
+        /// </summary>
+        void clear() noexcept;
+
+        /// <summary>
+        /// Returns the number of submitted draw packets.
+        /// </summary>
+        /// <returns>The number of submitted draw packets.</returns>
+        UInt32 size() const noexcept;
+
+        /// <summary>
+        /// Returns the draws in the order they are recorded, after the draw list has been sorted, or an empty span otherwise.
+        /// </summary>
+        /// <returns>The sorted and merged draws.</returns>
+        Span<const DrawPacket> draws() const noexcept;
+
+        /// <summary>
+        /// Sorts the draw packets by their state and merges instanced draws.
+        /// </summary>
+        /// <remarks>
+        /// Submitting another packet invalidates the sort order, so the draw list needs to be sorted again before recording. Draws with different states are reordered,
+        /// so sorting must not be used for draws that depend on their submission order, such as blended draws.
+        /// </remarks>
+        void sort();
+
+        /// <summary>
+        /// Sorts the draw packets by their state and merges instanced draws, using the workers of <paramref name="scheduler" /> for large draw lists.
+        /// </summary>
+        /// <param name="scheduler">The scheduler to execute the radix sort passes on.</param>
+        /// <seealso cref="sort" />
+        void sort(TaskScheduler& scheduler);
+
+        /// <summary>
+        /// Records the sorted draws into <paramref name="commandBuffer" />.
+        /// </summary>
+        /// <remarks>
+        /// State is only set if it differs from the state of the previous draw. After binding a different pipeline, descriptor sets and push constants are set again.
+        /// </remarks>
+        /// <param name="commandBuffer">The command buffer to record the draws into.</param>
+        /// <exception cref="RuntimeException">Thrown, if the draw list has not been sorted since the last packet has been submitted.</exception>
+        void record(const ICommandBuffer& commandBuffer) const;
+
+        /// <summary>
+        /// Records the sorted draws in parallel into command buffers acquired from <paramref name="renderPass" />.
+        /// </summary>
+        /// <remarks>
+        /// The draws are split into contiguous ranges, one for each worker of <paramref name="scheduler" />. Each range is recorded into its own command buffer, so that
+        /// the draws are executed in their sorted order. The first draw of each range sets the full state.
+        /// </remarks>
+        /// <param name="renderPass">The active render pass to acquire the command buffers from.</param>
+        /// <param name="scheduler">The scheduler to execute the recording tasks on.</param>
+        /// <exception cref="RuntimeException">Thrown, if the draw list has not been sorted since the last packet has been submitted.</exception>
+        /// <seealso cref="IRenderPass::acquireCommandBuffer" />
+        void record(const IRenderPass& renderPass, TaskScheduler& scheduler) const;
+
+        /// <summary>
+        /// Returns the statistics of the last sort and recording.
+        /// </summary>
+        /// <returns>The statistics of the last sort and recording.</returns>
+        Statistics statistics() const noexcept;
     };
 
     /// <summary>
@@ -9737,7 +10249,8 @@ namespace LiteFX::Rendering {
         /// Returns the current swap chain back buffer image.
         /// </summary>
         /// <returns>A reference of the current swap chain back buffer image.</returns>
-        virtual const IImage& image() const noexcept = 0;
+        /// <exception cref="RuntimeException">Thrown, if the swap chain does not provide back buffer images, because its device does not have a surface.</exception>
+        virtual const IImage& image() const = 0;
 
         /// <summary>
         /// Returns an array of the swap chain present images.
@@ -11141,7 +11654,8 @@ namespace LiteFX::Rendering {
         /// Returns the surface, the device draws to.
         /// </summary>
         /// <returns>A reference of the surface, the device draws to.</returns>
-        virtual const ISurface& surface() const noexcept = 0;
+        /// <exception cref="RuntimeException">Thrown, if the device has been created without a surface.</exception>
+        virtual const ISurface& surface() const = 0;
 
         /// <summary>
         /// Returns the graphics adapter, the device uses for drawing.
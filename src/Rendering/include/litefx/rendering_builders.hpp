@@ -405,6 +405,17 @@ namespace LiteFX::Rendering {
         /// <returns>The shader module instance.</return>
         constexpr virtual UniquePtr<shader_module_type> makeShaderModule(ShaderStage type, std::istream& stream, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) = 0;
 
+        /// <summary>
+        /// Called to create a new shader module in the program that is stored in a shader archive.
+        /// </summary>
+        /// <param name="type">The type of the shader module.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="entryPoint">The name of the entry point for the module.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        /// <returns>The shader module instance.</return>
+        constexpr virtual UniquePtr<shader_module_type> makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) = 0;
+
     public:
         /// <summary>
         /// Adds a shader module to the program.
@@ -433,6 +444,23 @@ namespace LiteFX::Rendering {
             return std::forward<TSelf>(self);
         }
 
+        /// <summary>
+        /// Adds a shader module to the program, that is stored in a shader archive.
+        /// </summary>
+        /// <remarks>
+        /// The shader module references the memory mapped by the <paramref name="archive" /> directly and keeps the archive alive.
+        /// </remarks>
+        /// <param name="type">The type of the shader module.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="entryPoint">The name of the entry point for the module.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        template<typename TSelf>
+        [[nodiscard]] constexpr auto withShaderModule(this TSelf&& self, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt) -> TSelf&& {
+            self.m_state.modules.push_back(std::move(static_cast<ShaderProgramBuilder&>(self).makeShaderModule(type, archive, name, entryPoint, shaderLocalDescriptor)));
+            return std::forward<TSelf>(self);
+        }
+
         /// <summary>
         /// Adds a vertex shader module to the program.
         /// </summary>
@@ -1661,6 +1689,11 @@ namespace LiteFX::Rendering {
             /// The multi-sampling level of the render pipeline.
             /// </summary>
             MultiSamplingLevel samples { MultiSamplingLevel::x1 };
+
+            /// <summary>
+            /// If set to `true`, the pipeline state is compiled asynchronously.
+            /// </summary>
+            bool compileAsync{ false };
         } m_state;
 
     protected:
@@ -1739,6 +1772,21 @@ namespace LiteFX::Rendering {
             self.m_state.samples = samples;
             return std::forward<TSelf>(self);
         }
+
+        /// <summary>
+        /// Compiles the pipeline state asynchronously on the task scheduler of the application.
+        /// </summary>
+        /// <remarks>
+        /// Building a pipeline that is compiled asynchronously returns immediately. Use <see cref="IPipeline::isReady" /> to check if compilation has 
+        /// finished or <see cref="IPipeline::wait" /> to wait for it. Building multiple pipelines asynchronously compiles them in parallel. Backends 
+        /// that do not support asynchronous compilation ignore this setting and compile the pipeline state when building it.
+        /// </remarks>
+        /// <param name="enable">Whether or not to compile the pipeline state asynchronously.</param>
+        template <typename TSelf>
+        constexpr auto compileAsync(this TSelf&& self, bool enable = true) -> TSelf&& {
+            self.m_state.compileAsync = enable;
+            return std::forward<TSelf>(self);
+        }
     };
 
     /// <summary>
@@ -1769,6 +1817,11 @@ namespace LiteFX::Rendering {
             /// The compute pipeline layout.
             /// </summary>
             SharedPtr<pipeline_layout_type> pipelineLayout{ };
+
+            /// <summary>
+            /// If set to `true`, the pipeline state is compiled asynchronously.
+            /// </summary>
+            bool compileAsync{ false };
         } m_state;
 
     protected:
@@ -1804,6 +1857,21 @@ namespace LiteFX::Rendering {
             self.m_state.pipelineLayout = std::move(layout);
             return std::forward<TSelf>(self);
         }
+
+        /// <summary>
+        /// Compiles the pipeline state asynchronously on the task scheduler of the application.
+        /// </summary>
+        /// <remarks>
+        /// Building a pipeline that is compiled asynchronously returns immediately. Use <see cref="IPipeline::isReady" /> to check if compilation has 
+        /// finished or <see cref="IPipeline::wait" /> to wait for it. Building multiple pipelines asynchronously compiles them in parallel. Backends 
+        /// that do not support asynchronous compilation ignore this setting and compile the pipeline state when building it.
+        /// </remarks>
+        /// <param name="enable">Whether or not to compile the pipeline state asynchronously.</param>
+        template <typename TSelf>
+        constexpr auto compileAsync(this TSelf&& self, bool enable = true) -> TSelf&& {
+            self.m_state.compileAsync = enable;
+            return std::forward<TSelf>(self);
+        }
     };
 
     /// <summary>
@@ -1844,6 +1912,11 @@ namespace LiteFX::Rendering {
             /// The maximum size for ray attributes in the pipeline.
             /// </summary>
             UInt32 maxAttributeSize { 32 }; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            /// <summary>
+            /// If set to `true`, the pipeline state is compiled asynchronously.
+            /// </summary>
+            bool compileAsync{ false };
         } m_state;
 
     protected:
@@ -1895,6 +1968,21 @@ namespace LiteFX::Rendering {
             self.m_state.maxAttributeSize = maxAttributeSize;
             return std::forward<TSelf>(self);
         }
+
+        /// <summary>
+        /// Compiles the pipeline state asynchronously on the task scheduler of the application.
+        /// </summary>
+        /// <remarks>
+        /// Building a pipeline that is compiled asynchronously returns immediately. Use <see cref="IPipeline::isReady" /> to check if compilation has 
+        /// finished or <see cref="IPipeline::wait" /> to wait for it. Building multiple pipelines asynchronously compiles them in parallel. Backends 
+        /// that do not support asynchronous compilation ignore this setting and compile the pipeline state when building it.
+        /// </remarks>
+        /// <param name="enable">Whether or not to compile the pipeline state asynchronously.</param>
+        template <typename TSelf>
+        constexpr auto compileAsync(this TSelf&& self, bool enable = true) -> TSelf&& {
+            self.m_state.compileAsync = enable;
+            return std::forward<TSelf>(self);
+        }
     };
 
     /// <summary>
@@ -456,6 +456,12 @@ struct LITEFX_RENDERING_API std::formatter<BufferFormat> : std::formatter<std::s
 		case 0x04:
 			names.emplace_back("S");
 			break;
+		case 0x08:
+			names.emplace_back("UN");
+			break;
+		case 0x10:
+			names.emplace_back("SN");
+			break;
 		default:
 			return formatter<string_view>::format("Invalid", ctx);
 		}
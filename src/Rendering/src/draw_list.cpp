@@ -0,0 +1,365 @@
+#include <litefx/rendering.hpp>
+#include <chrono>
+
+using namespace LiteFX::Rendering;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class DrawList::DrawListImpl {
+public:
+    friend class DrawList;
+
+    // Widths of the sort key fields, from the most to the least significant bits. Changing pipelines is the most expensive state change, so it is sorted first.
+    static constexpr UInt32 PIPELINE_BITS       = 10u;
+    static constexpr UInt32 DESCRIPTOR_SET_BITS = 14u;
+    static constexpr UInt32 VERTEX_BUFFER_BITS  = 10u;
+    static constexpr UInt32 INDEX_BUFFER_BITS   = 10u;
+    static constexpr UInt32 PUSH_CONSTANT_BITS  = 8u;
+    static constexpr UInt32 GEOMETRY_BITS       = 12u;
+
+    static_assert(PIPELINE_BITS + DESCRIPTOR_SET_BITS + VERTEX_BUFFER_BITS + INDEX_BUFFER_BITS + PUSH_CONSTANT_BITS + GEOMETRY_BITS == 64u, "The sort key fields must add up to 64 bits.");
+
+    // The radix sort processes one byte of the key per pass.
+    static constexpr UInt32 RADIX_BITS = 8u;
+    static constexpr UInt32 RADIX = 1u << RADIX_BITS;
+    static constexpr UInt32 PASSES = 64u / RADIX_BITS;
+
+    // Draw lists with fewer packets are sorted on the calling thread, as scheduling the passes would take longer than sorting them.
+    static constexpr size_t PARALLEL_SORT_THRESHOLD = 4096u;
+
+    // FNV-1a parameters used to combine states that are identified by multiple values.
+    static constexpr UInt64 FNV_OFFSET = 0xcbf29ce484222325ull;
+    static constexpr UInt64 FNV_PRIME = 0x00000100000001b3ull;
+
+private:
+    Array<DrawPacket> m_packets{};
+    Array<UInt64> m_keys{};
+    Array<DrawPacket> m_draws{};
+    Dictionary<const void*, UInt32> m_pipelineIds{}, m_vertexBufferIds{}, m_indexBufferIds{}, m_pushConstantIds{};
+    Dictionary<UInt64, UInt32> m_descriptorSetIds{}, m_geometryIds{};
+    Statistics m_statistics{};
+    bool m_sorted{ false };
+
+public:
+    DrawListImpl(UInt32 capacity)
+    {
+        m_packets.reserve(capacity);
+        m_keys.reserve(capacity);
+        m_draws.reserve(capacity);
+    }
+
+private:
+    template <typename TKey>
+    static inline UInt64 identify(Dictionary<TKey, UInt32>& ids, const TKey& key, UInt32 bits)
+    {
+        // Identifiers are assigned in the order states are first seen and wrap around, if there are more states than the key field can represent.
+        auto [match, inserted] = ids.try_emplace(key, static_cast<UInt32>(ids.size()));
+        return static_cast<UInt64>(match->second) & ((1ull << bits) - 1ull);
+    }
+
+    static inline UInt64 combine(UInt64 hash, UInt64 value) noexcept
+    {
+        return (hash ^ value) * FNV_PRIME;
+    }
+
+    static inline bool canMerge(const DrawPacket& draw, const DrawPacket& packet) noexcept
+    {
+        return draw.Pipeline == packet.Pipeline && draw.DescriptorSets == packet.DescriptorSets && draw.VertexBuffer == packet.VertexBuffer &&
+            draw.IndexBuffer == packet.IndexBuffer && draw.PushConstantsLayout == packet.PushConstantsLayout && draw.PushConstants == packet.PushConstants &&
+            draw.Elements == packet.Elements && draw.FirstElement == packet.FirstElement && draw.VertexOffset == packet.VertexOffset &&
+            draw.FirstInstance + draw.Instances == packet.FirstInstance;
+    }
+
+public:
+    UInt64 sortKey(const DrawPacket& packet)
+    {
+        auto descriptorSets = std::ranges::fold_left(packet.DescriptorSets, FNV_OFFSET, [](UInt64 hash, const IDescriptorSet* descriptorSet) { return combine(hash, reinterpret_cast<std::uintptr_t>(descriptorSet)); });
+        auto geometry = combine(combine(combine(FNV_OFFSET, packet.Elements), packet.FirstElement), static_cast<UInt32>(packet.VertexOffset));
+
+        UInt64 key = identify(m_pipelineIds, static_cast<const void*>(packet.Pipeline), PIPELINE_BITS);
+        key = (key << DESCRIPTOR_SET_BITS) | identify(m_descriptorSetIds, descriptorSets, DESCRIPTOR_SET_BITS);
+        key = (key << VERTEX_BUFFER_BITS) | identify(m_vertexBufferIds, static_cast<const void*>(packet.VertexBuffer), VERTEX_BUFFER_BITS);
+        key = (key << INDEX_BUFFER_BITS) | identify(m_indexBufferIds, static_cast<const void*>(packet.IndexBuffer), INDEX_BUFFER_BITS);
+        key = (key << PUSH_CONSTANT_BITS) | identify(m_pushConstantIds, packet.PushConstants, PUSH_CONSTANT_BITS);
+        key = (key << GEOMETRY_BITS) | identify(m_geometryIds, geometry, GEOMETRY_BITS);
+
+        return key;
+    }
+
+    void sort(TaskScheduler* scheduler)
+    {
+        using clock_type = std::chrono::steady_clock;
+        auto start = clock_type::now();
+        auto count = m_packets.size();
+
+        // Split the packets into one chunk per worker (and the calling thread), if the list is large enough.
+        size_t chunks = scheduler != nullptr && count >= PARALLEL_SORT_THRESHOLD ? static_cast<size_t>(scheduler->workers()) + 1 : 1;
+        size_t chunkSize = std::max<size_t>((count + chunks - 1) / chunks, 1);
+        chunks = std::max<size_t>((count + chunkSize - 1) / chunkSize, 1);
+
+        auto forEachChunk = [&](auto callback) {
+            if (chunks == 1)
+                callback(0);
+            else
+                scheduler->wait(*scheduler->parallelFor(chunks, callback, 1));
+        };
+
+        // Sort the packet indices by their keys using a stable LSD radix sort. Each pass counts the digits of each chunk, computes the target offsets for each
+        // chunk and then scatters the chunks in parallel. As the chunks are scattered in order, the sort remains stable.
+        Array<UInt64> keys = m_keys, sortedKeys(count);
+        Array<UInt32> order = std::views::iota(0u, static_cast<UInt32>(count)) | std::ranges::to<Array<UInt32>>(), sortedOrder(count);
+        Array<std::array<size_t, RADIX>> histograms(chunks);
+
+        for (UInt32 pass{ 0u }; pass < PASSES; ++pass)
+        {
+            const auto shift = pass * RADIX_BITS;
+
+            forEachChunk([&](size_t chunk) {
+                auto& histogram = histograms[chunk]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                histogram.fill(0);
+
+                for (auto i = chunk * chunkSize; i < std::min(count, (chunk + 1) * chunkSize); ++i)
+                    ++histogram[(keys[i] >> shift) & (RADIX - 1)]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, cppcoreguidelines-pro-bounds-constant-array-index)
+            });
+
+            // Skip the pass, if all keys share the same digit, which is common for the upper bytes. The keys are spread across all chunks, so the digit counts of
+            // all chunks need to be summed up.
+            bool skip{ false };
+
+            for (UInt32 digit{ 0u }; digit < RADIX && !skip; ++digit)
+                skip = std::ranges::fold_left(histograms, size_t{ 0 }, [digit](size_t digits, const auto& histogram) { return digits + histogram[digit]; }) == count; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+            if (skip)
+                continue;
+
+            // Compute the target offsets of each digit for each chunk.
+            size_t offset{ 0 };
+
+            for (UInt32 digit{ 0u }; digit < RADIX; ++digit)
+            {
+                for (auto& histogram : histograms)
+                {
+                    auto digits = histogram[digit]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    histogram[digit] = offset;      // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    offset += digits;
+                }
+            }
+
+            forEachChunk([&](size_t chunk) {
+                auto& offsets = histograms[chunk]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+                for (auto i = chunk * chunkSize; i < std::min(count, (chunk + 1) * chunkSize); ++i)
+                {
+                    auto target = offsets[(keys[i] >> shift) & (RADIX - 1)]++; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, cppcoreguidelines-pro-bounds-constant-array-index)
+                    sortedKeys[target] = keys[i];                              // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                    sortedOrder[target] = order[i];                            // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+                }
+            });
+
+            std::swap(keys, sortedKeys);
+            std::swap(order, sortedOrder);
+        }
+
+        // Merge adjacent draws that only differ in their instance range.
+        m_draws.clear();
+
+        for (auto index : order)
+        {
+            const auto& packet = m_packets[index]; // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+            if (!m_draws.empty() && canMerge(m_draws.back(), packet))
+                m_draws.back().Instances += packet.Instances;
+            else
+                m_draws.push_back(packet);
+        }
+
+        m_sorted = true;
+        m_statistics = {
+            .Packets = static_cast<UInt32>(count),
+            .Draws = static_cast<UInt32>(m_draws.size()),
+            .SortTime = std::chrono::duration<double, std::milli>(clock_type::now() - start).count()
+        };
+    }
+
+    static Statistics record(const ICommandBuffer& commandBuffer, Span<const DrawPacket> draws)
+    {
+        Statistics statistics{};
+        const IRenderPipeline* pipeline{ nullptr };
+        const IVertexBuffer* vertexBuffer{ nullptr };
+        const IIndexBuffer* indexBuffer{ nullptr };
+        const void* pushConstants{ nullptr };
+        std::array<const IDescriptorSet*, MAX_DESCRIPTOR_SETS> descriptorSets{};
+
+        for (const auto& draw : draws)
+        {
+            // Binding another pipeline may invalidate descriptor sets and push constants, so they are set again afterwards.
+            if (draw.Pipeline != pipeline)
+            {
+                commandBuffer.use(*draw.Pipeline);
+                pipeline = draw.Pipeline;
+                pushConstants = nullptr;
+                descriptorSets.fill(nullptr);
+                statistics.PipelineChanges++;
+            }
+
+            for (UInt32 i{ 0u }; i < MAX_DESCRIPTOR_SETS; ++i)
+            {
+                auto descriptorSet = draw.DescriptorSets[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+                if (descriptorSet != nullptr && descriptorSet != descriptorSets[i]) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                {
+                    commandBuffer.bind(*descriptorSet, *pipeline);
+                    descriptorSets[i] = descriptorSet; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                    statistics.DescriptorSetChanges++;
+                }
+            }
+
+            if (draw.VertexBuffer != nullptr && draw.VertexBuffer != vertexBuffer)
+            {
+                commandBuffer.bind(*draw.VertexBuffer);
+                vertexBuffer = draw.VertexBuffer;
+                statistics.VertexBufferChanges++;
+            }
+
+            if (draw.IndexBuffer != nullptr && draw.IndexBuffer != indexBuffer)
+            {
+                commandBuffer.bind(*draw.IndexBuffer);
+                indexBuffer = draw.IndexBuffer;
+                statistics.IndexBufferChanges++;
+            }
+
+            if (draw.PushConstantsLayout != nullptr && draw.PushConstants != pushConstants)
+            {
+                commandBuffer.pushConstants(*draw.PushConstantsLayout, draw.PushConstants);
+                pushConstants = draw.PushConstants;
+                statistics.PushConstantChanges++;
+            }
+
+            if (draw.IndexBuffer != nullptr)
+                commandBuffer.drawIndexed(draw.Elements, draw.Instances, draw.FirstElement, draw.VertexOffset, draw.FirstInstance);
+            else
+                commandBuffer.draw(draw.Elements, draw.Instances, draw.FirstElement, draw.FirstInstance);
+        }
+
+        return statistics;
+    }
+
+    void updateStatistics(Span<const Statistics> ranges, double recordTime) noexcept
+    {
+        m_statistics.PipelineChanges = std::ranges::fold_left(ranges, 0u, [](UInt32 changes, const Statistics& range) { return changes + range.PipelineChanges; });
+        m_statistics.DescriptorSetChanges = std::ranges::fold_left(ranges, 0u, [](UInt32 changes, const Statistics& range) { return changes + range.DescriptorSetChanges; });
+        m_statistics.VertexBufferChanges = std::ranges::fold_left(ranges, 0u, [](UInt32 changes, const Statistics& range) { return changes + range.VertexBufferChanges; });
+        m_statistics.IndexBufferChanges = std::ranges::fold_left(ranges, 0u, [](UInt32 changes, const Statistics& range) { return changes + range.IndexBufferChanges; });
+        m_statistics.PushConstantChanges = std::ranges::fold_left(ranges, 0u, [](UInt32 changes, const Statistics& range) { return changes + range.PushConstantChanges; });
+        m_statistics.RecordTime = recordTime;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+DrawList::DrawList(UInt32 capacity) :
+    m_impl(capacity)
+{
+}
+
+DrawList::DrawList(DrawList&& _other) noexcept = default;
+DrawList& DrawList::operator=(DrawList&& _other) noexcept = default;
+DrawList::~DrawList() noexcept = default;
+
+void DrawList::submit(const DrawPacket& packet)
+{
+    if (packet.Pipeline == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("packet", "The pipeline of the draw packet must be initialized.");
+
+    if ((packet.PushConstantsLayout == nullptr) != (packet.PushConstants == nullptr)) [[unlikely]]
+        throw InvalidArgumentException("packet", "The draw packet must either provide both, push constants memory and a push constants layout, or neither of them.");
+
+    if (packet.Instances == 0u || packet.Elements == 0u)
+        return;
+
+    m_impl->m_keys.push_back(m_impl->sortKey(packet));
+    m_impl->m_packets.push_back(packet);
+    m_impl->m_sorted = false;
+}
+
+void DrawList::clear() noexcept
+{
+    m_impl->m_packets.clear();
+    m_impl->m_keys.clear();
+    m_impl->m_draws.clear();
+    m_impl->m_pipelineIds.clear();
+    m_impl->m_descriptorSetIds.clear();
+    m_impl->m_vertexBufferIds.clear();
+    m_impl->m_indexBufferIds.clear();
+    m_impl->m_pushConstantIds.clear();
+    m_impl->m_geometryIds.clear();
+    m_impl->m_statistics = {};
+    m_impl->m_sorted = false;
+}
+
+UInt32 DrawList::size() const noexcept
+{
+    return static_cast<UInt32>(m_impl->m_packets.size());
+}
+
+Span<const DrawList::DrawPacket> DrawList::draws() const noexcept
+{
+    if (!m_impl->m_sorted)
+        return {};
+
+    return m_impl->m_draws;
+}
+
+void DrawList::sort()
+{
+    m_impl->sort(nullptr);
+}
+
+void DrawList::sort(TaskScheduler& scheduler)
+{
+    m_impl->sort(std::addressof(scheduler));
+}
+
+void DrawList::record(const ICommandBuffer& commandBuffer) const
+{
+    if (!m_impl->m_sorted) [[unlikely]]
+        throw RuntimeException("The draw list must be sorted before it can be recorded.");
+
+    auto start = std::chrono::steady_clock::now();
+    auto statistics = DrawListImpl::record(commandBuffer, m_impl->m_draws);
+    m_impl->updateStatistics(Span<const Statistics>(&statistics, 1), std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+void DrawList::record(const IRenderPass& renderPass, TaskScheduler& scheduler) const
+{
+    if (!m_impl->m_sorted) [[unlikely]]
+        throw RuntimeException("The draw list must be sorted before it can be recorded.");
+
+    auto start = std::chrono::steady_clock::now();
+    Span<const DrawPacket> draws = m_impl->m_draws;
+    const auto buffers = std::min<size_t>(std::max(scheduler.workers(), 1u), draws.size());
+
+    // Record each range into its own command buffer. The command buffers are acquired in order, so the draws are executed in their sorted order.
+    Array<Statistics> statistics(buffers);
+    auto counter = makeShared<TaskCounter>();
+
+    for (size_t i{ 0 }; i < buffers; ++i)
+    {
+        auto first = i * draws.size() / buffers, last = (i + 1) * draws.size() / buffers;
+        scheduler.schedule(counter, [commandBuffer = renderPass.acquireCommandBuffer(), range = draws.subspan(first, last - first), &result = statistics[i]]() { // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+            result = DrawListImpl::record(*commandBuffer, range);
+        });
+    }
+
+    scheduler.wait(*counter);
+    m_impl->updateStatistics(statistics, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+DrawList::Statistics DrawList::statistics() const noexcept
+{
+    return m_impl->m_statistics;
+}
@@ -97,6 +97,11 @@ bool RenderTarget::isVolatile() const noexcept
     return LITEFX_FLAG_IS_SET(m_impl->m_flags, RenderTargetFlags::Volatile);
 }
 
+bool RenderTarget::isTransient() const noexcept
+{
+    return LITEFX_FLAG_IS_SET(m_impl->m_flags, RenderTargetFlags::Transient);
+}
+
 const IRenderTarget::BlendState& RenderTarget::blendState() const noexcept
 {
     return m_impl->m_blendState;
@@ -0,0 +1,247 @@
+#include <litefx/rendering.hpp>
+
+#if defined(_WIN32) || defined(WINCE)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace LiteFX::Rendering;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class ShaderArchive::ShaderArchiveImpl {
+public:
+	friend class ShaderArchive;
+
+private:
+	struct Header {
+		UInt32 magic;
+		UInt32 version;
+		UInt32 entries;
+		UInt32 reserved;
+	};
+
+	struct IndexEntry {
+		UInt64 offset;
+		UInt64 size;
+		UInt32 nameOffset;
+		UInt32 nameLength;
+	};
+
+	static_assert(sizeof(Header) == 16 && sizeof(IndexEntry) == 24, "Unexpected shader archive layout.");
+
+	// Allows looking up entries by string views, without allocating a string for each lookup.
+	struct NameHash {
+		using is_transparent = void;
+
+		size_t operator()(StringView name) const noexcept {
+			return std::hash<StringView>{ }(name);
+		}
+	};
+
+private:
+	String m_fileName;
+	Span<const std::byte> m_data{ };
+	std::unordered_map<String, Span<const std::byte>, NameHash, std::equal_to<>> m_entries{ };
+
+#if defined(_WIN32) || defined(WINCE)
+	HANDLE m_file{ INVALID_HANDLE_VALUE };
+	HANDLE m_mapping{ nullptr };
+#else
+	int m_file{ -1 };
+#endif
+
+public:
+	ShaderArchiveImpl(String fileName) :
+		m_fileName(std::move(fileName))
+	{
+	}
+
+	ShaderArchiveImpl(ShaderArchiveImpl&&) noexcept = delete;
+	ShaderArchiveImpl(const ShaderArchiveImpl&) = delete;
+	ShaderArchiveImpl& operator=(ShaderArchiveImpl&&) noexcept = delete;
+	ShaderArchiveImpl& operator=(const ShaderArchiveImpl&) = delete;
+
+	~ShaderArchiveImpl() noexcept
+	{
+		this->unmap();
+	}
+
+public:
+	void initialize()
+	{
+		this->map();
+
+		try
+		{
+			this->readIndex();
+		}
+		catch (...)
+		{
+			this->unmap();
+			throw;
+		}
+	}
+
+private:
+	void map()
+	{
+#if defined(_WIN32) || defined(WINCE)
+		m_file = ::CreateFileW(::Widen(m_fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+		if (m_file == INVALID_HANDLE_VALUE) [[unlikely]]
+			throw RuntimeException("Unable to open shader archive {0}.", m_fileName);
+
+		LARGE_INTEGER size{};
+
+		if (!::GetFileSizeEx(m_file, &size) || size.QuadPart == 0) [[unlikely]]
+		{
+			this->unmap();
+			throw RuntimeException("Unable to read the size of shader archive {0}.", m_fileName);
+		}
+
+		m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		auto data = m_mapping == nullptr ? nullptr : ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+
+		if (data == nullptr) [[unlikely]]
+		{
+			this->unmap();
+			throw RuntimeException("Unable to map shader archive {0}.", m_fileName);
+		}
+
+		m_data = { static_cast<const std::byte*>(data), static_cast<size_t>(size.QuadPart) };
+#else
+		m_file = ::open(m_fileName.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+		if (m_file < 0) [[unlikely]]
+			throw RuntimeException("Unable to open shader archive {0}.", m_fileName);
+
+		struct stat status{};
+
+		if (::fstat(m_file, &status) != 0 || status.st_size <= 0) [[unlikely]]
+		{
+			this->unmap();
+			throw RuntimeException("Unable to read the size of shader archive {0}.", m_fileName);
+		}
+
+		auto data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, m_file, 0);
+
+		if (data == MAP_FAILED) [[unlikely]]
+		{
+			this->unmap();
+			throw RuntimeException("Unable to map shader archive {0}.", m_fileName);
+		}
+
+		m_data = { static_cast<const std::byte*>(data), static_cast<size_t>(status.st_size) };
+#endif
+	}
+
+	void unmap() noexcept
+	{
+		m_entries.clear();
+
+#if defined(_WIN32) || defined(WINCE)
+		if (!m_data.empty())
+			::UnmapViewOfFile(m_data.data());
+
+		if (m_mapping != nullptr)
+			::CloseHandle(m_mapping);
+
+		if (m_file != INVALID_HANDLE_VALUE)
+			::CloseHandle(m_file);
+
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		if (!m_data.empty())
+			::munmap(const_cast<std::byte*>(m_data.data()), m_data.size()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+		if (m_file >= 0)
+			::close(m_file);
+
+		m_file = -1;
+#endif
+
+		m_data = { };
+	}
+
+	void readIndex()
+	{
+		if (m_data.size() < sizeof(Header)) [[unlikely]]
+			throw RuntimeException("The file {0} is not a valid shader archive.", m_fileName);
+
+		Header header{};
+		std::memcpy(&header, m_data.data(), sizeof(Header));
+
+		if (header.magic != ShaderArchive::MAGIC) [[unlikely]]
+			throw RuntimeException("The file {0} is not a valid shader archive.", m_fileName);
+
+		if (header.version != ShaderArchive::VERSION) [[unlikely]]
+			throw RuntimeException("The shader archive {0} uses an unsupported format version ({1}, expected {2}).", m_fileName, header.version, ShaderArchive::VERSION);
+
+		if (m_data.size() < sizeof(Header) + static_cast<size_t>(header.entries) * sizeof(IndexEntry)) [[unlikely]]
+			throw RuntimeException("The index of shader archive {0} is truncated.", m_fileName);
+
+		m_entries.reserve(header.entries);
+		auto index = m_data.subspan(sizeof(Header));
+
+		for (UInt32 i{ 0 }; i < header.entries; ++i)
+		{
+			IndexEntry entry{};
+			std::memcpy(&entry, index.subspan(static_cast<size_t>(i) * sizeof(IndexEntry)).data(), sizeof(IndexEntry));
+
+			if (static_cast<UInt64>(entry.nameOffset) + entry.nameLength > m_data.size() || entry.offset > m_data.size() || entry.size > m_data.size() - entry.offset) [[unlikely]]
+				throw RuntimeException("The entry {0} of shader archive {1} is out of bounds.", i, m_fileName);
+
+			if (entry.offset % ShaderArchive::ALIGNMENT != 0) [[unlikely]]
+				throw RuntimeException("The entry {0} of shader archive {1} is not properly aligned.", i, m_fileName);
+
+			auto name = m_data.subspan(entry.nameOffset, entry.nameLength);
+			m_entries.emplace(String(reinterpret_cast<const char*>(name.data()), name.size()), m_data.subspan(static_cast<size_t>(entry.offset), static_cast<size_t>(entry.size))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		}
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+ShaderArchive::ShaderArchive(const String& fileName) :
+	m_impl(fileName)
+{
+	m_impl->initialize();
+}
+
+ShaderArchive::~ShaderArchive() noexcept = default;
+
+const String& ShaderArchive::fileName() const noexcept
+{
+	return m_impl->m_fileName;
+}
+
+Array<StringView> ShaderArchive::names() const
+{
+	return m_impl->m_entries | std::views::keys | std::views::transform([](const String& name) { return StringView(name); }) | std::ranges::to<Array<StringView>>();
+}
+
+bool ShaderArchive::contains(StringView name) const noexcept
+{
+	return m_impl->m_entries.contains(name);
+}
+
+Span<const std::byte> ShaderArchive::find(StringView name) const
+{
+	if (auto match = m_impl->m_entries.find(name); match != m_impl->m_entries.end()) [[likely]]
+		return match->second;
+
+	throw InvalidArgumentException("name", "The shader archive {0} does not contain an entry named {1}.", m_impl->m_fileName, name);
+}
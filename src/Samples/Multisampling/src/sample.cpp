@@ -76,10 +76,12 @@ void initRenderGraph(TRenderBackend* backend, SharedPtr<IInputAssembler>& inputA
 
     inputAssemblerState = std::static_pointer_cast<IInputAssembler>(inputAssembler);
 
-    // Create a geometry render pass.
+    // Create a geometry render pass. Both targets are transient: the multi-sampled color target gets resolved into the back buffer and the depth target is not used after 
+    // the render pass. On devices that support lazily allocated memory, this prevents physical memory from being committed for them. The window title shows how much 
+    // attachment memory is transient and how much is regular.
     SharedPtr<RenderPass> renderPass = device->buildRenderPass("Opaque")
-        .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f }) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
-        .renderTarget("Depth/Stencil Target", RenderTargetType::DepthStencil, Format::D32_SFLOAT, RenderTargetFlags::Clear, { 1.f, 0.f, 0.f, 0.f });
+        .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear | RenderTargetFlags::Transient, { 0.1f, 0.1f, 0.1f, 1.f }) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        .renderTarget("Depth/Stencil Target", RenderTargetType::DepthStencil, Format::D32_SFLOAT, RenderTargetFlags::Clear | RenderTargetFlags::Transient, { 1.f, 0.f, 0.f, 0.f });
 
     // Map all render targets to the frame buffer and set the multi-sampling level there.
     std::ranges::for_each(frameBuffers, [&renderPass, &samples](auto& frameBuffer) { frameBuffer->addImages(renderPass->renderTargets(), samples); });
@@ -352,8 +354,18 @@ void SampleApp::updateWindowTitle()
     static auto lastTime = std::chrono::high_resolution_clock::now();
     auto frameTime = std::chrono::duration<float, std::chrono::milliseconds::period>(std::chrono::high_resolution_clock::now() - lastTime).count();
 
+    // Sum up the memory of the frame buffer attachments, separated by transient and regular images. Transient images may never be committed to physical memory.
+    UInt64 transientMemory{ 0 }, regularMemory{ 0 };
+
+    for (UInt32 i{ 0 }; i < m_device->swapChain().buffers(); ++i)
+    {
+        for (const auto& image : m_device->state().frameBuffer(std::format("Frame Buffer {0}", i)).images())
+            (LITEFX_FLAG_IS_SET(image.usage(), ResourceUsage::Transient) ? transientMemory : regularMemory) += image.alignedElementSize();
+    }
+
     std::stringstream title;
     title << this->name() << " | " << "Backend: " << this->activeBackend(BackendType::Rendering)->name() << " | " << static_cast<UInt32>(1000.0f / frameTime) << " FPS"; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    title << " | Attachments: " << (transientMemory >> 20) << " MiB transient, " << (regularMemory >> 20) << " MiB regular"; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 
     ::glfwSetWindowTitle(m_window.get(), title.str().c_str());
     lastTime = std::chrono::high_resolution_clock::now();
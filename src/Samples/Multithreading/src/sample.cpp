@@ -90,8 +90,9 @@ void initRenderGraph(TRenderBackend* backend, SharedPtr<IInputAssembler>& inputA
 
     inputAssemblerState = std::static_pointer_cast<IInputAssembler>(inputAssembler);
 
-    // Create a geometry render pass.
-    SharedPtr<RenderPass> renderPass = device->buildRenderPass("Opaque", NUM_WORKERS)
+    // Create a geometry render pass. The secondary command buffers for multi-threaded recording are acquired from the render pass command buffer pool, so no 
+    // fixed command buffers are required.
+    SharedPtr<RenderPass> renderPass = device->buildRenderPass("Opaque", 0)
         .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f }) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
         .renderTarget("Depth/Stencil Target", RenderTargetType::DepthStencil, Format::D32_SFLOAT, RenderTargetFlags::Clear, { 1.f, 0.f, 0.f, 0.f });
 
@@ -379,7 +380,7 @@ void SampleApp::handleEvents()
     ::glfwPollEvents();
 }
 
-void SampleApp::drawObject(const IRenderPass* renderPass, int index, int backBuffer, float time)
+void SampleApp::drawObject(const ICommandBuffer& commandBuffer, UInt32 index, UInt32 backBuffer, float time)
 {
     // Query state. Be careful here, not to alter the state somewhere else!
     auto& geometryPipeline = m_device->state().pipeline("Geometry");
@@ -389,13 +390,10 @@ void SampleApp::drawObject(const IRenderPass* renderPass, int index, int backBuf
     auto& vertexBuffer = m_device->state().vertexBuffer("Vertex Buffer");
     auto& indexBuffer = m_device->state().indexBuffer("Index Buffer");
 
-    // Acquire command buffer from index.
-    auto commandBuffer = renderPass->commandBuffer(index);
-
     // Set the pipeline on the command buffer.
-    commandBuffer->use(geometryPipeline);
-    commandBuffer->setViewports(m_viewport.get());
-    commandBuffer->setScissors(m_scissor.get());
+    commandBuffer.use(geometryPipeline);
+    commandBuffer.setViewports(m_viewport.get());
+    commandBuffer.setScissors(m_scissor.get());
 
     // Compute world transform and update the transform buffer.
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
@@ -404,14 +402,14 @@ void SampleApp::drawObject(const IRenderPass* renderPass, int index, int backBuf
     // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
     // Bind both descriptor sets to the pipeline.
-    commandBuffer->bind({ &cameraBindings, &transformBindings });
+    commandBuffer.bind({ &cameraBindings, &transformBindings });
 
     // Bind the vertex and index buffers.
-    commandBuffer->bind(vertexBuffer);
-    commandBuffer->bind(indexBuffer);
+    commandBuffer.bind(vertexBuffer);
+    commandBuffer.bind(indexBuffer);
 
     // Record the draw call.
-    commandBuffer->drawIndexed(indexBuffer.elements());
+    commandBuffer.drawIndexed(indexBuffer.elements());
 }
 
 void SampleApp::drawFrame()
@@ -436,9 +434,8 @@ void SampleApp::drawFrame()
     auto now = std::chrono::high_resolution_clock::now();
     auto time = std::chrono::duration<float, std::chrono::seconds::period>(now - start).count();
 
-    // Initialize the worker threads.
-    std::ranges::generate(m_workers, [this, &backBuffer, &time, &renderPass, i = 0]() mutable { return std::async(std::launch::async, &SampleApp::drawObject, this, &renderPass, i++, backBuffer, time); });
-    std::ranges::for_each(m_workers, [](std::future<void>& future) { future.wait(); });
+    // Record the objects in parallel, using the worker threads of the app.
+    renderPass.recordParallel(this->scheduler(), NUM_WORKERS, [this, backBuffer, time](const ICommandBuffer& commandBuffer, UInt32 index) { this->drawObject(commandBuffer, index, backBuffer, time); });
 
     renderPass.end();
 }
\ No newline at end of file
@@ -13,7 +13,6 @@
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3native.h>
 #include <memory>
-#include <future>
 
 #include "config.h"
 
@@ -77,11 +76,6 @@ private:
 	/// </summary>
 	IGraphicsDevice* m_device{};
 
-	/// <summary>
-	/// Stores the array of worker threads.
-	/// </summary>
-	Array<std::future<void>> m_workers = Array<std::future<void>>(NUM_WORKERS);
-
 	/// <summary>
 	/// Stores the fence created at application load time.
 	/// </summary>
@@ -118,7 +112,7 @@ private:
 public:
 	void keyDown(int key, int scancode, int action, int mods);
 	void handleEvents();
-	void drawObject(const IRenderPass* renderPass, int i, int backBuffer, float time);
+	void drawObject(const ICommandBuffer& commandBuffer, UInt32 index, UInt32 backBuffer, float time);
 	void drawFrame();
 	void updateWindowTitle();
 };
\ No newline at end of file
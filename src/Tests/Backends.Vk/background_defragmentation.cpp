@@ -0,0 +1,164 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        auto& factory = _device->factory();
+        auto& transferQueue = _device->defaultQueue(QueueType::Transfer);
+
+        // Allocate a set of buffers and release every second one, so that the remaining ones can be packed more tightly.
+        Array<SharedPtr<IVulkanBuffer>> buffers;
+        UInt32 movingBuffers{ 0u }, movedBuffers{ 0u };
+
+        for (int i = 0; i < 64; ++i)
+            buffers.push_back(factory.createBuffer(BufferType::Storage, ResourceHeap::Resource, 64 * 1024, 1u, ResourceUsage::TransferSource | ResourceUsage::TransferDestination));
+
+        for (int i = 0; i < 64; i += 2)
+            buffers[i].reset();
+
+        std::erase(buffers, nullptr);
+
+        // Fill each remaining buffer with distinct contents, so that the moves can be validated afterwards.
+        constexpr UInt32 ELEMENTS = 64 * 1024 / sizeof(UInt32);
+        auto contents = [](size_t buffer) { return std::views::iota(static_cast<UInt32>(buffer * ELEMENTS), static_cast<UInt32>((buffer + 1) * ELEMENTS)) | std::ranges::to<Array<UInt32>>(); };
+
+        {
+            auto commandBuffer = transferQueue.createCommandBuffer(true);
+
+            for (size_t i{ 0 }; i < buffers.size(); ++i)
+            {
+                auto data = contents(i);
+                commandBuffer->transfer(data.data(), sizeof(UInt32) * data.size(), *buffers[i]);
+            }
+
+            transferQueue.waitFor(transferQueue.submit(commandBuffer));
+        }
+
+        for (auto& buffer : buffers)
+        {
+            buffer->moving += [&movingBuffers](const void* /*sender*/, const IDeviceMemory::ResourceMovingEventArgs& /*args*/) { movingBuffers++; };
+            buffer->moved += [&movedBuffers](const void* /*sender*/, const EventArgs& /*args*/) { movedBuffers++; };
+        }
+
+        // Start defragmenting immediately and move a few buffers in each frame.
+        factory.enableBackgroundDefragmentation({ .MaxAllocationsPerFrame = 4u, .MemoryPressureThreshold = 1.f, .FragmentationThreshold = 0.f, .Cooldown = 0u });
+
+        if (!factory.backgroundDefragmentationEnabled())
+            LITEFX_TEST_FAIL("!factory.backgroundDefragmentationEnabled()");
+
+        // Manual defragmentation is not available while the background defragmentation is enabled.
+        try
+        {
+            factory.beginDefragmentation(transferQueue);
+            LITEFX_TEST_FAIL("beginDefragmentation succeeded where it shouldn't.");
+        }
+        catch (const RuntimeException& /*ex*/)
+        {
+        }
+
+        // The device does not present, so advance the frames manually. Passes are only finished after the transfer queue has executed them.
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            auto previouslyMoving = movingBuffers;
+            factory.updateBackgroundDefragmentation();
+
+            if (movingBuffers - previouslyMoving > 4u)
+                LITEFX_TEST_FAIL("movingBuffers - previouslyMoving > 4u");
+
+            transferQueue.waitFor(transferQueue.currentFence());
+        }
+
+        factory.disableBackgroundDefragmentation();
+
+        if (factory.backgroundDefragmentationEnabled())
+            LITEFX_TEST_FAIL("factory.backgroundDefragmentationEnabled()");
+
+        // Disabling waits for the last pass, so each buffer that started moving has also been moved.
+        if (movedBuffers != movingBuffers)
+            LITEFX_TEST_FAIL("movedBuffers != movingBuffers");
+
+        if (movingBuffers == 0u)
+            LITEFX_TEST_FAIL("movingBuffers == 0u");
+
+        // The moved buffers must still contain their original contents.
+        auto readbackBuffer = factory.createBuffer("Readback Buffer", BufferType::Other, ResourceHeap::Readback, sizeof(UInt32) * ELEMENTS, 1u, ResourceUsage::TransferDestination);
+        Array<UInt32> result(ELEMENTS);
+
+        for (size_t i{ 0 }; i < buffers.size(); ++i)
+        {
+            auto commandBuffer = transferQueue.createCommandBuffer(true);
+            commandBuffer->transfer(*buffers[i], *readbackBuffer);
+            transferQueue.waitFor(transferQueue.submit(commandBuffer));
+
+            readbackBuffer->map(result.data(), sizeof(UInt32) * result.size(), 0, false);
+
+            if (result != contents(i))
+                LITEFX_TEST_FAIL("A buffer does not contain its original contents after it has been moved.");
+        }
+
+        buffers.clear();
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,189 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr, GraphicsDeviceFeatures { .RayTracing = true }).shared_from_this();
+
+        // Upload a single bounding box, that is used as the geometry of all acceleration structures.
+        const std::array<Float, 6> boundingBox { -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f };
+        auto& queue = _device->defaultQueue(QueueType::Compute);
+        auto commandBuffer = queue.createCommandBuffer(true);
+        auto boundingBoxBuffer = _device->factory().createBuffer("Bounding Box", BufferType::Storage, ResourceHeap::Resource, sizeof(boundingBox), 1u, ResourceUsage::TransferDestination | ResourceUsage::AccelerationStructureBuildInput);
+        commandBuffer->transfer(boundingBox.data(), sizeof(boundingBox), *boundingBoxBuffer);
+
+        auto barrier = _device->makeBarrier(PipelineStage::Transfer, PipelineStage::AccelerationStructureBuild);
+        barrier->transition(*boundingBoxBuffer, ResourceAccess::TransferWrite, ResourceAccess::Common);
+        commandBuffer->barrier(*barrier);
+        queue.waitFor(commandBuffer->submit());
+
+        // Queue three acceleration structures that allow compaction and one that does not.
+        auto batch = VulkanBottomLevelAccelerationStructureBatch::create(queue, 1);
+        Array<SharedPtr<VulkanBottomLevelAccelerationStructure>> accelerationStructures;
+
+        for (UInt32 i{ 0 }; i < 4; ++i)
+        {
+            auto flags = i < 3 ? AccelerationStructureFlags::AllowCompaction : AccelerationStructureFlags::None;
+            auto& blas = accelerationStructures.emplace_back(LiteFX::asShared(_device->factory().createBottomLevelAccelerationStructure(std::format("BLAS {0}", i), flags)));
+            blas->withBoundingBox(boundingBoxBuffer);
+            batch->add(blas);
+        }
+
+        if (batch->queued() != 4 || batch->idle())
+            LITEFX_TEST_FAIL("The acceleration structures have not been queued.");
+
+        UInt32 compactedEvents{ 0 };
+        batch->compacted.add([&compactedEvents](const void* /*sender*/, const EventArgs& /*args*/) { compactedEvents++; });
+
+        // All acceleration structures of a build are stored in a single buffer.
+        auto fence = batch->build();
+
+        if (batch->queued() != 0 || fence == 0)
+            LITEFX_TEST_FAIL("The batch has not been built.");
+
+        auto buildBuffer = accelerationStructures.front()->buffer();
+        auto builtHandles = accelerationStructures | std::views::transform([](const auto& blas) { return blas->handle(); }) | std::ranges::to<Array<VkAccelerationStructureKHR>>();
+        auto builtSizes = accelerationStructures | std::views::transform([](const auto& blas) { return blas->size(); }) | std::ranges::to<Array<UInt64>>();
+
+        if (buildBuffer == nullptr || std::ranges::any_of(accelerationStructures, [&buildBuffer](const auto& blas) { return blas->buffer() != buildBuffer || blas->handle() == VK_NULL_HANDLE || blas->offset() % 256 != 0; }))
+            LITEFX_TEST_FAIL("The acceleration structures of the batch do not share a single buffer.");
+
+        // Re-building an acceleration structure before the batch compacts it invalidates its compacted size, so it must not be compacted anymore.
+        auto rebuiltBuffer = _device->factory().createBuffer("Re-built BLAS", BufferType::AccelerationStructure, ResourceHeap::Resource, builtSizes[2], 1u, ResourceUsage::AllowWrite);
+        commandBuffer = queue.createCommandBuffer(true);
+        accelerationStructures[2]->build(*commandBuffer, nullptr, rebuiltBuffer, 0, builtSizes[2]);
+        queue.waitFor(commandBuffer->submit());
+        auto rebuiltHandle = accelerationStructures[2]->handle();
+
+        if (rebuiltHandle == builtHandles[2] || accelerationStructures[2]->buffer() != rebuiltBuffer)
+            LITEFX_TEST_FAIL("The acceleration structure has not been re-built into its own buffer.");
+
+        // Compact and release memory until the batch becomes idle. This never waits, so wait for the queue in between.
+        UInt32 compacted{ 0 };
+
+        for (UInt32 frame{ 0 }; !batch->idle(); ++frame)
+        {
+            if (frame > 100)
+                LITEFX_TEST_FAIL("The batch did not become idle.");
+
+            queue.waitFor(queue.currentFence());
+            compacted += batch->update();
+        }
+
+        auto statistics = batch->statistics();
+
+        if (statistics.Builds != 1 || statistics.AccelerationStructures != 4 || statistics.BuildSize == 0 || statistics.ScratchSize == 0)
+            LITEFX_TEST_FAIL("The build statistics have not been recorded.");
+
+        if (compacted == 0 || compacted > 2 || statistics.Compacted != compacted || compactedEvents == 0)
+            LITEFX_TEST_FAIL("The acceleration structures have not been compacted.");
+
+        // Compacted acceleration structures get a new handle and are moved into a new buffer. The others keep their original state.
+        UInt32 swapped{ 0 };
+        UInt64 savedMemory{ 0 };
+
+        for (UInt32 i{ 0 }; i < 4; ++i)
+        {
+            const auto& blas = accelerationStructures[i];
+
+            if (i == 2)
+            {
+                if (blas->handle() != rebuiltHandle || blas->buffer() != rebuiltBuffer)
+                    LITEFX_TEST_FAIL("An acceleration structure has been compacted after it has been re-built.");
+
+                continue;
+            }
+
+            if (blas->handle() == builtHandles[i])
+            {
+                if (blas->buffer() != buildBuffer || blas->size() != builtSizes[i])
+                    LITEFX_TEST_FAIL("An acceleration structure has been moved without receiving a new handle.");
+
+                continue;
+            }
+
+            if (i == 3)
+                LITEFX_TEST_FAIL("An acceleration structure that does not allow compaction has been compacted.");
+
+            if (blas->buffer() == nullptr || blas->buffer() == buildBuffer || blas->size() >= builtSizes[i])
+                LITEFX_TEST_FAIL("A compacted acceleration structure has not been moved into a smaller buffer range.");
+
+            swapped++;
+            savedMemory += builtSizes[i] - blas->size();
+        }
+
+        if (swapped != statistics.Compacted || savedMemory != statistics.SavedMemory)
+            LITEFX_TEST_FAIL("The compaction statistics do not match the compacted acceleration structures.");
+
+        // The compacted acceleration structures must still be usable to build a top-level acceleration structure.
+        auto tlas = _device->factory().createTopLevelAccelerationStructure("TLAS");
+
+        for (UInt32 i{ 0 }; i < 4; ++i)
+            tlas->insert({ .BottomLevelAccelerationStructure = accelerationStructures[i], .Id = i });
+
+        commandBuffer = queue.createCommandBuffer(true);
+        tlas->build(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
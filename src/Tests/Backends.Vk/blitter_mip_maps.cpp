@@ -0,0 +1,236 @@
+#include "common.h"
+#include <litefx/graphics.hpp>
+#include <filesystem>
+#include <bit>
+#include <cmath>
+
+using namespace LiteFX::Graphics;
+
+SharedPtr<VulkanDevice> _device;
+
+// Reference sRGB transfer functions, used to compute the expected average of sRGB encoded texels.
+Float decodeSRGB(Float color)
+{
+    return color < 0.04045f ? color / 12.92f : std::pow((color + 0.055f) / 1.055f, 2.4f);
+}
+
+Float encodeSRGB(Float color)
+{
+    return color < 0.0031308f ? color * 12.92f : 1.055f * std::pow(color, 1.f / 2.4f) - 0.055f;
+}
+
+// Each layer is filled with a checkerboard of two values, which is reduced to a single value for each filter. Uniform layers use the same value for both fields.
+struct LayerPattern {
+    UInt8 Low;
+    UInt8 High;
+};
+
+UInt8 expectedValue(const LayerPattern& pattern, MipMapReduction reduction, bool srgb, UInt32 channel)
+{
+    switch (reduction)
+    {
+    case MipMapReduction::Minimum: return pattern.Low;
+    case MipMapReduction::Maximum: return pattern.High;
+    default: break;
+    }
+
+    // Alpha is never sRGB encoded.
+    if (!srgb || channel == 3)
+        return static_cast<UInt8>(std::lround((pattern.Low + pattern.High) / 2.f));
+
+    auto linear = (decodeSRGB(pattern.Low / 255.f) + decodeSRGB(pattern.High / 255.f)) / 2.f;
+    return static_cast<UInt8>(std::lround(encodeSRGB(linear) * 255.f));
+}
+
+// Uploads the patterns into the first level of each layer, generates the mip maps and reads back all levels of all layers, indexed by sub-resource ID.
+Array<Array<UInt8>> generateAndReadBack(Blitter<VulkanBackend>& blitter, IVulkanImage& image, const Array<LayerPattern>& patterns, MipMapReduction reduction)
+{
+    auto& queue = _device->defaultQueue(QueueType::Graphics);
+    auto commandBuffer = queue.createCommandBuffer(true);
+
+    auto barrier = _device->makeBarrier(PipelineStage::None, PipelineStage::Transfer);
+    barrier->transition(image, ResourceAccess::None, ResourceAccess::TransferWrite, ImageLayout::Undefined, ImageLayout::CopyDestination);
+    commandBuffer->barrier(*barrier);
+
+    const auto width = static_cast<UInt32>(image.extent().width());
+    const auto height = static_cast<UInt32>(image.extent().height());
+
+    for (UInt32 layer{ 0 }; layer < image.layers(); ++layer)
+    {
+        Array<UInt8> texels(image.size(0));
+
+        for (UInt32 y{ 0 }; y < height; ++y)
+            for (UInt32 x{ 0 }; x < width; ++x)
+                std::fill_n(texels.begin() + 4 * (y * width + x), 4, (x + y) % 2 ? patterns[layer].High : patterns[layer].Low);
+
+        commandBuffer->transfer(texels.data(), texels.size(), image, image.subresourceId(0, layer, 0));
+    }
+
+    blitter.generateMipMaps(image, *commandBuffer, reduction);
+
+    // All levels are shader resources after the mip maps have been generated.
+    auto readbackBuffer = _device->factory().createBuffer(BufferType::Other, ResourceHeap::Readback, image.size(0), image.elements(), ResourceUsage::TransferDestination);
+    barrier = _device->makeBarrier(PipelineStage::All, PipelineStage::Transfer);
+    barrier->transition(image, ResourceAccess::ShaderRead, ResourceAccess::TransferRead, ImageLayout::ShaderResource, ImageLayout::CopySource);
+    commandBuffer->barrier(*barrier);
+    commandBuffer->transfer(image, *readbackBuffer, 0, 0, image.elements());
+    queue.waitFor(commandBuffer->submit());
+
+    Array<Array<UInt8>> subresources(image.elements());
+
+    for (UInt32 layer{ 0 }; layer < image.layers(); ++layer)
+    {
+        for (UInt32 level{ 0 }; level < image.levels(); ++level)
+        {
+            auto& texels = subresources[image.subresourceId(level, layer, 0)];
+            texels.resize(image.size(level));
+            readbackBuffer->map(texels.data(), texels.size(), image.subresourceId(level, layer, 0), false);
+        }
+    }
+
+    return subresources;
+}
+
+// Returns `true`, if every texel of every generated level matches the expected value of its layer. Rounding and the shader's sRGB approximation may introduce small errors.
+bool checkMipMaps(const IVulkanImage& image, const Array<Array<UInt8>>& subresources, const Array<LayerPattern>& patterns, MipMapReduction reduction, bool srgb)
+{
+    for (UInt32 layer{ 0 }; layer < image.layers(); ++layer)
+    {
+        for (UInt32 level{ 1 }; level < image.levels(); ++level)
+        {
+            const auto& texels = subresources[image.subresourceId(level, layer, 0)];
+
+            for (size_t i{ 0 }; i < texels.size(); ++i)
+            {
+                auto expected = expectedValue(patterns[layer], reduction, srgb, static_cast<UInt32>(i % 4));
+
+                if (std::abs(static_cast<Int32>(texels[i]) - static_cast<Int32>(expected)) > 2)
+                {
+                    LITEFX_ERROR(TEST_LOG, "Texel {0} of level {1} in layer {2} is {3}, but {4} was expected.", i / 4, level, layer, texels[i], expected);
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device on a headless surface, so that the graphics queue is available for the blit fallback.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createHeadlessSurface();
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, Size2d(800, 600), 3, false).shared_from_this();
+
+        auto blitter = Blitter<VulkanBackend>::create(*_device);
+        auto& factory = _device->factory();
+        const Array<LayerPattern> patterns { { 0, 255 }, { 32, 128 } };
+        const Array<LayerPattern> uniform { { 200, 200 }, { 100, 100 } };
+
+        // Images with non-power-of-two sizes and array layers are reduced by the compute shader, if they allow write access. The size requires more than six levels, so that
+        // the last work group generates the remaining levels.
+        const Size3d size { 300, 170, 1 };
+        const auto levels = static_cast<UInt32>(std::bit_width(300u));
+
+        for (auto reduction : { MipMapReduction::Average, MipMapReduction::Minimum, MipMapReduction::Maximum })
+        {
+            auto image = factory.createTexture(Format::R8G8B8A8_UNORM, size, ImageDimensions::DIM_2, levels, 2, MultiSamplingLevel::x1, ResourceUsage::AllowWrite | ResourceUsage::TransferDestination | ResourceUsage::TransferSource);
+
+            if (!checkMipMaps(*image, generateAndReadBack(*blitter, *image, patterns, reduction), patterns, reduction, false))
+                LITEFX_TEST_FAIL("The mip maps of the writable image do not match the reduction.");
+        }
+
+        // sRGB images are averaged in linear space.
+        for (auto reduction : { MipMapReduction::Average, MipMapReduction::Maximum })
+        {
+            auto image = factory.createTexture(Format::R8G8B8A8_SRGB, size, ImageDimensions::DIM_2, levels, 2, MultiSamplingLevel::x1, ResourceUsage::AllowWrite | ResourceUsage::TransferDestination | ResourceUsage::TransferSource);
+
+            if (!checkMipMaps(*image, generateAndReadBack(*blitter, *image, patterns, reduction), patterns, reduction, true))
+                LITEFX_TEST_FAIL("The mip maps of the sRGB image have not been computed in linear space.");
+        }
+
+        // Images that do not allow write access fall back to blitting. The filter only matches a box filter, if each level is exactly half the size of the previous one.
+        auto blitImage = factory.createTexture(Format::R8G8B8A8_UNORM, Size3d{ 32, 16, 1 }, ImageDimensions::DIM_2, 6, 2, MultiSamplingLevel::x1, ResourceUsage::TransferDestination | ResourceUsage::TransferSource);
+
+        if (!checkMipMaps(*blitImage, generateAndReadBack(*blitter, *blitImage, patterns, MipMapReduction::Average), patterns, MipMapReduction::Average, false))
+            LITEFX_TEST_FAIL("The blitted mip maps do not match the average of the base level.");
+
+        blitImage = factory.createTexture(Format::R8G8B8A8_UNORM, size, ImageDimensions::DIM_2, levels, 2, MultiSamplingLevel::x1, ResourceUsage::TransferDestination | ResourceUsage::TransferSource);
+
+        if (!checkMipMaps(*blitImage, generateAndReadBack(*blitter, *blitImage, uniform, MipMapReduction::Average), uniform, MipMapReduction::Average, false))
+            LITEFX_TEST_FAIL("Not all levels of the blitted image with non-power-of-two size have been written.");
+
+        // Blitting does not support other reductions than average.
+        for (auto reduction : { MipMapReduction::Minimum, MipMapReduction::Maximum })
+        {
+            auto commandBuffer = _device->defaultQueue(QueueType::Graphics).createCommandBuffer(true);
+
+            try
+            {
+                blitter->generateMipMaps(*blitImage, *commandBuffer, reduction);
+                LITEFX_TEST_FAIL("A reduction other than average has been accepted for an image that does not allow write access.");
+            }
+            catch (const InvalidArgumentException&)
+            {
+            }
+        }
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup instance extensions and validation layers. No window is required, as the device is created on a headless surface.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
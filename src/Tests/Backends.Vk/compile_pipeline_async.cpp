@@ -0,0 +1,115 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        // Create the shader program.
+        SharedPtr<VulkanShaderProgram> shaderProgram = _device->buildShaderProgram()
+            .withComputeShaderModule("shaders/test_cs.spv");
+
+        auto layout = shaderProgram->reflectPipelineLayout();
+
+        // Compile multiple pipelines concurrently. The builders return before the pipeline states have been compiled.
+        auto pipelines = std::views::iota(0u, 4u)
+            | std::views::transform([&](UInt32 index) -> UniquePtr<VulkanComputePipeline> {
+                return _device->buildComputePipeline(std::format("Compute {0}", index))
+                    .layout(layout)
+                    .shaderProgram(shaderProgram)
+                    .compileAsync();
+            })
+            | std::ranges::to<Array<UniquePtr<VulkanComputePipeline>>>();
+
+        // Waiting for a pipeline makes it ready and its handle valid.
+        for (const auto& pipeline : pipelines)
+        {
+            pipeline->wait();
+
+            if (!pipeline->isReady())
+                LITEFX_TEST_FAIL("!pipeline->isReady()");
+
+            if (std::as_const(*pipeline).handle() == VK_NULL_HANDLE)
+                LITEFX_TEST_FAIL("std::as_const(*pipeline).handle() == VK_NULL_HANDLE");
+
+            // Waiting again returns immediately.
+            pipeline->wait();
+        }
+
+        // Use the compiled pipelines on a command buffer.
+        auto& queue = _device->defaultQueue(QueueType::Compute);
+        auto commandBuffer = queue.createCommandBuffer(true);
+
+        for (const auto& pipeline : pipelines)
+            commandBuffer->use(*pipeline);
+
+        queue.waitFor(commandBuffer->submit());
+
+        // Synchronously compiled pipelines are ready immediately.
+        UniquePtr<VulkanComputePipeline> pipeline = _device->buildComputePipeline("Compute")
+            .layout(layout)
+            .shaderProgram(shaderProgram);
+
+        if (!pipeline->isReady() || std::as_const(*pipeline).handle() == VK_NULL_HANDLE)
+            LITEFX_TEST_FAIL("A synchronously compiled pipeline is not ready.");
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        if (!_device->computeOnly())
+            LITEFX_TEST_FAIL("!_device->computeOnly()");
+
+        // Compute-only devices must not provide a graphics queue.
+        try
+        {
+            std::ignore = _device->defaultQueue(QueueType::Graphics);
+            LITEFX_TEST_FAIL("A compute-only device returned a graphics queue.");
+        }
+        catch (const RuntimeException&)
+        {
+        }
+
+        // Compute-only devices do not have a surface and their swap chain does not provide back buffer images.
+        try
+        {
+            std::ignore = _device->surface();
+            LITEFX_TEST_FAIL("A compute-only device returned a surface.");
+        }
+        catch (const RuntimeException&)
+        {
+        }
+
+        try
+        {
+            std::ignore = _device->swapChain().image();
+            LITEFX_TEST_FAIL("The swap chain of a compute-only device returned a back buffer image.");
+        }
+        catch (const RuntimeException&)
+        {
+        }
+
+        // Run a few frames on the compute queue and make sure the timing events are resolved without a swap chain.
+        auto& swapChain = _device->swapChain();
+        auto timingEvent = swapChain.registerTimingEvent("Compute");
+        auto& queue = _device->defaultQueue(QueueType::Compute);
+
+        for (UInt32 frame{ 0 }; frame < 3 * swapChain.buffers(); ++frame)
+        {
+            std::ignore = swapChain.swapBackBuffer();
+
+            auto commandBuffer = queue.createCommandBuffer(true);
+            commandBuffer->writeTimingEvent(timingEvent);
+            std::ignore = queue.submit(commandBuffer);
+        }
+
+        _device->wait();
+
+        // Resetting the swap chain only changes the number of frames in flight. This must also work when the interop swap chain is enabled.
+        if (!(swapChain.presentModes() | std::ranges::to<Array<VkPresentModeKHR>>()).empty())
+            LITEFX_TEST_FAIL("The swap chain of a compute-only device reported present modes.");
+
+        swapChain.reset(swapChain.surfaceFormat(), swapChain.renderArea(), swapChain.buffers() + 1);
+
+        for (UInt32 frame{ 0 }; frame < 2 * swapChain.buffers(); ++frame)
+        {
+            std::ignore = swapChain.swapBackBuffer();
+            std::ignore = queue.submit(queue.createCommandBuffer(true));
+        }
+
+        _device->wait();
+
+        // Presenting is not possible without a surface.
+        try
+        {
+            swapChain.present(queue.currentFence());
+            LITEFX_TEST_FAIL("A compute-only device presented a frame.");
+        }
+        catch (const RuntimeException&)
+        {
+        }
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
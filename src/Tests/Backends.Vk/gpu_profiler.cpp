@@ -0,0 +1,139 @@
+#include "common.h"
+#include <filesystem>
+#include <sstream>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a compute-only device, so that no window is required.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        // Record nested scopes on the compute queue for a few frames.
+        auto profiler = VulkanProfiler::create(*_device);
+        auto& queue = _device->defaultQueue(QueueType::Compute);
+        const auto frames = 3 * (_device->swapChain().buffers() + 1);
+
+        for (UInt32 frame{ 0 }; frame < frames; ++frame)
+        {
+            std::ignore = _device->swapChain().swapBackBuffer();
+
+            auto commandBuffer = queue.createCommandBuffer(true);
+
+            {
+                auto outer = profiler->scope(*commandBuffer, "Outer");
+                auto inner = profiler->scope(*commandBuffer, "Inner");
+            }
+
+            std::ignore = queue.submit(commandBuffer);
+        }
+
+        _device->wait();
+        profiler->nextFrame();
+
+        // Check that the frames have been resolved and the nesting has been preserved.
+        auto lastFrame = profiler->lastFrame();
+
+        if (!lastFrame.has_value())
+            LITEFX_TEST_FAIL("!lastFrame.has_value()");
+
+        if (lastFrame->Scopes.size() != 2)
+            LITEFX_TEST_FAIL("lastFrame->Scopes.size() != 2");
+
+        const auto& outer = lastFrame->Scopes[0];
+        const auto& inner = lastFrame->Scopes[1];
+
+        if (outer.Name != "Outer" || outer.Depth != 0 || outer.Parent.has_value())
+            LITEFX_TEST_FAIL("outer.Name != \"Outer\" || outer.Depth != 0 || outer.Parent.has_value()");
+
+        if (inner.Name != "Inner" || inner.Depth != 1 || inner.Parent != 0u)
+            LITEFX_TEST_FAIL("inner.Name != \"Inner\" || inner.Depth != 1 || inner.Parent != 0u");
+
+        if (outer.duration() < 0.0 || inner.Begin < outer.Begin || inner.End > outer.End)
+            LITEFX_TEST_FAIL("outer.duration() < 0.0 || inner.Begin < outer.Begin || inner.End > outer.End");
+
+        // Export the trace.
+        std::stringstream trace;
+        profiler->exportChromeTrace(trace);
+
+        if (!trace.str().starts_with("{\"traceEvents\":[") || trace.str().find("\"name\":\"Inner\"") == String::npos)
+            LITEFX_TEST_FAIL("The exported trace does not contain the recorded scopes.");
+
+        profiler.reset();
+
+        // Releasing a profiler with frames in flight must wait for them, before their query pools are destroyed.
+        profiler = VulkanProfiler::create(*_device);
+
+        for (UInt32 frame{ 0 }; frame < 2; ++frame)
+        {
+            std::ignore = _device->swapChain().swapBackBuffer();
+
+            auto commandBuffer = queue.createCommandBuffer(true);
+
+            {
+                auto scope = profiler->scope(*commandBuffer, "In Flight");
+            }
+
+            std::ignore = queue.submit(commandBuffer);
+        }
+
+        profiler.reset();
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
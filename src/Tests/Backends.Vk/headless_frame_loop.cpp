@@ -0,0 +1,116 @@
+#include "common.h"
+#include <filesystem>
+#include <set>
+
+#define FRAMEBUFFER_WIDTH  800
+#define FRAMEBUFFER_HEIGHT 600
+
+SharedPtr<Viewport> _viewport;
+SharedPtr<Scissor> _scissor;
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Create viewport and scissors.
+        _viewport = makeShared<Viewport>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+        _scissor = makeShared<Scissor>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+
+        // Find adapter and create a headless surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createHeadlessSurface();
+
+        // Create the device.
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, _viewport->getRectangle().extent(), 3, false).shared_from_this();
+
+        // Create a render pass that only clears and presents the back buffer.
+        SharedPtr<VulkanRenderPass> renderPass = _device->buildRenderPass("Present")
+            .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f });
+
+        // Create one frame buffer per back buffer.
+        auto frameBuffers = std::views::iota(0u, _device->swapChain().buffers()) 
+            | std::views::transform([&renderPass](UInt32 index) {
+                auto frameBuffer = _device->makeFrameBuffer(std::format("Frame Buffer {0}", index), _device->swapChain().renderArea());
+                frameBuffer->addImages(renderPass->renderTargets());
+                return frameBuffer;
+            })
+            | std::ranges::to<Array<SharedPtr<VulkanFrameBuffer>>>();
+
+        // Run a few frames. The presentation engine may return the back buffers in any order and is not required to use all of them, so only check that each 
+        // acquired image belongs to the swap chain.
+        std::set<const IVulkanImage*> acquired;
+
+        for (UInt32 frame{ 0 }; frame < 3 * frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = _device->swapChain().swapBackBuffer();
+
+            if (backBuffer >= frameBuffers.size())
+                LITEFX_TEST_FAIL("backBuffer >= frameBuffers.size()");
+
+            acquired.insert(_device->swapChain().image(backBuffer));
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->end();
+        }
+
+        _device->wait();
+
+        const auto& images = _device->swapChain().images();
+
+        if (acquired.empty() || !std::ranges::all_of(acquired, [&images](const IVulkanImage* image) { return std::ranges::any_of(images, [image](const auto& backBuffer) { return backBuffer.get() == image; }); }))
+            LITEFX_TEST_FAIL("The acquired back buffers are not a subset of the swap chain images.");
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup instance extensions and validation layers. No window is required, as the device is created on a headless surface.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        auto& factory = _device->factory();
+
+        // Invalid thresholds are rejected.
+        try
+        {
+            factory.setMemoryBudgetThresholds({ .Soft = 0.9f, .Hard = 0.5f });
+            LITEFX_TEST_FAIL("setMemoryBudgetThresholds succeeded where it shouldn't.");
+        }
+        catch (const InvalidArgumentException& /*ex*/)
+        {
+        }
+
+        // Register eviction handlers in reverse priority order. They must be invoked in ascending order of their priorities.
+        Array<UInt32> invokedHandlers;
+        auto highPriority = factory.registerEvictionHandler(10u, [&invokedHandlers](UInt32 /*heap*/, UInt64 /*bytes*/) -> UInt64 { invokedHandlers.push_back(10u); return 0u; });
+        auto lowPriority = factory.registerEvictionHandler(1u, [&invokedHandlers](UInt32 /*heap*/, UInt64 /*bytes*/) -> UInt64 { invokedHandlers.push_back(1u); return 0u; });
+
+        // Lower the thresholds, so that any heap in use exceeds them.
+        UInt32 budgetEvents{ 0u };
+        factory.memoryBudgetChanged += [&budgetEvents](const void* /*sender*/, const VulkanGraphicsFactory::MemoryBudgetEventArgs& args) {
+            if (args.level() != VulkanGraphicsFactory::MemoryBudgetLevel::Hard)
+                LITEFX_TEST_FAIL("args.level() != VulkanGraphicsFactory::MemoryBudgetLevel::Hard");
+
+            budgetEvents++;
+        };
+
+        factory.setMemoryBudgetThresholds({ .Soft = 0.f, .Hard = 0.f });
+        auto buffer = factory.createBuffer(BufferType::Storage, ResourceHeap::Resource, 1024 * 1024);
+        factory.updateMemoryBudget();
+
+        if (budgetEvents == 0u)
+            LITEFX_TEST_FAIL("budgetEvents == 0u");
+
+        if (invokedHandlers.size() < 2 || invokedHandlers[0] != 1u || invokedHandlers[1] != 10u)
+            LITEFX_TEST_FAIL("Eviction handlers have not been invoked in order of their priorities.");
+
+        // Heaps remain at their level, so subsequent updates do not raise the event again, but still request eviction.
+        auto previousEvents = budgetEvents;
+        invokedHandlers.clear();
+
+        if (!factory.unregisterEvictionHandler(lowPriority) || factory.unregisterEvictionHandler(lowPriority))
+            LITEFX_TEST_FAIL("Unable to unregister eviction handler.");
+
+        factory.updateMemoryBudget();
+
+        if (budgetEvents != previousEvents)
+            LITEFX_TEST_FAIL("budgetEvents != previousEvents");
+
+        if (invokedHandlers.empty() || std::ranges::any_of(invokedHandlers, [](UInt32 priority) { return priority != 10u; }))
+            LITEFX_TEST_FAIL("Unregistered eviction handler has been invoked.");
+
+        factory.unregisterEvictionHandler(highPriority);
+        buffer.reset();
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
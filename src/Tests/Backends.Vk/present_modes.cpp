@@ -0,0 +1,139 @@
+#include "common.h"
+#include <filesystem>
+
+#define FRAMEBUFFER_WIDTH  800
+#define FRAMEBUFFER_HEIGHT 600
+
+SharedPtr<Viewport> _viewport;
+SharedPtr<Scissor> _scissor;
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Create viewport and scissors.
+        _viewport = makeShared<Viewport>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+        _scissor = makeShared<Scissor>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+
+        // Find adapter and create a headless surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createHeadlessSurface();
+
+        // Create the device.
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, _viewport->getRectangle().extent(), 3, false).shared_from_this();
+
+        // Create a render pass that only clears and presents the back buffer.
+        SharedPtr<VulkanRenderPass> renderPass = _device->buildRenderPass("Present")
+            .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f });
+
+        // Create one frame buffer per back buffer.
+        auto frameBuffers = std::views::iota(0u, _device->swapChain().buffers()) 
+            | std::views::transform([&renderPass](UInt32 index) {
+                auto frameBuffer = _device->makeFrameBuffer(std::format("Frame Buffer {0}", index), _device->swapChain().renderArea());
+                frameBuffer->addImages(renderPass->renderTargets());
+                return frameBuffer;
+            })
+            | std::ranges::to<Array<SharedPtr<VulkanFrameBuffer>>>();
+
+        // The selected present mode must always be supported by the surface, even if the requested one is not.
+        auto& swapChain = _device->swapChain();
+        auto presentModes = swapChain.presentModes() | std::ranges::to<Array<VkPresentModeKHR>>();
+
+        if (!std::ranges::contains(presentModes, VK_PRESENT_MODE_FIFO_KHR))
+            LITEFX_TEST_FAIL("!std::ranges::contains(presentModes, VK_PRESENT_MODE_FIFO_KHR)");
+
+        for (auto presentMode : { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_FIFO_RELAXED_KHR, VK_PRESENT_MODE_FIFO_KHR })
+        {
+            swapChain.setPresentMode(presentMode);
+
+            if (!std::ranges::contains(presentModes, swapChain.presentMode()))
+                LITEFX_TEST_FAIL("!std::ranges::contains(presentModes, swapChain.presentMode())");
+
+            if (swapChain.verticalSynchronization() != (presentMode == VK_PRESENT_MODE_FIFO_KHR || presentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR))
+                LITEFX_TEST_FAIL("swapChain.verticalSynchronization() != (presentMode == VK_PRESENT_MODE_FIFO_KHR || presentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR)");
+        }
+
+        // Toggling vertical synchronization replaces the requested present mode with the default one.
+        swapChain.reset(swapChain.surfaceFormat(), swapChain.renderArea(), swapChain.buffers(), false);
+
+        if (swapChain.presentMode() == VK_PRESENT_MODE_FIFO_RELAXED_KHR)
+            LITEFX_TEST_FAIL("swapChain.presentMode() == VK_PRESENT_MODE_FIFO_RELAXED_KHR");
+
+        // With a frame latency of 1, swapping the back buffer must wait for the previous frame to finish.
+        auto& queue = _device->defaultQueue(QueueType::Graphics);
+        swapChain.setMaxFrameLatency(1);
+        UInt64 lastFence{ 0 };
+
+        for (UInt32 frame{ 0 }; frame < 3 * frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = swapChain.swapBackBuffer();
+
+            if (queue.lastCompletedFence() < lastFence)
+                LITEFX_TEST_FAIL("queue.lastCompletedFence() < lastFence");
+
+            swapChain.markInput();
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->end();
+            lastFence = queue.currentFence();
+        }
+
+        _device->wait();
+
+        if (swapChain.presentLatency().count() <= 0)
+            LITEFX_TEST_FAIL("swapChain.presentLatency().count() <= 0");
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup instance extensions and validation layers. No window is required, as the device is created on a headless surface.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
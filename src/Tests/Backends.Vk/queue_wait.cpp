@@ -0,0 +1,132 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr).shared_from_this();
+
+        auto& transferQueue = _device->defaultQueue(QueueType::Transfer);
+        auto& computeQueue = _device->defaultQueue(QueueType::Compute);
+
+        // Waiting for a fence that has already been passed must not affect the next submission.
+        computeQueue.waitFor(transferQueue, 0);
+
+        // Upload data on the transfer queue in two submissions into separate buffers.
+        constexpr UInt32 ELEMENTS = 65536;
+        const auto initialData = std::views::iota(0u, ELEMENTS) | std::ranges::to<Array<UInt32>>();
+        const auto updatedData = std::views::iota(ELEMENTS, ELEMENTS + ELEMENTS / 2) | std::ranges::to<Array<UInt32>>();
+        auto sharedBuffer = _device->factory().createBuffer("Shared Buffer", BufferType::Other, ResourceHeap::Resource, sizeof(UInt32) * ELEMENTS, 1u, ResourceUsage::TransferSource | ResourceUsage::TransferDestination);
+        auto updateBuffer = _device->factory().createBuffer("Update Buffer", BufferType::Other, ResourceHeap::Resource, sizeof(UInt32) * ELEMENTS / 2, 1u, ResourceUsage::TransferSource | ResourceUsage::TransferDestination);
+        auto readbackBuffer = _device->factory().createBuffer("Readback Buffer", BufferType::Other, ResourceHeap::Readback, sizeof(UInt32) * ELEMENTS, 1u, ResourceUsage::TransferDestination);
+
+        auto commandBuffer = transferQueue.createCommandBuffer(true);
+        commandBuffer->transfer(initialData.data(), sizeof(UInt32) * initialData.size(), *sharedBuffer);
+        auto firstFence = transferQueue.submit(commandBuffer);
+
+        commandBuffer = transferQueue.createCommandBuffer(true);
+        commandBuffer->transfer(updatedData.data(), sizeof(UInt32) * updatedData.size(), *updateBuffer);
+        auto secondFence = transferQueue.submit(commandBuffer);
+
+        if (secondFence <= firstFence)
+            LITEFX_TEST_FAIL("secondFence <= firstFence");
+
+        // Record multiple waits for the same queue. They are merged and attached to the next submission on the compute queue, which reads the uploaded data.
+        computeQueue.waitFor(transferQueue, secondFence);
+        computeQueue.waitFor(transferQueue, firstFence);
+
+        commandBuffer = computeQueue.createCommandBuffer(true);
+        commandBuffer->transfer(*sharedBuffer, *readbackBuffer);
+        auto computeFence = computeQueue.submit(commandBuffer);
+        computeQueue.waitFor(computeFence);
+
+        // The compute queue only signals its fence after the transfer queue has passed the awaited fence, so the copy must contain the uploaded data.
+        if (transferQueue.lastCompletedFence() < secondFence)
+            LITEFX_TEST_FAIL("transferQueue.lastCompletedFence() < secondFence");
+
+        Array<UInt32> result(ELEMENTS);
+        readbackBuffer->map(result.data(), sizeof(UInt32) * result.size(), 0, false);
+
+        if (result != initialData)
+            LITEFX_TEST_FAIL("The compute queue did not wait for the transfer queue before reading the shared buffer.");
+
+        // Pending waits are consumed by the submission, so subsequent submissions do not wait again. Overwrite the first half of the shared buffer with the data 
+        // uploaded by the second transfer submission, which has already completed.
+        commandBuffer = computeQueue.createCommandBuffer(true);
+        commandBuffer->transfer(*updateBuffer, *sharedBuffer);
+        auto barrier = _device->makeBarrier(PipelineStage::Transfer, PipelineStage::Transfer);
+        barrier->transition(*sharedBuffer, ResourceAccess::TransferWrite, ResourceAccess::TransferRead);
+        commandBuffer->barrier(*barrier);
+        commandBuffer->transfer(*sharedBuffer, *readbackBuffer);
+        auto nextFence = computeQueue.submit(commandBuffer);
+        computeQueue.waitFor(nextFence);
+
+        if (computeQueue.lastCompletedFence() < nextFence)
+            LITEFX_TEST_FAIL("computeQueue.lastCompletedFence() < nextFence");
+
+        readbackBuffer->map(result.data(), sizeof(UInt32) * result.size(), 0, false);
+
+        if (!std::ranges::equal(Span<const UInt32>(result).first(ELEMENTS / 2), updatedData) || !std::ranges::equal(Span<const UInt32>(result).last(ELEMENTS / 2), Span<const UInt32>(initialData).last(ELEMENTS / 2)))
+            LITEFX_TEST_FAIL("The shared buffer does not contain the expected data after it has been partially overwritten.");
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
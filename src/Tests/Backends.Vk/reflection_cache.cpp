@@ -0,0 +1,250 @@
+#include "common.h"
+#include <filesystem>
+#include <fstream>
+
+#define FRAMEBUFFER_WIDTH  800
+#define FRAMEBUFFER_HEIGHT 600
+
+HWND _window { nullptr };
+
+SharedPtr<Viewport> _viewport;
+SharedPtr<Scissor> _scissor;
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Create viewport and scissors.
+        _viewport = makeShared<Viewport>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+        _scissor = makeShared<Scissor>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+
+        // Find adapter and create surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createSurface(_window);
+
+        // Create the device.
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, _viewport->getRectangle().extent(), 3, true).shared_from_this();
+
+        // Create the shader program.
+        SharedPtr<VulkanShaderProgram> shaderProgram = _device->buildShaderProgram()
+            .withVertexShaderModule("shaders/test_vs.spv")
+            .withFragmentShaderModule("shaders/test_fs.spv");
+
+        // Reflect the pipeline layout once to populate the reflection cache and store it.
+        auto reflectedLayout = shaderProgram->reflectPipelineLayout();
+        VulkanShaderProgram::saveReflectionCache("vk_reflection_cache.bin");
+
+        // Clear the cache, re-load it from the file and reflect the layout again.
+        VulkanShaderProgram::clearReflectionCache();
+        if (!VulkanShaderProgram::loadReflectionCache("vk_reflection_cache.bin"))
+            LITEFX_TEST_FAIL("The stored reflection cache has not been loaded.");
+
+        auto cachedLayout = shaderProgram->reflectPipelineLayout();
+
+        // Validate that both layouts are equal.
+        auto reflectedSets = reflectedLayout->descriptorSets() | std::ranges::to<std::vector>();
+        auto cachedSets = cachedLayout->descriptorSets() | std::ranges::to<std::vector>();
+        std::ranges::sort(reflectedSets, {}, [](const auto& set) { return set->space(); });
+        std::ranges::sort(cachedSets, {}, [](const auto& set) { return set->space(); });
+
+        if (reflectedSets.size() != cachedSets.size())
+            LITEFX_TEST_FAIL("reflectedSets.size() != cachedSets.size()");
+
+        for (size_t s{ 0 }; s < reflectedSets.size(); ++s)
+        {
+            if (reflectedSets[s]->space() != cachedSets[s]->space())
+                LITEFX_TEST_FAIL("reflectedSets[s]->space() != cachedSets[s]->space()");
+
+            if (reflectedSets[s]->shaderStages() != cachedSets[s]->shaderStages())
+                LITEFX_TEST_FAIL("reflectedSets[s]->shaderStages() != cachedSets[s]->shaderStages()");
+
+            auto reflectedDescriptors = reflectedSets[s]->descriptors() | std::ranges::to<std::vector>();
+            auto cachedDescriptors = cachedSets[s]->descriptors() | std::ranges::to<std::vector>();
+
+            if (reflectedDescriptors.size() != cachedDescriptors.size())
+                LITEFX_TEST_FAIL("reflectedDescriptors.size() != cachedDescriptors.size()");
+
+            for (size_t d{ 0 }; d < reflectedDescriptors.size(); ++d)
+            {
+                if (reflectedDescriptors[d].binding() != cachedDescriptors[d].binding())
+                    LITEFX_TEST_FAIL("reflectedDescriptors[d].binding() != cachedDescriptors[d].binding()");
+
+                if (reflectedDescriptors[d].descriptorType() != cachedDescriptors[d].descriptorType())
+                    LITEFX_TEST_FAIL("reflectedDescriptors[d].descriptorType() != cachedDescriptors[d].descriptorType()");
+
+                if (reflectedDescriptors[d].elementSize() != cachedDescriptors[d].elementSize())
+                    LITEFX_TEST_FAIL("reflectedDescriptors[d].elementSize() != cachedDescriptors[d].elementSize()");
+
+                if (reflectedDescriptors[d].descriptors() != cachedDescriptors[d].descriptors())
+                    LITEFX_TEST_FAIL("reflectedDescriptors[d].descriptors() != cachedDescriptors[d].descriptors()");
+            }
+        }
+
+        auto reflectedPushConstants = reflectedLayout->pushConstants() == nullptr ? 0u : reflectedLayout->pushConstants()->size();
+        auto cachedPushConstants = cachedLayout->pushConstants() == nullptr ? 0u : cachedLayout->pushConstants()->size();
+
+        if (reflectedPushConstants != cachedPushConstants)
+            LITEFX_TEST_FAIL("reflectedPushConstants != cachedPushConstants");
+
+        // Writes a cache with a single entry, that contains one descriptor of the provided type. The record size can be overridden to simulate a mismatch.
+        auto writeCache = [](UInt32 version, UInt32 descriptorType, Optional<UInt32> recordSize = std::nullopt) {
+            std::ofstream file("vk_reflection_cache_invalid.bin", std::ios::out | std::ios::binary | std::ios::trunc);
+            auto write = [&file](auto value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const std::array<UInt32, 10> record { 1, 0, 0, 1, 0, 16, 1, 0, descriptorType, 0 }; // 1 set (space 0) with 1 descriptor, no push constants.
+
+            write(0x4352464Cu);
+            write(version);
+            write(1u);
+            write(0u);
+            write(std::array<UInt32, 8>{ 1, 2, 3, 4, 5, 6, 7, 8 });
+            write(UInt64{ 4 });
+            write(recordSize.value_or(static_cast<UInt32>(sizeof(record))));
+            write(record);
+        };
+
+        // Valid records are loaded, whilst files from other versions, records with invalid descriptor types or mismatching sizes are ignored.
+        writeCache(3, static_cast<UInt32>(DescriptorType::ConstantBuffer));
+
+        if (!VulkanShaderProgram::loadReflectionCache("vk_reflection_cache_invalid.bin"))
+            LITEFX_TEST_FAIL("A valid reflection cache has not been loaded.");
+
+        writeCache(2, static_cast<UInt32>(DescriptorType::ConstantBuffer));
+
+        if (VulkanShaderProgram::loadReflectionCache("vk_reflection_cache_invalid.bin"))
+            LITEFX_TEST_FAIL("A reflection cache with an unsupported version has been loaded.");
+
+        writeCache(3, 0xFF);
+
+        if (VulkanShaderProgram::loadReflectionCache("vk_reflection_cache_invalid.bin"))
+            LITEFX_TEST_FAIL("A reflection cache with an invalid descriptor type has been loaded.");
+
+        writeCache(3, static_cast<UInt32>(DescriptorType::ConstantBuffer), 36);
+
+        if (VulkanShaderProgram::loadReflectionCache("vk_reflection_cache_invalid.bin"))
+            LITEFX_TEST_FAIL("A reflection cache with a mismatching record size has been loaded.");
+
+        writeCache(3, static_cast<UInt32>(DescriptorType::ConstantBuffer), 0x10000);
+
+        if (VulkanShaderProgram::loadReflectionCache("vk_reflection_cache_invalid.bin"))
+            LITEFX_TEST_FAIL("A truncated reflection cache has been loaded.");
+
+        // If the cache cannot be loaded, modules are reflected again.
+        VulkanShaderProgram::clearReflectionCache();
+        auto fallbackLayout = shaderProgram->reflectPipelineLayout();
+
+        if (fallbackLayout->descriptorSets().size() != reflectedSets.size())
+            LITEFX_TEST_FAIL("The pipeline layout could not be reflected after the reflection cache has been ignored.");
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+{
+    switch (msg)
+    {
+    case WM_CLOSE:
+        DestroyWindow(hwnd);
+        break;
+    case WM_DESTROY:
+        PostQuitMessage(0);
+        break;
+    default:
+        return DefWindowProc(hwnd, msg, wParam, lParam);
+    }
+
+    return 0;
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Register a window class.
+    HINSTANCE instance = ::GetModuleHandle(nullptr);
+    const auto windowClassName = "Test App Window Class";
+
+    WNDCLASSEX windowClass {
+        .cbSize = sizeof(WNDCLASSEX),
+        .lpfnWndProc = ::WndProc,
+        .hInstance = instance,
+        .hIcon = ::LoadIcon(nullptr, IDI_APPLICATION),
+        .hCursor = LoadCursor(nullptr, IDC_ARROW),
+        .hbrBackground = (HBRUSH)(COLOR_WINDOW + 1),
+        .lpszClassName = windowClassName,
+        .hIconSm = LoadIcon(NULL, IDI_APPLICATION)
+    };
+
+    if (!::RegisterClassEx(&windowClass))
+    {
+        std::cerr << "Unable to register window class." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Create a window instance.
+    _window = ::CreateWindowEx(WS_EX_CLIENTEDGE, windowClassName, "Test App",
+        WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT,
+        nullptr, nullptr, instance, nullptr);
+
+    if (_window == NULL)
+    {
+        std::cerr << "Unable to create test window." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Show the window.
+    ::ShowWindow(_window, SW_SHOWNORMAL);
+    ::UpdateWindow(_window);
+
+    // Setup instance extensions and validation layers.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+#if defined(WIN32)
+    // Enable Windows-specific extensions.
+    extensions.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
+#endif // defined(WIN32)
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "common.h"
+#include <filesystem>
+
+#define FRAMEBUFFER_WIDTH  800
+#define FRAMEBUFFER_HEIGHT 600
+
+SharedPtr<Viewport> _viewport;
+SharedPtr<Scissor> _scissor;
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Create viewport and scissors.
+        _viewport = makeShared<Viewport>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+        _scissor = makeShared<Scissor>(RectF(0.f, 0.f, static_cast<Float>(FRAMEBUFFER_WIDTH), static_cast<Float>(FRAMEBUFFER_HEIGHT)));
+
+        // Find adapter and create a headless surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createHeadlessSurface();
+
+        // Create the device.
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, _viewport->getRectangle().extent(), 3, false).shared_from_this();
+
+        // Create a render pass without fixed secondary command buffers.
+        SharedPtr<VulkanRenderPass> renderPass = _device->buildRenderPass("Present", 0)
+            .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f });
+
+        // Create one frame buffer per back buffer.
+        auto frameBuffers = std::views::iota(0u, _device->swapChain().buffers()) 
+            | std::views::transform([&renderPass](UInt32 index) {
+                auto frameBuffer = _device->makeFrameBuffer(std::format("Frame Buffer {0}", index), _device->swapChain().renderArea());
+                frameBuffer->addImages(renderPass->renderTargets());
+                return frameBuffer;
+            })
+            | std::ranges::to<Array<SharedPtr<VulkanFrameBuffer>>>();
+
+        // Acquiring command buffers outside of the render pass must fail.
+        try
+        {
+            std::ignore = renderPass->acquireCommandBuffer();
+            LITEFX_TEST_FAIL("renderPass->acquireCommandBuffer() did not throw.");
+        }
+        catch (const RuntimeException&)
+        {
+        }
+
+        // Record a few frames with multiple threads, which grows the pools of all frame buffers.
+        constexpr UInt32 WORKERS = 4u;
+        TaskScheduler scheduler(WORKERS);
+
+        for (UInt32 frame{ 0 }; frame < frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = _device->swapChain().swapBackBuffer();
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->recordParallel(scheduler, WORKERS, [](const ICommandBuffer& commandBuffer, UInt32 /*draw*/) { commandBuffer.setViewports(_viewport.get()); });
+
+            if (renderPass->pooledCommandBuffers() != WORKERS)
+                LITEFX_TEST_FAIL("renderPass->pooledCommandBuffers() != WORKERS");
+
+            renderPass->end();
+        }
+
+        // Only acquire a single command buffer for a while, which causes the pools to shrink again.
+        for (UInt32 frame{ 0 }; frame < 150u * frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = _device->swapChain().swapBackBuffer();
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->acquireCommandBuffer()->setViewports(_viewport.get());
+            renderPass->end();
+        }
+
+        auto backBuffer = _device->swapChain().swapBackBuffer();
+        renderPass->begin(*frameBuffers[backBuffer]);
+
+        if (renderPass->pooledCommandBuffers() != 1u)
+            LITEFX_TEST_FAIL("renderPass->pooledCommandBuffers() != 1u");
+
+        renderPass->end();
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the DirectX 12 backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup instance extensions and validation layers. No window is required, as the device is created on a headless surface.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+	// Create the app.
+	try
+	{
+		UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+			.logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+			.useBackend<VulkanBackend>(extensions, layers);
+
+		app->run();
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -57,6 +57,103 @@ void TestApp::onInit()
                 LITEFX_TEST_FAIL("image0.extent().width() != 400 || image0.extent().height() != 200");
         }
 
+        // Exact frame buffers re-allocate each image on every resize that changes the size, but not if the size stays the same.
+        frameBuffer->resize(Size2d{ 400, 200 });
+
+        {
+            auto statistics = frameBuffer->resizeStatistics();
+
+            if (statistics.Resizes != 2 || statistics.Reallocations != 1 || statistics.ReusedImages != 0)
+                LITEFX_TEST_FAIL("statistics.Resizes != 2 || statistics.Reallocations != 1 || statistics.ReusedImages != 0");
+
+            if (statistics.LastResizeTime < 0.0 || statistics.MaxResizeTime < statistics.LastResizeTime || statistics.TotalResizeTime < statistics.MaxResizeTime)
+                LITEFX_TEST_FAIL("statistics.LastResizeTime < 0.0 || statistics.MaxResizeTime < statistics.LastResizeTime || statistics.TotalResizeTime < statistics.MaxResizeTime");
+        }
+
+        // Frame buffers that reuse images return the replaced images, when resizing back to their previous size.
+        {
+            auto reusingFrameBuffer = _device->makeFrameBuffer("Reusing Frame Buffer", _viewport->getRectangle().extent());
+            reusingFrameBuffer->setResizePolicy(FrameBufferResizePolicy::ReuseImages);
+            reusingFrameBuffer->addImage("Color", Format::B8G8R8A8_UNORM, MultiSamplingLevel::x1);
+            reusingFrameBuffer->addImage("Depth", Format::D32_SFLOAT, MultiSamplingLevel::x1);
+
+            const auto* color = &reusingFrameBuffer->image(0);
+            const auto* depth = &reusingFrameBuffer->image(1);
+
+            reusingFrameBuffer->resize(Size2d{ 400, 200 });
+
+            if (&reusingFrameBuffer->image(0) == color || &reusingFrameBuffer->image(1) == depth)
+                LITEFX_TEST_FAIL("&reusingFrameBuffer->image(0) == color || &reusingFrameBuffer->image(1) == depth");
+
+            reusingFrameBuffer->resize(Size2d{ FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT });
+
+            if (&reusingFrameBuffer->image(0) != color || &reusingFrameBuffer->image(1) != depth)
+                LITEFX_TEST_FAIL("&reusingFrameBuffer->image(0) != color || &reusingFrameBuffer->image(1) != depth");
+
+            auto statistics = reusingFrameBuffer->resizeStatistics();
+
+            if (statistics.Resizes != 2 || statistics.Reallocations != 2 || statistics.ReusedImages != 2)
+                LITEFX_TEST_FAIL("statistics.Resizes != 2 || statistics.Reallocations != 2 || statistics.ReusedImages != 2");
+
+            // Without a pool, replaced images are released immediately and nothing can be reused.
+            reusingFrameBuffer->setResizePolicy(FrameBufferResizePolicy::ReuseImages, VulkanFrameBuffer::DEFAULT_BUCKET_SIZE, 0u);
+            reusingFrameBuffer->resize(Size2d{ 400, 200 });
+            reusingFrameBuffer->resize(Size2d{ FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT });
+            statistics = reusingFrameBuffer->resizeStatistics();
+
+            if (statistics.Resizes != 4 || statistics.Reallocations != 6 || statistics.ReusedImages != 2)
+                LITEFX_TEST_FAIL("statistics.Resizes != 4 || statistics.Reallocations != 6 || statistics.ReusedImages != 2");
+
+            // Over-allocated frame buffers do not re-allocate their images, if the new size fits into the allocated size.
+            auto overAllocatingFrameBuffer = _device->makeFrameBuffer("Over-Allocating Frame Buffer", Size2d{ 100, 100 });
+            overAllocatingFrameBuffer->setResizePolicy(FrameBufferResizePolicy::OverAllocate);
+            overAllocatingFrameBuffer->addImage("Color", Format::B8G8R8A8_UNORM, MultiSamplingLevel::x1);
+            overAllocatingFrameBuffer->resize(Size2d{ 200, 200 });
+            overAllocatingFrameBuffer->resize(Size2d{ 250, 120 });
+            statistics = overAllocatingFrameBuffer->resizeStatistics();
+
+            if (statistics.Resizes != 2 || statistics.Reallocations != 1 || statistics.ReusedImages != 0)
+                LITEFX_TEST_FAIL("statistics.Resizes != 2 || statistics.Reallocations != 1 || statistics.ReusedImages != 0");
+        }
+
+        // Over-allocated frame buffers can be larger than the back buffer, so presenting must only copy the sub-rectangle that matches the frame buffer size.
+        SharedPtr<VulkanRenderPass> renderPass = _device->buildRenderPass("Present")
+            .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear, { 0.1f, 0.1f, 0.1f, 1.f });
+
+        auto frameBuffers = std::views::iota(0u, _device->swapChain().buffers())
+            | std::views::transform([&renderPass](UInt32 index) {
+                auto frameBuffer = _device->makeFrameBuffer(std::format("Present Frame Buffer {0}", index), _device->swapChain().renderArea());
+                frameBuffer->setResizePolicy(FrameBufferResizePolicy::OverAllocate);
+                frameBuffer->addImages(renderPass->renderTargets());
+                frameBuffer->resize(Size2d{ FRAMEBUFFER_WIDTH - 10, FRAMEBUFFER_HEIGHT - 10 });
+                return frameBuffer;
+            })
+            | std::ranges::to<Array<SharedPtr<VulkanFrameBuffer>>>();
+
+        {
+            auto& frameBuffer = *frameBuffers.front();
+            auto& image0 = frameBuffer.image(0);
+
+            if (frameBuffer.getWidth() != FRAMEBUFFER_WIDTH - 10 || frameBuffer.getHeight() != FRAMEBUFFER_HEIGHT - 10)
+                LITEFX_TEST_FAIL("frameBuffer.getWidth() != FRAMEBUFFER_WIDTH - 10 || frameBuffer.getHeight() != FRAMEBUFFER_HEIGHT - 10");
+
+            if (image0.extent().width() <= FRAMEBUFFER_WIDTH || image0.extent().height() <= FRAMEBUFFER_HEIGHT)
+                LITEFX_TEST_FAIL("image0.extent().width() <= FRAMEBUFFER_WIDTH || image0.extent().height() <= FRAMEBUFFER_HEIGHT");
+
+            if (frameBuffer.allocatedSize().width() != image0.extent().width() || frameBuffer.allocatedSize().height() != image0.extent().height())
+                LITEFX_TEST_FAIL("frameBuffer.allocatedSize().width() != image0.extent().width() || frameBuffer.allocatedSize().height() != image0.extent().height()");
+        }
+
+        // The validation layers terminate the test, if the copy into the back buffer exceeds its extent.
+        for (UInt32 frame{ 0 }; frame < frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = _device->swapChain().swapBackBuffer();
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->end();
+        }
+
+        _device->wait();
+
         return true;
     };
 
@@ -0,0 +1,217 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+struct alignas(8) GeometryData {
+    UInt32 Index;
+    UInt32 Reflective;
+    UInt32 Padding[2];
+};
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr, GraphicsDeviceFeatures { .RayTracing = true }).shared_from_this();
+
+        // Create a ray tracing pipeline with a ray generation, a miss and two hit group records.
+        SharedPtr<VulkanShaderProgram> shaderProgram = _device->buildShaderProgram()
+            .withRayGenerationShaderModule("shaders/raytracing_gen.spv")
+            .withClosestHitShaderModule("shaders/raytracing_hit.spv", DescriptorBindingPoint{ .Register = 0, .Space = 3 })
+            .withMissShaderModule("shaders/raytracing_miss.spv");
+
+        UniquePtr<VulkanRayTracingPipeline> rayTracingPipeline = _device->buildRayTracingPipeline("RayTracing",
+            shaderProgram->buildShaderRecordCollection()
+                .withShaderRecord("shaders/raytracing_gen.spv")
+                .withShaderRecord("shaders/raytracing_miss.spv")
+                .withMeshGeometryHitGroupRecord(std::nullopt, "shaders/raytracing_hit.spv", GeometryData{ .Index = 0, .Reflective = 0 })
+                .withMeshGeometryHitGroupRecord(std::nullopt, "shaders/raytracing_hit.spv", GeometryData{ .Index = 1, .Reflective = 1 }))
+            .maxBounces(16)
+            .maxPayloadSize(sizeof(Float) * 5)
+            .maxAttributeSize(sizeof(Float) * 2)
+            .layout(shaderProgram->reflectPipelineLayout(std::array { PipelineBindingHint::runtimeArray(2u, 0u, 100u) }));
+
+        // The shader-local data of a record starts after the shader group handle.
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR rayTracingProperties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR };
+        VkPhysicalDeviceProperties2 deviceProperties { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &rayTracingProperties };
+        ::vkGetPhysicalDeviceProperties2(adapter->handle(), &deviceProperties);
+        const UInt64 handleSize = rayTracingProperties.shaderGroupHandleSize;
+
+        auto table = VulkanShaderBindingTable::create(*_device, *rayTracingPipeline, 3, 0, sizeof(GeometryData));
+
+        if (table->frames() != 3 || table->records() != 4 || table->hitGroups() != 2 || table->hitGroupCapacity() != 2)
+            LITEFX_TEST_FAIL("The shader binding table does not contain the records of the pipeline.");
+
+        // Each record must be located within the group reported by the offsets. Hit group records are stored in order.
+        auto offsets = table->offsets();
+        auto recordSize = table->recordSize();
+
+        if (recordSize < handleSize + sizeof(GeometryData) || offsets.RayGenerationGroupStride != recordSize || offsets.MissGroupStride != recordSize || offsets.HitGroupStride != recordSize)
+            LITEFX_TEST_FAIL("The record size does not match the group strides.");
+
+        if (offsets.RayGenerationGroupSize != recordSize || offsets.MissGroupSize != recordSize || offsets.HitGroupSize != 2 * recordSize)
+            LITEFX_TEST_FAIL("The group sizes do not match the number of records.");
+
+        if (offsets.RayGenerationGroupOffset % rayTracingProperties.shaderGroupBaseAlignment != 0 || offsets.MissGroupOffset % rayTracingProperties.shaderGroupBaseAlignment != 0 || offsets.HitGroupOffset % rayTracingProperties.shaderGroupBaseAlignment != 0)
+            LITEFX_TEST_FAIL("The group offsets are not aligned to the shader group base alignment.");
+
+        if (table->recordOffset(0) != offsets.RayGenerationGroupOffset || table->recordOffset(1) != offsets.MissGroupOffset ||
+            table->recordOffset(2) != offsets.HitGroupOffset || table->recordOffset(3) != offsets.HitGroupOffset + offsets.HitGroupStride)
+            LITEFX_TEST_FAIL("The record offsets do not match the group offsets.");
+
+        try
+        {
+            std::ignore = table->recordOffset(4);
+            LITEFX_TEST_FAIL("A record offset has been returned for a record that does not exist.");
+        }
+        catch (const ArgumentOutOfRangeException&)
+        {
+        }
+
+        // The buffers are owned by the shader binding table, but the test inspects and modifies their memory directly.
+        auto bufferOf = [&table](UInt32 frame) { return std::const_pointer_cast<IVulkanBuffer>(table->prepare(frame)); };
+
+        auto readLocalData = [&](IVulkanBuffer& buffer, UInt32 record) -> GeometryData {
+            Array<Byte> data(buffer.size());
+            buffer.map(data.data(), data.size(), 0, false);
+
+            GeometryData localData{ };
+            std::memcpy(&localData, std::next(data.data(), static_cast<std::ptrdiff_t>(table->recordOffset(record) + handleSize)), sizeof(GeometryData));
+            return localData;
+        };
+
+        auto writeLocalData = [&](IVulkanBuffer& buffer, UInt32 record, const GeometryData& localData) {
+            Array<Byte> data(buffer.size());
+            buffer.map(data.data(), data.size(), 0, false);
+            std::memcpy(std::next(data.data(), static_cast<std::ptrdiff_t>(table->recordOffset(record) + handleSize)), &localData, sizeof(GeometryData));
+            buffer.map(data.data(), data.size(), 0, true);
+        };
+
+        std::array<SharedPtr<IVulkanBuffer>, 3> buffers { bufferOf(0), bufferOf(1), bufferOf(2) };
+
+        if (std::ranges::any_of(buffers, [&](const auto& buffer) { return readLocalData(*buffer, 2).Index != 0 || readLocalData(*buffer, 3).Index != 1 || readLocalData(*buffer, 3).Reflective != 1; }))
+            LITEFX_TEST_FAIL("The buffers do not contain the initial shader-local data.");
+
+        // Overwrite a record that is not updated in the buffer of the first frame. As it is not stale, preparing the frame must not restore it.
+        writeLocalData(*buffers[0], 3, GeometryData{ .Index = 42 });
+        table->updateLocalData(2, GeometryData{ .Index = 7, .Reflective = 1 });
+
+        if (bufferOf(0) != buffers[0])
+            LITEFX_TEST_FAIL("The buffer has been re-allocated, although the capacity has not been exceeded.");
+
+        if (readLocalData(*buffers[0], 2).Index != 7 || readLocalData(*buffers[0], 3).Index != 42)
+            LITEFX_TEST_FAIL("Preparing the frame did not only write the updated record.");
+
+        // Buffers of other frames must not be written before they are prepared.
+        if (readLocalData(*buffers[1], 2).Index != 0)
+            LITEFX_TEST_FAIL("The buffer of another frame has been written before it was prepared.");
+
+        if (bufferOf(1) != buffers[1] || readLocalData(*buffers[1], 2).Index != 7)
+            LITEFX_TEST_FAIL("The updated record has not been written when preparing the second frame.");
+
+        // Preparing a frame again without changes writes nothing.
+        std::ignore = bufferOf(0);
+
+        if (readLocalData(*buffers[0], 2).Index != 7 || readLocalData(*buffers[0], 3).Index != 42)
+            LITEFX_TEST_FAIL("Preparing a frame without changes wrote to its buffer.");
+
+        // Only hit group records can be appended.
+        try
+        {
+            std::ignore = table->appendHitGroup(0, GeometryData{ .Index = 8 });
+            LITEFX_TEST_FAIL("A ray generation record has been appended as a hit group record.");
+        }
+        catch (const InvalidArgumentException&)
+        {
+        }
+
+        // Appending a hit group record beyond the capacity grows the hit group table without moving the other records.
+        auto appended = table->appendHitGroup(3, GeometryData{ .Index = 9 });
+        auto grown = table->offsets();
+
+        if (appended != 4 || table->records() != 5 || table->hitGroups() != 3 || table->hitGroupCapacity() != 4)
+            LITEFX_TEST_FAIL("The hit group record has not been appended.");
+
+        if (grown.HitGroupSize != 3 * recordSize || grown.HitGroupOffset != offsets.HitGroupOffset || grown.MissGroupOffset != offsets.MissGroupOffset ||
+            grown.RayGenerationGroupOffset != offsets.RayGenerationGroupOffset || table->recordOffset(appended) != offsets.HitGroupOffset + 2 * recordSize)
+            LITEFX_TEST_FAIL("Appending a hit group record moved other records.");
+
+        // Each frame re-allocates its buffer, when it is prepared next. The new buffer contains all records.
+        for (UInt32 frame{ 0 }; frame < 3; ++frame)
+        {
+            auto buffer = bufferOf(frame);
+
+            if (buffer == buffers[frame] || buffer->size() < grown.HitGroupOffset + 4 * recordSize) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                LITEFX_TEST_FAIL("The buffer has not been re-allocated after the hit group capacity has been exceeded.");
+
+            if (readLocalData(*buffer, 2).Index != 7 || readLocalData(*buffer, 3).Index != 1 || readLocalData(*buffer, appended).Index != 9)
+                LITEFX_TEST_FAIL("The re-allocated buffer does not contain all records.");
+
+            buffers[frame] = buffer; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        // Appending another record fits into the grown capacity.
+        std::ignore = table->appendHitGroup(2, GeometryData{ .Index = 10 });
+
+        if (table->hitGroupCapacity() != 4 || bufferOf(0) != buffers[0] || readLocalData(*buffers[0], 5).Index != 10)
+            LITEFX_TEST_FAIL("The buffer has been re-allocated, although the appended record fits into the capacity.");
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
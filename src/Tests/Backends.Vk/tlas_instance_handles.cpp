@@ -0,0 +1,223 @@
+#include "common.h"
+#include <filesystem>
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a device without a surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        _device = backend->createDevice("Default", *adapter, nullptr, GraphicsDeviceFeatures { .RayTracing = true }).shared_from_this();
+
+        // Instance handles can be managed without building the acceleration structure.
+        auto blas = LiteFX::asShared(_device->factory().createBottomLevelAccelerationStructure("BLAS"));
+        auto tlas = _device->factory().createTopLevelAccelerationStructure("TLAS", AccelerationStructureFlags::AllowUpdate);
+
+        auto first = tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = 0 });
+        auto second = tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = 1 });
+        auto third = tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = 2 });
+
+        // Removing an instance moves the last instance into its place, without invalidating its handle.
+        if (!tlas->remove(first) || tlas->remove(first))
+            LITEFX_TEST_FAIL("Unable to remove instance by handle.");
+
+        if (tlas->instances().size() != 2 || tlas->instances()[0].Id != 2)
+            LITEFX_TEST_FAIL("The last instance has not been moved into the place of the removed instance.");
+
+        if (tlas->contains(first) || !tlas->contains(second) || !tlas->contains(third) || tlas->instance(third).Id != 2)
+            LITEFX_TEST_FAIL("Handles do not resolve to the expected instances after removal.");
+
+        // Released slots are re-used, but old handles must not resolve to the new instance.
+        auto fourth = tlas->insert({ .BottomLevelAccelerationStructure = blas, .Id = 3 });
+
+        if (fourth == first || tlas->contains(first) || tlas->instance(fourth).Id != 3)
+            LITEFX_TEST_FAIL("A handle of a removed instance resolves to a new instance.");
+
+        // Instances can be updated in place.
+        tlas->updateMask(second, 0x0F);
+        tlas->updateFlags(second, InstanceFlags::ForceOpaque);
+
+        if (tlas->instance(second).Mask != 0x0F || tlas->instance(second).Flags != InstanceFlags::ForceOpaque)
+            LITEFX_TEST_FAIL("Instance has not been updated.");
+
+        try
+        {
+            tlas->updateTransform(first, TMatrix3x4<Float>::identity());
+            LITEFX_TEST_FAIL("updateTransform succeeded for a removed instance.");
+        }
+        catch (const InvalidArgumentException& /*ex*/)
+        {
+        }
+
+        // Removing instances by reference still works and keeps the handles of the remaining instances valid.
+        if (!tlas->remove(tlas->instances()[0]) || tlas->contains(third) || !tlas->contains(fourth) || tlas->instance(fourth).Id != 3)
+            LITEFX_TEST_FAIL("Unable to remove instance by reference.");
+
+        tlas->clear();
+
+        if (!tlas->instances().empty() || tlas->contains(second) || tlas->contains(fourth))
+            LITEFX_TEST_FAIL("Handles are still valid after clearing the acceleration structure.");
+
+        // Build a bottom-level acceleration structure from a single bounding box, so that the top-level acceleration structure can be built.
+        const std::array<Float, 6> boundingBox { -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f };
+        auto& queue = _device->defaultQueue(QueueType::Compute);
+        auto commandBuffer = queue.createCommandBuffer(true);
+        auto boundingBoxBuffer = _device->factory().createBuffer("Bounding Box", BufferType::Storage, ResourceHeap::Resource, sizeof(boundingBox), 1u, ResourceUsage::TransferDestination | ResourceUsage::AccelerationStructureBuildInput);
+        commandBuffer->transfer(boundingBox.data(), sizeof(boundingBox), *boundingBoxBuffer);
+
+        auto barrier = _device->makeBarrier(PipelineStage::Transfer, PipelineStage::AccelerationStructureBuild);
+        barrier->transition(*boundingBoxBuffer, ResourceAccess::TransferWrite, ResourceAccess::Common);
+        commandBuffer->barrier(*barrier);
+
+        auto geometry = LiteFX::asShared(_device->factory().createBottomLevelAccelerationStructure("Geometry"));
+        geometry->withBoundingBox(boundingBoxBuffer);
+        geometry->build(*commandBuffer);
+
+        barrier = _device->makeBarrier(PipelineStage::AccelerationStructureBuild, PipelineStage::AccelerationStructureBuild);
+        barrier->transition(*geometry->buffer(), ResourceAccess::AccelerationStructureWrite, ResourceAccess::AccelerationStructureRead);
+        commandBuffer->barrier(*barrier);
+
+        Array<VulkanTopLevelAccelerationStructure::instance_handle> handles;
+
+        for (UInt32 id{ 0 }; id < 4; ++id)
+            handles.push_back(tlas->insert({ .BottomLevelAccelerationStructure = geometry, .Id = id }));
+
+        tlas->build(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        auto instanceBuffer = tlas->instanceBuffer();
+
+        if (instanceBuffer == nullptr || instanceBuffer->size() < 4 * sizeof(VkAccelerationStructureInstanceKHR))
+            LITEFX_TEST_FAIL("The instance buffer has not been created by the build.");
+
+        // Reads back the instance ids, that have been uploaded to the instance buffer.
+        auto readInstanceIds = [&]() -> Array<UInt32> {
+            auto readbackBuffer = _device->factory().createBuffer(BufferType::Other, ResourceHeap::Readback, instanceBuffer->size(), 1u, ResourceUsage::TransferDestination);
+            auto readbackCommands = queue.createCommandBuffer(true);
+            auto readbackBarrier = _device->makeBarrier(PipelineStage::AccelerationStructureBuild, PipelineStage::Transfer);
+            readbackBarrier->transition(*instanceBuffer, ResourceAccess::ShaderRead, ResourceAccess::TransferRead);
+            readbackCommands->barrier(*readbackBarrier);
+            readbackCommands->transfer(*instanceBuffer, *readbackBuffer);
+            queue.waitFor(readbackCommands->submit());
+
+            Array<VkAccelerationStructureInstanceKHR> uploaded(tlas->instances().size());
+            readbackBuffer->map(uploaded.data(), uploaded.size() * sizeof(VkAccelerationStructureInstanceKHR), 0, false);
+            return uploaded | std::views::transform([](const auto& instance) { return static_cast<UInt32>(instance.instanceCustomIndex); }) | std::ranges::to<Array<UInt32>>();
+        };
+
+        if (readInstanceIds() != Array<UInt32> { 0, 1, 2, 3 })
+            LITEFX_TEST_FAIL("The instance buffer does not contain the built instances.");
+
+        // Updating an instance in place only uploads the changed instance during an update.
+        tlas->updateInstance(handles[1], { .BottomLevelAccelerationStructure = geometry, .Id = 5 });
+        commandBuffer = queue.createCommandBuffer(true);
+        tlas->update(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        if (readInstanceIds() != Array<UInt32> { 0, 5, 2, 3 })
+            LITEFX_TEST_FAIL("The updated instance has not been uploaded.");
+
+        // Removing an instance moves the last instance into its place, which requires a re-build. The instance buffer can still hold all instances and is re-used.
+        if (!tlas->remove(handles[0]))
+            LITEFX_TEST_FAIL("Unable to remove a built instance.");
+
+        commandBuffer = queue.createCommandBuffer(true);
+
+        try
+        {
+            tlas->update(*commandBuffer);
+            LITEFX_TEST_FAIL("Updating the acceleration structure succeeded after an instance has been removed.");
+        }
+        catch (const RuntimeException& /*ex*/)
+        {
+        }
+
+        tlas->build(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        if (tlas->instanceBuffer() != instanceBuffer)
+            LITEFX_TEST_FAIL("The instance buffer has been re-allocated, although it can hold all instances.");
+
+        if (tlas->instance(handles[3]).Id != 3 || readInstanceIds() != Array<UInt32> { 3, 5, 2 })
+            LITEFX_TEST_FAIL("The instance buffer does not contain the remaining instances after the re-build.");
+
+        // Each build creates a new handle. Updating and re-building within one command buffer uses the previous handles as sources, so they must stay alive
+        // until the command buffer has been executed.
+        auto builtHandle = tlas->handle();
+        tlas->updateInstance(handles[2], { .BottomLevelAccelerationStructure = geometry, .Id = 6 });
+        commandBuffer = queue.createCommandBuffer(true);
+        tlas->update(*commandBuffer);
+        auto updatedHandle = tlas->handle();
+        tlas->build(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        if (builtHandle == VK_NULL_HANDLE || updatedHandle == builtHandle || tlas->handle() == updatedHandle || tlas->handle() == VK_NULL_HANDLE)
+            LITEFX_TEST_FAIL("Updating or re-building the acceleration structure did not create a new handle.");
+
+        if (readInstanceIds() != Array<UInt32> { 3, 5, 6 })
+            LITEFX_TEST_FAIL("The instance buffer does not contain the updated instance after the re-build.");
+
+        // Re-building after the previous command buffer has been executed must also work with the current handle.
+        commandBuffer = queue.createCommandBuffer(true);
+        tlas->update(*commandBuffer);
+        tlas->build(*commandBuffer);
+        queue.waitFor(commandBuffer->submit());
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup validation layers. No window or surface extensions are required, as the device does not present.
+    Array<String> extensions { };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
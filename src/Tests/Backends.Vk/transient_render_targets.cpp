@@ -0,0 +1,146 @@
+#include "common.h"
+#include <filesystem>
+
+#define FRAMEBUFFER_WIDTH  800
+#define FRAMEBUFFER_HEIGHT 600
+
+SharedPtr<VulkanDevice> _device;
+
+void TestApp::onInit()
+{
+    // Create a callback for backend startup and shutdown.
+    auto startCallback = [](VulkanBackend* backend) {
+        // Find adapter and create a headless surface.
+        auto adapter = backend->findAdapter(std::nullopt);
+        auto surface = backend->createHeadlessSurface();
+
+        // Create the device.
+        _device = backend->createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, Size2d(FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT), 3, false).shared_from_this();
+
+        // Transient images must be render targets and must not be written to or copied.
+        const Size3d size { FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT, 1 };
+        auto& factory = _device->factory();
+
+        for (auto usage : { ResourceUsage::Transient, ResourceUsage::Transient | ResourceUsage::RenderTarget | ResourceUsage::AllowWrite,
+            ResourceUsage::Transient | ResourceUsage::RenderTarget | ResourceUsage::TransferSource, ResourceUsage::Transient | ResourceUsage::RenderTarget | ResourceUsage::TransferDestination })
+        {
+            try
+            {
+                std::ignore = factory.createTexture(Format::B8G8R8A8_UNORM, size, ImageDimensions::DIM_2, 1, 1, MultiSamplingLevel::x1, usage);
+                LITEFX_TEST_FAIL("A transient image with invalid usage has been created.");
+            }
+            catch (const InvalidArgumentException&)
+            {
+            }
+        }
+
+        auto transientImage = factory.createTexture(Format::B8G8R8A8_UNORM, size, ImageDimensions::DIM_2, 1, 1, MultiSamplingLevel::x1, ResourceUsage::Transient | ResourceUsage::RenderTarget);
+
+        if (!LITEFX_FLAG_IS_SET(transientImage->usage(), ResourceUsage::Transient))
+            LITEFX_TEST_FAIL("The transient render target image does not report transient usage.");
+
+        // Create a render pass with a cleared, transient present target and a transient depth target that is not cleared.
+        SharedPtr<VulkanRenderPass> renderPass = _device->buildRenderPass("Transient")
+            .renderTarget("Color Target", RenderTargetType::Present, Format::B8G8R8A8_UNORM, RenderTargetFlags::Clear | RenderTargetFlags::Transient, { 0.1f, 0.1f, 0.1f, 1.f })
+            .renderTarget("Depth Target", RenderTargetType::DepthStencil, Format::D32_SFLOAT, RenderTargetFlags::Transient, { 1.f, 0.f, 0.f, 0.f });
+
+        const auto& colorTarget = renderPass->renderTargets()[0];
+        const auto& depthTarget = renderPass->renderTargets()[1];
+
+        // Multi-sampled transient targets are resolved and never stored. Transient targets are only loaded, if they are cleared.
+        auto frameBuffers = std::views::iota(0u, _device->swapChain().buffers())
+            | std::views::transform([&renderPass](UInt32 index) {
+                auto frameBuffer = _device->makeFrameBuffer(std::format("Frame Buffer {0}", index), _device->swapChain().renderArea());
+                frameBuffer->addImages(renderPass->renderTargets(), MultiSamplingLevel::x4);
+                return frameBuffer;
+            })
+            | std::ranges::to<Array<SharedPtr<VulkanFrameBuffer>>>();
+
+        const auto& multiSampled = *frameBuffers.front();
+
+        if (!LITEFX_FLAG_IS_SET(multiSampled[colorTarget].usage(), ResourceUsage::Transient) || !LITEFX_FLAG_IS_SET(multiSampled[depthTarget].usage(), ResourceUsage::Transient))
+            LITEFX_TEST_FAIL("The multi-sampled frame buffer does not contain transient images.");
+
+        if (renderPass->attachmentOperations(multiSampled, colorTarget) != std::make_pair(VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_DONT_CARE))
+            LITEFX_TEST_FAIL("The cleared transient color target is stored.");
+
+        if (renderPass->attachmentOperations(multiSampled, depthTarget) != std::make_pair(VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE))
+            LITEFX_TEST_FAIL("The transient depth target is loaded or stored.");
+
+        // Present targets that are not multi-sampled are copied into the back buffer, so they fall back to regular images. Other targets stay transient.
+        auto frameBuffer = _device->makeFrameBuffer("Single-Sampled", _device->swapChain().renderArea());
+        frameBuffer->addImages(renderPass->renderTargets(), MultiSamplingLevel::x1);
+
+        if (LITEFX_FLAG_IS_SET((*frameBuffer)[colorTarget].usage(), ResourceUsage::Transient) || !LITEFX_FLAG_IS_SET((*frameBuffer)[colorTarget].usage(), ResourceUsage::TransferSource))
+            LITEFX_TEST_FAIL("The single-sampled present target has not fallen back to a regular image.");
+
+        if (!LITEFX_FLAG_IS_SET((*frameBuffer)[depthTarget].usage(), ResourceUsage::Transient))
+            LITEFX_TEST_FAIL("The single-sampled depth target is not transient.");
+
+        if (renderPass->attachmentOperations(*frameBuffer, colorTarget) != std::make_pair(VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE))
+            LITEFX_TEST_FAIL("The present target that has fallen back to a regular image is not stored.");
+
+        // Run a few frames, so that the validation layers can check the attachments.
+        for (UInt32 frame{ 0 }; frame < 2 * frameBuffers.size(); ++frame)
+        {
+            auto backBuffer = _device->swapChain().swapBackBuffer();
+            renderPass->begin(*frameBuffers[backBuffer]);
+            renderPass->end();
+        }
+
+        _device->wait();
+
+        return true;
+    };
+
+    auto stopCallback = [](VulkanBackend* backend) {
+        _device.reset();
+        backend->releaseDevice("Default");
+    };
+
+    // Register the Vulkan backend de-/initializer.
+    this->onBackendStart<VulkanBackend>(startCallback);
+    this->onBackendStop<VulkanBackend>(stopCallback);
+}
+
+void TestApp::onStartup()
+{
+}
+
+void TestApp::onShutdown()
+{
+}
+
+void TestApp::onResize(const void* /*sender*/, ResizeEventArgs /*e*/)
+{
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    // Set the current path.
+    auto binaryDir = std::filesystem::path(argv[0]);
+    std::filesystem::current_path(binaryDir.remove_filename());
+
+    // Setup instance extensions and validation layers. No window is required, as the device is created on a headless surface.
+    Array<String> extensions { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+    Array<String> layers { "VK_LAYER_KHRONOS_validation", "VK_LAYER_KHRONOS_synchronization2" };
+
+    // Create the app.
+    try
+    {
+        UniquePtr<App> app = App::build<TestApp>()
+            .logTo<ConsoleSink>(LogLevel::Error)
+            .logTo<TerminationSink>(LogLevel::Error) // Exit on error.
+            .useBackend<VulkanBackend>(extensions, layers);
+
+        app->run();
+    }
+    catch (const LiteFX::Exception& ex)
+    {
+        std::cerr << "Unhandled exception: " << ex.what() << '\n' << "at: " << ex.trace() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
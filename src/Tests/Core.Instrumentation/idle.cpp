@@ -0,0 +1,58 @@
+#include <litefx/core.h>
+
+using namespace LiteFX;
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    // NOTE: The overhead of idle zones is checked against a budget by the `benchmarks_idle_zone_budget` test. This test only validates that nothing gets recorded.
+    constexpr int ITERATIONS = 10000;
+
+    Instrumentation instrumentation;
+    std::atomic_int sum{ 0 };
+
+    // Zones and counters are not recorded from any thread, while the instrumentation is not capturing.
+    Array<std::jthread> threads;
+
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&instrumentation, &sum]() {
+            for (int i = 0; i < ITERATIONS; ++i)
+            {
+                InstrumentationZone zone(instrumentation, "Idle");
+                instrumentation.counter("Idle", i);
+                sum.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+    threads.clear();
+
+    if (sum != 4 * ITERATIONS || instrumentation.capturing())
+        return -1;
+
+    if (!instrumentation.events().empty() || instrumentation.dropped() != 0)
+        return -2;
+
+    // Zones that begin before capturing starts are not recorded, even if they end while capturing.
+    {
+        InstrumentationZone zone(instrumentation, "Before");
+        instrumentation.start();
+    }
+
+    // Zones that begin while capturing are recorded, even if they end after capturing stopped.
+    {
+        InstrumentationZone zone(instrumentation, "During");
+        instrumentation.stop();
+    }
+
+    // Nothing is recorded after capturing stopped.
+    {
+        InstrumentationZone zone(instrumentation, "After");
+        instrumentation.counter("After", 1);
+    }
+
+    auto events = instrumentation.events();
+
+    if (events.size() != 1 || StringView(events.front().Name) != "During")
+        return -3;
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <litefx/core.h>
+#include <sstream>
+
+using namespace LiteFX;
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    Instrumentation instrumentation;
+    instrumentation.start();
+
+    // Record nested zones and counters from multiple threads.
+    Array<std::jthread> threads;
+
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&instrumentation]() {
+            for (int i = 0; i < 100; ++i)
+            {
+                InstrumentationZone outer(instrumentation, "Outer");
+                InstrumentationZone inner(instrumentation, "Inner");
+                instrumentation.counter("Iteration", i);
+            }
+        });
+
+    threads.clear();
+
+    auto events = instrumentation.events();
+
+    if (events.size() != 4 * 100 * 3 || instrumentation.dropped() != 0)
+        return -1;
+
+    if (!std::ranges::is_sorted(events, {}, &Instrumentation::Event::Timestamp))
+        return -2;
+
+    if (std::ranges::count_if(events, [](const auto& event) { return event.Type == Instrumentation::EventType::Counter; }) != 400)
+        return -3;
+
+    // Export the trace and merge an additional event.
+    std::stringstream trace;
+    std::array<Instrumentation::trace_writer_type, 1> writers { [](std::ostream& stream) { stream << ",{\"name\":\"GPU\",\"ph\":\"M\",\"pid\":1}"; } };
+    instrumentation.exportChromeTrace(trace, writers);
+
+    if (!trace.str().starts_with("{\"traceEvents\":[") || trace.str().find("\"name\":\"Inner\"") == String::npos || trace.str().find("\"name\":\"GPU\"") == String::npos)
+        return -4;
+
+    // Stop and clear the instrumentation.
+    instrumentation.stop();
+    instrumentation.clear();
+
+    {
+        InstrumentationZone zone(instrumentation, "Ignored");
+    }
+
+    if (!instrumentation.events().empty())
+        return -5;
+
+    // Names are escaped when they are written into a trace.
+    std::stringstream name;
+    Instrumentation::writeJsonString(name, "Zone \"1\"\\\n\x01");
+
+    return name.str() == "\"Zone \\\"1\\\"\\\\\\n\\u0001\"" ? 0 : -6;
+}
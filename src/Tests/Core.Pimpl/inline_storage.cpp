@@ -0,0 +1,131 @@
+#include <litefx/core.h>
+
+using namespace LiteFX;
+
+static int instances = 0;
+
+class Foo {
+    LITEFX_INLINE_IMPLEMENTATION(FooImpl, 64);
+
+public:
+    Foo(int index, const String& name);
+    Foo(const Foo&);
+    Foo(Foo&&) noexcept;
+    Foo& operator=(const Foo&);
+    Foo& operator=(Foo&&) noexcept;
+    ~Foo() noexcept;
+
+public:
+    int index() const noexcept;
+    const String& name() const noexcept;
+};
+
+class Foo::FooImpl {
+public:
+    friend class Foo;
+
+private:
+    int m_index;
+    String m_name;
+
+public:
+    FooImpl(int index, String name) :
+        m_index(index), m_name(std::move(name))
+    {
+        instances++;
+    }
+
+    FooImpl(const FooImpl& other) :
+        m_index(other.m_index), m_name(other.m_name)
+    {
+        instances++;
+    }
+
+    FooImpl(FooImpl&& other) noexcept :
+        m_index(other.m_index), m_name(std::move(other.m_name))
+    {
+        instances++;
+    }
+
+    FooImpl& operator=(const FooImpl&) = delete;
+    FooImpl& operator=(FooImpl&&) noexcept = delete;
+
+    ~FooImpl() noexcept 
+    {
+        instances--;
+    }
+};
+
+Foo::Foo(int index, const String& name) : m_impl(index, name) { }
+Foo::Foo(const Foo&) = default;
+Foo::Foo(Foo&&) noexcept = default;
+Foo& Foo::operator=(const Foo&) = default;
+Foo& Foo::operator=(Foo&&) noexcept = default;
+Foo::~Foo() noexcept = default;
+
+int Foo::index() const noexcept 
+{
+    return m_impl->m_index;
+}
+
+const String& Foo::name() const noexcept
+{
+    return m_impl->m_name;
+}
+
+// The forwarding constructor must only accept arguments that construct the implementation and must not hide the copy constructor for non-const sources.
+struct Bar {
+    int Index;
+    String Name;
+
+    Bar(int index, String name) : Index(index), Name(std::move(name)) { }
+};
+
+using BarPtr = InlinePimplPtr<Bar, sizeof(Bar), alignof(Bar)>;
+
+static_assert(std::is_constructible_v<BarPtr, int, const char*>, "The pointer must be constructible from the implementation constructor arguments.");
+static_assert(!std::is_constructible_v<BarPtr, String>, "The pointer must not be constructible from arguments that do not construct the implementation.");
+static_assert(!std::is_convertible_v<int, BarPtr>, "The pointer must not be convertible from arguments that do not construct the implementation.");
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    static_assert(sizeof(Foo) == 64, "The implementation must be stored inline.");
+
+    {
+        BarPtr a(3, "Bar");
+        BarPtr b(a);
+
+        if (b->Index != 3 || b->Name != "Bar" || a->Name != "Bar")
+            return -7;
+    }
+
+    {
+        Foo a(1, "A long name that does not fit into the small string buffer.");
+        Foo b(a);
+
+        if (b.index() != 1 || b.name() != a.name())
+            return -1;
+
+        Foo c(std::move(a));
+
+        if (c.index() != 1 || c.name() != b.name())
+            return -2;
+
+        a = Foo(2, "Foo");
+        b = a;
+
+        if (b.index() != 2 || b.name() != "Foo")
+            return -3;
+
+        c = std::move(b);
+
+        if (c.index() != 2 || c.name() != "Foo")
+            return -4;
+
+        if (instances != 3)
+            return -5;
+    }
+
+    // All implementation instances must be destroyed.
+    return instances == 0 ? 0 : -6;
+}
@@ -0,0 +1,36 @@
+#include <litefx/core.h>
+
+using namespace LiteFX;
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    TaskScheduler scheduler(4);
+    std::atomic_int sum{ 0 };
+    std::atomic_bool first{ false }, nested{ false };
+
+    // Schedule a set of independent tasks.
+    auto range = scheduler.parallelFor(1000, [&sum](std::size_t i) { sum += static_cast<int>(i); });
+    auto single = scheduler.schedule([&first]() { first = true; });
+
+    // Schedule a task that depends on both counters and waits for nested work itself.
+    std::array dependencies { range, single };
+    
+    auto dependent = scheduler.schedule([&]() {
+        if (sum != 499500 || !first)
+            return;
+
+        auto children = scheduler.parallelFor(100, [&sum](std::size_t) { sum++; });
+        scheduler.wait(*children);
+        nested = true;
+    }, dependencies);
+
+    scheduler.wait(*dependent);
+
+    if (!range->done() || !single->done() || !dependent->done())
+        return -1;
+
+    if (!nested)
+        return -2;
+
+    return sum == 499600 ? 0 : -3;
+}
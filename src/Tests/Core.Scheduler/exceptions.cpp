@@ -0,0 +1,20 @@
+#include <litefx/core.h>
+
+using namespace LiteFX;
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    TaskScheduler scheduler;
+    auto counter = scheduler.schedule([]() { throw RuntimeException("Task failed."); });
+
+    try
+    {
+        scheduler.wait(*counter);
+    }
+    catch (const RuntimeException&)
+    {
+        return counter->done() ? 0 : -1;
+    }
+
+    return -2;
+}
@@ -0,0 +1,71 @@
+#include <litefx/gfx/meshlet.hpp>
+
+using namespace LiteFX::Graphics;
+
+// Creates a flat grid of quads in the xy-plane, facing into positive z-direction.
+static void createGrid(UInt32 size, Array<Vertex>& vertices, Array<UInt32>& indices)
+{
+    for (UInt32 y{ 0u }; y <= size; ++y)
+        for (UInt32 x{ 0u }; x <= size; ++x)
+            vertices.push_back({ { static_cast<Float>(x), static_cast<Float>(y), 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f } });
+
+    for (UInt32 y{ 0u }; y < size; ++y)
+    {
+        for (UInt32 x{ 0u }; x < size; ++x)
+        {
+            auto i = y * (size + 1) + x;
+            indices.insert(indices.end(), { i, i + 1, i + size + 2, i, i + size + 2, i + size + 1 });
+        }
+    }
+}
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    Array<Vertex> vertices;
+    Array<UInt32> indices;
+    createGrid(32, vertices, indices);
+
+    MeshletBuilder builder(64, 124);
+    auto mesh = builder.build(vertices, indices);
+
+    if (mesh.Meshlets.empty() || mesh.Meshlets.size() != mesh.Bounds.size())
+        return -1;
+
+    // Each triangle must be emitted exactly once, without exceeding the limits of a meshlet.
+    if (mesh.Primitives.size() != indices.size() / 3)
+        return -2;
+
+    for (const auto& [meshlet, bounds] : std::views::zip(mesh.Meshlets, mesh.Bounds))
+    {
+        if (meshlet.VertexCount > 64u || meshlet.PrimitiveCount > 124u || meshlet.PrimitiveCount == 0u)
+            return -3;
+
+        // All vertices must be inside the bounding sphere and the normal cone of a flat meshlet must be tight.
+        for (auto index : Span<const UInt32>(mesh.VertexIndices).subspan(meshlet.VertexOffset, meshlet.VertexCount))
+        {
+            const auto& p = vertices[index].Position;
+            auto dx = p.x() - bounds.Center.x(), dy = p.y() - bounds.Center.y(), dz = p.z() - bounds.Center.z();
+
+            if (std::sqrt(dx * dx + dy * dy + dz * dz) > bounds.Radius + 1e-4f)
+                return -4;
+        }
+
+        if (bounds.ConeAxis.z() < 0.999f || bounds.ConeCutoff > 1e-3f)
+            return -5;
+
+        for (auto primitive : Span<const UInt32>(mesh.Primitives).subspan(meshlet.PrimitiveOffset, meshlet.PrimitiveCount))
+            if ((primitive & 0xFF) >= meshlet.VertexCount || ((primitive >> 8) & 0xFF) >= meshlet.VertexCount || ((primitive >> 16) & 0xFF) >= meshlet.VertexCount)
+                return -6;
+    }
+
+    // Building multiple meshes in parallel must produce the same meshlets.
+    TaskScheduler scheduler(4);
+    std::array<MeshletBuilder::Mesh, 3> meshes;
+    meshes.fill({ vertices, indices });
+    auto results = builder.build(meshes, scheduler);
+
+    if (std::ranges::any_of(results, [&](const MeshletMesh& result) { return result.Primitives != mesh.Primitives || result.VertexIndices != mesh.VertexIndices; }))
+        return -7;
+
+    return mesh.dispatchBatch(4).X == (mesh.Meshlets.size() + 3) / 4 ? 0 : -8;
+}
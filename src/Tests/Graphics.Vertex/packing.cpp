@@ -0,0 +1,57 @@
+#include <litefx/gfx/vertex.hpp>
+#include <cstring>
+
+using namespace LiteFX::Graphics;
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    const Array<Vertex> vertices {
+        { { -0.5f, -0.5f, 0.0f }, { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f } },
+        { {  0.5f, -0.5f, 0.0f }, { 0.0f, 1.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 0.0f } },
+        { {  0.5f,  0.5f, 0.0f }, { 0.0f, 0.0f, 1.0f, 1.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f } },
+        { { -0.5f,  0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f } }
+    };
+
+    const Array<UInt32> indices { 0, 1, 2, 0, 2, 3 };
+
+    // A fully compressed vertex contains 8 bytes of position and 4 bytes of color, normal and texture coordinate each.
+    auto mesh = VertexPacker().pack(vertices, indices);
+
+    if (mesh.VertexSize != 20u || mesh.Vertices.size() != 80u || mesh.Attributes.size() != 4u)
+        return -1;
+
+    if (mesh.Attributes[0].format() != BufferFormat::XYZW16F || mesh.Attributes[2].format() != BufferFormat::XY16SN || mesh.Attributes[3].format() != BufferFormat::XY16UN || mesh.Attributes[3].offset() != 16u)
+        return -2;
+
+    if (mesh.IndexFormat != IndexType::UInt16 || mesh.IndexCount != 6u || mesh.Indices.size() != 12u)
+        return -3;
+
+    // Check the encoded position (-0.5 as half float) and the octahedral normal of the vertex pointing away (folded into a corner).
+    std::array<UInt16, 4> position{};
+    std::array<Int16, 2> normal{};
+    std::memcpy(position.data(), mesh.Vertices.data(), sizeof(position));
+    std::memcpy(normal.data(), mesh.Vertices.data() + mesh.VertexSize + mesh.Attributes[2].offset(), sizeof(normal));
+
+    if (position[0] != 0xB800 || position[3] != 0x3C00 || std::abs(normal[0]) != 32767 || std::abs(normal[1]) != 32767)
+        return -4;
+
+    // Texture coordinates outside of the unit range fall back to half floats and uncompressed indices remain 32 bit.
+    auto tiled = vertices;
+    tiled[2].TextureCoordinate0 = { 2.0f, 2.0f };
+    mesh = VertexPacker(VertexCompression::TextureCoordinate).pack(tiled, indices);
+
+    if (mesh.Attributes[3].format() != BufferFormat::XY16F || mesh.IndexFormat != IndexType::UInt32 || mesh.VertexSize != 44u)
+        return -5;
+
+    // Out-of-range indices must be rejected.
+    try
+    {
+        const Array<UInt32> invalid { 0, 1, 4 };
+        std::ignore = VertexPacker().pack(vertices, invalid);
+        return -6;
+    }
+    catch (const ArgumentOutOfRangeException&)
+    {
+        return 0;
+    }
+}
@@ -0,0 +1,264 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX::Rendering;
+
+using DrawPacket = DrawList::DrawPacket;
+
+// Sorting never dereferences the pipelines, so distinct fake addresses are sufficient to identify them.
+static const IRenderPipeline* fakePipeline(std::uintptr_t id)
+{
+    return reinterpret_cast<const IRenderPipeline*>((id + 1) * 0x100); // NOLINT(performance-no-int-to-ptr)
+}
+
+// Recording does not dereference descriptor sets, buffers and push constant layouts either, so fake addresses identify them as well. Pipelines, however, are bound
+// through their virtual base interface, so recording requires actual pipeline objects.
+template <typename T>
+static const T* fakeState(std::uintptr_t id)
+{
+    return reinterpret_cast<const T*>((id + 1) * 0x100); // NOLINT(performance-no-int-to-ptr)
+}
+
+class TestPipeline final : public virtual IRenderPipeline, public StateResource {
+public:
+    explicit TestPipeline(StringView name) : StateResource(name) { }
+
+public:
+    bool isReady() const noexcept override { return true; }
+    void wait() const override { }
+    bool alphaToCoverage() const noexcept override { return false; }
+    MultiSamplingLevel samples() const noexcept override { return MultiSamplingLevel::x1; }
+    void updateSamples(MultiSamplingLevel /*samples*/) override { }
+
+private:
+    SharedPtr<const IShaderProgram> getProgram() const noexcept override { return nullptr; }
+    SharedPtr<const IPipelineLayout> getLayout() const noexcept override { return nullptr; }
+    SharedPtr<IInputAssembler> getInputAssembler() const noexcept override { return nullptr; }
+    SharedPtr<IRasterizer> getRasterizer() const noexcept override { return nullptr; }
+};
+
+// Counts the state changes and draws recorded by a draw list. All other commands are ignored.
+class TestCommandBuffer final : public ICommandBuffer {
+public:
+    mutable DrawList::Statistics Commands{};
+
+public:
+    void begin() const override { }
+    void end() const override { }
+    bool isSecondary() const noexcept override { return false; }
+    void track(SharedPtr<const IBuffer> /*buffer*/) const override { }
+    void track(SharedPtr<const IImage> /*image*/) const override { }
+    void track(SharedPtr<const ISampler> /*sampler*/) const override { }
+    void track(UniquePtr<const IDescriptorSet>&& /*descriptorSet*/) const override { }
+    void dispatch(const Vector3u& /*threadGroupCount*/) const noexcept override { }
+    void dispatchMesh(const Vector3u& /*threadGroupCount*/) const noexcept override { }
+    void draw(UInt32 /*vertices*/, UInt32 /*instances*/, UInt32 /*firstVertex*/, UInt32 /*firstInstance*/) const noexcept override { Commands.Draws++; }
+    void drawIndexed(UInt32 /*indices*/, UInt32 /*instances*/, UInt32 /*firstIndex*/, Int32 /*vertexOffset*/, UInt32 /*firstInstance*/) const noexcept override { Commands.Draws++; }
+    void setViewports(Span<const IViewport*> /*viewports*/) const override { }
+    void setViewports(const IViewport* /*viewport*/) const override { }
+    void setScissors(Span<const IScissor*> /*scissors*/) const override { }
+    void setScissors(const IScissor* /*scissor*/) const override { }
+    void setBlendFactors(const Vector4f& /*blendFactors*/) const noexcept override { }
+    void setStencilRef(UInt32 /*stencilRef*/) const noexcept override { }
+    void setDepthBounds(Float /*minBounds*/, Float /*maxBounds*/) const noexcept override { }
+    UInt64 submit() const override { return 0; }
+    void writeTimingEvent(const SharedPtr<const TimingEvent>& /*timingEvent*/) const override { }
+    void releaseSharedState() const override { }
+
+private:
+    SharedPtr<const ICommandQueue> getQueue() const noexcept override { return nullptr; }
+    UniquePtr<IBarrier> getBarrier(PipelineStage /*syncBefore*/, PipelineStage /*syncAfter*/) const override { return nullptr; }
+    void cmdBarrier(const IBarrier& /*barrier*/) const noexcept override { }
+    void cmdTransfer(const IBuffer& /*source*/, const IBuffer& /*target*/, UInt32 /*sourceElement*/, UInt32 /*targetElement*/, UInt32 /*elements*/) const override { }
+    void cmdTransfer(const IBuffer& /*source*/, const IImage& /*target*/, UInt32 /*sourceElement*/, UInt32 /*firstSubresource*/, UInt32 /*elements*/) const override { }
+    void cmdTransfer(const IImage& /*source*/, const IImage& /*target*/, UInt32 /*sourceSubresource*/, UInt32 /*targetSubresource*/, UInt32 /*subresources*/) const override { }
+    void cmdTransfer(const IImage& /*source*/, const IBuffer& /*target*/, UInt32 /*firstSubresource*/, UInt32 /*targetElement*/, UInt32 /*subresources*/) const override { }
+    void cmdTransfer(const SharedPtr<const IBuffer>& /*source*/, const IBuffer& /*target*/, UInt32 /*sourceElement*/, UInt32 /*targetElement*/, UInt32 /*elements*/) const override { }
+    void cmdTransfer(const SharedPtr<const IBuffer>& /*source*/, const IImage& /*target*/, UInt32 /*sourceElement*/, UInt32 /*firstSubresource*/, UInt32 /*elements*/) const override { }
+    void cmdTransfer(const SharedPtr<const IImage>& /*source*/, const IImage& /*target*/, UInt32 /*sourceSubresource*/, UInt32 /*targetSubresource*/, UInt32 /*subresources*/) const override { }
+    void cmdTransfer(const SharedPtr<const IImage>& /*source*/, const IBuffer& /*target*/, UInt32 /*firstSubresource*/, UInt32 /*targetElement*/, UInt32 /*subresources*/) const override { }
+    void cmdTransfer(const void* const /*data*/, size_t /*size*/, const IBuffer& /*target*/, UInt32 /*targetElement*/, UInt32 /*elements*/) const override { }
+    void cmdTransfer(Span<const void* const> /*data*/, size_t /*elementSize*/, const IBuffer& /*target*/, UInt32 /*targetElement*/) const override { }
+    void cmdTransfer(const void* const /*data*/, size_t /*size*/, const IImage& /*target*/, UInt32 /*subresource*/) const override { }
+    void cmdTransfer(Span<const void* const> /*data*/, size_t /*elementSize*/, const IImage& /*target*/, UInt32 /*firstSubresource*/, UInt32 /*elements*/) const override { }
+    void cmdUse(const IPipeline& /*pipeline*/) const noexcept override { Commands.PipelineChanges++; }
+    void cmdBind(const IDescriptorSet& /*descriptorSet*/) const override { }
+    void cmdBind(Span<const IDescriptorSet*> /*descriptorSets*/) const override { }
+    void cmdBind(const IDescriptorSet& /*descriptorSet*/, const IPipeline& /*pipeline*/) const override { Commands.DescriptorSetChanges++; }
+    void cmdBind(Span<const IDescriptorSet*> /*descriptorSets*/, const IPipeline& /*pipeline*/) const override { }
+    void cmdBind(const IVertexBuffer& /*buffer*/) const override { Commands.VertexBufferChanges++; }
+    void cmdBind(const IIndexBuffer& /*buffer*/) const override { Commands.IndexBufferChanges++; }
+    void cmdPushConstants(const IPushConstantsLayout& /*layout*/, const void* const /*memory*/) const override { Commands.PushConstantChanges++; }
+    void cmdDispatchIndirect(const IBuffer& /*batchBuffer*/, UInt32 /*batchCount*/, UInt64 /*offset*/) const noexcept override { }
+    void cmdDispatchMeshIndirect(const IBuffer& /*batchBuffer*/, UInt32 /*batchCount*/, UInt64 /*offset*/) const noexcept override { }
+    void cmdDispatchMeshIndirect(const IBuffer& /*batchBuffer*/, const IBuffer& /*countBuffer*/, UInt64 /*offset*/, UInt64 /*countOffset*/, UInt32 /*maxBatches*/) const noexcept override { }
+    void cmdDraw(const IVertexBuffer& /*vertexBuffer*/, UInt32 /*instances*/, UInt32 /*firstVertex*/, UInt32 /*firstInstance*/) const override { }
+    void cmdDrawIndirect(const IBuffer& /*batchBuffer*/, UInt32 /*batchCount*/, UInt64 /*offset*/) const noexcept override { }
+    void cmdDrawIndirect(const IBuffer& /*batchBuffer*/, const IBuffer& /*countBuffer*/, UInt64 /*offset*/, UInt64 /*countOffset*/, UInt32 /*maxBatches*/) const noexcept override { }
+    void cmdDrawIndexed(const IIndexBuffer& /*indexBuffer*/, UInt32 /*instances*/, UInt32 /*firstIndex*/, Int32 /*vertexOffset*/, UInt32 /*firstInstance*/) const override { }
+    void cmdDrawIndexed(const IVertexBuffer& /*vertexBuffer*/, const IIndexBuffer& /*indexBuffer*/, UInt32 /*instances*/, UInt32 /*firstIndex*/, Int32 /*vertexOffset*/, UInt32 /*firstInstance*/) const override { }
+    void cmdDrawIndexedIndirect(const IBuffer& /*batchBuffer*/, UInt32 /*batchCount*/, UInt64 /*offset*/) const noexcept override { }
+    void cmdDrawIndexedIndirect(const IBuffer& /*batchBuffer*/, const IBuffer& /*countBuffer*/, UInt64 /*offset*/, UInt64 /*countOffset*/, UInt32 /*maxBatches*/) const noexcept override { }
+    void cmdExecute(const SharedPtr<const ICommandBuffer>& /*commandBuffer*/) const override { }
+    void cmdExecute(Enumerable<SharedPtr<const ICommandBuffer>> /*commandBuffer*/) const override { }
+    void cmdBuildAccelerationStructure(IBottomLevelAccelerationStructure& /*blas*/, const SharedPtr<const IBuffer>& /*scratchBuffer*/, const IBuffer& /*buffer*/, UInt64 /*offset*/) const override { }
+    void cmdBuildAccelerationStructure(ITopLevelAccelerationStructure& /*tlas*/, const SharedPtr<const IBuffer>& /*scratchBuffer*/, const IBuffer& /*buffer*/, UInt64 /*offset*/) const override { }
+    void cmdUpdateAccelerationStructure(IBottomLevelAccelerationStructure& /*blas*/, const SharedPtr<const IBuffer>& /*scratchBuffer*/, const IBuffer& /*buffer*/, UInt64 /*offset*/) const override { }
+    void cmdUpdateAccelerationStructure(ITopLevelAccelerationStructure& /*tlas*/, const SharedPtr<const IBuffer>& /*scratchBuffer*/, const IBuffer& /*buffer*/, UInt64 /*offset*/) const override { }
+    void cmdCopyAccelerationStructure(const IBottomLevelAccelerationStructure& /*from*/, const IBottomLevelAccelerationStructure& /*to*/, bool /*compress*/) const noexcept override { }
+    void cmdCopyAccelerationStructure(const ITopLevelAccelerationStructure& /*from*/, const ITopLevelAccelerationStructure& /*to*/, bool /*compress*/) const noexcept override { }
+    void cmdTraceRays(UInt32 /*width*/, UInt32 /*height*/, UInt32 /*depth*/, const ShaderBindingTableOffsets& /*offsets*/, const IBuffer& /*rayGenerationShaderBindingTable*/, const IBuffer* /*missShaderBindingTable*/, const IBuffer* /*hitShaderBindingTable*/, const IBuffer* /*callableShaderBindingTable*/) const noexcept override { }
+};
+
+static bool matches(const DrawPacket& draw, const IRenderPipeline* pipeline, UInt32 elements, UInt32 firstInstance, UInt32 instances)
+{
+    return draw.Pipeline == pipeline && draw.Elements == elements && draw.FirstInstance == firstInstance && draw.Instances == instances;
+}
+
+int main(int /*argc*/, char* /*argv*/[])
+{
+    const auto* first = fakePipeline(0);
+    const auto* second = fakePipeline(1);
+
+    DrawList drawList;
+
+    // Packets without a pipeline or with push constants memory, but no layout, are rejected.
+    try
+    {
+        drawList.submit({ .Elements = 3 });
+        return -1;
+    }
+    catch (const ArgumentNotInitializedException&) { }
+
+    try
+    {
+        int pushConstants{ 0 };
+        drawList.submit({ .Pipeline = first, .PushConstants = &pushConstants, .Elements = 3 });
+        return -1;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    // Pipelines are sorted in the order they are first seen. Packets with the same state keep their submission order and adjacent instance ranges are merged.
+    drawList.submit({ .Pipeline = first, .Elements = 3, .FirstInstance = 10 });
+    drawList.submit({ .Pipeline = second, .Elements = 3, .Instances = 2, .FirstInstance = 0 });
+    drawList.submit({ .Pipeline = first, .Elements = 3, .FirstInstance = 0 });
+    drawList.submit({ .Pipeline = second, .Elements = 3, .Instances = 3, .FirstInstance = 2 });
+    drawList.submit({ .Pipeline = first, .Elements = 3, .FirstInstance = 20 });
+    drawList.submit({ .Pipeline = second, .Elements = 0, .FirstInstance = 5 });
+    drawList.submit({ .Pipeline = second, .Elements = 6, .FirstInstance = 5 });
+
+    if (drawList.size() != 6 || !drawList.draws().empty())
+        return -2;
+
+    drawList.sort();
+    auto draws = drawList.draws();
+
+    if (draws.size() != 5)
+        return -3;
+
+    if (!matches(draws[0], first, 3, 10, 1) || !matches(draws[1], first, 3, 0, 1) || !matches(draws[2], first, 3, 20, 1) ||
+        !matches(draws[3], second, 3, 0, 5) || !matches(draws[4], second, 6, 5, 1))
+        return -4;
+
+    // Sorting does not record anything, so there are no state changes yet.
+    auto statistics = drawList.statistics();
+
+    if (statistics.Packets != 6 || statistics.Draws != 5 || statistics.stateChanges() != 0 || statistics.SortTime < 0.0)
+        return -5;
+
+    // Submitting another packet invalidates the sort order.
+    drawList.submit({ .Pipeline = first, .Elements = 3 });
+
+    if (!drawList.draws().empty())
+        return -6;
+
+    drawList.clear();
+
+    if (drawList.size() != 0 || drawList.statistics().Packets != 0)
+        return -7;
+
+    // Large draw lists are sorted in parallel chunks and must produce the same result as sorting them on the calling thread.
+    constexpr UInt32 PACKETS = 10000;
+    constexpr UInt32 PIPELINES = 13;
+
+    TaskScheduler scheduler(3);
+    DrawList serial(PACKETS), parallel(PACKETS);
+
+    for (UInt32 i{ 0u }; i < PACKETS; ++i)
+    {
+        DrawPacket packet{ .Pipeline = fakePipeline((i * 7919u) % PIPELINES), .Elements = 3, .FirstInstance = i * 2 };
+        serial.submit(packet);
+        parallel.submit(packet);
+    }
+
+    serial.sort();
+    parallel.sort(scheduler);
+
+    auto serialDraws = serial.draws();
+    auto parallelDraws = parallel.draws();
+
+    if (parallelDraws.size() != PACKETS || parallel.statistics().Draws != PACKETS || parallel.statistics().Packets != PACKETS)
+        return -8;
+
+    if (!std::ranges::equal(serialDraws, parallelDraws, [](const DrawPacket& a, const DrawPacket& b) { return matches(a, b.Pipeline, b.Elements, b.FirstInstance, b.Instances); }))
+        return -9;
+
+    // Each pipeline must be bound exactly once and the draws of each pipeline must keep their submission order.
+    UInt32 runs{ 0u };
+
+    for (size_t i{ 0 }; i < parallelDraws.size(); ++i)
+    {
+        if (i == 0 || parallelDraws[i].Pipeline != parallelDraws[i - 1].Pipeline)
+            ++runs;
+        else if (parallelDraws[i].FirstInstance <= parallelDraws[i - 1].FirstInstance)
+            return -10;
+    }
+
+    if (runs != PIPELINES)
+        return -11;
+
+    // Recording only sets states that differ from the previous draw. Binding another pipeline resets the descriptor sets and push constants, but not the buffers.
+    TestPipeline opaque("Opaque"), transparent("Transparent");
+    const auto* sets = fakeState<IDescriptorSet>(0);
+    const auto* otherSets = fakeState<IDescriptorSet>(1);
+    const auto* vertices = fakeState<IVertexBuffer>(0);
+    const auto* otherVertices = fakeState<IVertexBuffer>(1);
+    const auto* indices = fakeState<IIndexBuffer>(0);
+    const auto* pushConstantsLayout = fakeState<IPushConstantsLayout>(0);
+    int pushConstants{ 0 };
+
+    DrawList recorded;
+    recorded.submit({ .Pipeline = &opaque, .DescriptorSets = { sets }, .VertexBuffer = vertices, .IndexBuffer = indices, .Elements = 3 });
+    recorded.submit({ .Pipeline = &transparent, .DescriptorSets = { sets }, .VertexBuffer = vertices, .IndexBuffer = indices, .PushConstantsLayout = pushConstantsLayout, .PushConstants = &pushConstants, .Elements = 3 });
+    recorded.submit({ .Pipeline = &opaque, .DescriptorSets = { otherSets }, .VertexBuffer = vertices, .IndexBuffer = indices, .Elements = 3 });
+    recorded.submit({ .Pipeline = &opaque, .DescriptorSets = { sets }, .VertexBuffer = otherVertices, .IndexBuffer = indices, .Elements = 3 });
+
+    TestCommandBuffer commandBuffer;
+
+    try
+    {
+        recorded.record(commandBuffer);
+        return -12;
+    }
+    catch (const RuntimeException&) { }
+
+    recorded.sort();
+    recorded.record(commandBuffer);
+    statistics = recorded.statistics();
+
+    if (statistics.Packets != 4 || statistics.Draws != 4 || commandBuffer.Commands.Draws != 4 || statistics.RecordTime < 0.0)
+        return -13;
+
+    if (statistics.PipelineChanges != 2 || statistics.DescriptorSetChanges != 3 || statistics.VertexBufferChanges != 3 || statistics.IndexBufferChanges != 1 || 
+        statistics.PushConstantChanges != 1 || statistics.stateChanges() != 10)
+        return -14;
+
+    // The statistics must match the commands, that have actually been recorded.
+    const auto& commands = commandBuffer.Commands;
+
+    if (commands.PipelineChanges != statistics.PipelineChanges || commands.DescriptorSetChanges != statistics.DescriptorSetChanges || 
+        commands.VertexBufferChanges != statistics.VertexBufferChanges || commands.IndexBufferChanges != statistics.IndexBufferChanges || 
+        commands.PushConstantChanges != statistics.PushConstantChanges)
+        return -15;
+
+    return 0;
+}
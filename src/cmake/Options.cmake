@@ -12,17 +12,19 @@ OPTION(LITEFX_BUILD_DIRECTX_12_BACKEND "Builds the DirectX 12 backend." ON)
 
 OPTION(LITEFX_BUILD_DEFINE_BUILDERS "Defines builder types to allow to use builder syntax in applications." ON)
 OPTION(LITEFX_BUILD_SUPPORT_DEBUG_MARKERS "Implements support for setting debug markers on device queues." OFF)
+OPTION(LITEFX_BUILD_INSTRUMENTATION "Compiles CPU instrumentation zones into the engine hot paths. Zones only record events while the app instrumentation is capturing." ON)
 
 OPTION(LITEFX_BUILD_EXAMPLES "When set to OFF, no samples will be built, regardless of their individual option." ON)
 OPTION(LITEFX_BUILD_EXAMPLES_DX12_PIX_LOADER "Add code to samples to load PIX GPU capture library when starting with --dx-load-pix=1 command line argument." ON)
 
 OPTION(LITEFX_BUILD_TESTS "When set to ON, tests will be built for the project." OFF)
+OPTION(LITEFX_BUILD_BENCHMARKS "When set to ON, the benchmark executable will be built for the project." OFF)
 
-# Forcefully disable interop swap chain for test builds.
+# The interop swap chain is disabled by default for test builds, as most tests do not require a DirectX 12 device. It can still be enabled to test the interop code paths.
 IF(LITEFX_BUILD_TESTS)
-  SET(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN OFF CACHE BOOL "" FORCE)
+  OPTION(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN "When set to ON, the Vulkan backend will use a DXIL interop swap chain, if the DirectX backend is also built." OFF)
 ELSE(LITEFX_BUILD_TESTS)
-  OPTION(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN "When set to ON, the Vulkan backend will use a DXIL interop swap chain, if the DirectX backend is also built. This option is not available when building tests." ON)
+  OPTION(LITEFX_BUILD_VULKAN_INTEROP_SWAP_CHAIN "When set to ON, the Vulkan backend will use a DXIL interop swap chain, if the DirectX backend is also built." ON)
 ENDIF(LITEFX_BUILD_TESTS)
 
 # NOTE: In order for this to work, you should add the RenderDoc installation path to the PATH environment variable, so that the runtime can pick up the API dll.
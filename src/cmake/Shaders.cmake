@@ -66,6 +66,26 @@
 # This will define a dependency for the specified target for all shader module targets. Furthermore, it automatically creates an install command for the shader module 
 # binaries. The source file is build from the RUNTIME_OUTPUT_DIRECTORY, OUTPUT_NAME and SUFFIX properties of each shader module target. The install destination can be 
 # provided by the INSTALL_DESTINATION parameter. Note that it is always prepended with the CMAKE_INSTALL_PREFIX.
+#
+# Instead of loading each shader module binary from a separate file, multiple shader modules can be packed into a single shader archive. Shader archives are memory
+# mapped at runtime (see `LiteFX::Rendering::ShaderArchive`), so that shader modules can be created without any per-module file I/O. A shader archive target is 
+# defined using ADD_SHADER_ARCHIVE and shader modules are added to it by providing the ARCHIVE parameter to ADD_SHADER_MODULE:
+#
+# ADD_SHADER_ARCHIVE(${PROJECT_NAME}.Shaders OUTPUT_FILE "shaders.lfxs")
+#
+# ADD_SHADER_MODULE(${PROJECT_NAME}.VertexShader
+#   SOURCE "vs.hlsl"
+#   ...
+#   ARCHIVE ${PROJECT_NAME}.Shaders
+# )
+#
+# Each module is stored under its binary file name (i.e., OUTPUT_NAME and SUFFIX). The archive can be linked to a target using TARGET_LINK_SHADER_ARCHIVES, which also
+# creates an install command for the archive file:
+#
+# TARGET_LINK_SHADER_ARCHIVES(${PROJECT_NAME}
+#   ARCHIVES ${PROJECT_NAME}.Shaders
+#   INSTALL_DESTINATION "${INSTALL_BINARY_DIR}/shaders/"
+# )
 
 SET(SHADER_DEFAULT_SUBDIR "shaders" CACHE STRING "Default subdirectory for shader module binaries within the current binary directory (CMAKE_CURRENT_BINARY_DIR).")
 SET(DXIL_DEFAULT_SUFFIX ".dxi" CACHE STRING "Default file extension for DXIL shaders.")
@@ -300,7 +320,7 @@ ENDFUNCTION(TARGET_GLSL_SHADERS target_name shader_source compile_as compile_wit
 
 
 FUNCTION(ADD_SHADER_MODULE module_name)
-  CMAKE_PARSE_ARGUMENTS(SHADER "" "SOURCE;LANGUAGE;COMPILE_AS;SHADER_MODEL;TYPE;COMPILER;LIBRARY;COMPILE_OPTIONS" "INCLUDES" ${ARGN})
+  CMAKE_PARSE_ARGUMENTS(SHADER "" "SOURCE;LANGUAGE;COMPILE_AS;SHADER_MODEL;TYPE;COMPILER;LIBRARY;ARCHIVE;COMPILE_OPTIONS" "INCLUDES" ${ARGN})
 
   IF(NOT SHADER_COMPILE_OPTIONS)
     SET(SHADER_COMPILE_OPTIONS " ")  # This must be set to some valid value, since all variable arguments are reserved for shader includes. A whitespace does not hurt.
@@ -328,6 +348,19 @@ FUNCTION(ADD_SHADER_MODULE module_name)
       COMMAND pcksl pack "\"${SHADER_LIBRARY_DIR}/${SHADER_LIBRARY_SOURCE}\"" "\"${SHADER_PROGRAM_BINARY_DIR}/${SHADER_PROGRAM_NAME}${SHADER_PROGRAM_SUFFIX}\"" ${SHADER_LIBRARY_NAMESPACE} "${SHADER_PROGRAM_NAME}${SHADER_PROGRAM_SUFFIX}"
     )
   ENDIF(SHADER_LIBRARY)
+
+  # If an archive is specified, add the shader binary to the archive.
+  IF(SHADER_ARCHIVE)
+    ADD_DEPENDENCIES(${SHADER_ARCHIVE} pcksl ${module_name})
+    GET_TARGET_PROPERTY(SHADER_ARCHIVE_FILE ${SHADER_ARCHIVE} ARCHIVE_FILE)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_NAME ${module_name} OUTPUT_NAME)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_SUFFIX ${module_name} SUFFIX)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_BINARY_DIR ${module_name} RUNTIME_OUTPUT_DIRECTORY)
+
+    ADD_CUSTOM_COMMAND(TARGET ${SHADER_ARCHIVE} POST_BUILD
+      COMMAND pcksl archive-add "\"${SHADER_ARCHIVE_FILE}\"" "\"${SHADER_PROGRAM_BINARY_DIR}/${SHADER_PROGRAM_NAME}${SHADER_PROGRAM_SUFFIX}\"" "${SHADER_PROGRAM_NAME}${SHADER_PROGRAM_SUFFIX}"
+    )
+  ENDIF(SHADER_ARCHIVE)
 ENDFUNCTION(ADD_SHADER_MODULE module_name)
 
 FUNCTION(TARGET_LINK_SHADERS target_name)
@@ -367,6 +400,45 @@ FUNCTION(ADD_SHADER_LIBRARY library_name)
 ENDFUNCTION(ADD_SHADER_LIBRARY library_name)
 
 
+FUNCTION(ADD_SHADER_ARCHIVE archive_name)
+  CMAKE_PARSE_ARGUMENTS(SHADER_ARCHIVE "" "OUTPUT_FILE" "" ${ARGN})
+
+  IF(NOT DEFINED CMAKE_RUNTIME_OUTPUT_DIRECTORY)
+    SET(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/${SHADER_DEFAULT_SUBDIR})
+  ELSE()
+    SET(OUTPUT_DIR ${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/${SHADER_DEFAULT_SUBDIR})
+  ENDIF(NOT DEFINED CMAKE_RUNTIME_OUTPUT_DIRECTORY)
+
+  # Define a target for the shader archive.
+  ADD_CUSTOM_TARGET(${archive_name}
+    COMMENT "Packing shader archive ${archive_name} to '${OUTPUT_DIR}/${SHADER_ARCHIVE_OUTPUT_FILE}'..."
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${OUTPUT_DIR}"
+  )
+
+  ADD_CUSTOM_COMMAND(TARGET ${archive_name} POST_BUILD
+    COMMAND pcksl archive-init "${OUTPUT_DIR}/${SHADER_ARCHIVE_OUTPUT_FILE}"
+  )
+
+  SET_TARGET_PROPERTIES(${archive_name} PROPERTIES 
+    ARCHIVE_FILE "${OUTPUT_DIR}/${SHADER_ARCHIVE_OUTPUT_FILE}"
+  )
+ENDFUNCTION(ADD_SHADER_ARCHIVE archive_name)
+
+
+FUNCTION(TARGET_LINK_SHADER_ARCHIVES target_name)
+  CMAKE_PARSE_ARGUMENTS(SHADER "" "INSTALL_DESTINATION" "ARCHIVES" ${ARGN})
+  
+  ADD_DEPENDENCIES(${target_name} ${SHADER_ARCHIVES})
+
+  FOREACH(shader_archive ${SHADER_ARCHIVES})
+    GET_TARGET_PROPERTY(SHADER_ARCHIVE_FILE ${shader_archive} ARCHIVE_FILE)
+    
+    CMAKE_PATH(SET SHADER_INSTALL_DEST NORMALIZE ${CMAKE_INSTALL_PREFIX}/${SHADER_INSTALL_DESTINATION})
+    INSTALL(FILES "${SHADER_ARCHIVE_FILE}" DESTINATION ${SHADER_INSTALL_DEST})
+  ENDFOREACH(shader_archive ${SHADER_ARCHIVES})
+ENDFUNCTION(TARGET_LINK_SHADER_ARCHIVES target_name)
+
+
 FUNCTION(TARGET_LINK_SHADER_LIBRARIES target_name)
   CMAKE_PARSE_ARGUMENTS(SHADER "" "" "LIBRARIES" ${ARGN})
   
@@ -394,11 +466,111 @@ FILE(GENERATE OUTPUT "${CMAKE_BINARY_DIR}/Auxiliary/pcksl.cxx" CONTENT [==[
 #include <iterator>
 #include <vector>
 #include <cstdint>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
 
 // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
 // NOLINTBEGIN(performance-avoid-endl)
 
+// Shader archive layout. This must match the layout expected by `LiteFX::Rendering::ShaderArchive`.
+constexpr uint32_t ARCHIVE_MAGIC = 0x4153464C;
+constexpr uint32_t ARCHIVE_VERSION = 1;
+constexpr uint64_t ARCHIVE_ALIGNMENT = 16;
+constexpr size_t ARCHIVE_HEADER_SIZE = 16;
+constexpr size_t ARCHIVE_INDEX_ENTRY_SIZE = 24;
+
+using ArchiveEntry = std::pair<std::string, std::vector<char>>;
+
+template <typename T>
+void writeValue(std::vector<char>& buffer, size_t offset, T value) {
+    // Values are always stored in little-endian byte order.
+    for (size_t i = 0; i < sizeof(T); ++i)
+        buffer[offset + i] = static_cast<char>((static_cast<uint64_t>(value) >> (i * 8)) & 0xFF);
+}
+
+template <typename T>
+T readValue(const std::vector<char>& buffer, size_t offset) {
+    if (offset + sizeof(T) > buffer.size())
+        throw std::out_of_range("The shader archive is truncated.");
+
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer[offset + i])) << (i * 8);
+
+    return static_cast<T>(value);
+}
+
+std::vector<ArchiveEntry> readArchive(const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> buffer(std::istreambuf_iterator<char>(file), { });
+    std::vector<ArchiveEntry> entries;
+
+    // If the archive does not exist yet, start with an empty one.
+    if (buffer.size() < ARCHIVE_HEADER_SIZE || readValue<uint32_t>(buffer, 0) != ARCHIVE_MAGIC || readValue<uint32_t>(buffer, 4) != ARCHIVE_VERSION)
+        return entries;
+
+    auto count = readValue<uint32_t>(buffer, 8);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto index = ARCHIVE_HEADER_SIZE + i * ARCHIVE_INDEX_ENTRY_SIZE;
+        auto offset = readValue<uint64_t>(buffer, index);
+        auto size = readValue<uint64_t>(buffer, index + 8);
+        auto nameOffset = readValue<uint32_t>(buffer, index + 16);
+        auto nameLength = readValue<uint32_t>(buffer, index + 20);
+
+        if (offset + size > buffer.size() || static_cast<uint64_t>(nameOffset) + nameLength > buffer.size())
+            throw std::out_of_range("The shader archive is corrupted.");
+
+        entries.emplace_back(std::string(buffer.data() + nameOffset, nameLength), std::vector<char>(buffer.data() + offset, buffer.data() + offset + size));
+    }
+
+    return entries;
+}
+
+void writeArchive(const std::string& fileName, const std::vector<ArchiveEntry>& entries) {
+    auto align = [](uint64_t value) { return (value + ARCHIVE_ALIGNMENT - 1) & ~(ARCHIVE_ALIGNMENT - 1); };
+
+    // Compute the layout: header, index, names and finally the aligned shader binaries.
+    std::vector<uint64_t> nameOffsets, dataOffsets;
+    uint64_t size = ARCHIVE_HEADER_SIZE + entries.size() * ARCHIVE_INDEX_ENTRY_SIZE;
+
+    for (const auto& entry : entries)
+    {
+        nameOffsets.push_back(size);
+        size += entry.first.size();
+    }
+
+    for (const auto& entry : entries)
+    {
+        size = align(size);
+        dataOffsets.push_back(size);
+        size += entry.second.size();
+    }
+
+    std::vector<char> buffer(size, 0);
+    writeValue<uint32_t>(buffer, 0, ARCHIVE_MAGIC);
+    writeValue<uint32_t>(buffer, 4, ARCHIVE_VERSION);
+    writeValue<uint32_t>(buffer, 8, static_cast<uint32_t>(entries.size()));
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto index = ARCHIVE_HEADER_SIZE + i * ARCHIVE_INDEX_ENTRY_SIZE;
+        writeValue<uint64_t>(buffer, index, dataOffsets[i]);
+        writeValue<uint64_t>(buffer, index + 8, entries[i].second.size());
+        writeValue<uint32_t>(buffer, index + 16, static_cast<uint32_t>(nameOffsets[i]));
+        writeValue<uint32_t>(buffer, index + 20, static_cast<uint32_t>(entries[i].first.size()));
+        std::memcpy(buffer.data() + nameOffsets[i], entries[i].first.data(), entries[i].first.size());
+        std::memcpy(buffer.data() + dataOffsets[i], entries[i].second.data(), entries[i].second.size());
+    }
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
 int main(int argc, char* argv[]) {
     if (argc < 2)
         return -1;
@@ -477,6 +649,37 @@ int main(int argc, char* argv[]) {
 
             file.close();
         }
+        else if (command == "archive-init")
+        {
+            if (argc != 3)
+                return -1;
+
+            writeArchive(argv[2], { });
+        }
+        else if (command == "archive-add")
+        {
+            if (argc != 5)
+                return -1;
+
+            std::string archiveFile(argv[2]);
+            std::string resourceFile(argv[3]);
+            std::string name(argv[4]);
+
+            std::ifstream resource(resourceFile, std::ios::binary);
+
+            if (!resource.is_open())
+                return -1;
+
+            std::vector<char> buffer(std::istreambuf_iterator<char>(resource), { });
+            auto entries = readArchive(archiveFile);
+
+            if (auto match = std::find_if(entries.begin(), entries.end(), [&name](const auto& entry) { return entry.first == name; }); match != entries.end())
+                match->second = std::move(buffer);
+            else
+                entries.emplace_back(name, std::move(buffer));
+
+            writeArchive(archiveFile, entries);
+        }
         else
         {
             return -1;